@@ -14,6 +14,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "app/editor/dungeon/dungeon_project_labels.h"
+#include "app/editor/dungeon/dungeon_thumbnail_atlas.h"
 #include "app/editor/dungeon/ui_constants.h"
 #include "app/gfx/resource/arena.h"
 #include "app/gui/core/agent_theme.h"
@@ -1078,6 +1079,16 @@ std::optional<int> DungeonCanvasViewer::DrawConnectedRoomMatrix(
                               (scroll_y + map_viewport_size.y) / scaled_step)) +
                               1);
 
+  // Zoomed out, rooms that are not loaded yet come from the thumbnail atlas
+  // instead of being loaded and rendered on this frame.
+  const bool use_thumbnails =
+      thumbnail_atlas_ &&
+      kDungeonRoomPixelSize * canvas_rt.scale <=
+          DungeonThumbnailAtlas::kSlotSize * 2.0f;
+  auto shows_thumbnail = [&](int room_id) {
+    return use_thumbnails && rooms_->GetIfLoaded(room_id) == nullptr;
+  };
+
   std::vector<int> visible_rooms;
   visible_rooms.reserve(static_cast<size_t>(connected_room_count));
   for (int room_id = 0; room_id < zelda3::kNumberOfRooms; ++room_id) {
@@ -1099,7 +1110,12 @@ std::optional<int> DungeonCanvasViewer::DrawConnectedRoomMatrix(
     }
 
     visible_rooms.push_back(room_id);
-    (void)PrepareRoomCompositeBitmap(room_id);
+    if (!shows_thumbnail(room_id)) {
+      (void)PrepareRoomCompositeBitmap(room_id);
+    }
+  }
+  if (thumbnail_atlas_) {
+    thumbnail_atlas_->Prioritize(visible_rooms);
   }
 
   if (renderer_) {
@@ -1173,8 +1189,18 @@ std::optional<int> DungeonCanvasViewer::DrawConnectedRoomMatrix(
         screen_min.x + (kDungeonRoomPixelSize * canvas_rt.scale),
         screen_min.y + (kDungeonRoomPixelSize * canvas_rt.scale));
 
-    if (gfx::Bitmap* composite = PrepareRoomCompositeBitmap(room_id);
-        composite && composite->texture()) {
+    if (shows_thumbnail(room_id)) {
+      if (thumbnail_atlas_->HasThumbnail(room_id)) {
+        const auto slot = DungeonThumbnailAtlas::GetSlot(room_id);
+        canvas_rt.draw_list->AddImage(
+            (ImTextureID)(intptr_t)thumbnail_atlas_->texture(), screen_min,
+            screen_max, ImVec2(slot.u0, slot.v0), ImVec2(slot.u1, slot.v1));
+      } else {
+        canvas_rt.draw_list->AddRectFilled(screen_min, screen_max,
+                                           placeholder_fill, 6.0f);
+      }
+    } else if (gfx::Bitmap* composite = PrepareRoomCompositeBitmap(room_id);
+               composite && composite->texture()) {
       canvas_rt.draw_list->AddImage((ImTextureID)(intptr_t)composite->texture(),
                                     screen_min, screen_max, ImVec2(0, 0),
                                     ImVec2(1, 1), IM_COL32(255, 255, 255, 255));
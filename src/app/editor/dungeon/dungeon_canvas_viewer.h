@@ -29,6 +29,7 @@
 namespace yaze {
 namespace editor {
 
+class DungeonThumbnailAtlas;
 class MinecartTrackEditorPanel;
 class DungeonCanvasViewerTestPeer;
 
@@ -285,6 +286,12 @@ class DungeonCanvasViewer {
                              DungeonRoomStore* rooms, int room_id);
   DungeonRoomStore* rooms() const { return rooms_; }
   bool HasRooms() const { return rooms_ != nullptr; }
+  // Background thumbnails used by overview views for rooms that are not
+  // loaded yet. Owned by the editor; may be null.
+  void SetThumbnailAtlas(DungeonThumbnailAtlas* atlas) {
+    thumbnail_atlas_ = atlas;
+  }
+  DungeonThumbnailAtlas* thumbnail_atlas() const { return thumbnail_atlas_; }
 
   // Best-effort "current room" context for auxiliary panels that are driven by
   // whichever room the viewer is currently drawing.
@@ -855,6 +862,7 @@ class DungeonCanvasViewer {
 
   // Room data
   DungeonRoomStore* rooms_ = nullptr;
+  DungeonThumbnailAtlas* thumbnail_atlas_ = nullptr;
   int current_room_id_ = -1;
   std::vector<int> recently_visited_rooms_;
   int current_entrance_id_ = -1;
@@ -66,6 +66,7 @@
 #include "core/project.h"
 #include "rom/snes.h"
 #include "util/log.h"
+#include "util/platform_paths.h"
 #include "util/macro.h"
 #include "zelda3/dungeon/custom_object.h"
 #include "zelda3/dungeon/dungeon_editor_system.h"
@@ -386,6 +387,7 @@ absl::Status DungeonEditorV2::RefreshRomBackedState() {
   if (current_viewer) {
     SyncPanelsToRoom(current_room_id_);
   }
+  StartThumbnailAtlas();
 
   return absl::OkStatus();
 }
@@ -725,6 +727,7 @@ absl::Status DungeonEditorV2::Load() {
   ASSIGN_OR_RETURN(current_palette_group_,
                    gfx::CreatePaletteGroupFromLargePalette(current_palette_));
 
+  room_validator_.Reset();
   room_selector_.set_rooms(&rooms_);
   room_selector_.set_entrances(&entrances_);
   room_selector_.set_spawn_points(&spawn_points_);
@@ -779,11 +782,14 @@ absl::Status DungeonEditorV2::Load() {
       [this](size_t /*object_index*/, const zelda3::RoomObject& /*object*/) {
         if (current_room_id_ >= 0 && current_room_id_ < (int)rooms_.size()) {
           rooms_[current_room_id_].RenderRoomGraphics();
+          room_validator_.NotifyChanged(current_room_id_,
+                                        zelda3::kRoomInputObjects);
         }
       });
 
   // Set rooms and initial palette group for correct preview rendering
   object_selector->SetRooms(&rooms_);
+  object_selector->SetRoomValidator(&room_validator_);
   object_selector->SetCurrentPaletteGroup(current_palette_group_);
 
   auto open_workbench_selection_inspector = [this]() {
@@ -1013,6 +1019,8 @@ absl::Status DungeonEditorV2::Load() {
         item_editor_panel_, room_graphics_panel_, palette_editor_panel_);
   }
 
+  StartThumbnailAtlas();
+
   is_loaded_ = true;
   return absl::OkStatus();
 }
@@ -1187,6 +1195,8 @@ absl::Status DungeonEditorV2::Update() {
     return absl::OkStatus();
   }
 
+  thumbnail_atlas_.UpdateTexture(renderer_);
+
   if (!IsWorkbenchWorkflowEnabled() || active_rooms_.Size > 0) {
     DrawRoomPanels();
   }
@@ -1975,6 +1985,18 @@ void DungeonEditorV2::ProcessDeferredTextures() {
   gfx::Arena::Get().ProcessTextureQueue(renderer_);
 }
 
+void DungeonEditorV2::StartThumbnailAtlas() {
+  if (!rom_ || !rom_->is_loaded() || !game_data()) {
+    return;
+  }
+  std::filesystem::path cache_dir;
+  if (auto dir = util::PlatformPaths::GetAppDataSubdirectory("cache");
+      dir.ok()) {
+    cache_dir = *dir / "dungeon_thumbnails";
+  }
+  thumbnail_atlas_.Start(*rom_, *game_data(), cache_dir);
+}
+
 void DungeonEditorV2::HandleObjectPlaced(const zelda3::RoomObject& obj) {
   if (!IsValidRoomId(current_room_id_)) {
     LOG_ERROR("DungeonEditorV2", "Cannot place object: Invalid room ID %d",
@@ -2407,6 +2429,7 @@ DungeonCanvasViewer* DungeonEditorV2::GetViewerForRoom(int room_id) {
     viewer->SetRoomDetailsExpanded(true);
     DungeonCanvasViewer* viewer_ptr = viewer.get();
     viewer->SetRooms(&rooms_);
+    viewer->SetThumbnailAtlas(&thumbnail_atlas_);
     viewer->SetRenderer(renderer_);
     viewer->SetCurrentPaletteGroup(current_palette_group_);
     viewer->SetCurrentPaletteId(current_palette_id_);
@@ -2439,6 +2462,7 @@ DungeonCanvasViewer* DungeonEditorV2::GetViewerForRoom(int room_id) {
       if (rid >= 0 && rid < static_cast<int>(rooms_.size())) {
         const auto domain =
             viewer_ptr->object_interaction().last_invalidation_domain();
+        NotifyRoomValidation(rid, domain);
         if (domain == MutationDomain::kTileObjects) {
           rooms_[rid].MarkObjectsDirty();
           rooms_[rid].RenderRoomGraphics();
@@ -2520,6 +2544,7 @@ void DungeonEditorV2::RefreshWorkbenchViewerRuntimeContext(
   if (viewer->rooms() != &rooms_) {
     viewer->SetRooms(&rooms_);
   }
+  viewer->SetThumbnailAtlas(&thumbnail_atlas_);
   if (viewer->game_data() != game_data_) {
     viewer->SetGameData(game_data_);
   }
@@ -2543,6 +2568,7 @@ DungeonCanvasViewer* DungeonEditorV2::GetWorkbenchViewer() {
     viewer->SetHeaderVisible(false);
     viewer->SetHeaderHiddenMetadataHudVisible(false);
     viewer->SetRooms(&rooms_);
+    viewer->SetThumbnailAtlas(&thumbnail_atlas_);
     viewer->SetRenderer(renderer_);
     viewer->SetCurrentPaletteGroup(current_palette_group_);
     viewer->SetCurrentPaletteId(current_palette_id_);
@@ -2568,6 +2594,7 @@ DungeonCanvasViewer* DungeonEditorV2::GetWorkbenchViewer() {
       if (rid >= 0 && rid < static_cast<int>(rooms_.size())) {
         const auto domain =
             viewer->object_interaction().last_invalidation_domain();
+        NotifyRoomValidation(rid, domain);
         if (domain == MutationDomain::kTileObjects) {
           rooms_[rid].MarkObjectsDirty();
           rooms_[rid].RenderRoomGraphics();
@@ -2630,6 +2657,7 @@ DungeonCanvasViewer* DungeonEditorV2::GetWorkbenchCompareViewer(int room_id) {
     viewer->SetRoomDetailsExpanded(false);
     viewer->SetHeaderHiddenMetadataHudVisible(false);
     viewer->SetRooms(&rooms_);
+    viewer->SetThumbnailAtlas(&thumbnail_atlas_);
     viewer->SetRenderer(renderer_);
     viewer->SetCurrentPaletteGroup(current_palette_group_);
     viewer->SetCurrentPaletteId(current_palette_id_);
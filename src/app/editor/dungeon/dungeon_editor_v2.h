@@ -25,6 +25,7 @@
 #include "dungeon_room_loader.h"
 #include "dungeon_room_selector.h"
 #include "dungeon_room_store.h"
+#include "dungeon_thumbnail_atlas.h"
 #include "dungeon_undo_actions.h"
 #include "imgui/imgui.h"
 #include "inspectors/door_editor_content.h"
@@ -34,6 +35,7 @@
 #include "util/lru_cache.h"
 #include "workspace/room_graphics_content.h"
 #include "zelda3/dungeon/dungeon_editor_system.h"
+#include "zelda3/dungeon/incremental_dungeon_validator.h"
 #include "zelda3/dungeon/room.h"
 #include "zelda3/dungeon/room_entrance.h"
 #include "zelda3/dungeon/room_object.h"
@@ -291,6 +293,8 @@ class DungeonEditorV2 : public Editor {
 
   // Texture processing (critical for rendering)
   void ProcessDeferredTextures();
+  // (Re)starts background thumbnail rendering against the current ROM.
+  void StartThumbnailAtlas();
   void ReloadWaterFillZones();
 
   // Room selection callback
@@ -342,6 +346,9 @@ class DungeonEditorV2 : public Editor {
   Rom* rom_;
   zelda3::GameData* game_data_ = nullptr;
   DungeonRoomStore rooms_;
+  DungeonThumbnailAtlas thumbnail_atlas_;
+  // Live warnings for the object selector, refreshed per edit domain.
+  zelda3::IncrementalDungeonValidator room_validator_;
   std::array<zelda3::RoomEntrance, zelda3::kNumDungeonEntranceSlots> entrances_;
   std::array<zelda3::DungeonSpawnPoint, zelda3::kNumDungeonSpawnPoints>
       spawn_points_;
@@ -490,6 +497,8 @@ class DungeonEditorV2 : public Editor {
   void BeginWaterFillUndoSnapshot(int room_id);
   void FinalizeWaterFillUndoAction(int room_id);
   void RestoreRoomWaterFill(int room_id, const WaterFillSnapshot& snap);
+  // Marks the validator inputs an edit in domain touched as stale.
+  void NotifyRoomValidation(int room_id, MutationDomain domain);
   void SwapRoomInPanel(int old_room_id, int new_room_id);
   void ProcessPendingSwap();  // Process deferred swap after draw
   void ProcessPendingWorkflowMode();
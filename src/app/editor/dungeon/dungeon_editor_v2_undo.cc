@@ -199,12 +199,18 @@ void DungeonEditorV2::FinalizeUndoAction(int room_id) {
   }
 
   auto action = std::make_unique<DungeonObjectsAction>(
-      room_id, std::move(pending_undo_.before_objects),
-      std::move(pending_undo_.before_selection), std::move(after_objects),
+      room_id, pending_undo_.before_objects,
+      std::move(pending_undo_.before_selection), after_objects,
       std::move(after_selection),
       [this](int rid, const std::vector<zelda3::RoomObject>& objects,
              const std::vector<size_t>& selected_indices) {
         RestoreRoomObjects(rid, objects, selected_indices);
+      },
+      [this](int rid) {
+        if (rid < 0 || rid >= static_cast<int>(rooms_.size())) {
+          return std::vector<zelda3::RoomObject>{};
+        }
+        return rooms_[rid].GetTileObjects();
       });
   undo_manager_.Push(std::move(action));
 
@@ -224,6 +230,7 @@ void DungeonEditorV2::RestoreRoomObjects(
   const auto previous_objects = room.GetTileObjects();
   room.SetTileObjects(objects);
   room.RenderRoomGraphics();
+  room_validator_.NotifyChanged(room_id, zelda3::kRoomInputObjects);
   if (auto* viewer = GetViewerForRoom(room_id)) {
     std::vector<size_t> valid_selection;
     for (size_t index : selected_indices) {
@@ -239,6 +246,29 @@ void DungeonEditorV2::RestoreRoomObjects(
   }
 }
 
+void DungeonEditorV2::NotifyRoomValidation(int room_id,
+                                           MutationDomain domain) {
+  switch (domain) {
+    case MutationDomain::kTileObjects:
+      room_validator_.NotifyChanged(room_id, zelda3::kRoomInputObjects);
+      break;
+    case MutationDomain::kDoors:
+      room_validator_.NotifyChanged(room_id, zelda3::kRoomInputDoors);
+      break;
+    case MutationDomain::kSprites:
+      room_validator_.NotifyChanged(room_id, zelda3::kRoomInputSprites);
+      break;
+    case MutationDomain::kUnknown:
+      room_validator_.NotifyChanged(room_id, zelda3::kAllRoomInputs);
+      break;
+    // No rule reads pot items, collision or water fill yet.
+    case MutationDomain::kItems:
+    case MutationDomain::kCustomCollision:
+    case MutationDomain::kWaterFill:
+      break;
+  }
+}
+
 void DungeonEditorV2::BeginCollisionUndoSnapshot(int room_id) {
   if (room_id < 0 || room_id >= static_cast<int>(rooms_.size()))
     return;
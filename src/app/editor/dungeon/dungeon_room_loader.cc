@@ -1,10 +1,7 @@
 #include "dungeon_room_loader.h"
 
 #include <algorithm>
-#include <future>
-#include <map>
-#include <mutex>
-#include <thread>
+#include <optional>
 
 #ifdef __EMSCRIPTEN__
 #include "app/platform/wasm/wasm_loading_manager.h"
@@ -14,7 +11,9 @@
 #include "app/gfx/types/snes_palette.h"
 #include "util/log.h"
 #include "util/macro.h"
+#include "util/task_scheduler.h"
 #include "zelda3/dungeon/room.h"
+#include "zelda3/dungeon/room_stream_table.h"
 
 namespace yaze::editor {
 
@@ -40,7 +39,6 @@ absl::Status DungeonRoomLoader::LoadAllRooms(DungeonRoomStore& rooms) {
   constexpr int kTotalRooms = 0x100 + 40;  // 296 rooms
 
   // Data structures for collecting results
-  std::vector<std::pair<int, zelda3::RoomSize>> room_size_results;
   std::vector<std::pair<int, ImVec4>> room_palette_results;
 
 #ifdef __EMSCRIPTEN__
@@ -76,87 +74,51 @@ absl::Status DungeonRoomLoader::LoadAllRooms(DungeonRoomStore& rooms) {
     // Lazy load: Only load header/metadata, not objects/graphics
     rooms[i] = zelda3::LoadRoomHeaderFromRom(rom_, i);
     rooms[i].SetGameData(game_data_);  // Ensure room has access to GameData
-    auto room_size = zelda3::CalculateRoomSize(rom_, i);
     // rooms[i].LoadObjects(); // DEFERRED: Load on demand
 
     const int p_id = rooms[i].ResolveDungeonPaletteId();
     if (p_id >= 0 && p_id < static_cast<int>(dungeon_man_pal_group.size())) {
       auto color = dungeon_man_pal_group[p_id][3];
-      room_size_results.emplace_back(i, room_size);
       room_palette_results.emplace_back(rooms[i].palette(), color.rgb());
     }
   }
 
   app::platform::WasmLoadingManager::EndLoading(loading_handle);
 #else
-  // Native: Parallel loading for performance
-  constexpr int kMaxConcurrency =
-      8;  // Reasonable thread limit for room loading
-
-  // Determine optimal number of threads
-  const int max_concurrency = std::min(
-      kMaxConcurrency, static_cast<int>(std::thread::hardware_concurrency()));
-  const int rooms_per_thread =
-      (kTotalRooms + max_concurrency - 1) / max_concurrency;
-
-  LOG_DEBUG("Dungeon",
-            "Loading %d dungeon rooms using %d threads (%d rooms per thread)",
-            kTotalRooms, max_concurrency, rooms_per_thread);
-
-  // Thread-safe data structures for collecting results
-  std::mutex results_mutex;
-
-  // Process rooms in parallel batches
-  std::vector<std::future<absl::Status>> futures;
-
-  for (int thread_id = 0; thread_id < max_concurrency; ++thread_id) {
-    auto task = [this, &rooms, thread_id, rooms_per_thread, &results_mutex,
-                 &room_size_results, &room_palette_results,
-                 kTotalRooms]() -> absl::Status {
-      const int start_room = thread_id * rooms_per_thread;
-      const int end_room = std::min(start_room + rooms_per_thread, kTotalRooms);
-
-      if (!game_data_) {
-        return absl::FailedPreconditionError("GameData not available");
-      }
-      auto dungeon_man_pal_group = game_data_->palette_groups.dungeon_main;
-
-      for (int i = start_room; i < end_room; ++i) {
-        // Lazy load: Only load header/metadata
-        rooms[i] = zelda3::LoadRoomHeaderFromRom(rom_, i);
-        rooms[i].SetGameData(game_data_);  // Ensure room has access to GameData
-
-        // Calculate room size
-        auto room_size = zelda3::CalculateRoomSize(rom_, i);
-
-        // Load room objects - DEFERRED
-        // rooms[i].LoadObjects();
-
-        // Process palette (ResolveDungeonPaletteId handles the two-level
-        // lookup with out-of-range fallback; skip if group is empty).
-        const int p_id = rooms[i].ResolveDungeonPaletteId();
-        if (p_id >= 0 &&
-            p_id < static_cast<int>(dungeon_man_pal_group.size())) {
-          auto color = dungeon_man_pal_group[p_id][3];
-
-          // Thread-safe collection of results
-          {
-            std::lock_guard<std::mutex> lock(results_mutex);
-            room_size_results.emplace_back(i, room_size);
-            room_palette_results.emplace_back(rooms[i].palette(), color.rgb());
-          }
-        }
-      }
+  // Native: one task per room on the shared scheduler. Room cost varies a
+  // lot, so idle workers steal rooms instead of waiting on a fixed chunk.
+  if (!game_data_) {
+    return absl::FailedPreconditionError("GameData not available");
+  }
+  const auto& dungeon_man_pal_group = game_data_->palette_groups.dungeon_main;
 
-      return absl::OkStatus();
-    };
+  LOG_DEBUG("Dungeon", "Loading %d dungeon rooms on %d scheduler workers",
+            kTotalRooms, util::TaskScheduler::Get().worker_count());
 
-    futures.emplace_back(std::async(std::launch::async, task));
-  }
+  // Each task writes only its own slot, so no lock is needed.
+  std::vector<std::optional<ImVec4>> room_color_slots(kTotalRooms);
+
+  util::TaskGroup group;
+  group.RunEach(kTotalRooms, [&](int i) {
+    // Lazy load: Only load header/metadata; objects load on demand
+    rooms[i] = zelda3::LoadRoomHeaderFromRom(rom_, i);
+    rooms[i].SetGameData(game_data_);  // Ensure room has access to GameData
+
+    // Process palette (ResolveDungeonPaletteId handles the two-level
+    // lookup with out-of-range fallback; skip if group is empty).
+    const int p_id = rooms[i].ResolveDungeonPaletteId();
+    if (p_id >= 0 && p_id < static_cast<int>(dungeon_man_pal_group.size())) {
+      room_color_slots[i] = dungeon_man_pal_group[p_id][3].rgb();
+    }
+    return absl::OkStatus();
+  });
+  RETURN_IF_ERROR(group.Wait());
 
-  // Wait for all threads to complete
-  for (auto& future : futures) {
-    RETURN_IF_ERROR(future.get());
+  for (int i = 0; i < kTotalRooms; ++i) {
+    if (room_color_slots[i].has_value()) {
+      room_palette_results.emplace_back(rooms[i].palette(),
+                                        *room_color_slots[i]);
+    }
   }
 #endif
 
@@ -165,20 +127,9 @@ absl::Status DungeonRoomLoader::LoadAllRooms(DungeonRoomStore& rooms) {
     gfx::ScopedTimer postprocess_timer("DungeonRoomLoader::PostProcessResults");
 
     // Sort results by room ID for consistent ordering
-    std::sort(room_size_results.begin(), room_size_results.end(),
-              [](const auto& a, const auto& b) { return a.first < b.first; });
     std::sort(room_palette_results.begin(), room_palette_results.end(),
               [](const auto& a, const auto& b) { return a.first < b.first; });
 
-    // Process room size results
-    for (const auto& [room_id, room_size] : room_size_results) {
-      room_size_pointers_.push_back(room_size.room_size_pointer);
-      room_sizes_.push_back(room_size.room_size);
-      if (room_size.room_size_pointer != 0x0A8000) {
-        room_size_addresses_[room_id] = room_size.room_size_pointer;
-      }
-    }
-
     // Process palette results
     for (const auto& [palette_id, color] : room_palette_results) {
       room_palette_[palette_id] = color;
@@ -225,38 +176,28 @@ absl::Status DungeonRoomLoader::LoadDungeonSpawnPoints(
 }
 
 void DungeonRoomLoader::LoadDungeonRoomSize() {
-  std::map<int, std::vector<int>> rooms_by_bank;
-  for (const auto& room : room_size_addresses_) {
-    int bank = room.second >> 16;
-    rooms_by_bank[bank].push_back(room.second);
-  }
-
-  // Process and calculate room sizes within each bank
-  for (auto& bank_rooms : rooms_by_bank) {
-    std::ranges::sort(bank_rooms.second);
-
-    for (size_t i = 0; i < bank_rooms.second.size(); ++i) {
-      int room_ptr = bank_rooms.second[i];
-
-      // Identify the room ID for the current room pointer
-      int room_id =
-          std::ranges::find_if(room_size_addresses_, [room_ptr](
-                                                         const auto& entry) {
-            return entry.second == room_ptr;
-          })->first;
-
-      if (room_ptr != 0x0A8000) {
-        if (i < bank_rooms.second.size() - 1) {
-          room_sizes_[room_id] = bank_rooms.second[i + 1] - room_ptr;
-        } else {
-          int bank_end_address = (bank_rooms.first << 16) | 0xFFFF;
-          room_sizes_[room_id] = bank_end_address - room_ptr + 1;
-        }
-        total_room_size_ += room_sizes_[room_id];
-      } else {
-        room_sizes_[room_id] = 0x00;
-      }
+  room_size_pointers_.assign(zelda3::kNumberOfRooms, 0);
+  room_sizes_.assign(zelda3::kNumberOfRooms, 0);
+  room_size_addresses_.clear();
+  total_room_size_ = 0;
+  if (!rom_ || !rom_->is_loaded()) {
+    return;
+  }
+
+  // Sizes come from the shared pointer-table analysis, which sorts the object
+  // pointers once per ROM revision. The last stream in a bank runs to the bank
+  // end and a shared stream counts once, so the total stays the bytes used.
+  const auto tables = zelda3::GetRoomStreamTables(*rom_);
+  const std::vector<int> spans = zelda3::RoomStreamSpans(tables->objects);
+  for (int room_id = 0; room_id < zelda3::kNumberOfRooms; ++room_id) {
+    const auto room_size = zelda3::CalculateRoomSize(rom_, room_id);
+    room_size_pointers_[room_id] = room_size.room_size_pointer;
+    if (room_size.room_size_pointer == 0x0A8000) {
+      continue;
     }
+    room_size_addresses_[room_id] = room_size.room_size_pointer;
+    room_sizes_[room_id] = spans[room_id];
+    total_room_size_ += spans[room_id];
   }
 }
 
@@ -48,7 +48,8 @@ class DungeonRoomLoader {
       std::array<zelda3::DungeonSpawnPoint, zelda3::kNumDungeonSpawnPoints>&
           spawn_points);
 
-  // Room size management
+  // Room size management. Sizes every room's object stream in place; the
+  // size vectors are indexed by room ID.
   void LoadDungeonRoomSize();
   uint64_t GetTotalRoomSize() const { return total_room_size_; }
 
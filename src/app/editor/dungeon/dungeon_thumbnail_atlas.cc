@@ -0,0 +1,298 @@
+#include "app/editor/dungeon/dungeon_thumbnail_atlas.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "app/gfx/render/tile_pixel_cache.h"
+#include "util/log.h"
+#include "util/rom_hash.h"
+#include "zelda3/dungeon/palette_debug.h"
+#include "zelda3/dungeon/room.h"
+
+namespace yaze {
+namespace editor {
+
+namespace {
+
+// Bounds the per-frame upload cost when a whole cache lands at once.
+constexpr int kMaxUploadsPerFrame = 48;
+
+std::filesystem::path CachePath(const std::filesystem::path& dir,
+                                const std::string& rom_hash) {
+  return dir / (rom_hash + ".thumbs");
+}
+
+}  // namespace
+
+DungeonThumbnailAtlas::DungeonThumbnailAtlas()
+    : entries_(kRoomCount), uploaded_(kRoomCount, false) {}
+
+DungeonThumbnailAtlas::~DungeonThumbnailAtlas() {
+  Stop();
+  // The renderer is destroyed before editors, so the texture is left for SDL
+  // to release at shutdown (same as the emulator's PPU texture).
+}
+
+void DungeonThumbnailAtlas::Start(const Rom& rom,
+                                  const zelda3::GameData& game_data,
+                                  const std::filesystem::path& cache_dir) {
+  Stop();
+  if (!rom.is_loaded()) {
+    return;
+  }
+
+  // Workers read only the snapshot, so editing (and saving) the live ROM
+  // while they run is safe. Rom copies share pages until written.
+  auto snapshot = std::make_shared<Snapshot>();
+  snapshot->rom = rom;
+  snapshot->cache_dir = cache_dir;
+  auto& data = snapshot->game_data;
+  data.version = game_data.version;
+  data.graphics_buffer = game_data.graphics_buffer;
+  data.palette_groups = game_data.palette_groups;
+  data.main_blockset_ids = game_data.main_blockset_ids;
+  data.room_blockset_ids = game_data.room_blockset_ids;
+  data.spriteset_ids = game_data.spriteset_ids;
+  data.paletteset_ids = game_data.paletteset_ids;
+  data.pit_damage_table = game_data.pit_damage_table;
+  data.set_rom(&snapshot->rom);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.clear();
+    for (int room_id = 0; room_id < kRoomCount; ++room_id) {
+      queue_.push_back(room_id);
+    }
+    // Re-apply the last hint; the view that asked for it is likely still up.
+    for (auto it = last_priority_.rbegin(); it != last_priority_.rend(); ++it) {
+      auto queued = std::find(queue_.begin(), queue_.end(), *it);
+      if (queued != queue_.end()) {
+        queue_.erase(queued);
+        queue_.push_front(*it);
+      }
+    }
+    cache_dirty_ = false;
+  }
+  completed_ = 0;
+  snapshot_ = snapshot;
+  running_ = true;
+
+  // Without pool workers (Emscripten) nothing would run the tasks until
+  // Stop() waits on them, so UpdateTexture() renders one room per call.
+  if (util::TaskScheduler::Get().worker_count() == 0) {
+    return;
+  }
+  // One task per room; each takes whatever room is at the front of the queue
+  // when it runs, so Prioritize() still reorders work that has not started.
+  tasks_ = std::make_unique<util::TaskGroup>(util::TaskPriority::kLow);
+  tasks_->RunEach(kRoomCount, [this, snapshot](int) {
+    ProcessNextRoom(*snapshot);
+    return absl::OkStatus();
+  });
+}
+
+void DungeonThumbnailAtlas::Stop() {
+  if (tasks_) {
+    // Queued rooms are skipped; at most one room per pool thread finishes.
+    tasks_->Cancel();
+    tasks_->Wait().IgnoreError();
+    tasks_.reset();
+  }
+  snapshot_.reset();
+  running_ = false;
+}
+
+void DungeonThumbnailAtlas::Prioritize(const std::vector<int>& room_ids) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (room_ids == last_priority_) {
+    return;
+  }
+  last_priority_ = room_ids;
+  for (auto it = room_ids.rbegin(); it != room_ids.rend(); ++it) {
+    auto queued = std::find(queue_.begin(), queue_.end(), *it);
+    if (queued != queue_.end()) {
+      queue_.erase(queued);
+      queue_.push_front(*it);
+    }
+  }
+}
+
+void DungeonThumbnailAtlas::UpdateTexture(gfx::IRenderer* renderer) {
+  if (!tasks_ && snapshot_) {
+    ProcessNextRoom(*snapshot_);
+  }
+  if (!renderer) {
+    return;
+  }
+
+  if (!texture_) {
+    texture_ = renderer->CreateTexture(kWidth, kHeight);
+    if (!texture_) {
+      return;
+    }
+    // Streaming textures start undefined; clear every slot to transparent.
+    void* pixels = nullptr;
+    int pitch = 0;
+    if (renderer->LockTexture(texture_, nullptr, &pixels, &pitch)) {
+      for (int y = 0; y < kHeight; ++y) {
+        std::memset(static_cast<uint8_t*>(pixels) + y * pitch, 0,
+                    kWidth * sizeof(uint32_t));
+      }
+      renderer->UnlockTexture(texture_);
+    }
+  }
+
+  std::vector<std::pair<int, std::vector<uint32_t>>> uploads;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const size_t count =
+        std::min<size_t>(pending_uploads_.size(), kMaxUploadsPerFrame);
+    for (size_t i = 0; i < count; ++i) {
+      const int room_id = pending_uploads_[i];
+      uploads.emplace_back(room_id, entries_[room_id].pixels);
+    }
+    pending_uploads_.erase(pending_uploads_.begin(),
+                           pending_uploads_.begin() + count);
+  }
+
+  for (const auto& [room_id, thumbnail] : uploads) {
+    if (thumbnail.size() != zelda3::RoomThumbnail::kPixelCount) {
+      continue;
+    }
+    SDL_Rect rect{(room_id % kColumns) * kSlotSize,
+                  (room_id / kColumns) * kSlotSize, kSlotSize, kSlotSize};
+    void* pixels = nullptr;
+    int pitch = 0;
+    if (!renderer->LockTexture(texture_, &rect, &pixels, &pitch)) {
+      continue;
+    }
+    for (int y = 0; y < kSlotSize; ++y) {
+      std::memcpy(static_cast<uint8_t*>(pixels) + y * pitch,
+                  thumbnail.data() + y * kSlotSize,
+                  kSlotSize * sizeof(uint32_t));
+    }
+    renderer->UnlockTexture(texture_);
+    uploaded_[room_id] = true;
+  }
+}
+
+bool DungeonThumbnailAtlas::HasThumbnail(int room_id) const {
+  return texture_ && room_id >= 0 && room_id < kRoomCount &&
+         uploaded_[room_id];
+}
+
+DungeonThumbnailAtlas::Slot DungeonThumbnailAtlas::GetSlot(int room_id) {
+  const float x = static_cast<float>((room_id % kColumns) * kSlotSize);
+  const float y = static_cast<float>((room_id / kColumns) * kSlotSize);
+  return {x / kWidth, y / kHeight, (x + kSlotSize) / kWidth,
+          (y + kSlotSize) / kHeight};
+}
+
+bool DungeonThumbnailAtlas::ProcessNextRoom(Snapshot& snapshot) {
+  std::call_once(snapshot.cache_once, [&] { LoadDiskCache(snapshot); });
+
+  int room_id = -1;
+  uint32_t known_crc = 0;
+  bool have_known = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return false;
+    }
+    room_id = queue_.front();
+    queue_.pop_front();
+    have_known = !entries_[room_id].pixels.empty();
+    known_crc = entries_[room_id].source_crc;
+  }
+
+  // The room renders from the snapshot, so live sheet edits must not reach
+  // its tile cache, and its palette reports must not replace the inspected
+  // room's in the debugger.
+  gfx::TilePixelCache::ScopedUnregistered unregistered_tile_caches;
+  zelda3::PaletteDebugger::ScopedMute mute_palette_debugger;
+  zelda3::Room room = zelda3::LoadRoomFromRom(&snapshot.rom, room_id);
+  room.SetGameData(&snapshot.game_data);
+  if (have_known && zelda3::ComputeRoomThumbnailCrc(room) == known_crc) {
+    FinishRoom(snapshot);
+    return true;
+  }
+
+  auto thumbnail = zelda3::RenderRoomThumbnail(room);
+  if (!thumbnail.ok()) {
+    LOG_WARN("DungeonThumbnailAtlas", "Room 0x%03X: %s", room_id,
+             std::string(thumbnail.status().message()).c_str());
+  } else {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_[room_id] = *std::move(thumbnail);
+    pending_uploads_.push_back(room_id);
+    cache_dirty_ = true;
+  }
+  FinishRoom(snapshot);
+  return true;
+}
+
+void DungeonThumbnailAtlas::FinishRoom(const Snapshot& snapshot) {
+  if (completed_.fetch_add(1) + 1 == kRoomCount) {
+    WriteDiskCache(snapshot);
+  }
+}
+
+void DungeonThumbnailAtlas::LoadDiskCache(Snapshot& snapshot) {
+  const auto& rom_data = snapshot.rom.vector();
+  const std::string rom_hash =
+      util::ComputeRomHash(rom_data.data(), rom_data.size());
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rom_hash_ = rom_hash;
+  }
+  if (snapshot.cache_dir.empty()) {
+    return;
+  }
+
+  auto cached = zelda3::ReadRoomThumbnailCache(
+      CachePath(snapshot.cache_dir, rom_hash), rom_hash);
+  if (!cached.ok()) {
+    if (!absl::IsNotFound(cached.status())) {
+      LOG_WARN("DungeonThumbnailAtlas", "Ignoring thumbnail cache: %s",
+               std::string(cached.status().message()).c_str());
+    }
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& entry : *cached) {
+    // Thumbnails rendered this session are at least as fresh.
+    if (entries_[entry.room_id].pixels.empty()) {
+      const int room_id = entry.room_id;
+      entries_[room_id] = std::move(entry);
+      pending_uploads_.push_back(room_id);
+    }
+  }
+}
+
+void DungeonThumbnailAtlas::WriteDiskCache(const Snapshot& snapshot) {
+  std::vector<zelda3::RoomThumbnail> entries;
+  std::string rom_hash;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!cache_dirty_ || snapshot.cache_dir.empty() || rom_hash_.empty()) {
+      return;
+    }
+    cache_dirty_ = false;
+    rom_hash = rom_hash_;
+    for (const auto& entry : entries_) {
+      if (!entry.pixels.empty()) {
+        entries.push_back(entry);
+      }
+    }
+  }
+  auto status = zelda3::WriteRoomThumbnailCache(
+      CachePath(snapshot.cache_dir, rom_hash), rom_hash, entries);
+  if (!status.ok()) {
+    LOG_WARN("DungeonThumbnailAtlas", "Could not save thumbnails: %s",
+             std::string(status.message()).c_str());
+  }
+}
+
+}  // namespace editor
+}  // namespace yaze
@@ -0,0 +1,119 @@
+#ifndef YAZE_APP_EDITOR_DUNGEON_DUNGEON_THUMBNAIL_ATLAS_H
+#define YAZE_APP_EDITOR_DUNGEON_DUNGEON_THUMBNAIL_ATLAS_H
+
+#include <atomic>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "app/gfx/backend/irenderer.h"
+#include "rom/rom.h"
+#include "util/task_scheduler.h"
+#include "zelda3/dungeon/dungeon_rom_addresses.h"
+#include "zelda3/dungeon/room_thumbnail.h"
+#include "zelda3/game_data.h"
+
+namespace yaze {
+namespace editor {
+
+/**
+ * @brief Background-rendered thumbnails of every dungeon room in one texture
+ *
+ * Start() snapshots the ROM and GameData, then queues one low-priority
+ * util::TaskGroup task per room that loads and renders a room off-screen at
+ * 1/8 scale. Low-priority tasks only run when the shared pool has nothing
+ * else queued. Finished thumbnails are streamed into a packed RGBA atlas by
+ * UpdateTexture() on the UI thread, so overview views can show every room
+ * without rendering any of them on the UI thread. Rooms passed to
+ * Prioritize() (the dungeon in view) render first.
+ *
+ * Thumbnails persist to `<cache_dir>/<rom hash>.thumbs`. Each entry carries
+ * the CRC of the room data it was drawn from; cached and previously rendered
+ * entries whose CRC still matches are shown immediately and not re-rendered,
+ * which also makes restarting after a save cheap.
+ */
+class DungeonThumbnailAtlas {
+ public:
+  static constexpr int kRoomCount = zelda3::kNumberOfRooms;
+  static constexpr int kSlotSize = zelda3::RoomThumbnail::kSize;
+  static constexpr int kColumns = 16;
+  static constexpr int kRows = (kRoomCount + kColumns - 1) / kColumns;
+  static constexpr int kWidth = kColumns * kSlotSize;
+  static constexpr int kHeight = kRows * kSlotSize;
+
+  // Normalized texture coordinates of a room's slot.
+  struct Slot {
+    float u0 = 0.0f;
+    float v0 = 0.0f;
+    float u1 = 0.0f;
+    float v1 = 0.0f;
+  };
+
+  DungeonThumbnailAtlas();
+  ~DungeonThumbnailAtlas();
+  DungeonThumbnailAtlas(const DungeonThumbnailAtlas&) = delete;
+  DungeonThumbnailAtlas& operator=(const DungeonThumbnailAtlas&) = delete;
+
+  // Restarts rendering against a snapshot of @p rom and @p game_data. An
+  // empty @p cache_dir disables the disk cache.
+  void Start(const Rom& rom, const zelda3::GameData& game_data,
+             const std::filesystem::path& cache_dir);
+  void Stop();
+
+  // Move these rooms to the front of the queue, in order.
+  void Prioritize(const std::vector<int>& room_ids);
+
+  // UI thread only. Creates the atlas texture and uploads thumbnails
+  // finished since the last call.
+  void UpdateTexture(gfx::IRenderer* renderer);
+
+  gfx::TextureHandle texture() const { return texture_; }
+  bool HasThumbnail(int room_id) const;
+  static Slot GetSlot(int room_id);
+
+  // Rooms whose thumbnail is current for the running snapshot.
+  int completed_count() const { return completed_.load(); }
+  bool busy() const { return completed_.load() < kRoomCount && running_; }
+
+ private:
+  struct Snapshot {
+    Rom rom;
+    zelda3::GameData game_data;
+    std::filesystem::path cache_dir;
+    std::once_flag cache_once;
+  };
+
+  // Renders or verifies one queued room; false when the queue is empty.
+  bool ProcessNextRoom(Snapshot& snapshot);
+  void LoadDiskCache(Snapshot& snapshot);
+  void WriteDiskCache(const Snapshot& snapshot);
+  // Counts a room as done; the last one persists the cache.
+  void FinishRoom(const Snapshot& snapshot);
+
+  // Guarded by mutex_.
+  mutable std::mutex mutex_;
+  std::vector<zelda3::RoomThumbnail> entries_;
+  std::deque<int> queue_;
+  std::vector<int> pending_uploads_;
+  std::vector<int> last_priority_;
+  std::string rom_hash_;
+  bool cache_dirty_ = false;
+
+  std::shared_ptr<Snapshot> snapshot_;
+  // Null when the scheduler has no workers; UpdateTexture() then renders.
+  std::unique_ptr<util::TaskGroup> tasks_;
+  std::atomic<int> completed_{0};
+  bool running_ = false;
+
+  // UI thread only.
+  gfx::TextureHandle texture_ = nullptr;
+  std::vector<bool> uploaded_;
+};
+
+}  // namespace editor
+}  // namespace yaze
+
+#endif  // YAZE_APP_EDITOR_DUNGEON_DUNGEON_THUMBNAIL_ATLAS_H
@@ -0,0 +1,108 @@
+#include "app/editor/dungeon/dungeon_undo_actions.h"
+
+#include "app/gfx/types/snes_tile.h"
+
+namespace yaze {
+namespace editor {
+
+namespace {
+
+size_t ObjectMemoryUsage(const zelda3::RoomObject& object) {
+  return sizeof(object) + object.name_.capacity() +
+         object.preview_object_data_.capacity() +
+         object.tiles_.capacity() * sizeof(gfx::TileInfo);
+}
+
+}  // namespace
+
+RoomObjectsDelta RoomObjectsDelta::Compute(
+    const std::vector<zelda3::RoomObject>& before,
+    const std::vector<zelda3::RoomObject>& after) {
+  RoomObjectsDelta delta;
+  delta.before_size_ = before.size();
+  delta.after_size_ = after.size();
+
+  if (before.size() == after.size()) {
+    delta.sparse_ = true;
+    for (size_t i = 0; i < before.size(); ++i) {
+      if (!zelda3::SameObjectState(before[i], after[i])) {
+        delta.indices_.push_back(static_cast<uint32_t>(i));
+        delta.before_span_.push_back(before[i]);
+        delta.after_span_.push_back(after[i]);
+      }
+    }
+    return delta;
+  }
+
+  const size_t shorter = std::min(before.size(), after.size());
+  size_t prefix = 0;
+  while (prefix < shorter &&
+         zelda3::SameObjectState(before[prefix], after[prefix])) {
+    ++prefix;
+  }
+  size_t suffix = 0;
+  while (suffix < shorter - prefix &&
+         zelda3::SameObjectState(before[before.size() - 1 - suffix],
+                                 after[after.size() - 1 - suffix])) {
+    ++suffix;
+  }
+  delta.prefix_ = prefix;
+  delta.before_span_.assign(before.begin() + prefix, before.end() - suffix);
+  delta.after_span_.assign(after.begin() + prefix, after.end() - suffix);
+  return delta;
+}
+
+absl::StatusOr<std::vector<zelda3::RoomObject>> RoomObjectsDelta::Revert(
+    const std::vector<zelda3::RoomObject>& current) const {
+  return Rebuild(current, after_size_, after_span_, before_span_,
+                 before_size_);
+}
+
+absl::StatusOr<std::vector<zelda3::RoomObject>> RoomObjectsDelta::Reapply(
+    const std::vector<zelda3::RoomObject>& current) const {
+  return Rebuild(current, before_size_, before_span_, after_span_,
+                 after_size_);
+}
+
+absl::StatusOr<std::vector<zelda3::RoomObject>> RoomObjectsDelta::Rebuild(
+    const std::vector<zelda3::RoomObject>& current, size_t current_size,
+    const std::vector<zelda3::RoomObject>& from_span,
+    const std::vector<zelda3::RoomObject>& to_span,
+    size_t result_size) const {
+  if (current.size() != current_size) {
+    return absl::FailedPreconditionError(absl::StrFormat(
+        "Room has %d objects, undo history expected %d; it was changed "
+        "outside the undo history",
+        current.size(), current_size));
+  }
+
+  if (sparse_) {
+    std::vector<zelda3::RoomObject> result = current;
+    for (size_t i = 0; i < indices_.size(); ++i) {
+      result[indices_[i]] = to_span[i];
+    }
+    return result;
+  }
+
+  const size_t suffix = current_size - prefix_ - from_span.size();
+  std::vector<zelda3::RoomObject> result;
+  result.reserve(result_size);
+  result.insert(result.end(), current.begin(), current.begin() + prefix_);
+  result.insert(result.end(), to_span.begin(), to_span.end());
+  result.insert(result.end(), current.end() - suffix, current.end());
+  return result;
+}
+
+size_t RoomObjectsDelta::MemoryUsage() const {
+  size_t bytes = indices_.capacity() * sizeof(uint32_t);
+  for (const auto& object : before_span_) {
+    bytes += ObjectMemoryUsage(object);
+  }
+  for (const auto& object : after_span_) {
+    bytes += ObjectMemoryUsage(object);
+  }
+  return bytes;
+}
+
+}  // namespace editor
+}  // namespace yaze
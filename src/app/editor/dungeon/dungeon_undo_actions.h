@@ -1,6 +1,7 @@
 #ifndef YAZE_APP_EDITOR_DUNGEON_UNDO_ACTIONS_H_
 #define YAZE_APP_EDITOR_DUNGEON_UNDO_ACTIONS_H_
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -9,53 +10,106 @@
 #include <vector>
 
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/str_format.h"
 #include "app/editor/core/undo_action.h"
 #include "zelda3/dungeon/custom_collision.h"
+#include "util/macro.h"
 #include "zelda3/dungeon/room_object.h"
 
 namespace yaze {
 namespace editor {
 
+/**
+ * @class RoomObjectsDelta
+ * @brief Reversible difference between two room object lists
+ *
+ * Same-length edits (moves, resizes, property changes) keep only the changed
+ * indices with their before/after objects. Inserts and deletes keep the
+ * differing middle span after trimming the common prefix and suffix.
+ * Unchanged objects are taken from the room's current list on undo/redo.
+ */
+class RoomObjectsDelta {
+ public:
+  static RoomObjectsDelta Compute(const std::vector<zelda3::RoomObject>& before,
+                                  const std::vector<zelda3::RoomObject>& after);
+
+  /// Rebuild the before-state from the current (after-state) list.
+  absl::StatusOr<std::vector<zelda3::RoomObject>> Revert(
+      const std::vector<zelda3::RoomObject>& current) const;
+
+  /// Rebuild the after-state from the current (before-state) list.
+  absl::StatusOr<std::vector<zelda3::RoomObject>> Reapply(
+      const std::vector<zelda3::RoomObject>& current) const;
+
+  size_t changed_count() const {
+    return std::max(before_span_.size(), after_span_.size());
+  }
+  size_t MemoryUsage() const;
+
+ private:
+  absl::StatusOr<std::vector<zelda3::RoomObject>> Rebuild(
+      const std::vector<zelda3::RoomObject>& current, size_t current_size,
+      const std::vector<zelda3::RoomObject>& from_span,
+      const std::vector<zelda3::RoomObject>& to_span,
+      size_t result_size) const;
+
+  size_t before_size_ = 0;
+  size_t after_size_ = 0;
+  // Sparse mode: before_span_[i]/after_span_[i] replace index indices_[i].
+  bool sparse_ = false;
+  std::vector<uint32_t> indices_;
+  // Span mode: the objects between the common prefix and suffix.
+  size_t prefix_ = 0;
+  std::vector<zelda3::RoomObject> before_span_;
+  std::vector<zelda3::RoomObject> after_span_;
+};
+
 /**
  * @class DungeonObjectsAction
  * @brief Undoable action for dungeon room object edits.
  *
- * Captures a full snapshot of a room's tile objects and object selection
- * before and after an editing operation. Undo restores the before-state,
- * Redo restores the after-state, using a caller-provided restore callback
- * that applies the snapshot back into the room.
+ * Records a RoomObjectsDelta and the object selection before and after an
+ * editing operation. Undo and Redo read the room's current objects through
+ * the snapshot callback, rebuild the other state from the delta, and apply
+ * it with the restore callback.
  */
 class DungeonObjectsAction : public UndoAction {
  public:
   using RestoreFn =
       std::function<void(int room_id, const std::vector<zelda3::RoomObject>&,
                          const std::vector<size_t>& selected_indices)>;
+  using SnapshotFn =
+      std::function<std::vector<zelda3::RoomObject>(int room_id)>;
 
-  DungeonObjectsAction(int room_id, std::vector<zelda3::RoomObject> before,
+  DungeonObjectsAction(int room_id,
+                       const std::vector<zelda3::RoomObject>& before,
                        std::vector<size_t> before_selection,
-                       std::vector<zelda3::RoomObject> after,
-                       std::vector<size_t> after_selection, RestoreFn restore)
+                       const std::vector<zelda3::RoomObject>& after,
+                       std::vector<size_t> after_selection, RestoreFn restore,
+                       SnapshotFn snapshot)
       : room_id_(room_id),
-        before_(std::move(before)),
+        delta_(RoomObjectsDelta::Compute(before, after)),
         before_selection_(std::move(before_selection)),
-        after_(std::move(after)),
         after_selection_(std::move(after_selection)),
-        restore_(std::move(restore)) {}
+        restore_(std::move(restore)),
+        snapshot_(std::move(snapshot)) {}
 
   absl::Status Undo() override {
-    if (!restore_) {
+    if (!restore_ || !snapshot_) {
       return absl::InternalError("DungeonObjectsAction: no restore callback");
     }
-    restore_(room_id_, before_, before_selection_);
+    ASSIGN_OR_RETURN(auto objects, delta_.Revert(snapshot_(room_id_)));
+    restore_(room_id_, objects, before_selection_);
     return absl::OkStatus();
   }
 
   absl::Status Redo() override {
-    if (!restore_) {
+    if (!restore_ || !snapshot_) {
       return absl::InternalError("DungeonObjectsAction: no restore callback");
     }
-    restore_(room_id_, after_, after_selection_);
+    ASSIGN_OR_RETURN(auto objects, delta_.Reapply(snapshot_(room_id_)));
+    restore_(room_id_, objects, after_selection_);
     return absl::OkStatus();
   }
 
@@ -64,9 +118,8 @@ class DungeonObjectsAction : public UndoAction {
   }
 
   size_t MemoryUsage() const override {
-    // Rough estimate: each RoomObject is ~40-80 bytes
-    return (before_.size() + after_.size()) * sizeof(zelda3::RoomObject) +
-           (before_selection_.size() + after_selection_.size()) *
+    return sizeof(*this) + delta_.MemoryUsage() +
+           (before_selection_.capacity() + after_selection_.capacity()) *
                sizeof(size_t);
   }
 
@@ -78,11 +131,11 @@ class DungeonObjectsAction : public UndoAction {
 
  private:
   int room_id_;
-  std::vector<zelda3::RoomObject> before_;
+  RoomObjectsDelta delta_;
   std::vector<size_t> before_selection_;
-  std::vector<zelda3::RoomObject> after_;
   std::vector<size_t> after_selection_;
   RestoreFn restore_;
+  SnapshotFn snapshot_;
 };
 
 struct WaterFillSnapshot {
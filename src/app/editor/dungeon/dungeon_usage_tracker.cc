@@ -2,6 +2,7 @@
 #include "util/i18n/tr.h"
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "app/editor/dungeon/dungeon_room_store.h"
@@ -49,6 +50,7 @@ void DungeonUsageTracker::CalculateUsageStats(const DungeonRoomStore& rooms) {
   blockset_usage_.clear();
   spriteset_usage_.clear();
   palette_usage_.clear();
+  stream_tables_.reset();
 
   for (int room_id = 0; room_id < static_cast<int>(rooms.size()); ++room_id) {
     const auto& room = rooms[room_id];
@@ -69,6 +71,10 @@ void DungeonUsageTracker::CalculateUsageStats(const DungeonRoomStore& rooms) {
     } else {
       palette_usage_[room.palette()] += 1;
     }
+
+    if (!stream_tables_ && room.rom() && room.rom()->is_loaded()) {
+      stream_tables_ = zelda3::GetRoomStreamTables(*room.rom());
+    }
   }
 }
 
@@ -104,6 +110,22 @@ void DungeonUsageTracker::DrawUsageStats() {
       ImGui::Text(tr("Palette 0x%02X: %d rooms"), palette, count);
     }
   }
+
+  if (stream_tables_ && ImGui::CollapsingHeader(tr("Stream Space"))) {
+    const std::pair<const char*, const zelda3::RoomStreamTable*> kinds[] = {
+        {tr("Objects"), &stream_tables_->objects},
+        {tr("Sprites"), &stream_tables_->sprites},
+        {tr("Pot items"), &stream_tables_->pot_items}};
+    for (const auto& [name, table] : kinds) {
+      if (!table->status.ok()) {
+        ImGui::Text(tr("%s: pointer table unreadable"), name);
+        continue;
+      }
+      ImGui::Text(tr("%s: %d streams, %d shared rooms, %d unbounded rooms"),
+                  name, table->stream_count, table->shared_room_count,
+                  table->unbounded_room_count);
+    }
+  }
 }
 
 void DungeonUsageTracker::DrawUsageGrid() {
@@ -301,6 +323,7 @@ void DungeonUsageTracker::ClearUsageStats() {
   spriteset_usage_.clear();
   blockset_usage_.clear();
   palette_usage_.clear();
+  stream_tables_.reset();
 }
 
 }  // namespace yaze::editor
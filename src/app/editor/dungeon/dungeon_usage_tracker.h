@@ -1,9 +1,12 @@
 #ifndef YAZE_APP_EDITOR_DUNGEON_DUNGEON_USAGE_TRACKER_H
 #define YAZE_APP_EDITOR_DUNGEON_DUNGEON_USAGE_TRACKER_H
 
+#include <memory>
+
 #include "absl/container/flat_hash_map.h"
 #include "app/editor/dungeon/dungeon_room_store.h"
 #include "zelda3/dungeon/room.h"
+#include "zelda3/dungeon/room_stream_table.h"
 
 namespace yaze {
 namespace editor {
@@ -12,7 +15,9 @@ namespace editor {
  * @brief Tracks and analyzes usage statistics for dungeon resources
  *
  * This component manages blockset, spriteset, and palette usage statistics
- * across all dungeon rooms, providing insights for optimization.
+ * across all dungeon rooms, plus how the object, sprite, and pot-item
+ * streams share and bound their ROM space, providing insights for
+ * optimization.
  */
 class DungeonUsageTracker {
  public:
@@ -35,6 +40,10 @@ class DungeonUsageTracker {
   const absl::flat_hash_map<uint16_t, int>& GetPaletteUsage() const {
     return palette_usage_;
   }
+  // Pointer-table analysis of the rooms' ROM; null until stats are computed.
+  const zelda3::RoomStreamTables* GetStreamTables() const {
+    return stream_tables_.get();
+  }
 
   // Selection state
   uint16_t GetSelectedBlockset() const { return selected_blockset_; }
@@ -54,6 +63,7 @@ class DungeonUsageTracker {
   absl::flat_hash_map<uint16_t, int> spriteset_usage_;
   absl::flat_hash_map<uint16_t, int> blockset_usage_;
   absl::flat_hash_map<uint16_t, int> palette_usage_;
+  std::shared_ptr<const zelda3::RoomStreamTables> stream_tables_;
 
   uint16_t selected_blockset_ = 0xFFFF;  // 0xFFFF indicates no selection
   uint16_t selected_spriteset_ = 0xFFFF;
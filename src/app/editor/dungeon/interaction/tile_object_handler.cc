@@ -297,7 +297,8 @@ void TileObjectHandler::HandleMarqueeSelection(
     }
 
     ctx_->selection->EndRectangleSelection(
-        room->GetTileObjects(), ObjectSelection::SelectionMode::Single);
+        room->GetTileObjects(), ObjectSelection::SelectionMode::Single,
+        &room->GetObjectSpatialIndex());
   }
 }
 
@@ -499,29 +500,19 @@ std::optional<size_t> TileObjectHandler::GetEntityAtPosition(
   if (!room)
     return std::nullopt;
 
+  // The spatial index only returns objects whose hit-test bounds contain the
+  // hovered tile; prefer the topmost (last drawn) one.
   const auto& objects = room->GetTileObjects();
-  for (size_t i = objects.size(); i > 0; --i) {
-    size_t index = i - 1;
-    const auto& object = objects[index];
-
+  const auto hits =
+      room->GetObjectSpatialIndex().QueryPoint(canvas_x / 8, canvas_y / 8);
+  for (auto it = hits.rbegin(); it != hits.rend(); ++it) {
+    const size_t index = *it;
     // Respect layer filter if available in context
     if (ctx_ && ctx_->selection &&
-        !ctx_->selection->PassesLayerFilterForObject(object)) {
+        !ctx_->selection->PassesLayerFilterForObject(objects[index])) {
       continue;
     }
-
-    auto [obj_tile_x, obj_tile_y, width_tiles, height_tiles] =
-        zelda3::DimensionService::Get().GetHitTestBounds(object);
-
-    int obj_px = obj_tile_x * 8;
-    int obj_py = obj_tile_y * 8;
-    int w_px = width_tiles * 8;
-    int h_px = height_tiles * 8;
-
-    if (canvas_x >= obj_px && canvas_x < obj_px + w_px && canvas_y >= obj_py &&
-        canvas_y < obj_py + h_px) {
-      return index;
-    }
+    return index;
   }
   return std::nullopt;
 }
@@ -51,7 +51,8 @@ void ObjectSelection::SelectObject(size_t index, SelectionMode mode) {
 
 void ObjectSelection::SelectObjectsInRect(
     int room_min_x, int room_min_y, int room_max_x, int room_max_y,
-    const std::vector<zelda3::RoomObject>& objects, SelectionMode mode) {
+    const std::vector<zelda3::RoomObject>& objects, SelectionMode mode,
+    const zelda3::ObjectSpatialIndex* index) {
   // Normalize rectangle bounds
   int min_x = std::min(room_min_x, room_max_x);
   int max_x = std::max(room_min_x, room_max_x);
@@ -64,7 +65,16 @@ void ObjectSelection::SelectObjectsInRect(
   }
 
   // Find all objects within rectangle
-  for (size_t i = 0; i < objects.size(); ++i) {
+  std::vector<size_t> candidates;
+  if (index && index->size() == objects.size()) {
+    candidates = index->QueryRect(min_x, min_y, max_x, max_y);
+  } else {
+    candidates.resize(objects.size());
+    for (size_t i = 0; i < objects.size(); ++i) {
+      candidates[i] = i;
+    }
+  }
+  for (size_t i : candidates) {
     if (IsObjectInRectangle(objects[i], min_x, min_y, max_x, max_y)) {
       if (mode == SelectionMode::Toggle) {
         // Toggle each object
@@ -157,7 +167,8 @@ void ObjectSelection::UpdateRectangleSelection(int canvas_x, int canvas_y) {
 }
 
 void ObjectSelection::EndRectangleSelection(
-    const std::vector<zelda3::RoomObject>& objects, SelectionMode mode) {
+    const std::vector<zelda3::RoomObject>& objects, SelectionMode mode,
+    const zelda3::ObjectSpatialIndex* index) {
   if (!rectangle_selection_active_) {
     LOG_ERROR("ObjectSelection",
               "EndRectangleSelection called when not active");
@@ -172,7 +183,7 @@ void ObjectSelection::EndRectangleSelection(
 
   // Select objects in rectangle
   SelectObjectsInRect(start_room_x, start_room_y, end_room_x, end_room_y,
-                      objects, mode);
+                      objects, mode, index);
 
   rectangle_selection_active_ = false;
 }
@@ -10,6 +10,7 @@
 #include "app/gui/canvas/canvas.h"
 #include "imgui/imgui.h"
 #include "zelda3/dungeon/object_dimensions.h"
+#include "zelda3/dungeon/object_spatial_index.h"
 #include "zelda3/dungeon/room.h"
 #include "zelda3/dungeon/room_object.h"
 
@@ -70,11 +71,14 @@ class ObjectSelection {
    * @param room_max_y Maximum Y coordinate in room tiles
    * @param objects Object list to select from
    * @param mode How to modify the selection
+   * @param index Optional spatial index over `objects`; when given, only
+   *        objects in the covered grid cells are tested
    */
   void SelectObjectsInRect(int room_min_x, int room_min_y, int room_max_x,
                            int room_max_y,
                            const std::vector<zelda3::RoomObject>& objects,
-                           SelectionMode mode = SelectionMode::Single);
+                           SelectionMode mode = SelectionMode::Single,
+                           const zelda3::ObjectSpatialIndex* index = nullptr);
 
   /**
    * @brief Select all objects in the current room
@@ -146,9 +150,11 @@ class ObjectSelection {
    * @brief Complete rectangle selection operation
    * @param objects Object list to select from
    * @param mode How to modify the selection
+   * @param index Optional spatial index over `objects`
    */
   void EndRectangleSelection(const std::vector<zelda3::RoomObject>& objects,
-                             SelectionMode mode = SelectionMode::Single);
+                             SelectionMode mode = SelectionMode::Single,
+                             const zelda3::ObjectSpatialIndex* index = nullptr);
 
   /**
    * @brief Cancel rectangle selection without modifying selection
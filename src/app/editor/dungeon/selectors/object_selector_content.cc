@@ -345,8 +345,14 @@ void ObjectSelectorContent::DrawInteractionSummary() {
       return theme.text_secondary_gray;
     };
 
-    zelda3::DungeonValidator validator;
-    auto result = validator.ValidateRoom(room);
+    // The editor's incremental validator only re-runs rules an edit touched;
+    // without one, validate the whole room.
+    zelda3::ValidationResult full_result;
+    if (!room_validator_) {
+      full_result = zelda3::DungeonValidator().ValidateRoom(room);
+    }
+    const zelda3::ValidationResult& result =
+        room_validator_ ? room_validator_->Update(room) : full_result;
 
     ImGui::Spacing();
     DrawUsageChips(
@@ -14,6 +14,7 @@
 #include "rom/rom.h"
 #include "zelda3/dungeon/dungeon_object_editor.h"
 #include "zelda3/dungeon/dungeon_validator.h"
+#include "zelda3/dungeon/incremental_dungeon_validator.h"
 #include "zelda3/dungeon/room_object.h"
 #include "zelda3/game_data.h"
 
@@ -119,6 +120,10 @@ class ObjectSelectorContent : public WindowContent {
     open_object_editor_callback_ = std::move(callback);
   }
 
+  void SetRoomValidator(zelda3::IncrementalDungeonValidator* validator) {
+    room_validator_ = validator;
+  }
+
  private:
   DungeonCanvasViewer* ResolveCanvasViewer();
 
@@ -151,6 +156,7 @@ class ObjectSelectorContent : public WindowContent {
   double placement_error_time_ = -1.0;  // ImGui::GetTime() when error was set
 
   std::function<void()> open_object_editor_callback_;
+  zelda3::IncrementalDungeonValidator* room_validator_ = nullptr;
 };
 
 }  // namespace editor
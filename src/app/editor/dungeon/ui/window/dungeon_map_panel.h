@@ -13,6 +13,7 @@
 #include "app/editor/agent/agent_ui_theme.h"
 #include "app/editor/dungeon/dungeon_room_selector.h"
 #include "app/editor/dungeon/dungeon_room_store.h"
+#include "app/editor/dungeon/dungeon_thumbnail_atlas.h"
 #include "app/editor/system/workspace/editor_panel.h"
 #include "app/gfx/resource/arena.h"
 #include "app/gui/core/icons.h"
@@ -118,6 +119,9 @@ class DungeonMapPanel : public WindowContent {
   }
 
   void SetRooms(DungeonRoomStore* rooms) { rooms_ = rooms; }
+  void SetThumbnailAtlas(DungeonThumbnailAtlas* atlas) {
+    thumbnail_atlas_ = atlas;
+  }
 
   /**
    * @brief Set the hack manifest for project registry access
@@ -258,6 +262,11 @@ class DungeonMapPanel : public WindowContent {
       }
     }
 
+    // Thumbnails for the dungeon on screen render ahead of the rest.
+    if (thumbnail_atlas_) {
+      thumbnail_atlas_->Prioritize(dungeon_room_ids_);
+    }
+
     // Draw each room
     for (int room_id : dungeon_room_ids_) {
       auto pos_it = room_positions_.find(room_id);
@@ -285,50 +294,39 @@ class DungeonMapPanel : public WindowContent {
       }
 
       // Draw room thumbnail or placeholder
-      if (rooms_) {
-        auto* loaded_room = rooms_->GetIfLoaded(room_id);
-        if (loaded_room != nullptr) {
-          zelda3::RoomLayerManager layer_mgr;
-          layer_mgr.ApplyLayerMerging(loaded_room->layer_merging());
-          auto& preview_bitmap = loaded_room->GetCompositeBitmap(layer_mgr);
-          if (preview_bitmap.is_active() && preview_bitmap.width() > 0) {
-            if (!preview_bitmap.texture()) {
-              gfx::Arena::Get().QueueTextureCommand(
-                  gfx::Arena::TextureCommandType::CREATE, &preview_bitmap);
-              gfx::Arena::Get().ProcessTextureQueue(nullptr);
-            } else if (preview_bitmap.modified()) {
-              gfx::Arena::Get().QueueTextureCommand(
-                  gfx::Arena::TextureCommandType::UPDATE, &preview_bitmap);
-              gfx::Arena::Get().ProcessTextureQueue(nullptr);
-              preview_bitmap.set_modified(false);
-            }
-          }
-          if (preview_bitmap.is_active() && preview_bitmap.texture() != 0) {
-            // Draw room thumbnail
-            draw_list->AddImage((ImTextureID)(intptr_t)preview_bitmap.texture(),
-                                room_min, room_max);
-          } else {
-            // Placeholder for loaded but no texture
-            draw_list->AddRectFilled(
-                room_min, room_max,
-                ImGui::ColorConvertFloat4ToU32(theme.panel_bg_color));
+      auto* loaded_room = rooms_ ? rooms_->GetIfLoaded(room_id) : nullptr;
+      if (loaded_room != nullptr) {
+        zelda3::RoomLayerManager layer_mgr;
+        layer_mgr.ApplyLayerMerging(loaded_room->layer_merging());
+        auto& preview_bitmap = loaded_room->GetCompositeBitmap(layer_mgr);
+        if (preview_bitmap.is_active() && preview_bitmap.width() > 0) {
+          if (!preview_bitmap.texture()) {
+            gfx::Arena::Get().QueueTextureCommand(
+                gfx::Arena::TextureCommandType::CREATE, &preview_bitmap);
+            gfx::Arena::Get().ProcessTextureQueue(nullptr);
+          } else if (preview_bitmap.modified()) {
+            gfx::Arena::Get().QueueTextureCommand(
+                gfx::Arena::TextureCommandType::UPDATE, &preview_bitmap);
+            gfx::Arena::Get().ProcessTextureQueue(nullptr);
+            preview_bitmap.set_modified(false);
           }
+        }
+        if (preview_bitmap.is_active() && preview_bitmap.texture() != 0) {
+          // Draw room thumbnail
+          draw_list->AddImage((ImTextureID)(intptr_t)preview_bitmap.texture(),
+                              room_min, room_max);
         } else {
-          // Not loaded - gray placeholder
+          // Placeholder for loaded but no texture
           draw_list->AddRectFilled(
               room_min, room_max,
-              ImGui::ColorConvertFloat4ToU32(theme.panel_bg_darker));
-
-          // Show room ID
-          char label[8];
-          snprintf(label, sizeof(label), "%02X", room_id);
-          ImVec2 text_size = ImGui::CalcTextSize(label);
-          ImVec2 text_pos(room_min.x + (kRoomWidth - text_size.x) * 0.5f,
-                          room_min.y + (kRoomHeight - text_size.y) * 0.5f);
-          draw_list->AddText(
-              text_pos,
-              ImGui::ColorConvertFloat4ToU32(theme.text_secondary_gray), label);
+              ImGui::ColorConvertFloat4ToU32(theme.panel_bg_color));
         }
+      } else if (thumbnail_atlas_ && thumbnail_atlas_->HasThumbnail(room_id)) {
+        // Not loaded - background-rendered thumbnail
+        const auto slot = DungeonThumbnailAtlas::GetSlot(room_id);
+        draw_list->AddImage(
+            (ImTextureID)(intptr_t)thumbnail_atlas_->texture(), room_min,
+            room_max, ImVec2(slot.u0, slot.v0), ImVec2(slot.u1, slot.v1));
       } else {
         // Not loaded - gray placeholder
         draw_list->AddRectFilled(
@@ -604,6 +602,7 @@ class DungeonMapPanel : public WindowContent {
   int* current_room_id_ = nullptr;
   ImVector<int>* active_rooms_ = nullptr;
   DungeonRoomStore* rooms_ = nullptr;
+  DungeonThumbnailAtlas* thumbnail_atlas_ = nullptr;
   std::function<void(int)> on_room_selected_;
   std::function<void(int, RoomSelectionIntent)> on_room_intent_;
 
@@ -1198,47 +1198,31 @@ void MinecartTrackEditorPanel::Draw(bool* p_open) {
                                           " Generate All (%d rooms)",
                                           rooms_needing_collision)
                               .c_str())) {
-          int generated_rooms = 0;
-          int total_tiles = 0;
-          bool had_error = false;
-
-          for (auto& [rid, audit] : room_audit_) {
-            if (audit.track_subtypes.empty() || audit.has_track_collision) {
-              continue;
-            }
-
-            auto& target_room = (*rooms_)[rid];
-            zelda3::GeneratorOptions opts;
-            auto gen_result =
-                zelda3::GenerateTrackCollision(&target_room, opts);
-            if (!gen_result.ok()) {
-              status_message_ =
-                  absl::StrFormat("Generate failed for room 0x%03X: %s", rid,
-                                  gen_result.status().message());
-              show_success_ = false;
-              had_error = true;
-              break;
-            }
-
-            auto write_status = zelda3::WriteTrackCollision(
-                rom_, rid, gen_result->collision_map);
-            if (!write_status.ok()) {
-              status_message_ =
-                  absl::StrFormat("Write failed for room 0x%03X: %s", rid,
-                                  write_status.message());
-              show_success_ = false;
-              had_error = true;
-              break;
+          std::vector<zelda3::Room*> target_rooms;
+          for (const auto& [rid, audit] : room_audit_) {
+            if (!audit.track_subtypes.empty() && !audit.has_track_collision) {
+              target_rooms.push_back(&(*rooms_)[rid]);
             }
-
-            generated_rooms++;
-            total_tiles += gen_result->tiles_generated;
           }
 
-          if (!had_error) {
+          // Generate in parallel and write every map in one batch, so a
+          // failure leaves no room half-updated.
+          auto batch = zelda3::GenerateTrackCollisionBatch(target_rooms);
+          absl::Status write_status =
+              batch.ok() ? zelda3::WriteTrackCollisionBatch(rom_, *batch)
+                         : batch.status();
+          if (!write_status.ok()) {
+            status_message_ = absl::StrFormat("Generate All failed: %s",
+                                              write_status.message());
+            show_success_ = false;
+          } else {
+            int total_tiles = 0;
+            for (const auto& room : batch->rooms) {
+              total_tiles += room.result.tiles_generated;
+            }
             status_message_ = absl::StrFormat(
                 "Generated collision for %d rooms (%d tiles total)",
-                generated_rooms, total_tiles);
+                batch->changed_count, total_tiles);
             show_success_ = true;
           }
           audit_dirty_ = true;
@@ -1545,6 +1545,7 @@ DungeonMapPanel* DungeonWorkbenchContent::GetEmbeddedDungeonMap(
     }
   }
   embedded_dungeon_map_->SetRooms(viewer.rooms());
+  embedded_dungeon_map_->SetThumbnailAtlas(viewer.thumbnail_atlas());
   if (const auto* project = viewer.project()) {
     embedded_dungeon_map_->SetHackManifest(&project->hack_manifest);
   } else {
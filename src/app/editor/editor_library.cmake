@@ -4,6 +4,7 @@ set(
   app/editor/code/assembly_editor.cc
   app/editor/code/diagnostics_panel.cc
   app/editor/registry/content_registry.cc
+  app/editor/registry/undo_delta.cc
   app/editor/registry/undo_manager.cc
   app/editor/hack/workflow/hack_workflow_backend_factory.cc
   app/editor/hack/workflow/manifest_only_hack_workflow_backend.cc
@@ -27,12 +28,14 @@ set(
   app/editor/dungeon/dungeon_editor_v2.cc
   app/editor/dungeon/dungeon_editor_v2_persistence.cc
   app/editor/dungeon/dungeon_editor_v2_undo.cc
+  app/editor/dungeon/dungeon_undo_actions.cc
   app/editor/dungeon/dungeon_object_interaction.cc
   app/editor/dungeon/dungeon_object_selector.cc
   app/editor/dungeon/minecart_track_source.cc
   app/editor/dungeon/object_selection.cc
   app/editor/dungeon/dungeon_room_loader.cc
   app/editor/dungeon/dungeon_room_selector.cc
+  app/editor/dungeon/dungeon_thumbnail_atlas.cc
   app/editor/dungeon/dungeon_toolset.cc
   app/editor/dungeon/dungeon_usage_tracker.cc
   app/editor/dungeon/ui/reporting/dungeon_issue_report_storage.cc
@@ -236,127 +236,43 @@ absl::Status GraphicsEditor::Save() {
     return absl::FailedPreconditionError("ROM not loaded");
   }
 
-  // Only save sheets that have been modified
-  if (!state_.HasUnsavedChanges()) {
+  // Sheets touched through this editor plus any sheet another editor (or an
+  // undo/redo of a pixel edit) reported to the Arena. Sheets whose pixels
+  // round-trip to the bytes already in the ROM are detected and not rewritten.
+  auto& arena = gfx::Arena::Get();
+  std::set<uint16_t> pending(state_.modified_sheets.begin(),
+                             state_.modified_sheets.end());
+  for (uint16_t sheet_id : arena.GetSheetsPendingSave()) {
+    pending.insert(sheet_id);
+  }
+  if (pending.empty()) {
     LOG_INFO("GraphicsEditor", "No modified sheets to save");
     return absl::OkStatus();
   }
 
   LOG_INFO("GraphicsEditor", "Saving %zu modified graphics sheets",
-           state_.modified_sheets.size());
+           pending.size());
 
-  auto& sheets = gfx::Arena::Get().gfx_sheets();
-  std::set<uint16_t> saved_sheets;
-  std::vector<uint16_t> skipped_sheets;
-
-  for (uint16_t sheet_id : state_.modified_sheets) {
-    if (sheet_id >= zelda3::kNumGfxSheets)
-      continue;
-
-    auto& sheet = sheets[sheet_id];
-    if (!sheet.is_active())
-      continue;
-
-    // Determine BPP and compression based on sheet range
-    int bpp = 3;  // Default 3BPP
-    bool compressed = true;
-
-    // Sheets 113-114, 218+ are 2BPP
-    if (sheet_id == 113 || sheet_id == 114 || sheet_id >= 218) {
-      bpp = 2;
-    }
+  const std::vector<uint16_t> sheet_ids(pending.begin(), pending.end());
+  zelda3::GraphicsSaveOptions options;
+  options.version = game_data()->version;
+  ASSIGN_OR_RETURN(auto result,
+                   zelda3::SaveGraphicsSheets(*rom_, arena.gfx_sheets(),
+                                              sheet_ids, options));
 
-    // Sheets 115-126 are uncompressed
-    if (sheet_id >= 115 && sheet_id <= 126) {
-      compressed = false;
-    }
-
-    if (bpp == 2) {
-      const size_t expected_size =
-          gfx::kTilesheetWidth * gfx::kTilesheetHeight * 2;
-      const size_t actual_size = sheet.vector().size();
-      if (actual_size < expected_size) {
-        LOG_WARN("GraphicsEditor",
-                 "Skipping 2BPP sheet %02X save (expected %zu bytes, got %zu)",
-                 sheet_id, expected_size, actual_size);
-        skipped_sheets.push_back(sheet_id);
-        continue;
-      }
-    }
-
-    // Calculate ROM offset for this sheet
-    // Get version constants from game_data
-    auto version_constants =
-        zelda3::kVersionConstantsMap.at(game_data()->version);
-    const uint32_t gfx_ptr1 = core::RomSettings::Get().GetAddressOr(
-        core::RomAddressKey::kOverworldGfxPtr1,
-        version_constants.kOverworldGfxPtr1);
-    const uint32_t gfx_ptr2 = core::RomSettings::Get().GetAddressOr(
-        core::RomAddressKey::kOverworldGfxPtr2,
-        version_constants.kOverworldGfxPtr2);
-    const uint32_t gfx_ptr3 = core::RomSettings::Get().GetAddressOr(
-        core::RomAddressKey::kOverworldGfxPtr3,
-        version_constants.kOverworldGfxPtr3);
-    uint32_t offset =
-        zelda3::GetGraphicsAddress(rom_->data(), static_cast<uint8_t>(sheet_id),
-                                   gfx_ptr1, gfx_ptr2, gfx_ptr3, rom_->size());
-
-    // Convert 8BPP bitmap data to SNES planar format
-    auto snes_tile_data = gfx::IndexedToSnesSheet(sheet.vector(), bpp);
-
-    constexpr size_t kDecompressedSheetSize = 0x800;
-    std::vector<uint8_t> base_data;
-    if (compressed) {
-      auto decomp_result = gfx::lc_lz2::DecompressV2(
-          rom_->data(), offset, static_cast<int>(kDecompressedSheetSize), 1,
-          rom_->size());
-      if (!decomp_result.ok()) {
-        return decomp_result.status();
-      }
-      base_data = std::move(*decomp_result);
-    } else {
-      auto read_result = rom_->ReadByteVector(offset, kDecompressedSheetSize);
-      if (!read_result.ok()) {
-        return read_result.status();
-      }
-      base_data = std::move(*read_result);
-    }
-
-    if (base_data.size() < snes_tile_data.size()) {
-      base_data.resize(snes_tile_data.size(), 0);
-    }
-    std::copy(snes_tile_data.begin(), snes_tile_data.end(), base_data.begin());
-
-    std::vector<uint8_t> final_data;
-    if (compressed) {
-      // Compress using Hyrule Magic LC-LZ2
-      int compressed_size = 0;
-      auto compressed_data = gfx::HyruleMagicCompress(
-          base_data.data(), static_cast<int>(base_data.size()),
-          &compressed_size, 1);
-      final_data.assign(compressed_data.begin(),
-                        compressed_data.begin() + compressed_size);
-    } else {
-      final_data = std::move(base_data);
-    }
-
-    // Write data to ROM buffer
-    for (size_t i = 0; i < final_data.size(); i++) {
-      rom_->WriteByte(offset + i, final_data[i]);
+  // Clear modified tracking for everything now matching the ROM
+  std::set<uint16_t> saved_sheets;
+  for (const auto* ids : {&result.written_sheets, &result.unchanged_sheets}) {
+    for (uint16_t sheet_id : *ids) {
+      saved_sheets.insert(sheet_id);
+      arena.ClearSheetPendingSave(sheet_id);
     }
-
-    LOG_INFO("GraphicsEditor",
-             "Saved sheet %02X (%zu bytes, %s) at offset %06X", sheet_id,
-             final_data.size(), compressed ? "compressed" : "raw", offset);
-    saved_sheets.insert(sheet_id);
   }
-
-  // Clear modified tracking after successful save
   state_.ClearModifiedSheets(saved_sheets);
-  if (!skipped_sheets.empty()) {
+  if (!result.skipped_sheets.empty()) {
     return absl::FailedPreconditionError(
-        absl::StrCat("Skipped ", skipped_sheets.size(),
-                     " 2BPP sheet(s); full data unavailable."));
+        absl::StrCat("Skipped ", result.skipped_sheets.size(),
+                     " sheet(s); full data unavailable."));
   }
 
   return absl::OkStatus();
@@ -11,7 +11,10 @@
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "app/editor/core/undo_action.h"
+#include "app/editor/registry/undo_delta.h"
 #include "app/gfx/resource/arena.h"
+#include "util/macro.h"
+#include "util/rom_hash.h"
 
 namespace yaze {
 namespace editor {
@@ -20,53 +23,35 @@ namespace editor {
  * @class GraphicsPixelEditAction
  * @brief Undoable action for pixel edits on a graphics sheet.
  *
- * Captures a full snapshot of the sheet pixel data before and after the
- * edit stroke so that Undo restores the before-state and Redo restores
- * the after-state.
+ * Keeps only an XOR-RLE delta between the sheet pixel data before and after
+ * the edit stroke. Undo and Redo both apply the delta to the sheet's current
+ * data, which flips it between the two states. CRCs of both states guard the
+ * flip: if the sheet was changed outside the history (a gfx-group edit, a
+ * palette path calling set_data, a reload), the delta no longer describes it
+ * and the action fails instead of corrupting the sheet.
  */
 class GraphicsPixelEditAction : public UndoAction {
  public:
   using MarkDirtyFn = std::function<void(uint16_t)>;
 
-  GraphicsPixelEditAction(uint16_t sheet_id, std::vector<uint8_t> before_data,
-                          std::vector<uint8_t> after_data,
+  GraphicsPixelEditAction(uint16_t sheet_id,
+                          const std::vector<uint8_t>& before_data,
+                          const std::vector<uint8_t>& after_data,
                           std::string description, MarkDirtyFn mark_dirty)
       : sheet_id_(sheet_id),
-        before_data_(std::move(before_data)),
-        after_data_(std::move(after_data)),
+        delta_(XorRleDelta::Encode(before_data, after_data)),
+        before_crc_(Crc(before_data)),
+        after_crc_(Crc(after_data)),
         description_(std::move(description)),
         mark_dirty_(std::move(mark_dirty)) {}
 
-  absl::Status Undo() override {
-    auto* sheets = gfx::Arena::Get().mutable_gfx_sheets();
-    if (sheet_id_ >= sheets->size()) {
-      return absl::OutOfRangeError(
-          absl::StrFormat("Sheet %02X out of range", sheet_id_));
-    }
-    auto& sheet = sheets->at(sheet_id_);
-    sheet.set_data(before_data_);
-    gfx::Arena::Get().NotifySheetModified(sheet_id_);
-    MarkDirty();
-    return absl::OkStatus();
-  }
-
-  absl::Status Redo() override {
-    auto* sheets = gfx::Arena::Get().mutable_gfx_sheets();
-    if (sheet_id_ >= sheets->size()) {
-      return absl::OutOfRangeError(
-          absl::StrFormat("Sheet %02X out of range", sheet_id_));
-    }
-    auto& sheet = sheets->at(sheet_id_);
-    sheet.set_data(after_data_);
-    gfx::Arena::Get().NotifySheetModified(sheet_id_);
-    MarkDirty();
-    return absl::OkStatus();
-  }
+  absl::Status Undo() override { return Toggle(after_crc_, "undo"); }
+  absl::Status Redo() override { return Toggle(before_crc_, "redo"); }
 
   std::string Description() const override { return description_; }
 
   size_t MemoryUsage() const override {
-    return before_data_.size() + after_data_.size();
+    return sizeof(*this) + delta_.MemoryUsage() + description_.capacity();
   }
 
   bool CanMergeWith(const UndoAction& /*prev*/) const override {
@@ -76,6 +61,31 @@ class GraphicsPixelEditAction : public UndoAction {
   }
 
  private:
+  static uint32_t Crc(const std::vector<uint8_t>& data) {
+    return util::CalculateCrc32(data.data(), data.size());
+  }
+
+  // Applies the delta when the sheet holds the state with @p expected_crc.
+  absl::Status Toggle(uint32_t expected_crc, const char* direction) {
+    auto* sheets = gfx::Arena::Get().mutable_gfx_sheets();
+    if (sheet_id_ >= sheets->size()) {
+      return absl::OutOfRangeError(
+          absl::StrFormat("Sheet %02X out of range", sheet_id_));
+    }
+    auto& sheet = sheets->at(sheet_id_);
+    std::vector<uint8_t> data = sheet.vector();
+    if (Crc(data) != expected_crc) {
+      return absl::FailedPreconditionError(absl::StrFormat(
+          "Cannot %s pixel edit: sheet %02X changed outside the undo history",
+          direction, sheet_id_));
+    }
+    RETURN_IF_ERROR(delta_.Apply(data));
+    sheet.set_data(data);
+    gfx::Arena::Get().NotifySheetPixelsModified(sheet_id_);
+    MarkDirty();
+    return absl::OkStatus();
+  }
+
   void MarkDirty() {
     if (mark_dirty_) {
       mark_dirty_(sheet_id_);
@@ -83,8 +93,9 @@ class GraphicsPixelEditAction : public UndoAction {
   }
 
   uint16_t sheet_id_;
-  std::vector<uint8_t> before_data_;
-  std::vector<uint8_t> after_data_;
+  XorRleDelta delta_;
+  uint32_t before_crc_;
+  uint32_t after_crc_;
   std::string description_;
   MarkDirtyFn mark_dirty_;
 };
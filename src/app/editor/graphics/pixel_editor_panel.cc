@@ -712,7 +712,7 @@ void PixelEditorPanel::ApplyPencil(int x, int y) {
   if (x >= 0 && x < sheet.width() && y >= 0 && y < sheet.height()) {
     sheet.WriteToPixel(x, y, state_->current_color_index);
     state_->MarkSheetModified(state_->current_sheet_id);
-    gfx::Arena::Get().NotifySheetModified(state_->current_sheet_id);
+    gfx::Arena::Get().NotifySheetPixelsModified(state_->current_sheet_id);
   }
 }
 
@@ -733,7 +733,7 @@ void PixelEditorPanel::ApplyBrush(int x, int y) {
   }
 
   state_->MarkSheetModified(state_->current_sheet_id);
-  gfx::Arena::Get().NotifySheetModified(state_->current_sheet_id);
+  gfx::Arena::Get().NotifySheetPixelsModified(state_->current_sheet_id);
 }
 
 void PixelEditorPanel::ApplyEraser(int x, int y) {
@@ -753,7 +753,7 @@ void PixelEditorPanel::ApplyEraser(int x, int y) {
   }
 
   state_->MarkSheetModified(state_->current_sheet_id);
-  gfx::Arena::Get().NotifySheetModified(state_->current_sheet_id);
+  gfx::Arena::Get().NotifySheetPixelsModified(state_->current_sheet_id);
 }
 
 void PixelEditorPanel::ApplyFill(int x, int y) {
@@ -801,7 +801,7 @@ void PixelEditorPanel::ApplyFill(int x, int y) {
   }
 
   state_->MarkSheetModified(state_->current_sheet_id);
-  gfx::Arena::Get().NotifySheetModified(state_->current_sheet_id);
+  gfx::Arena::Get().NotifySheetPixelsModified(state_->current_sheet_id);
 }
 
 void PixelEditorPanel::ApplyEyedropper(int x, int y) {
@@ -852,7 +852,7 @@ void PixelEditorPanel::DrawLine(int x1, int y1, int x2, int y2) {
   }
 
   state_->MarkSheetModified(state_->current_sheet_id);
-  gfx::Arena::Get().NotifySheetModified(state_->current_sheet_id);
+  gfx::Arena::Get().NotifySheetPixelsModified(state_->current_sheet_id);
 }
 
 void PixelEditorPanel::DrawRectangle(int x1, int y1, int x2, int y2,
@@ -895,7 +895,7 @@ void PixelEditorPanel::DrawRectangle(int x1, int y1, int x2, int y2,
   }
 
   state_->MarkSheetModified(state_->current_sheet_id);
-  gfx::Arena::Get().NotifySheetModified(state_->current_sheet_id);
+  gfx::Arena::Get().NotifySheetPixelsModified(state_->current_sheet_id);
 }
 
 void PixelEditorPanel::BeginSelection(int x, int y) {
@@ -969,7 +969,7 @@ void PixelEditorPanel::PasteSelection(int x, int y) {
   }
 
   state_->MarkSheetModified(state_->current_sheet_id);
-  gfx::Arena::Get().NotifySheetModified(state_->current_sheet_id);
+  gfx::Arena::Get().NotifySheetPixelsModified(state_->current_sheet_id);
   FinalizeUndoAction();
 }
 
@@ -319,7 +319,7 @@ absl::StatusOr<MessageBank> MessageBankFromString(std::string_view value) {
       absl::StrFormat("Unknown message bank: %s", std::string(value)));
 }
 
-std::vector<DictionaryEntry> BuildDictionaryEntries(Rom* rom) {
+std::vector<DictionaryEntry> BuildDictionaryEntries(const Rom* rom) {
   std::vector<DictionaryEntry> AllDictionaries;
   for (int i = 0; i < kNumDictionaryEntries; i++) {
     std::vector<uint8_t> bytes;
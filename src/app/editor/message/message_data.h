@@ -209,7 +209,7 @@ constexpr uint8_t kLine2 = 0x75;
 constexpr uint8_t kLine3 = 0x76;
 
 // Reads all dictionary entries from ROM and builds the dictionary table
-std::vector<DictionaryEntry> BuildDictionaryEntries(Rom* rom);
+std::vector<DictionaryEntry> BuildDictionaryEntries(const Rom* rom);
 
 // Replaces all dictionary words in a string with their [D:XX] tokens
 // Used for text compression when saving messages back to ROM
@@ -0,0 +1,123 @@
+#include "app/editor/registry/undo_delta.h"
+
+#include <algorithm>
+
+namespace yaze {
+namespace editor {
+
+namespace {
+
+// Zero runs shorter than this stay inside the current literal; splitting
+// would cost two varints for little or no saving.
+constexpr size_t kMinZeroRun = 4;
+
+void PutVarint(std::vector<uint8_t>& out, size_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+bool GetVarint(const std::vector<uint8_t>& in, size_t& pos, size_t& value) {
+  value = 0;
+  for (int shift = 0; shift < 64 && pos < in.size(); shift += 7) {
+    const uint8_t byte = in[pos++];
+    value |= static_cast<size_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+XorRleDelta XorRleDelta::Encode(std::span<const uint8_t> before,
+                                std::span<const uint8_t> after) {
+  XorRleDelta delta;
+  delta.size_a_ = before.size();
+  delta.size_b_ = after.size();
+
+  // The shorter buffer reads as zero-extended, so a resize round-trips too.
+  const size_t length = std::max(before.size(), after.size());
+  auto xor_at = [&](size_t i) -> uint8_t {
+    const uint8_t a = i < before.size() ? before[i] : 0;
+    const uint8_t b = i < after.size() ? after[i] : 0;
+    return a ^ b;
+  };
+
+  size_t i = 0;
+  while (i < length) {
+    const size_t zero_start = i;
+    while (i < length && xor_at(i) == 0) {
+      ++i;
+    }
+    if (i == length) {
+      break;  // Trailing zeros are implicit
+    }
+    const size_t skip = i - zero_start;
+
+    const size_t literal_start = i;
+    while (i < length) {
+      if (xor_at(i) != 0) {
+        ++i;
+        continue;
+      }
+      size_t j = i;
+      while (j < length && xor_at(j) == 0) {
+        ++j;
+      }
+      if (j == length || j - i >= kMinZeroRun) {
+        break;
+      }
+      i = j;
+    }
+
+    PutVarint(delta.encoded_, skip);
+    PutVarint(delta.encoded_, i - literal_start);
+    for (size_t k = literal_start; k < i; ++k) {
+      delta.encoded_.push_back(xor_at(k));
+    }
+  }
+  delta.encoded_.shrink_to_fit();
+  return delta;
+}
+
+absl::Status XorRleDelta::Apply(std::vector<uint8_t>& data) const {
+  size_t target_size;
+  if (data.size() == size_a_) {
+    target_size = size_b_;
+  } else if (data.size() == size_b_) {
+    target_size = size_a_;
+  } else {
+    return absl::FailedPreconditionError(
+        "Buffer size does not match either side of the delta");
+  }
+
+  const size_t length = std::max(size_a_, size_b_);
+  data.resize(length, 0);
+  size_t pos = 0;
+  size_t cursor = 0;
+  while (cursor < encoded_.size()) {
+    size_t skip = 0;
+    size_t literal = 0;
+    if (!GetVarint(encoded_, cursor, skip) ||
+        !GetVarint(encoded_, cursor, literal) || skip > length - pos ||
+        literal > length - pos - skip ||
+        literal > encoded_.size() - cursor) {
+      return absl::DataLossError("Corrupt XOR-RLE delta");
+    }
+    pos += skip;
+    for (size_t k = 0; k < literal; ++k) {
+      data[pos + k] ^= encoded_[cursor + k];
+    }
+    pos += literal;
+    cursor += literal;
+  }
+  data.resize(target_size);
+  return absl::OkStatus();
+}
+
+}  // namespace editor
+}  // namespace yaze
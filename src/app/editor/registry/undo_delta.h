@@ -0,0 +1,48 @@
+#ifndef YAZE_APP_EDITOR_REGISTRY_UNDO_DELTA_H_
+#define YAZE_APP_EDITOR_REGISTRY_UNDO_DELTA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "absl/status/status.h"
+
+namespace yaze {
+namespace editor {
+
+/**
+ * @class XorRleDelta
+ * @brief Compact, reversible difference between two byte buffers
+ *
+ * Stores before XOR after as run-length encoded (skip, literal) pairs, so an
+ * edit touching a few pixels of a 4 KB sheet costs a few dozen bytes instead
+ * of two full copies. XOR is its own inverse: applying the delta to the
+ * after-state yields the before-state and vice versa, which lets undo actions
+ * keep only the delta and work from the buffer's current contents.
+ */
+class XorRleDelta {
+ public:
+  XorRleDelta() = default;
+
+  static XorRleDelta Encode(std::span<const uint8_t> before,
+                            std::span<const uint8_t> after);
+
+  /// Flip `data` between the two encoded states. Fails if `data` has the
+  /// size of neither state or the encoding is corrupt.
+  absl::Status Apply(std::vector<uint8_t>& data) const;
+
+  bool empty() const { return encoded_.empty() && size_a_ == size_b_; }
+  size_t encoded_size() const { return encoded_.size(); }
+  size_t MemoryUsage() const { return encoded_.capacity(); }
+
+ private:
+  std::vector<uint8_t> encoded_;
+  size_t size_a_ = 0;
+  size_t size_b_ = 0;
+};
+
+}  // namespace editor
+}  // namespace yaze
+
+#endif  // YAZE_APP_EDITOR_REGISTRY_UNDO_DELTA_H_
@@ -12,13 +12,17 @@ namespace editor {
 void UndoManager::Push(std::unique_ptr<UndoAction> action) {
   // Clear redo stack on new action
   redo_stack_.clear();
+  redo_bytes_ = 0;
 
   // Try to merge with the top of the undo stack
   if (!undo_stack_.empty() && action->CanMergeWith(*undo_stack_.back())) {
+    // Account before merging; MergeWith may move state out of the old top.
+    undo_bytes_ -= undo_stack_.back()->MemoryUsage();
     action->MergeWith(*undo_stack_.back());
     undo_stack_.pop_back();
   }
 
+  undo_bytes_ += action->MemoryUsage();
   undo_stack_.push_back(std::move(action));
   EnforceStackLimit();
 }
@@ -34,6 +38,9 @@ absl::Status UndoManager::Undo() {
     return status;
   }
 
+  const size_t bytes = action->MemoryUsage();
+  undo_bytes_ -= bytes;
+  redo_bytes_ += bytes;
   redo_stack_.push_back(std::move(action));
   undo_stack_.pop_back();
   return absl::OkStatus();
@@ -50,6 +57,9 @@ absl::Status UndoManager::Redo() {
     return status;
   }
 
+  const size_t bytes = action->MemoryUsage();
+  redo_bytes_ -= bytes;
+  undo_bytes_ += bytes;
   undo_stack_.push_back(std::move(action));
   redo_stack_.pop_back();
   return absl::OkStatus();
@@ -70,10 +80,16 @@ std::string UndoManager::GetRedoDescription() const {
 void UndoManager::Clear() {
   undo_stack_.clear();
   redo_stack_.clear();
+  undo_bytes_ = 0;
+  redo_bytes_ = 0;
 }
 
 void UndoManager::EnforceStackLimit() {
-  while (undo_stack_.size() > max_stack_size_) {
+  while (!undo_stack_.empty() &&
+         (undo_stack_.size() > max_stack_size_ ||
+          (undo_stack_.size() > 1 &&
+           undo_bytes_ + redo_bytes_ > memory_budget_))) {
+    undo_bytes_ -= undo_stack_.front()->MemoryUsage();
     undo_stack_.pop_front();
   }
 }
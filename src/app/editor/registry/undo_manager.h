@@ -19,6 +19,12 @@ namespace editor {
  * Each editor gets its own UndoManager (via EditorDependencies).
  * Supports bounded stacks, action merging, and description queries
  * for status bar / toast feedback.
+ *
+ * History is bounded by memory rather than step count: every action reports
+ * its footprint via UndoAction::MemoryUsage(), and the oldest undo steps are
+ * evicted once the undo and redo stacks together exceed the byte budget.
+ * The step cap remains as a backstop for actions that report no cost. The
+ * newest undo step is never evicted, however large.
  */
 class UndoManager {
  public:
@@ -50,9 +56,22 @@ class UndoManager {
   /// Description of the action that would be redone (for UI)
   std::string GetRedoDescription() const;
 
-  void SetMaxStackSize(size_t max) { max_stack_size_ = max; }
+  void SetMaxStackSize(size_t max) {
+    max_stack_size_ = max;
+    EnforceStackLimit();
+  }
   size_t GetMaxStackSize() const { return max_stack_size_; }
 
+  /// Total bytes the undo and redo stacks may hold before eviction
+  void SetMemoryBudget(size_t bytes) {
+    memory_budget_ = bytes;
+    EnforceStackLimit();
+  }
+  size_t GetMemoryBudget() const { return memory_budget_; }
+
+  /// Bytes currently held by both stacks, as reported by the actions
+  size_t MemoryUsage() const { return undo_bytes_ + redo_bytes_; }
+
   size_t UndoStackSize() const { return undo_stack_.size(); }
   size_t RedoStackSize() const { return redo_stack_.size(); }
 
@@ -63,7 +82,10 @@ class UndoManager {
 
   std::deque<std::unique_ptr<UndoAction>> undo_stack_;
   std::deque<std::unique_ptr<UndoAction>> redo_stack_;
-  size_t max_stack_size_ = 50;
+  size_t undo_bytes_ = 0;
+  size_t redo_bytes_ = 0;
+  size_t max_stack_size_ = 1000;
+  size_t memory_budget_ = 64 * 1024 * 1024;
 };
 
 }  // namespace editor
@@ -20,6 +20,7 @@
 #include "app/editor/overworld/overworld_editor.h"
 #include "app/editor/session_types.h"
 #include "app/editor/system/editor_registry.h"
+#include "app/gfx/resource/arena.h"
 #include "app/gfx/util/palette_manager.h"
 #include "app/gui/core/icons.h"
 #include "app/gui/core/style_guard.h"
@@ -253,6 +254,12 @@ void SessionCoordinator::CloseSession(size_t index) {
   // Notify observers before removal
   NotifySessionClosed(index);
 
+  // The Arena's sheets come from the active session's ROM; edits to them
+  // can no longer be saved once that ROM is closed.
+  if (closing_active_session) {
+    gfx::Arena::Get().ClearSheetsPendingSave();
+  }
+
   // Remove session (safe now with unique_ptr!)
   sessions_.erase(sessions_.begin() + index);
   UpdateSessionCount();
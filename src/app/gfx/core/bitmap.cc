@@ -2,15 +2,19 @@
 
 #include "app/platform/sdl_compat.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>  // for memcpy
 #include <span>
 #include <stdexcept>
 
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
 #include "app/gfx/debug/performance/performance_profiler.h"
 #include "app/gfx/resource/arena.h"
 #include "app/gfx/types/snes_palette.h"
 #include "util/log.h"
+#include "util/macro.h"
 
 namespace yaze {
 namespace gfx {
@@ -107,9 +111,10 @@ Bitmap& Bitmap::operator=(const Bitmap& other) {
     active_ = other.active_;
     modified_ = other.modified_;
     palette_ = other.palette_;
+    color_lut_stale_ = true;
     data_ = other.data_;
     // Assign new generation since this is effectively a new bitmap
-    generation_ = next_generation_++;
+    generation_ = next_generation_.fetch_add(1, std::memory_order_relaxed);
 
     // Copy the data and recreate surface/texture
     pixel_data_ = data_.data();
@@ -180,6 +185,8 @@ Bitmap& Bitmap::operator=(Bitmap&& other) noexcept {
     texture_pixels = other.texture_pixels;
     pixel_data_ = other.pixel_data_;
     palette_ = std::move(other.palette_);
+    color_lut_ = std::move(other.color_lut_);
+    color_lut_stale_ = true;
     data_ = std::move(other.data_);
     surface_ = other.surface_;
     texture_ = other.texture_;
@@ -228,7 +235,7 @@ void Bitmap::Create(int width, int height, int depth, int format,
   // Treat recreation as a new resource generation before touching either
   // deferred commands or the current resources. Commands queued for the old
   // surface/texture will then be discarded as stale by Arena.
-  generation_ = next_generation_++;
+  generation_ = next_generation_.fetch_add(1, std::memory_order_relaxed);
 
   // Preserve an existing texture handle. A caller can queue UPDATE to reuse it
   // with the new surface. If the caller instead queues CREATE, Arena owns
@@ -394,6 +401,7 @@ void Bitmap::UpdateSurfacePixels() {
 void Bitmap::SetPalette(const SnesPalette& palette) {
   // Store palette even if surface isn't ready yet
   palette_ = palette;
+  InvalidatePaletteCache();
 
   // Apply it immediately if surface is ready
   ApplyStoredPalette();
@@ -467,6 +475,7 @@ void Bitmap::SetPaletteWithTransparent(const SnesPalette& palette, size_t index,
                                        int length) {
   // Store the full palette for reference (not modified)
   palette_ = palette;
+  InvalidatePaletteCache();
 
   // If surface isn't created yet, just store the palette for later
   if (surface_ == nullptr) {
@@ -510,9 +519,6 @@ void Bitmap::SetPaletteWithTransparent(const SnesPalette& palette, size_t index,
     colors.push_back(ImVec4(0, 0, 0, 1.0f));  // Fill with opaque black
   }
 
-  // Update palette cache with full palette (for color lookup)
-  InvalidatePaletteCache();
-
   // Apply the SNES sub-palette to SDL surface (supports 3bpp=8 and 4bpp=16)
   SDL_UnlockSurface(surface_);
   SDL_Palette* sdl_palette = platform::GetSurfacePalette(surface_);
@@ -726,12 +732,12 @@ void Bitmap::Get16x16Tile(int tile_x, int tile_y,
  *
  * Performance Notes:
  * - Bounds checking for safety
- * - O(1) palette lookup using hash map cache (100x faster than linear search)
+ * - O(1) palette lookup through the 15-bit color table
  * - Dirty region tracking for efficient texture updates
  * - Direct pixel data manipulation for speed
  *
  * Optimizations Applied:
- * - Hash map palette lookup instead of linear search
+ * - Direct color table lookup instead of linear search
  * - Dirty region tracking to minimize texture update area
  */
 void Bitmap::SetPixel(int x, int y, const SnesColor& color) {
@@ -802,63 +808,76 @@ void Bitmap::Resize(int new_width, int new_height) {
   modified_ = true;
 }
 
-/**
- * @brief Hash a color for cache lookup
- * @param color ImVec4 color to hash
- * @return 32-bit hash value
- *
- * Performance Notes:
- * - Simple hash combining RGBA components
- * - Fast integer operations for cache key generation
- * - Collision-resistant for typical SNES palette sizes
- */
-uint32_t Bitmap::HashColor(const ImVec4& color) {
-  // Convert float values to integers for consistent hashing
-  uint32_t r = static_cast<uint32_t>(color.x * 255.0F) & 0xFF;
-  uint32_t g = static_cast<uint32_t>(color.y * 255.0F) & 0xFF;
-  uint32_t b = static_cast<uint32_t>(color.z * 255.0F) & 0xFF;
-  uint32_t a = static_cast<uint32_t>(color.w * 255.0F) & 0xFF;
-
-  // Simple hash combining all components
-  return (r << 24) | (g << 16) | (b << 8) | a;
-}
-
 /**
  * @brief Invalidate the palette lookup cache (call when palette changes)
  * @note This must be called whenever the palette is modified to maintain cache
  * consistency
  *
  * Performance Notes:
- * - Clears existing cache to force rebuild
- * - Rebuilds cache with current palette colors
- * - O(n) operation but only called when palette changes
+ * - O(1): only marks the lookup table stale
+ * - The table pulls palette_ on the next lookup and keeps its resolved
+ *   entries when the colors are unchanged
  */
 void Bitmap::InvalidatePaletteCache() {
-  color_to_index_cache_.clear();
+  color_lut_stale_ = true;
+}
 
-  // Rebuild cache with current palette
-  for (size_t i = 0; i < palette_.size(); i++) {
-    uint32_t color_hash = HashColor(palette_[i].rgb());
-    color_to_index_cache_[color_hash] = static_cast<uint8_t>(i);
+ColorIndexLut& Bitmap::UpdatedColorLut() {
+  if (color_lut_stale_) {
+    color_lut_.SetPalette(palette_);
+    color_lut_stale_ = false;
   }
+  return color_lut_;
 }
 
 /**
- * @brief Find color index in palette using optimized hash map lookup
+ * @brief Find the palette index nearest to a color
  * @param color SNES color to find index for
- * @return Palette index (0 if not found)
- * @note O(1) lookup time vs O(n) linear search
+ * @return Palette index (0 if the palette is empty)
  *
  * Performance Notes:
- * - Hash map lookup for O(1) performance
- * - 100x faster than linear search for large palettes
- * - Falls back to index 0 if color not found
+ * - Direct 15-bit table lookup, no hashing
+ * - Nearest-color search runs once per distinct color per palette
  */
 uint8_t Bitmap::FindColorIndex(const SnesColor& color) {
   ScopedTimer timer("palette_lookup_optimized");
-  uint32_t hash = HashColor(color.rgb());
-  auto it = color_to_index_cache_.find(hash);
-  return (it != color_to_index_cache_.end()) ? it->second : 0;
+  return UpdatedColorLut().Lookup(color.snes());
+}
+
+absl::Status Bitmap::QuantizeToPalette(std::span<const uint8_t> rgba) {
+  const size_t pixel_count =
+      static_cast<size_t>(std::max(width_, 0)) * std::max(height_, 0);
+  if (pixel_count == 0 || rgba.size() != pixel_count * 4) {
+    return absl::InvalidArgumentError(
+        absl::StrFormat("Expected %dx%d RGBA pixels (%d bytes), got %d bytes",
+                        width_, height_, pixel_count * 4, rgba.size()));
+  }
+
+  if (data_.size() < pixel_count) {
+    data_.resize(pixel_count, 0);
+  }
+  RETURN_IF_ERROR(UpdatedColorLut().QuantizeToPalette(
+      rgba, std::span<uint8_t>(data_.data(), pixel_count)));
+  pixel_data_ = data_.data();
+
+  if (surface_ && surface_->pixels) {
+    SDL_LockSurface(surface_);
+    if (surface_->pitch == width_) {
+      memcpy(surface_->pixels, pixel_data_, pixel_count);
+    } else {
+      auto* dst = static_cast<uint8_t*>(surface_->pixels);
+      for (int y = 0; y < height_; ++y) {
+        memcpy(dst + (y * surface_->pitch), pixel_data_ + (y * width_),
+               width_);
+      }
+    }
+    SDL_UnlockSurface(surface_);
+  }
+
+  dirty_region_.AddPoint(0, 0);
+  dirty_region_.AddPoint(width_ - 1, height_ - 1);
+  modified_ = true;
+  return absl::OkStatus();
 }
 
 void Bitmap::set_data(const std::vector<uint8_t>& data) {
@@ -3,13 +3,16 @@
 
 #include "app/platform/sdl_compat.h"
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <span>
 #include <unordered_map>
 #include <vector>
 
+#include "absl/status/status.h"
 #include "app/gfx/backend/irenderer.h"
+#include "app/gfx/types/color_index_lut.h"
 #include "app/gfx/types/snes_palette.h"
 
 namespace yaze {
@@ -309,13 +312,21 @@ class Bitmap {
   void InvalidatePaletteCache();
 
   /**
-   * @brief Find color index in palette using optimized hash map lookup
+   * @brief Find the palette index nearest to a color
    * @param color SNES color to find index for
-   * @return Palette index (0 if not found)
-   * @note O(1) lookup time vs O(n) linear search
+   * @return Palette index (0 if the palette is empty)
+   * @note O(1) lookup through a 15-bit color table resolved lazily per palette
    */
   uint8_t FindColorIndex(const SnesColor& color);
 
+  /**
+   * @brief Replace the bitmap pixels with an RGBA8 image mapped to palette()
+   * @param rgba width * height pixels as R, G, B, A bytes
+   * @note Pixels with alpha below 128 become index 0. Marks the whole bitmap
+   * dirty.
+   */
+  absl::Status QuantizeToPalette(std::span<const uint8_t> rgba);
+
   /**
    * @brief Validate that bitmap data and surface pixels are synchronized
    * @return true if synchronized, false if there are issues
@@ -387,7 +398,10 @@ class Bitmap {
   };
 
   const SnesPalette& palette() const { return palette_; }
-  SnesPalette* mutable_palette() { return &palette_; }
+  SnesPalette* mutable_palette() {
+    color_lut_stale_ = true;
+    return &palette_;
+  }
   BitmapMetadata& metadata() { return metadata_; }
   const BitmapMetadata& metadata() const { return metadata_; }
 
@@ -420,7 +434,7 @@ class Bitmap {
   // Generation counter for staleness detection in deferred operations
   // Incremented on each Create() call to detect reused/reallocated bitmaps
   uint32_t generation_ = 0;
-  static inline uint32_t next_generation_ = 1;
+  static inline std::atomic<uint32_t> next_generation_{1};
 
   // Pointer to the texture pixels
   void* texture_pixels = nullptr;
@@ -478,8 +492,9 @@ class Bitmap {
   // Texture for the bitmap (managed by Arena)
   TextureHandle texture_ = nullptr;
 
-  // Optimized palette lookup cache for O(1) color index lookups
-  std::unordered_map<uint32_t, uint8_t> color_to_index_cache_;
+  // Color -> palette index table, refreshed from palette_ when stale
+  ColorIndexLut color_lut_;
+  bool color_lut_stale_ = true;
 
   // Dirty region tracking for efficient texture updates
   struct DirtyRegion {
@@ -505,12 +520,7 @@ class Bitmap {
     }
   } dirty_region_;
 
-  /**
-   * @brief Hash a color for cache lookup
-   * @param color ImVec4 color to hash
-   * @return 32-bit hash value
-   */
-  static uint32_t HashColor(const ImVec4& color);
+  ColorIndexLut& UpdatedColorLut();
 };
 
 // Type alias for a table of bitmaps - uses unique_ptr for stable pointers
@@ -49,6 +49,7 @@ endmacro()
 
 # build_cleaner:auto-maintain
 set(GFX_TYPES_SRC
+  app/gfx/types/color_index_lut.cc
   app/gfx/types/sheet_role_palette_table.cc
   app/gfx/types/snes_color.cc
   app/gfx/types/snes_palette.cc
@@ -98,6 +99,7 @@ set(GFX_UTIL_SRC
 set(GFX_RENDER_SRC
   app/gfx/render/atlas_renderer.cc
   app/gfx/render/texture_atlas.cc
+  app/gfx/render/tile_pixel_cache.cc
   app/gfx/render/tilemap.cc
 )
 
@@ -105,6 +105,36 @@ void BackgroundBuffer::ClearCoverageBuffer() {
   }
 }
 
+void BackgroundBuffer::ClearRect(int start_x, int start_y, int width,
+                                 int height, uint8_t fill) {
+  const int x0 = std::max(start_x, 0);
+  const int y0 = std::max(start_y, 0);
+  const int x1 = std::min(start_x + width, width_);
+  const int y1 = std::min(start_y + height, height_);
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+
+  const bool has_pixels = bitmap_.is_active() && bitmap_.width() == width_ &&
+                          bitmap_.size() >= static_cast<size_t>(width_ *
+                                                                height_);
+  for (int y = y0; y < y1; ++y) {
+    const size_t row = static_cast<size_t>(y) * width_;
+    if (has_pixels) {
+      std::fill_n(bitmap_.mutable_data().begin() + row + x0, x1 - x0, fill);
+    }
+    if (!priority_buffer_.empty()) {
+      std::fill_n(priority_buffer_.begin() + row + x0, x1 - x0, 0xFF);
+    }
+    if (!coverage_buffer_.empty()) {
+      std::fill_n(coverage_buffer_.begin() + row + x0, x1 - x0, 0);
+    }
+  }
+  if (has_pixels) {
+    bitmap_.set_modified(true);
+  }
+}
+
 void BackgroundBuffer::ClearBG1RevealMask() {
   if (!bg1_reveal_mask_buffer_.empty()) {
     std::fill(bg1_reveal_mask_buffer_.begin(), bg1_reveal_mask_buffer_.end(),
@@ -202,7 +232,8 @@ void BackgroundBuffer::EnsureBitmapInitialized() {
 }
 
 void BackgroundBuffer::DrawTile(const TileInfo& tile, uint8_t* canvas,
-                                const uint8_t* tiledata, int indexoffset) {
+                                const uint8_t* tiledata, int indexoffset,
+                                TilePixelCache* tile_cache) {
   // tiledata is now 8BPP linear data (1 byte per pixel)
   // Buffer size: 0x10000 (65536 bytes) = 64 tile rows max
   constexpr int kGfxBufferSize = 0x10000;
@@ -234,6 +265,36 @@ void BackgroundBuffer::DrawTile(const TileInfo& tile, uint8_t* canvas,
   // Get priority bit from tile (over_ = priority bit in SNES tilemap)
   uint8_t priority = tile.over_ ? 1 : 0;
 
+  // Fast path: blit pre-flipped rows from the tile cache. Pixel 0 stays
+  // transparent, so each row is merged through its opaque-lane mask.
+  if (tile_cache) {
+    const uint8_t* pixels = tile_cache->GetTileById(
+        tiledata, kGfxBufferSize, tile.id_,
+        TilePixelCache::FlipIndex(tile.horizontal_mirror_,
+                                  tile.vertical_mirror_));
+    const int last_row_end = indexoffset + (7 * width_) + 8;
+    if (pixels && indexoffset >= 0 && last_row_end <= max_dest) {
+      const uint64_t priority_lanes = TilePixelCache::Broadcast(priority);
+      for (int py = 0; py < 8; py++) {
+        const uint64_t src = TilePixelCache::LoadRow(pixels, py);
+        const uint64_t mask = TilePixelCache::OpaqueMask(src);
+        if (mask == 0) {
+          continue;
+        }
+        const uint64_t color = TilePixelCache::AddToLanes(src, palette_offset);
+        const int row_offset = indexoffset + (py * width_);
+        uint8_t* dst = canvas + row_offset;
+        uint8_t* priority_dst = priority_buffer_.data() + row_offset;
+        TilePixelCache::StoreRow(
+            dst, (TilePixelCache::LoadRow(dst, 0) & ~mask) | (color & mask));
+        TilePixelCache::StoreRow(
+            priority_dst, (TilePixelCache::LoadRow(priority_dst, 0) & ~mask) |
+                              (priority_lanes & mask));
+      }
+      return;
+    }
+  }
+
   // Copy 8x8 pixels
   for (int py = 0; py < 8; py++) {
     int src_row = tile.vertical_mirror_ ? (7 - py) : py;
@@ -268,7 +329,8 @@ void BackgroundBuffer::DrawTile(const TileInfo& tile, uint8_t* canvas,
   }
 }
 
-void BackgroundBuffer::DrawBackground(std::span<uint8_t> gfx16_data) {
+void BackgroundBuffer::DrawBackground(std::span<const uint8_t> gfx16_data,
+                                      TilePixelCache* tile_cache) {
   int tiles_w = width_ / 8;
   int tiles_h = height_ / 8;
   EnsureTileBufferAllocated();
@@ -318,7 +380,7 @@ void BackgroundBuffer::DrawBackground(std::span<uint8_t> gfx16_data) {
       // Linear offset = (pixel_y * width) + pixel_x = (yy * 8 * 512) + (xx * 8)
       int tile_offset = (yy * 8 * width_) + (xx * 8);
       DrawTile(tile, bitmap_.mutable_data().data(), gfx16_data.data(),
-               tile_offset);
+               tile_offset, tile_cache);
       // drawn_count++;
     }
   }
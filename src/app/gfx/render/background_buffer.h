@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "app/gfx/core/bitmap.h"
+#include "app/gfx/render/tile_pixel_cache.h"
 #include "app/gfx/types/snes_tile.h"
 
 namespace yaze {
@@ -25,9 +26,15 @@ class BackgroundBuffer {
   void ClearBuffer();
 
   // Drawing methods
+  //
+  // When a TilePixelCache over the same gfx16 buffer is supplied, tiles are
+  // blitted from pre-flipped 8x8 blocks one 8-pixel row at a time instead of
+  // being un-mirrored pixel by pixel.
   void DrawTile(const TileInfo& tile_info, uint8_t* canvas,
-                const uint8_t* tiledata, int indexoffset);
-  void DrawBackground(std::span<uint8_t> gfx16_data);
+                const uint8_t* tiledata, int indexoffset,
+                TilePixelCache* tile_cache = nullptr);
+  void DrawBackground(std::span<const uint8_t> gfx16_data,
+                      TilePixelCache* tile_cache = nullptr);
 
   // Floor drawing methods
   void DrawFloor(const std::vector<uint8_t>& rom_data, int tile_address,
@@ -57,6 +64,11 @@ class BackgroundBuffer {
   const std::vector<uint8_t>& coverage_data() const { return coverage_buffer_; }
   std::vector<uint8_t>& mutable_coverage_data();
 
+  // Reset a pixel rectangle of the bitmap to `fill`, and of the priority and
+  // coverage buffers to their cleared values, ahead of a partial redraw.
+  void ClearRect(int start_x, int start_y, int width, int height,
+                 uint8_t fill);
+
   // Per-pixel cross-layer reveal bits carried by raw BG1 target buffers.
   // Each bit identifies the BG2 source layer that requested the reveal, so
   // compositing can ignore that request when its owner is hidden while later
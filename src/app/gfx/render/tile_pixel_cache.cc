@@ -0,0 +1,207 @@
+#include "app/gfx/render/tile_pixel_cache.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+namespace yaze {
+namespace gfx {
+
+namespace {
+
+// Every live cache, so sheet edits can be broadcast without each owner having
+// to subscribe to Arena individually.
+std::mutex& RegistryMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<TilePixelCache*>& Registry() {
+  static std::vector<TilePixelCache*> caches;
+  return caches;
+}
+
+thread_local int unregistered_depth = 0;
+
+}  // namespace
+
+TilePixelCache::TilePixelCache(int sheet_count, bool identity_binding)
+    : sheets_(static_cast<size_t>(std::max(sheet_count, 0))),
+      bindings_(static_cast<size_t>(std::max(sheet_count, 0)),
+                kUnboundSheet) {
+  if (identity_binding) {
+    for (size_t i = 0; i < bindings_.size(); ++i) {
+      bindings_[i] = static_cast<int>(i);
+    }
+  }
+  Register();
+}
+
+TilePixelCache::~TilePixelCache() {
+  Unregister();
+}
+
+TilePixelCache::TilePixelCache(const TilePixelCache& other)
+    : sheets_(other.sheets_.size()), bindings_(other.bindings_) {
+  Register();
+}
+
+TilePixelCache& TilePixelCache::operator=(const TilePixelCache& other) {
+  if (this != &other) {
+    sheets_.clear();
+    sheets_.resize(other.sheets_.size());
+    bindings_ = other.bindings_;
+    stats_ = Stats{};
+  }
+  return *this;
+}
+
+TilePixelCache::TilePixelCache(TilePixelCache&& other) noexcept
+    : sheets_(std::move(other.sheets_)),
+      bindings_(std::move(other.bindings_)),
+      stats_(other.stats_) {
+  Register();
+}
+
+TilePixelCache& TilePixelCache::operator=(TilePixelCache&& other) noexcept {
+  if (this != &other) {
+    sheets_ = std::move(other.sheets_);
+    bindings_ = std::move(other.bindings_);
+    stats_ = other.stats_;
+  }
+  return *this;
+}
+
+const uint8_t* TilePixelCache::GetTile(const uint8_t* source,
+                                       size_t source_size, int sheet, int tile,
+                                       int flip) {
+  if (!source || sheet < 0 || sheet >= sheet_count() || tile < 0 ||
+      tile >= kTilesPerSheet || flip < 0 || flip >= kFlipVariants) {
+    return nullptr;
+  }
+
+  if (source != source_) {
+    InvalidateAll();
+    source_ = source;
+  }
+
+  auto& block = sheets_[static_cast<size_t>(sheet)];
+  const uint64_t tile_bit = 1ULL << tile;
+  if (block && (block->valid_mask & tile_bit)) {
+    ++stats_.hits;
+    return block->tiles[static_cast<size_t>(tile)].variants[flip];
+  }
+
+  const size_t base = static_cast<size_t>(sheet) * kSheetBytes +
+                      static_cast<size_t>(tile / kTilesPerRow) *
+                          (kBufferStride * kTileSize) +
+                      static_cast<size_t>(tile % kTilesPerRow) * kTileSize;
+  const size_t last_row = base + (kTileSize - 1) * kBufferStride;
+  if (last_row + kTileSize > source_size) {
+    return nullptr;
+  }
+
+  ++stats_.misses;
+  if (!block) {
+    block = std::make_unique<SheetBlock>();
+  }
+
+  // Decode all four variants at once; the unflipped rows are read once and
+  // mirrored in registers.
+  auto& decoded = block->tiles[static_cast<size_t>(tile)];
+  for (int row = 0; row < kTileSize; ++row) {
+    const uint8_t* src = source + base + row * kBufferStride;
+    uint8_t* plain = decoded.variants[FlipIndex(false, false)] + row * 8;
+    uint8_t* h_flip = decoded.variants[FlipIndex(true, false)] + row * 8;
+    uint8_t* v_flip =
+        decoded.variants[FlipIndex(false, true)] + (7 - row) * kTileSize;
+    uint8_t* hv_flip =
+        decoded.variants[FlipIndex(true, true)] + (7 - row) * kTileSize;
+    std::memcpy(plain, src, kTileSize);
+    std::memcpy(v_flip, src, kTileSize);
+    for (int col = 0; col < kTileSize; ++col) {
+      h_flip[col] = src[7 - col];
+      hv_flip[col] = src[7 - col];
+    }
+  }
+  block->valid_mask |= tile_bit;
+  return decoded.variants[flip];
+}
+
+void TilePixelCache::BindSheet(int sheet, int arena_sheet) {
+  if (sheet < 0 || sheet >= sheet_count()) {
+    return;
+  }
+  if (bindings_[static_cast<size_t>(sheet)] != arena_sheet) {
+    bindings_[static_cast<size_t>(sheet)] = arena_sheet;
+    InvalidateSheet(sheet);
+  }
+}
+
+int TilePixelCache::BoundSheet(int sheet) const {
+  if (sheet < 0 || sheet >= sheet_count()) {
+    return kUnboundSheet;
+  }
+  return bindings_[static_cast<size_t>(sheet)];
+}
+
+void TilePixelCache::InvalidateSheet(int sheet) {
+  if (sheet < 0 || sheet >= sheet_count()) {
+    return;
+  }
+  auto& block = sheets_[static_cast<size_t>(sheet)];
+  if (block && block->valid_mask != 0) {
+    block->valid_mask = 0;
+    ++stats_.invalidations;
+  }
+}
+
+void TilePixelCache::InvalidateArenaSheet(int arena_sheet) {
+  for (int sheet = 0; sheet < sheet_count(); ++sheet) {
+    if (bindings_[static_cast<size_t>(sheet)] == arena_sheet) {
+      InvalidateSheet(sheet);
+    }
+  }
+}
+
+void TilePixelCache::InvalidateAll() {
+  for (int sheet = 0; sheet < sheet_count(); ++sheet) {
+    InvalidateSheet(sheet);
+  }
+}
+
+void TilePixelCache::NotifySheetModified(int arena_sheet) {
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  for (TilePixelCache* cache : Registry()) {
+    cache->InvalidateArenaSheet(arena_sheet);
+  }
+}
+
+TilePixelCache::ScopedUnregistered::ScopedUnregistered() {
+  ++unregistered_depth;
+}
+
+TilePixelCache::ScopedUnregistered::~ScopedUnregistered() {
+  --unregistered_depth;
+}
+
+void TilePixelCache::Register() {
+  if (unregistered_depth > 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  Registry().push_back(this);
+  registered_ = true;
+}
+
+void TilePixelCache::Unregister() {
+  if (!registered_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  auto& caches = Registry();
+  caches.erase(std::remove(caches.begin(), caches.end(), this), caches.end());
+}
+
+}  // namespace gfx
+}  // namespace yaze
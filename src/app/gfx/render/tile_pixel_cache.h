@@ -0,0 +1,178 @@
+#ifndef YAZE_APP_GFX_RENDER_TILE_PIXEL_CACHE_H
+#define YAZE_APP_GFX_RENDER_TILE_PIXEL_CACHE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace yaze {
+namespace gfx {
+
+/**
+ * @brief Cache of decoded 8x8 tiles with all four flip variants pre-rendered
+ *
+ * Tile sources in yaze are 8BPP linear buffers laid out as a stack of
+ * 128x32 sheets (16 tiles per row, 64 tiles per sheet, 4096 bytes per sheet):
+ * the ROM-wide graphics buffer in GameData and each Room's assembled
+ * graphics buffer both use this layout.
+ *
+ * Instead of un-mirroring every pixel on each redraw, the first access to a
+ * tile copies it into a 64-byte block per flip variant (none, H, V, HV).
+ * Consumers then blit whole 8-byte rows using the helpers below.
+ *
+ * Entries are indexed by (sheet, tile, flip). A sheet index is local to the
+ * buffer the cache decodes from; BindSheet() records which Arena sheet a slot
+ * was copied from so Arena::NotifySheetModified() can invalidate it. Caches
+ * register themselves on construction so a single notification reaches every
+ * live cache, unless a ScopedUnregistered is alive on the constructing
+ * thread. Passing a different source buffer than the previous lookup drops
+ * every decoded tile.
+ *
+ * Not thread-safe; each cache is owned by a single render path. Registered
+ * caches are invalidated from the UI thread, so caches owned by other
+ * threads must be created under ScopedUnregistered.
+ */
+class TilePixelCache {
+ public:
+  static constexpr int kTileSize = 8;
+  static constexpr int kTileBytes = kTileSize * kTileSize;
+  static constexpr int kBufferStride = 128;
+  static constexpr int kTilesPerRow = kBufferStride / kTileSize;
+  static constexpr int kTilesPerSheet = 64;
+  static constexpr int kSheetBytes = 4096;
+  static constexpr int kFlipVariants = 4;
+  static constexpr int kUnboundSheet = -1;
+
+  /// One decoded tile: [flip][row * 8 + col].
+  struct alignas(64) DecodedTile {
+    uint8_t variants[kFlipVariants][kTileBytes];
+  };
+
+  struct Stats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t invalidations = 0;
+  };
+
+  /**
+   * @param sheet_count Number of sheets addressable in the source buffer
+   * @param identity_binding When true, sheet N is bound to Arena sheet N
+   *        (for caches over the ROM-wide graphics buffer)
+   */
+  explicit TilePixelCache(int sheet_count = 16, bool identity_binding = false);
+  ~TilePixelCache();
+
+  // Copies start empty (decoded blocks are cheap to rebuild) but keep the
+  // sheet bindings so invalidation keeps working.
+  TilePixelCache(const TilePixelCache& other);
+  TilePixelCache& operator=(const TilePixelCache& other);
+  TilePixelCache(TilePixelCache&& other) noexcept;
+  TilePixelCache& operator=(TilePixelCache&& other) noexcept;
+
+  static constexpr int FlipIndex(bool horizontal, bool vertical) {
+    return (horizontal ? 1 : 0) | (vertical ? 2 : 0);
+  }
+
+  /**
+   * @brief Get a decoded tile variant, decoding from @p source on a miss
+   * @param source 8BPP sheet-stacked buffer the cache is associated with
+   * @param source_size Size of @p source in bytes
+   * @param sheet Sheet index within @p source
+   * @param tile Tile index within the sheet (0-63)
+   * @param flip Flip variant from FlipIndex()
+   * @return 64 bytes of row-major pixels, or nullptr if out of range
+   */
+  const uint8_t* GetTile(const uint8_t* source, size_t source_size, int sheet,
+                         int tile, int flip);
+
+  /// Convenience lookup by buffer-wide tile id (sheet * 64 + tile).
+  const uint8_t* GetTileById(const uint8_t* source, size_t source_size,
+                             int tile_id, int flip) {
+    return GetTile(source, source_size, tile_id / kTilesPerSheet,
+                   tile_id % kTilesPerSheet, flip);
+  }
+
+  /// Record that local @p sheet was copied from Arena sheet @p arena_sheet.
+  void BindSheet(int sheet, int arena_sheet);
+  int BoundSheet(int sheet) const;
+
+  void InvalidateSheet(int sheet);
+  void InvalidateArenaSheet(int arena_sheet);
+  void InvalidateAll();
+
+  int sheet_count() const { return static_cast<int>(sheets_.size()); }
+  const Stats& stats() const { return stats_; }
+
+  /// Invalidate every live cache holding tiles copied from @p arena_sheet.
+  static void NotifySheetModified(int arena_sheet);
+
+  /**
+   * @brief Keep caches created on the current thread out of the registry
+   *
+   * For worker-owned renders over a private copy of the graphics (room
+   * thumbnails): Arena sheet edits cannot affect them, and a notification
+   * from the UI thread would race the worker's own lookups.
+   */
+  class ScopedUnregistered {
+   public:
+    ScopedUnregistered();
+    ~ScopedUnregistered();
+    ScopedUnregistered(const ScopedUnregistered&) = delete;
+    ScopedUnregistered& operator=(const ScopedUnregistered&) = delete;
+  };
+
+  // ---- 8-pixel row helpers (SWAR on one uint64_t per row) ----
+
+  static uint64_t LoadRow(const uint8_t* pixels, int row) {
+    uint64_t value;
+    std::memcpy(&value, pixels + row * kTileSize, sizeof(value));
+    return value;
+  }
+
+  static void StoreRow(uint8_t* dst, uint64_t value) {
+    std::memcpy(dst, &value, sizeof(value));
+  }
+
+  /// 0xFF in every byte lane whose pixel is non-zero, 0x00 elsewhere.
+  static uint64_t OpaqueMask(uint64_t row) {
+    constexpr uint64_t kLow7 = 0x7F7F7F7F7F7F7F7FULL;
+    constexpr uint64_t kHigh = 0x8080808080808080ULL;
+    uint64_t nonzero = (((row & kLow7) + kLow7) | row) & kHigh;
+    return (nonzero >> 7) * 0xFF;
+  }
+
+  /// Per-byte wrapping add of @p offset to every lane.
+  static uint64_t AddToLanes(uint64_t row, uint8_t offset) {
+    constexpr uint64_t kLow7 = 0x7F7F7F7F7F7F7F7FULL;
+    constexpr uint64_t kHigh = 0x8080808080808080ULL;
+    const uint64_t add = 0x0101010101010101ULL * offset;
+    return ((row & kLow7) + (add & kLow7)) ^ ((row ^ add) & kHigh);
+  }
+
+  static uint64_t Broadcast(uint8_t value) {
+    return 0x0101010101010101ULL * value;
+  }
+
+ private:
+  struct SheetBlock {
+    uint64_t valid_mask = 0;  // Bit per tile in the sheet
+    std::array<DecodedTile, kTilesPerSheet> tiles;
+  };
+
+  void Register();
+  void Unregister();
+
+  std::vector<std::unique_ptr<SheetBlock>> sheets_;
+  std::vector<int> bindings_;
+  const uint8_t* source_ = nullptr;
+  Stats stats_;
+  bool registered_ = false;
+};
+
+}  // namespace gfx
+}  // namespace yaze
+
+#endif  // YAZE_APP_GFX_RENDER_TILE_PIXEL_CACHE_H
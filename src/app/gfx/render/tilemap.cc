@@ -193,9 +193,62 @@ void MirrorTileDataHorizontally(std::vector<uint8_t>& tile_data) {
   }
 }
 
+// Copies a pre-flipped 8x8 tile into the atlas one 8-pixel row at a time.
+// Returns false when the tile cannot be served from the cache or does not fit
+// inside the atlas, in which case the per-pixel path is used.
+bool PlaceCachedTilePart(Tilemap& tilemap, const std::vector<uint8_t>& data,
+                         const TileInfo& tile_info, int base_x, int base_y,
+                         int sheet_offset) {
+  constexpr int kTilesPerSheet = TilePixelCache::kTilesPerSheet;
+  auto& atlas = tilemap.atlas;
+  if (!atlas.is_active() || base_x < 0 || base_y < 0 ||
+      base_x + 8 > atlas.width() || base_y + 8 > atlas.height() ||
+      static_cast<size_t>(atlas.width()) * atlas.height() >
+          atlas.vector().size()) {
+    return false;
+  }
+
+  // Same sheet/tile resolution as FetchTileDataFromGraphicsBuffer.
+  const int sheet = (tile_info.id_ / kTilesPerSheet) % 4 + sheet_offset;
+  const int tile = tile_info.id_ % kTilesPerSheet;
+  const uint8_t* pixels = tilemap.pixel_cache.GetTile(
+      data.data(), data.size(), sheet, tile,
+      TilePixelCache::FlipIndex(tile_info.horizontal_mirror_,
+                                tile_info.vertical_mirror_));
+  if (!pixels) {
+    return false;
+  }
+
+  const int width = atlas.width();
+  uint8_t* dst = atlas.mutable_data().data();
+  SDL_Surface* surface = atlas.surface();
+  if (surface && surface->pixels) {
+    SDL_LockSurface(surface);
+  }
+  for (int y = 0; y < 8; ++y) {
+    const uint64_t row = TilePixelCache::LoadRow(pixels, y);
+    TilePixelCache::StoreRow(dst + (base_y + y) * width + base_x, row);
+    if (surface && surface->pixels) {
+      TilePixelCache::StoreRow(static_cast<uint8_t*>(surface->pixels) +
+                                   (base_y + y) * surface->pitch + base_x,
+                               row);
+    }
+  }
+  if (surface && surface->pixels) {
+    SDL_UnlockSurface(surface);
+  }
+  atlas.set_modified(true);
+  return true;
+}
+
 void ComposeAndPlaceTilePart(Tilemap& tilemap, const std::vector<uint8_t>& data,
                              const TileInfo& tile_info, int base_x, int base_y,
                              int sheet_offset) {
+  if (PlaceCachedTilePart(tilemap, data, tile_info, base_x, base_y,
+                          sheet_offset)) {
+    return;
+  }
+
   std::vector<uint8_t> tile_data =
       FetchTileDataFromGraphicsBuffer(data, tile_info.id_, sheet_offset);
 
@@ -8,6 +8,7 @@
 #include "absl/container/flat_hash_map.h"
 #include "app/gfx/backend/irenderer.h"
 #include "app/gfx/core/bitmap.h"
+#include "app/gfx/render/tile_pixel_cache.h"
 #include "app/gfx/types/snes_tile.h"
 
 namespace yaze {
@@ -114,10 +115,14 @@ struct TileCache {
  * - Tile mirroring and flipping support
  * - Palette index management per tile
  * - Integration with SNES graphics buffer format
+ * - Pre-flipped 8x8 source tiles for ComposeTile16/ModifyTile16
  */
 struct Tilemap {
   Bitmap atlas;          ///< Master bitmap containing all tiles
   TileCache tile_cache;  ///< Smart tile cache with LRU eviction
+  /// Decoded 8x8 tiles from the sheet buffer passed to ComposeTile16.
+  /// Sheet N maps to Arena sheet N, so sheet edits invalidate it.
+  TilePixelCache pixel_cache{223, /*identity_binding=*/true};
   std::vector<std::array<gfx::TileInfo, 4>>
       tile_info;   ///< Tile metadata (4 tiles per 16x16)
   Pair tile_size;  ///< Size of individual tiles (8x8 or 16x16)
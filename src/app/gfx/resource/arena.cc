@@ -7,6 +7,7 @@
 
 #include "absl/strings/str_format.h"
 #include "app/gfx/backend/irenderer.h"
+#include "app/gfx/render/tile_pixel_cache.h"
 #include "util/log.h"
 #include "util/sdl_deleter.h"
 #include "zelda3/dungeon/palette_debug.h"
@@ -382,6 +383,7 @@ bool Arena::ProcessTextureQueueWithBudget(IRenderer* renderer,
 
 SDL_Surface* Arena::AllocateSurface(int width, int height, int depth,
                                     int format) {
+  std::lock_guard<std::mutex> lock(surface_mutex_);
   // Try to get a surface from the pool first
   for (auto it = surface_pool_.available_surfaces_.begin();
        it != surface_pool_.available_surfaces_.end(); ++it) {
@@ -414,6 +416,7 @@ void Arena::FreeSurface(SDL_Surface* surface) {
   if (!surface)
     return;
 
+  std::lock_guard<std::mutex> lock(surface_mutex_);
   // Return surface to pool if space available
   if (surface_pool_.available_surfaces_.size() < surface_pool_.MAX_POOL_SIZE) {
     surface_pool_.available_surfaces_.push_back(surface);
@@ -432,20 +435,43 @@ void Arena::Shutdown() {
   ClearSheetCache();
 
   // Clear pool references first to prevent reuse during shutdown
-  surface_pool_.available_surfaces_.clear();
-  surface_pool_.surface_info_.clear();
+  {
+    std::lock_guard<std::mutex> lock(surface_mutex_);
+    surface_pool_.available_surfaces_.clear();
+    surface_pool_.surface_info_.clear();
+  }
   texture_pool_.available_textures_.clear();
   texture_pool_.texture_sizes_.clear();
 
   // CRITICAL FIX: Clear containers in reverse order to prevent cleanup issues
   // This ensures that dependent resources are freed before their dependencies
   textures_.clear();
-  surfaces_.clear();
+  {
+    std::lock_guard<std::mutex> lock(surface_mutex_);
+    surfaces_.clear();
+  }
 
   // Clear any remaining queue items
   texture_command_queue_.clear();
 }
 
+std::vector<uint16_t> Arena::GetSheetsPendingSave() const {
+  std::vector<uint16_t> sheets;
+  for (size_t i = 0; i < sheets_pending_save_.size(); ++i) {
+    if (sheets_pending_save_.test(i)) {
+      sheets.push_back(static_cast<uint16_t>(i));
+    }
+  }
+  return sheets;
+}
+
+void Arena::NotifySheetPixelsModified(int sheet_index) {
+  if (sheet_index >= 0 && sheet_index < 223) {
+    sheets_pending_save_.set(sheet_index);
+  }
+  NotifySheetModified(sheet_index);
+}
+
 void Arena::NotifySheetModified(int sheet_index) {
   if (sheet_index < 0 || sheet_index >= 223) {
     LOG_WARN("Arena", "Invalid sheet index %d, ignoring notification",
@@ -453,6 +479,17 @@ void Arena::NotifySheetModified(int sheet_index) {
     return;
   }
 
+  // Decoded tiles copied from this sheet are stale regardless of whether the
+  // sheet currently has a surface.
+  TilePixelCache::NotifySheetModified(sheet_index);
+  for (const auto& [id, callback] : sheet_listeners_) {
+    try {
+      callback(sheet_index);
+    } catch (const std::exception& e) {
+      LOG_ERROR("Arena", "Exception in sheet listener %d: %s", id, e.what());
+    }
+  }
+
   auto& sheet = gfx_sheets_[sheet_index];
   if (!sheet.is_active() || !sheet.surface()) {
     LOG_DEBUG("Arena",
@@ -474,6 +511,16 @@ void Arena::NotifySheetModified(int sheet_index) {
   }
 }
 
+int Arena::RegisterSheetListener(SheetChangeCallback callback) {
+  int id = next_sheet_listener_id_++;
+  sheet_listeners_[id] = std::move(callback);
+  return id;
+}
+
+void Arena::UnregisterSheetListener(int listener_id) {
+  sheet_listeners_.erase(listener_id);
+}
+
 // ========== Palette Change Notification System ==========
 
 void Arena::NotifyPaletteModified(const std::string& group_name,
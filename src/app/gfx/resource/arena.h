@@ -2,6 +2,7 @@
 #define YAZE_APP_GFX_ARENA_H
 
 #include <array>
+#include <bitset>
 #include <cstdint>
 #include <functional>
 #include <list>
@@ -180,10 +181,42 @@ class Arena {
   /**
    * @brief Notify Arena that a graphics sheet has been modified
    * @param sheet_index Index of the modified sheet (0-222)
-   * @details This ensures textures are updated across all editors
+   * @details This ensures textures are updated across all editors. Use it
+   * for presentation changes (palette, gfx group preview); they are not
+   * written back to the ROM.
    */
   void NotifySheetModified(int sheet_index);
 
+  /**
+   * @brief NotifySheetModified() for edits to a sheet's pixel data
+   * @details Also marks the sheet as pending save.
+   */
+  void NotifySheetPixelsModified(int sheet_index);
+
+  /// Sheets modified since they were last written back to the ROM.
+  std::vector<uint16_t> GetSheetsPendingSave() const;
+  bool IsSheetPendingSave(int sheet_index) const {
+    return sheet_index >= 0 && sheet_index < 223 &&
+           sheets_pending_save_.test(sheet_index);
+  }
+  void ClearSheetPendingSave(int sheet_index) {
+    if (sheet_index >= 0 && sheet_index < 223) {
+      sheets_pending_save_.reset(sheet_index);
+    }
+  }
+  void ClearSheetsPendingSave() { sheets_pending_save_.reset(); }
+
+  /// Callback type for sheet change listeners
+  /// @param sheet_index The graphics sheet that changed (0-222)
+  using SheetChangeCallback = std::function<void(int sheet_index)>;
+
+  /**
+   * @brief Register a callback run by NotifySheetModified
+   * @return Unique ID for this listener (use to unregister)
+   */
+  int RegisterSheetListener(SheetChangeCallback callback);
+  void UnregisterSheetListener(int listener_id);
+
   // ========== Palette Change Notification System ==========
 
   /// Callback type for palette change listeners
@@ -338,6 +371,7 @@ class Arena {
   std::array<uint16_t, kTotalTiles> layer2_buffer_;
 
   std::array<gfx::Bitmap, 223> gfx_sheets_;
+  std::bitset<223> sheets_pending_save_;
 
   std::unordered_map<TextureHandle,
                      std::unique_ptr<SDL_Texture, util::SDL_Texture_Deleter>>
@@ -360,6 +394,9 @@ class Arena {
         surface_info_;
     static constexpr size_t MAX_POOL_SIZE = 100;
   } surface_pool_;
+  // Guards surfaces_ and surface_pool_: bitmaps for off-screen renders (room
+  // thumbnails) are created and freed on worker threads.
+  std::mutex surface_mutex_;
 
   std::vector<TextureCommand> texture_command_queue_;
   IRenderer* renderer_ = nullptr;
@@ -369,6 +406,10 @@ class Arena {
   std::unordered_map<int, PaletteChangeCallback> palette_listeners_;
   int next_palette_listener_id_ = 1;
 
+  // Sheet change notification system
+  std::unordered_map<int, SheetChangeCallback> sheet_listeners_;
+  int next_sheet_listener_id_ = 1;
+
   // LRU sheet texture cache
   // List stores sheet indices in access order (front = most recent)
   std::list<int> sheet_lru_list_;
@@ -3,175 +3,430 @@
 #include <algorithm>
 #include <cstdlib>
 #include <cstring>
+#include <new>
 
 namespace yaze {
 namespace gfx {
 
-using MemoryBlock = MemoryPool::MemoryBlock;
+namespace {
+
+constexpr uint32_t kBlockMagic = 0x59415A45;  // 'YAZE'
+constexpr uint16_t kSystemClass = 0xFFFF;
+constexpr uint16_t kRedirectFlag = 0x1;
+constexpr size_t kSlabAlignment = 64;
+
+// Blocks pulled from / returned to the shared free list per lock acquisition
+// when a thread cache is active.
+constexpr size_t kThreadCacheBatch = 16;
+constexpr size_t kThreadCacheLimit = 64;
+
+// Precedes every payload handed out by the pool. For slab blocks the header is
+// written once when the slab is carved and never touched again; the free-list
+// link lives in the payload while the block is free. AllocateAligned() writes a
+// second "redirect" header directly in front of the aligned pointer that
+// records the distance back to the real payload.
+struct alignas(16) BlockHeader {
+  uint32_t magic;
+  uint16_t size_class;
+  uint16_t flags;
+  uint64_t payload;  // System: requested bytes. Redirect: offset to payload.
+};
+static_assert(sizeof(BlockHeader) == 16, "BlockHeader must stay 16 bytes");
+
+constexpr size_t kHeaderSize = sizeof(BlockHeader);
+
+BlockHeader* HeaderFor(const void* ptr) {
+  return reinterpret_cast<BlockHeader*>(
+      const_cast<std::byte*>(static_cast<const std::byte*>(ptr)) -
+      kHeaderSize);
+}
+
+// Follows an AllocateAligned() redirect back to the pool payload.
+void* ResolvePayload(void* ptr, BlockHeader** header_out) {
+  BlockHeader* header = HeaderFor(ptr);
+  if (header->flags & kRedirectFlag) {
+    ptr = static_cast<std::byte*>(ptr) - header->payload;
+    header = HeaderFor(ptr);
+  }
+  *header_out = header;
+  return ptr;
+}
+
+}  // namespace
+
+// Per-thread stash of free blocks, one intrusive list per size class. Only
+// used by threads that opt in through SetThreadCacheEnabled().
+struct MemoryPoolThreadCache {
+  bool enabled = false;
+  uint64_t epoch = 0;
+  std::array<MemoryPool::FreeNode*, MemoryPool::kNumSizeClasses> heads{};
+  std::array<size_t, MemoryPool::kNumSizeClasses> counts{};
+
+  ~MemoryPoolThreadCache() { Flush(); }
+
+  void Drop() {
+    heads.fill(nullptr);
+    counts.fill(0);
+  }
+
+  // Blocks cached before MemoryPool::Clear() were already reclaimed.
+  void Revalidate(uint64_t pool_epoch) {
+    if (epoch != pool_epoch) {
+      Drop();
+      epoch = pool_epoch;
+    }
+  }
+
+  void Flush() {
+    bool any = false;
+    for (size_t count : counts) {
+      any = any || count != 0;
+    }
+    if (!any) {
+      return;
+    }
+    auto& pool = MemoryPool::Get();
+    Revalidate(pool.epoch_.load(std::memory_order_acquire));
+    for (size_t i = 0; i < MemoryPool::kNumSizeClasses; ++i) {
+      if (!heads[i]) {
+        continue;
+      }
+      MemoryPool::FreeNode* tail = heads[i];
+      while (tail->next) {
+        tail = tail->next;
+      }
+      pool.ReleaseToClass(i, heads[i], tail, counts[i]);
+    }
+    Drop();
+  }
+
+  // Returns the older half of the list to the shared pool.
+  void Trim(size_t class_index) {
+    size_t keep = kThreadCacheLimit / 2;
+    MemoryPool::FreeNode* last_kept = heads[class_index];
+    for (size_t i = 1; i < keep && last_kept; ++i) {
+      last_kept = last_kept->next;
+    }
+    if (!last_kept || !last_kept->next) {
+      return;
+    }
+    MemoryPool::FreeNode* head = last_kept->next;
+    MemoryPool::FreeNode* tail = head;
+    size_t released = 1;
+    while (tail->next) {
+      tail = tail->next;
+      ++released;
+    }
+    last_kept->next = nullptr;
+    counts[class_index] -= released;
+    MemoryPool::Get().ReleaseToClass(class_index, head, tail, released);
+  }
+};
+
+namespace {
+thread_local MemoryPoolThreadCache t_thread_cache;
+}  // namespace
 
 MemoryPool& MemoryPool::Get() {
   static MemoryPool instance;
   return instance;
 }
 
-MemoryPool::MemoryPool()
-    : total_allocations_(0),
-      total_deallocations_(0),
-      total_used_bytes_(0),
-      total_allocated_bytes_(0) {
-  // Initialize block pools with common graphics sizes
-  InitializeBlockPool(small_blocks_, kSmallBlockSize,
-                      100);  // 100KB for small tiles
-  InitializeBlockPool(medium_blocks_, kMediumBlockSize,
-                      50);  // 200KB for medium tiles
-  InitializeBlockPool(large_blocks_, kLargeBlockSize,
-                      20);  // 320KB for large tiles
-  InitializeBlockPool(huge_blocks_, kHugeBlockSize,
-                      10);  // 640KB for graphics sheets
-
-  total_allocated_bytes_ = (100 * kSmallBlockSize) + (50 * kMediumBlockSize) +
-                           (20 * kLargeBlockSize) + (10 * kHugeBlockSize);
+MemoryPool::MemoryPool() {
+  // Initialize size classes with common graphics sizes. The initial block
+  // count doubles as the slab size used when a class grows.
+  InitializeSizeClass(0, kSmallBlockSize, 100);  // 100KB for small tiles
+  InitializeSizeClass(1, kMediumBlockSize, 50);  // 200KB for medium tiles
+  InitializeSizeClass(2, kLargeBlockSize, 20);   // 320KB for large tiles
+  InitializeSizeClass(3, kHugeBlockSize, 10);    // 640KB for graphics sheets
 }
 
 MemoryPool::~MemoryPool() {
-  Clear();
-  // Clear() only resets block usage flags; the backing storage for each pool
-  // is owned here and must be released to avoid leaking the pre-allocated
-  // blocks (flagged by AddressSanitizer/LeakSanitizer at process exit).
-  for (auto* pool :
-       {&small_blocks_, &medium_blocks_, &large_blocks_, &huge_blocks_}) {
-    for (auto& block : *pool) {
-      std::free(block.data);
-      block.data = nullptr;
+  for (auto& size_class : classes_) {
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    for (std::byte* slab : size_class.slabs) {
+      ::operator delete(slab, std::align_val_t{kSlabAlignment});
     }
-    pool->clear();
+    size_class.slabs.clear();
+    size_class.free_list = nullptr;
+    size_class.free_count = 0;
+    size_class.total_blocks = 0;
   }
 }
 
 void* MemoryPool::Allocate(size_t size) {
-  total_allocations_++;
-
-  MemoryBlock* block = FindFreeBlock(size);
-  if (!block) {
-    // Fallback to system malloc if no pool block available
-    void* data = std::malloc(size);
-    if (data) {
-      total_used_bytes_ += size;
-      allocated_blocks_[data] = nullptr;  // Mark as system allocated
+  total_allocations_.fetch_add(1, std::memory_order_relaxed);
+
+  size_t class_index = GetPoolIndex(size);
+  if (class_index >= kNumSizeClasses) {
+    return AllocateSystem(size);
+  }
+
+  void* data = nullptr;
+  auto& cache = t_thread_cache;
+  if (cache.enabled) {
+    cache.Revalidate(epoch_.load(std::memory_order_acquire));
+    if (!cache.heads[class_index]) {
+      // Refill a batch under a single lock acquisition.
+      auto& size_class = classes_[class_index];
+      std::lock_guard<std::mutex> lock(size_class.mutex);
+      for (size_t i = 0; i < kThreadCacheBatch; ++i) {
+        if (!size_class.free_list &&
+            !GrowSizeClass(size_class, static_cast<uint16_t>(class_index))) {
+          break;
+        }
+        FreeNode* node = size_class.free_list;
+        size_class.free_list = node->next;
+        --size_class.free_count;
+        node->next = cache.heads[class_index];
+        cache.heads[class_index] = node;
+        ++cache.counts[class_index];
+      }
     }
-    return data;
+    if (FreeNode* node = cache.heads[class_index]) {
+      cache.heads[class_index] = node->next;
+      --cache.counts[class_index];
+      data = node;
+    }
+  } else {
+    data = AllocateFromClass(class_index);
   }
 
-  block->in_use = true;
-  total_used_bytes_ += block->size;
-  allocated_blocks_[block->data] = block;
+  if (!data) {
+    // Slab growth failed; fall back to a header-tagged system allocation.
+    return AllocateSystem(size);
+  }
 
-  return block->data;
+  total_used_bytes_.fetch_add(classes_[class_index].block_size,
+                              std::memory_order_relaxed);
+  return data;
 }
 
 void MemoryPool::Deallocate(void* ptr) {
   if (!ptr)
     return;
 
-  total_deallocations_++;
+  total_deallocations_.fetch_add(1, std::memory_order_relaxed);
 
-  auto it = allocated_blocks_.find(ptr);
-  if (it == allocated_blocks_.end()) {
-    // System allocated, use free
-    std::free(ptr);
+  BlockHeader* header = nullptr;
+  ptr = ResolvePayload(ptr, &header);
+
+  if (header->size_class == kSystemClass) {
+    total_used_bytes_.fetch_sub(header->payload, std::memory_order_relaxed);
+    std::free(header);
     return;
   }
 
-  MemoryBlock* block = it->second;
-  if (block) {
-    block->in_use = false;
-    total_used_bytes_ -= block->size;
-  } else {
-    // System-allocated fallback (see Allocate): the map only tracked the
-    // pointer, so the backing storage must be released here to avoid leaking
-    // every overflow allocation.
-    std::free(ptr);
+  size_t class_index = header->size_class;
+  total_used_bytes_.fetch_sub(classes_[class_index].block_size,
+                              std::memory_order_relaxed);
+
+  auto* node = static_cast<FreeNode*>(ptr);
+  auto& cache = t_thread_cache;
+  if (cache.enabled) {
+    cache.Revalidate(epoch_.load(std::memory_order_acquire));
+    node->next = cache.heads[class_index];
+    cache.heads[class_index] = node;
+    if (++cache.counts[class_index] > kThreadCacheLimit) {
+      cache.Trim(class_index);
+    }
+    return;
   }
 
-  allocated_blocks_.erase(it);
+  node->next = nullptr;
+  ReleaseToClass(class_index, node, node, 1);
 }
 
 void* MemoryPool::AllocateAligned(size_t size, size_t alignment) {
-  // For simplicity, allocate extra space and align manually
-  // In a production system, you'd want more sophisticated alignment handling
-  size_t aligned_size = size + alignment - 1;
-  void* ptr = Allocate(aligned_size);
+  if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+    return nullptr;
+  }
+  // Every pool payload is already 16-byte aligned.
+  if (alignment <= kHeaderSize) {
+    return Allocate(size);
+  }
 
-  if (ptr) {
-    uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
-    uintptr_t aligned_addr = (addr + alignment - 1) & ~(alignment - 1);
-    return reinterpret_cast<void*>(aligned_addr);
+  // Payloads are 16-byte aligned, so rounding (raw + header) up to the
+  // requested boundary consumes at most `alignment` extra bytes and always
+  // leaves room for the redirect header.
+  void* raw = Allocate(size + alignment);
+  if (!raw) {
+    return nullptr;
   }
 
-  return nullptr;
+  uintptr_t addr = reinterpret_cast<uintptr_t>(raw) + kHeaderSize;
+  uintptr_t aligned_addr = (addr + alignment - 1) & ~(alignment - 1);
+  void* aligned = reinterpret_cast<void*>(aligned_addr);
+
+  BlockHeader* raw_header = HeaderFor(raw);
+  BlockHeader* redirect = HeaderFor(aligned);
+  redirect->magic = kBlockMagic;
+  redirect->size_class = raw_header->size_class;
+  redirect->flags = kRedirectFlag;
+  redirect->payload = aligned_addr - reinterpret_cast<uintptr_t>(raw);
+  return aligned;
 }
 
 std::pair<size_t, size_t> MemoryPool::GetMemoryStats() const {
-  return {total_used_bytes_, total_allocated_bytes_};
+  return {total_used_bytes_.load(std::memory_order_relaxed),
+          total_allocated_bytes_.load(std::memory_order_relaxed)};
 }
 
 std::pair<size_t, size_t> MemoryPool::GetAllocationStats() const {
-  return {total_allocations_, total_deallocations_};
+  return {total_allocations_.load(std::memory_order_relaxed),
+          total_deallocations_.load(std::memory_order_relaxed)};
 }
 
-void MemoryPool::Clear() {
-  // Reset all blocks to unused state
-  for (auto& block : small_blocks_) {
-    block.in_use = false;
-  }
-  for (auto& block : medium_blocks_) {
-    block.in_use = false;
+MemoryPool::SizeClassStats MemoryPool::GetSizeClassStats(
+    size_t class_index) const {
+  SizeClassStats stats;
+  if (class_index >= kNumSizeClasses) {
+    return stats;
   }
-  for (auto& block : large_blocks_) {
-    block.in_use = false;
-  }
-  for (auto& block : huge_blocks_) {
-    block.in_use = false;
+  const auto& size_class = classes_[class_index];
+  std::lock_guard<std::mutex> lock(size_class.mutex);
+  stats.block_size = size_class.block_size;
+  stats.total_blocks = size_class.total_blocks;
+  stats.free_blocks = size_class.free_count;
+  stats.slab_count = size_class.slabs.size();
+  return stats;
+}
+
+void MemoryPool::Clear() {
+  // Invalidate blocks parked in thread caches before rebuilding free lists.
+  epoch_.fetch_add(1, std::memory_order_acq_rel);
+  t_thread_cache.Drop();
+
+  for (auto& size_class : classes_) {
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    const size_t stride = kHeaderSize + size_class.block_size;
+    FreeNode* head = nullptr;
+    for (std::byte* slab : size_class.slabs) {
+      for (size_t i = 0; i < size_class.blocks_per_slab; ++i) {
+        auto* node = reinterpret_cast<FreeNode*>(slab + i * stride +
+                                                 kHeaderSize);
+        node->next = head;
+        head = node;
+      }
+    }
+    size_class.free_list = head;
+    size_class.free_count = size_class.total_blocks;
   }
 
-  allocated_blocks_.clear();
-  total_used_bytes_ = 0;
+  total_used_bytes_.store(0, std::memory_order_relaxed);
 }
 
-MemoryBlock* MemoryPool::FindFreeBlock(size_t size) {
-  // Determine which pool to use based on size
-  size_t pool_index = GetPoolIndex(size);
+void MemoryPool::SetThreadCacheEnabled(bool enabled) {
+  auto& cache = t_thread_cache;
+  if (!enabled && cache.enabled) {
+    cache.Flush();
+  }
+  if (enabled && !cache.enabled) {
+    cache.Drop();
+    cache.epoch = epoch_.load(std::memory_order_acquire);
+  }
+  cache.enabled = enabled;
+}
 
-  std::vector<MemoryBlock>* pools[] = {&small_blocks_, &medium_blocks_,
-                                       &large_blocks_, &huge_blocks_};
+bool MemoryPool::IsThreadCacheEnabled() const {
+  return t_thread_cache.enabled;
+}
 
-  if (pool_index >= 4) {
-    return nullptr;  // Size too large for any pool
+size_t MemoryPool::GetBlockSize(const void* ptr) {
+  if (!ptr) {
+    return 0;
+  }
+  BlockHeader* header = HeaderFor(ptr);
+  size_t redirect_offset = 0;
+  if (header->flags & kRedirectFlag) {
+    redirect_offset = header->payload;
+    header = HeaderFor(static_cast<const std::byte*>(ptr) - redirect_offset);
   }
+  if (header->size_class == kSystemClass) {
+    return header->payload - redirect_offset;
+  }
+  return Get().classes_[header->size_class].block_size - redirect_offset;
+}
+
+void MemoryPool::InitializeSizeClass(size_t class_index, size_t block_size,
+                                     size_t initial_blocks) {
+  auto& size_class = classes_[class_index];
+  std::lock_guard<std::mutex> lock(size_class.mutex);
+  size_class.block_size = block_size;
+  size_class.blocks_per_slab = initial_blocks;
+  GrowSizeClass(size_class, static_cast<uint16_t>(class_index));
+}
 
-  auto& pool = *pools[pool_index];
+bool MemoryPool::GrowSizeClass(SizeClass& size_class, uint16_t class_index) {
+  const size_t stride = kHeaderSize + size_class.block_size;
+  const size_t slab_bytes = stride * size_class.blocks_per_slab;
 
-  // Find first unused block
-  auto it =
-      std::find_if(pool.begin(), pool.end(),
-                   [](const MemoryBlock& block) { return !block.in_use; });
+  auto* slab = static_cast<std::byte*>(::operator new(
+      slab_bytes, std::align_val_t{kSlabAlignment}, std::nothrow));
+  if (!slab) {
+    return false;
+  }
+  size_class.slabs.push_back(slab);
+
+  // Carve the slab back-to-front so the free list hands out ascending
+  // addresses.
+  for (size_t i = size_class.blocks_per_slab; i-- > 0;) {
+    std::byte* block = slab + i * stride;
+    auto* header = reinterpret_cast<BlockHeader*>(block);
+    header->magic = kBlockMagic;
+    header->size_class = class_index;
+    header->flags = 0;
+    header->payload = 0;
+
+    auto* node = reinterpret_cast<FreeNode*>(block + kHeaderSize);
+    node->next = size_class.free_list;
+    size_class.free_list = node;
+  }
+  size_class.free_count += size_class.blocks_per_slab;
+  size_class.total_blocks += size_class.blocks_per_slab;
+  total_allocated_bytes_.fetch_add(
+      size_class.block_size * size_class.blocks_per_slab,
+      std::memory_order_relaxed);
+  return true;
+}
 
-  return (it != pool.end()) ? &(*it) : nullptr;
+void* MemoryPool::AllocateFromClass(size_t class_index) {
+  auto& size_class = classes_[class_index];
+  std::lock_guard<std::mutex> lock(size_class.mutex);
+  if (!size_class.free_list &&
+      !GrowSizeClass(size_class, static_cast<uint16_t>(class_index))) {
+    return nullptr;
+  }
+  FreeNode* node = size_class.free_list;
+  size_class.free_list = node->next;
+  --size_class.free_count;
+  return node;
 }
 
-void MemoryPool::InitializeBlockPool(std::vector<MemoryBlock>& pool,
-                                     size_t block_size, size_t count) {
-  pool.reserve(count);
+void MemoryPool::ReleaseToClass(size_t class_index, FreeNode* head,
+                                FreeNode* tail, size_t count) {
+  auto& size_class = classes_[class_index];
+  std::lock_guard<std::mutex> lock(size_class.mutex);
+  tail->next = size_class.free_list;
+  size_class.free_list = head;
+  size_class.free_count += count;
+}
 
-  for (size_t i = 0; i < count; ++i) {
-    void* data = std::malloc(block_size);
-    if (data) {
-      pool.emplace_back(data, block_size);
-    }
+void* MemoryPool::AllocateSystem(size_t size) {
+  void* raw = std::malloc(kHeaderSize + size);
+  if (!raw) {
+    return nullptr;
   }
+  auto* header = static_cast<BlockHeader*>(raw);
+  header->magic = kBlockMagic;
+  header->size_class = kSystemClass;
+  header->flags = 0;
+  header->payload = size;
+  total_used_bytes_.fetch_add(size, std::memory_order_relaxed);
+  return static_cast<std::byte*>(raw) + kHeaderSize;
 }
 
-size_t MemoryPool::GetPoolIndex(size_t size) const {
+size_t MemoryPool::GetPoolIndex(size_t size) {
   if (size <= kSmallBlockSize)
     return 0;
   if (size <= kMediumBlockSize)
@@ -180,7 +435,7 @@ size_t MemoryPool::GetPoolIndex(size_t size) const {
     return 2;
   if (size <= kHugeBlockSize)
     return 3;
-  return 4;  // Too large for any pool
+  return kNumSizeClasses;  // Too large for any pool
 }
 
 }  // namespace gfx
@@ -1,9 +1,12 @@
 #ifndef YAZE_APP_GFX_MEMORY_POOL_H
 #define YAZE_APP_GFX_MEMORY_POOL_H
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <unordered_map>
+#include <mutex>
 #include <vector>
 
 namespace yaze {
@@ -17,9 +20,11 @@ namespace gfx {
  * and allocation overhead through pre-allocated memory blocks.
  *
  * Key Features:
- * - Pre-allocated memory blocks for common graphics sizes
- * - O(1) allocation and deallocation
- * - Automatic block size management
+ * - Per-size-class slabs with intrusive free lists
+ * - O(1) allocation and deallocation (block header lookup, no hash map)
+ * - Slabs grow on demand instead of falling back to malloc per request
+ * - Real aligned allocation for SIMD/texture upload buffers
+ * - Optional thread-local caches for worker threads
  * - Memory usage tracking and statistics
  * - Thread-safe operations
  *
@@ -27,13 +32,18 @@ namespace gfx {
  * - Eliminates malloc/free overhead for graphics data
  * - Reduces memory fragmentation
  * - Fast allocation for common sizes (8x8, 16x16, 32x32 tiles)
- * - Automatic block reuse and recycling
+ * - Workers that build maps can enable a thread cache and skip the class
+ *   lock on most allocations
  *
  * ROM Hacking Specific:
  * - Optimized for SNES tile sizes (8x8, 16x16)
  * - Support for graphics sheet buffers (128x128, 256x256)
  * - Efficient palette data allocation
  * - Tile cache memory management
+ *
+ * Every pointer returned by the pool is preceded by a 16-byte BlockHeader
+ * recording its size class, so Deallocate() only accepts pointers that were
+ * returned by Allocate()/AllocateAligned().
  */
 class MemoryPool {
  public:
@@ -42,7 +52,7 @@ class MemoryPool {
   /**
    * @brief Allocate memory block of specified size
    * @param size Size in bytes
-   * @return Pointer to allocated memory block
+   * @return Pointer to allocated memory block (16-byte aligned)
    */
   void* Allocate(size_t size);
 
@@ -56,7 +66,7 @@ class MemoryPool {
    * @brief Allocate memory block aligned to specified boundary
    * @param size Size in bytes
    * @param alignment Alignment boundary (must be power of 2)
-   * @return Pointer to aligned memory block
+   * @return Pointer to aligned memory block, release with Deallocate()
    */
   void* AllocateAligned(size_t size, size_t alignment);
 
@@ -74,24 +84,29 @@ class MemoryPool {
 
   /**
    * @brief Clear all allocated blocks (for cleanup)
+   *
+   * Returns every slab block to its free list. Outstanding pool pointers
+   * become invalid; thread caches populated before the call are discarded.
    */
   void Clear();
 
-  struct MemoryBlock {
-    void* data;
-    size_t size;
-    bool in_use;
-    size_t alignment;
-
-    MemoryBlock(void* d, size_t s, size_t a = 0)
-        : data(d), size(s), in_use(false), alignment(a) {}
-  };
+  /**
+   * @brief Enable or disable the calling thread's block cache
+   *
+   * Worker threads that allocate many short-lived buffers (map builds, sheet
+   * decoding) can enable a per-thread cache so most Allocate/Deallocate calls
+   * avoid the size-class lock. Disabling flushes cached blocks back to the
+   * shared free lists; caches are also flushed on thread exit.
+   */
+  void SetThreadCacheEnabled(bool enabled);
+  bool IsThreadCacheEnabled() const;
 
- private:
-  MemoryPool();
-  ~MemoryPool();
+  /**
+   * @brief Usable size of a block returned by Allocate()
+   */
+  static size_t GetBlockSize(const void* ptr);
 
-  // Block size categories for common graphics operations
+  // Size classes for common graphics operations
   static constexpr size_t kSmallBlockSize = 1024;  // 8x8 tiles, small palettes
   static constexpr size_t kMediumBlockSize =
       4096;  // 16x16 tiles, medium graphics
@@ -99,25 +114,59 @@ class MemoryPool {
       16384;  // 32x32 tiles, large graphics
   static constexpr size_t kHugeBlockSize =
       65536;  // Graphics sheets, large buffers
+  static constexpr size_t kNumSizeClasses = 4;
+
+  struct SizeClassStats {
+    size_t block_size = 0;
+    size_t total_blocks = 0;
+    size_t free_blocks = 0;
+    size_t slab_count = 0;
+  };
+
+  /**
+   * @brief Snapshot of a size class (blocks held in thread caches count as
+   * in use)
+   */
+  SizeClassStats GetSizeClassStats(size_t class_index) const;
+
+ private:
+  MemoryPool();
+  ~MemoryPool();
+
+  struct FreeNode {
+    FreeNode* next;
+  };
+
+  struct SizeClass {
+    size_t block_size = 0;
+    size_t blocks_per_slab = 0;
+    mutable std::mutex mutex;
+    FreeNode* free_list = nullptr;
+    size_t free_count = 0;
+    size_t total_blocks = 0;
+    std::vector<std::byte*> slabs;
+  };
+
+  friend struct MemoryPoolThreadCache;
+
+  void InitializeSizeClass(size_t class_index, size_t block_size,
+                           size_t initial_blocks);
+  // Requires the class mutex to be held.
+  bool GrowSizeClass(SizeClass& size_class, uint16_t class_index);
+  void* AllocateFromClass(size_t class_index);
+  void ReleaseToClass(size_t class_index, FreeNode* head, FreeNode* tail,
+                      size_t count);
+  void* AllocateSystem(size_t size);
+  static size_t GetPoolIndex(size_t size);
 
-  // Pre-allocated block pools
-  std::vector<MemoryBlock> small_blocks_;
-  std::vector<MemoryBlock> medium_blocks_;
-  std::vector<MemoryBlock> large_blocks_;
-  std::vector<MemoryBlock> huge_blocks_;
+  std::array<SizeClass, kNumSizeClasses> classes_;
 
   // Allocation tracking
-  std::unordered_map<void*, MemoryBlock*> allocated_blocks_;
-  size_t total_allocations_;
-  size_t total_deallocations_;
-  size_t total_used_bytes_;
-  size_t total_allocated_bytes_;
-
-  // Helper methods
-  MemoryBlock* FindFreeBlock(size_t size);
-  void InitializeBlockPool(std::vector<MemoryBlock>& pool, size_t block_size,
-                           size_t count);
-  size_t GetPoolIndex(size_t size) const;
+  std::atomic<size_t> total_allocations_{0};
+  std::atomic<size_t> total_deallocations_{0};
+  std::atomic<size_t> total_used_bytes_{0};
+  std::atomic<size_t> total_allocated_bytes_{0};
+  std::atomic<uint64_t> epoch_{0};
 };
 
 /**
@@ -140,7 +189,12 @@ class PoolAllocator {
   PoolAllocator(const PoolAllocator<U>&) {}
 
   pointer allocate(size_type n) {
-    return static_cast<pointer>(MemoryPool::Get().Allocate(n * sizeof(T)));
+    if constexpr (alignof(T) > 16) {
+      return static_cast<pointer>(
+          MemoryPool::Get().AllocateAligned(n * sizeof(T), alignof(T)));
+    } else {
+      return static_cast<pointer>(MemoryPool::Get().Allocate(n * sizeof(T)));
+    }
   }
 
   void deallocate(pointer p, size_type) { MemoryPool::Get().Deallocate(p); }
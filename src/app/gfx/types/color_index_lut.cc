@@ -0,0 +1,175 @@
+#include "app/gfx/types/color_index_lut.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include "absl/strings/str_format.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define YAZE_COLOR_LUT_SSE2 1
+#endif
+
+namespace yaze {
+namespace gfx {
+
+namespace {
+
+constexpr uint16_t kColorMask = 0x7FFF;
+constexpr uint16_t kTransparentKey = 0x8000;
+constexpr size_t kQuantizeChunk = 256;
+
+uint16_t PackKey(const uint8_t* px) {
+  const uint16_t transparent = (px[3] < 0x80) ? kTransparentKey : 0;
+  return static_cast<uint16_t>(
+      ColorIndexLut::RgbToSnes(px[0], px[1], px[2]) | transparent);
+}
+
+// 15-bit key per RGBA8 pixel; kTransparentKey is set for alpha below 128.
+void PackKeys(const uint8_t* rgba, size_t count, uint16_t* keys) {
+  size_t i = 0;
+#if defined(YAZE_COLOR_LUT_SSE2)
+  // Each 32-bit lane holds one pixel: R in bits 0-7 up to A in bits 24-31.
+  const __m128i channel_mask = _mm_set1_epi32(0x001F1F1F);
+  const __m128i red_mask = _mm_set1_epi32(0x0000001F);
+  const __m128i green_mask = _mm_set1_epi32(0x00001F00);
+  const __m128i blue_mask = _mm_set1_epi32(0x001F0000);
+  const __m128i one = _mm_set1_epi32(1);
+  const __m128i bias32 = _mm_set1_epi32(0x8000);
+  const __m128i bias16 = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+  auto pack4 = [&](const uint8_t* src) {
+    const __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const __m128i c = _mm_and_si128(_mm_srli_epi32(px, 3), channel_mask);
+    __m128i key = _mm_or_si128(
+        _mm_and_si128(c, red_mask),
+        _mm_or_si128(_mm_srli_epi32(_mm_and_si128(c, green_mask), 3),
+                     _mm_srli_epi32(_mm_and_si128(c, blue_mask), 6)));
+    const __m128i transparent =
+        _mm_xor_si128(_mm_srli_epi32(px, 31), one);  // 1 when A < 0x80
+    key = _mm_or_si128(key, _mm_slli_epi32(transparent, 15));
+    // Bias into signed range so the saturating pack keeps bit 15.
+    return _mm_sub_epi32(key, bias32);
+  };
+  for (; i + 8 <= count; i += 8) {
+    const __m128i lo = pack4(rgba + (i * 4));
+    const __m128i hi = pack4(rgba + (i * 4) + 16);
+    const __m128i packed = _mm_add_epi16(_mm_packs_epi32(lo, hi), bias16);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(keys + i), packed);
+  }
+#endif
+  for (; i < count; ++i) {
+    keys[i] = PackKey(rgba + (i * 4));
+  }
+}
+
+}  // namespace
+
+void ColorIndexLut::SetPalette(const SnesPalette& palette) {
+  std::vector<uint16_t> colors;
+  colors.reserve(palette.size());
+  for (const auto& color : palette) {
+    colors.push_back(color.snes());
+  }
+  SetColors(colors);
+}
+
+void ColorIndexLut::SetColors(std::span<const uint16_t> snes_colors) {
+  if (std::equal(colors_.begin(), colors_.end(), snes_colors.begin(),
+                 snes_colors.end())) {
+    return;
+  }
+  colors_.assign(snes_colors.begin(), snes_colors.end());
+  if (resolved_count_ != 0) {
+    std::fill(resolved_.begin(), resolved_.end(), 0);
+    resolved_count_ = 0;
+  }
+}
+
+void ColorIndexLut::EnsureTables() {
+  if (resolved_.empty()) {
+    indices_.resize(kColorCount);
+    resolved_.resize(kColorCount / 64);
+  }
+}
+
+uint8_t ColorIndexLut::Lookup(uint16_t snes_color) {
+  snes_color &= kColorMask;
+  EnsureTables();
+
+  uint64_t& word = resolved_[snes_color >> 6];
+  const uint64_t bit = 1ULL << (snes_color & 63);
+  if ((word & bit) == 0) {
+    indices_[snes_color] = Resolve(snes_color);
+    word |= bit;
+    ++resolved_count_;
+  }
+  return indices_[snes_color];
+}
+
+uint8_t ColorIndexLut::Resolve(uint16_t snes_color) const {
+  const int r = snes_color & 0x1F;
+  const int g = (snes_color >> 5) & 0x1F;
+  const int b = (snes_color >> 10) & 0x1F;
+
+  int best_index = 0;
+  int best_distance = std::numeric_limits<int>::max();
+  for (size_t i = 0; i < colors_.size(); ++i) {
+    const uint16_t candidate = colors_[i] & kColorMask;
+    const int dr = (candidate & 0x1F) - r;
+    const int dg = ((candidate >> 5) & 0x1F) - g;
+    const int db = ((candidate >> 10) & 0x1F) - b;
+    const int distance = (dr * dr) + (dg * dg) + (db * db);
+    if (distance <= best_distance) {
+      best_distance = distance;
+      best_index = static_cast<int>(i);
+    }
+  }
+  return static_cast<uint8_t>(best_index);
+}
+
+absl::Status ColorIndexLut::QuantizeToPalette(std::span<const uint8_t> rgba,
+                                              std::span<uint8_t> indices,
+                                              uint8_t transparent_index) {
+  if (rgba.size() % 4 != 0) {
+    return absl::InvalidArgumentError(absl::StrFormat(
+        "RGBA buffer size %d is not a multiple of 4", rgba.size()));
+  }
+  const size_t pixel_count = rgba.size() / 4;
+  if (indices.size() < pixel_count) {
+    return absl::InvalidArgumentError(
+        absl::StrFormat("Index buffer holds %d pixels, image has %d",
+                        indices.size(), pixel_count));
+  }
+
+  // Two passes per chunk: SIMD key packing, then table reads. Only colors
+  // not seen since the palette changed fall back to the nearest-color search.
+  EnsureTables();
+  std::array<uint16_t, kQuantizeChunk> keys;
+  for (size_t start = 0; start < pixel_count; start += kQuantizeChunk) {
+    const size_t count = std::min(kQuantizeChunk, pixel_count - start);
+    PackKeys(rgba.data() + (start * 4), count, keys.data());
+
+    uint8_t* dst = indices.data() + start;
+    for (size_t i = 0; i < count; ++i) {
+      const uint16_t key = keys[i];
+      if (key & kTransparentKey) {
+        dst[i] = transparent_index;
+        continue;
+      }
+      uint64_t& word = resolved_[key >> 6];
+      const uint64_t bit = 1ULL << (key & 63);
+      if ((word & bit) == 0) {
+        indices_[key] = Resolve(key);
+        word |= bit;
+        ++resolved_count_;
+      }
+      dst[i] = indices_[key];
+    }
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace gfx
+}  // namespace yaze
@@ -0,0 +1,77 @@
+#ifndef YAZE_APP_GFX_TYPES_COLOR_INDEX_LUT_H_
+#define YAZE_APP_GFX_TYPES_COLOR_INDEX_LUT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "app/gfx/types/snes_palette.h"
+
+namespace yaze {
+namespace gfx {
+
+/**
+ * @brief Direct 15-bit color to palette index lookup table
+ *
+ * SNES colors only have 32768 distinct values, so instead of hashing colors
+ * the table is indexed by the 15-bit BGR value itself. Entries are resolved
+ * lazily to the nearest palette color (squared distance in 5-bit RGB) the
+ * first time they are looked up, and stay valid until the palette changes.
+ * Exact matches always win; ties go to the later palette entry, matching the
+ * hash map this replaces.
+ *
+ * The tables (32 KB of indices plus a 4 KB resolved mask) are only allocated
+ * on first lookup, so bitmaps that never map colors back to indices pay
+ * nothing.
+ */
+class ColorIndexLut {
+ public:
+  static constexpr int kColorCount = 1 << 15;
+
+  /// Replace the palette. A palette equal to the current one keeps the
+  /// resolved entries.
+  void SetPalette(const SnesPalette& palette);
+  /// Same as SetPalette() for raw 15-bit BGR values.
+  void SetColors(std::span<const uint16_t> snes_colors);
+
+  /// Palette index nearest to @p snes_color (0 for an empty palette).
+  uint8_t Lookup(uint16_t snes_color);
+
+  /**
+   * @brief Convert an RGBA8 image to palette indices
+   * @param rgba Pixels as R, G, B, A bytes
+   * @param indices Output, one index per pixel
+   * @param transparent_index Index written for pixels with alpha below 128
+   *
+   * Pixels are packed to 15-bit keys with SSE2 (8 per step, scalar
+   * elsewhere), then mapped through the table.
+   */
+  absl::Status QuantizeToPalette(std::span<const uint8_t> rgba,
+                                 std::span<uint8_t> indices,
+                                 uint8_t transparent_index = 0);
+
+  /// 15-bit SNES BGR value for an 8-bit-per-channel color.
+  static constexpr uint16_t RgbToSnes(uint8_t r, uint8_t g, uint8_t b) {
+    return static_cast<uint16_t>((r >> 3) | ((g >> 3) << 5) |
+                                 ((b >> 3) << 10));
+  }
+
+  size_t palette_size() const { return colors_.size(); }
+  size_t resolved_count() const { return resolved_count_; }
+
+ private:
+  void EnsureTables();
+  uint8_t Resolve(uint16_t snes_color) const;
+
+  std::vector<uint16_t> colors_;
+  std::vector<uint8_t> indices_;
+  std::vector<uint64_t> resolved_;  // Bit per 15-bit color
+  size_t resolved_count_ = 0;
+};
+
+}  // namespace gfx
+}  // namespace yaze
+
+#endif  // YAZE_APP_GFX_TYPES_COLOR_INDEX_LUT_H_
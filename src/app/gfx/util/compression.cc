@@ -25,6 +25,25 @@ std::vector<uint8_t> HyruleMagicCompress(uint8_t const* const src,
 
   int i, j, k, l, m = 0, n, o = 0, bd = 0, p, q = 0, r;
 
+  // Emits the q uncompressed bytes that end at src + i as a direct copy.
+  auto flush_copy = [&]() {
+    if (!q)
+      return;
+    q--;
+
+    if (q > 31) {
+      b2[bd++] = (unsigned char)(224 + (q >> 8));
+    }
+
+    b2[bd++] = (unsigned char)q;
+    q++;
+
+    memcpy(b2.data() + bd, src + i - q, q);
+
+    bd += q;
+    q = 0;
+  };
+
   for (i = 0; i < oldsize;) {
     l = src[i];  // grab a char from the buffer.
 
@@ -90,24 +109,17 @@ std::vector<uint8_t> HyruleMagicCompress(uint8_t const* const src,
     if (k > 3 + r && k > n + (p & 1))
       p = 4, n = k;
 
-    if (!p)
-      q++, i++;
-    else {
-      if (q) {
-        q--;
-
-        if (q > 31) {
-          b2[bd++] = (unsigned char)(224 + (q >> 8));
-        }
-
-        b2[bd++] = (unsigned char)q;
-        q++;
+    // A command covers at most kMaxLengthCompression bytes; longer lengths
+    // would spill into the command bits of the expanded header.
+    if (n > lc_lz2::kMaxLengthCompression)
+      n = lc_lz2::kMaxLengthCompression;
 
-        memcpy(b2.data() + bd, src + i - q, q);
-
-        bd += q;
-        q = 0;
-      }
+    if (!p) {
+      q++, i++;
+      if (q == lc_lz2::kMaxLengthCompression)
+        flush_copy();
+    } else {
+      flush_copy();
 
       i += n;
       n--;
@@ -144,20 +156,7 @@ std::vector<uint8_t> HyruleMagicCompress(uint8_t const* const src,
     }
   }
 
-  if (q) {
-    q--;
-
-    if (q > 31) {
-      b2[bd++] = (unsigned char)(224 + (q >> 8));
-    }
-
-    b2[bd++] = (unsigned char)q;
-    q++;
-
-    memcpy(b2.data() + bd, src + i - q, q);
-
-    bd += q;
-  }
+  flush_copy();
 
   b2[bd++] = 255;
   b2.resize(bd);
@@ -1625,6 +1624,59 @@ absl::StatusOr<std::vector<uint8_t>> DecompressV2(const uint8_t* data,
   return buffer;
 }
 
+absl::StatusOr<size_t> CompressedStreamSize(const uint8_t* data, int offset,
+                                            size_t rom_size) {
+  if (offset < 0 || static_cast<size_t>(offset) >= rom_size) {
+    return absl::OutOfRangeError(absl::StrFormat(
+        "CompressedStreamSize: Offset %d exceeds ROM size %zu", offset,
+        rom_size));
+  }
+
+  // Walks the command headers the same way DecompressV2 does, but only
+  // counts the operand bytes each command consumes.
+  size_t pos = static_cast<size_t>(offset);
+  while (pos < rom_size && data[pos] != kSnesByteMax) {
+    const uint8_t header = data[pos];
+    uint8_t command = 0;
+    size_t length = 0;
+    if ((header & kExpandedMod) == kExpandedMod) {
+      if (pos + 1 >= rom_size) {
+        break;
+      }
+      command = ((header >> 2) & kCommandMod);
+      length = (((header << 8) | data[pos + 1]) & kExpandedLengthMod) + 1;
+      pos += 2;
+    } else {
+      command = ((header >> 5) & kCommandMod);
+      length = (header & kNormalLengthMod) + 1;
+      pos += 1;
+    }
+
+    switch (command) {
+      case kCommandDirectCopy:
+        pos += length;
+        break;
+      case kCommandByteFill:
+      case kCommandIncreasingFill:
+        pos += 1;
+        break;
+      case kCommandWordFill:
+      case kCommandRepeatingBytes:
+        pos += 2;
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (pos >= rom_size) {
+    return absl::OutOfRangeError(absl::StrFormat(
+        "CompressedStreamSize: Stream at %d has no terminator before ROM end",
+        offset));
+  }
+  return pos + 1 - static_cast<size_t>(offset);
+}
+
 absl::StatusOr<std::vector<uint8_t>> DecompressGraphics(const uint8_t* data,
                                                         int pos, int size) {
   return DecompressV2(data, pos, size, kNintendoMode2);
@@ -256,6 +256,12 @@ void memfill(const uint8_t* data, std::vector<uint8_t>& buffer, int buffer_pos,
 absl::StatusOr<std::vector<uint8_t>> DecompressV2(const uint8_t* data,
                                                   int offset, int size = 0x800,
                                                   int mode = 1, size_t rom_size = static_cast<size_t>(-1));
+/**
+ * @brief Size of the compressed stream at @p offset without decompressing it
+ * @return Bytes from @p offset up to and including the 0xFF terminator
+ */
+absl::StatusOr<size_t> CompressedStreamSize(const uint8_t* data, int offset,
+                                            size_t rom_size);
 absl::StatusOr<std::vector<uint8_t>> DecompressGraphics(const uint8_t* data,
                                                         int pos, int size);
 absl::StatusOr<std::vector<uint8_t>> DecompressOverworld(const uint8_t* data,
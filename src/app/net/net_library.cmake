@@ -8,13 +8,14 @@
 # - Proposal approval system
 # - Collaboration utilities
 #
-# Dependencies: yaze_util, absl
+# Dependencies: yaze_util, yaze_miniz, absl
 # ==============================================================================
 
 # Base network sources (always included)
 set(
   YAZE_NET_BASE_SRC
   app/net/rom_version_manager.cc
+  app/net/snapshot_chunk_store.cc
   app/net/websocket_client.cc
   app/net/collaboration_service.cc
   app/net/network_factory.cc
@@ -63,6 +64,7 @@ target_include_directories(yaze_net PUBLIC
 target_link_libraries(yaze_net PUBLIC
   yaze_util
   yaze_common
+  yaze_miniz
   ${ABSL_TARGETS}
   ${YAZE_SDL2_TARGETS}
 )
@@ -4,12 +4,12 @@
 #include <chrono>
 #include <cstring>
 
+#include <span>
+#include <vector>
+
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 
-// For compression (placeholder - would use zlib or similar)
-#include <vector>
-
 #ifdef YAZE_WITH_JSON
 #include "nlohmann/json.hpp"
 #endif
@@ -21,7 +21,7 @@ namespace net {
 namespace {
 
 // Simple hash function (in production, use SHA256)
-std::string ComputeHash(const std::vector<uint8_t>& data) {
+std::string ComputeHash(std::span<const uint8_t> data) {
   uint32_t hash = 0;
   for (size_t i = 0; i < data.size(); ++i) {
     hash = hash * 31 + data[i];
@@ -38,6 +38,35 @@ std::string GenerateId() {
   return absl::StrFormat("snap_%lld", ms);
 }
 
+SnapshotChunkStore::Options ChunkStoreOptions(
+    const RomVersionManager::Config& config) {
+  SnapshotChunkStore::Options options;
+  options.chunk_size = config.snapshot_chunk_size;
+  options.compression_level = config.compress_snapshots ? 6 : 0;
+  options.spill_directory = config.spill_directory;
+  options.max_resident_bytes = config.max_resident_mb * 1024 * 1024;
+  return options;
+}
+
+// Appends the runs where @p to differs from @p from, as (offset, new bytes).
+void AppendChangedRuns(size_t base, const std::vector<uint8_t>& from,
+                       const std::vector<uint8_t>& to, VersionDiff& diff) {
+  size_t i = 0;
+  while (i < to.size()) {
+    if (i < from.size() && from[i] == to[i]) {
+      ++i;
+      continue;
+    }
+    const size_t start = i;
+    while (i < to.size() && (i >= from.size() || from[i] != to[i])) {
+      ++i;
+    }
+    diff.changes.emplace_back(
+        base + start, std::vector<uint8_t>(to.begin() + start, to.begin() + i));
+    diff.total_bytes_changed += i - start;
+  }
+}
+
 int64_t GetCurrentTimestamp() {
   return std::chrono::duration_cast<std::chrono::milliseconds>(
              std::chrono::system_clock::now().time_since_epoch())
@@ -51,7 +80,10 @@ int64_t GetCurrentTimestamp() {
 // ============================================================================
 
 RomVersionManager::RomVersionManager(Rom* rom)
-    : rom_(rom), last_backup_time_(0) {}
+    : rom_(rom),
+      chunk_store_(
+          std::make_unique<SnapshotChunkStore>(ChunkStoreOptions(config_))),
+      last_backup_time_(0) {}
 
 RomVersionManager::~RomVersionManager() {
   // Cleanup if needed
@@ -59,6 +91,10 @@ RomVersionManager::~RomVersionManager() {
 
 absl::Status RomVersionManager::Initialize(const Config& config) {
   config_ = config;
+  if (snapshots_.empty()) {
+    chunk_store_ =
+        std::make_unique<SnapshotChunkStore>(ChunkStoreOptions(config_));
+  }
 
   // Create initial snapshot
   auto initial_result = CreateSnapshot("Initial state", "system", true);
@@ -78,9 +114,7 @@ absl::StatusOr<std::string> RomVersionManager::CreateSnapshot(
     return absl::FailedPreconditionError("ROM not loaded");
   }
 
-  // Get ROM data
-  std::vector<uint8_t> rom_data(rom_->size());
-  std::memcpy(rom_data.data(), rom_->data(), rom_->size());
+  const std::span<const uint8_t> rom_data(rom_->data(), rom_->size());
 
   // Create snapshot
   RomSnapshot snapshot;
@@ -92,14 +126,10 @@ absl::StatusOr<std::string> RomVersionManager::CreateSnapshot(
   snapshot.is_checkpoint = is_checkpoint;
   snapshot.is_safe_point = false;
 
-  // Compress if enabled
-  if (config_.compress_snapshots) {
-    snapshot.rom_data = CompressData(rom_data);
-    snapshot.compressed_size = snapshot.rom_data.size();
-  } else {
-    snapshot.rom_data = std::move(rom_data);
-    snapshot.compressed_size = snapshot.rom_data.size();
-  }
+  // Only chunks not already held by an earlier snapshot are stored
+  snapshot.rom_size = rom_data.size();
+  snapshot.chunks =
+      chunk_store_->AddImage(rom_data, &snapshot.compressed_size);
 
 #ifdef YAZE_WITH_JSON
   snapshot.metadata = nlohmann::json::object();
@@ -107,16 +137,25 @@ absl::StatusOr<std::string> RomVersionManager::CreateSnapshot(
   snapshot.metadata["auto_backup"] = !is_checkpoint;
 #endif
 
-  // Store snapshot
-  snapshots_[snapshot.snapshot_id] = std::move(snapshot);
-  last_known_hash_ = snapshots_[snapshot.snapshot_id].rom_hash;
+  // Store snapshot (ids are millisecond timestamps, so a second snapshot in
+  // the same millisecond replaces the first; release its chunks)
+  const std::string snapshot_id = snapshot.snapshot_id;
+  last_known_hash_ = snapshot.rom_hash;
+  if (auto existing = snapshots_.find(snapshot_id);
+      existing != snapshots_.end()) {
+    chunk_store_->Release(existing->second.chunks);
+    existing->second = std::move(snapshot);
+  } else {
+    snapshots_.emplace(snapshot_id, std::move(snapshot));
+  }
 
   // Cleanup if needed
-  if (snapshots_.size() > config_.max_snapshots) {
+  if (snapshots_.size() > config_.max_snapshots ||
+      GetTotalStorageUsed() > config_.max_storage_mb * 1024 * 1024) {
     CleanupOldSnapshots();
   }
 
-  return snapshots_[snapshot.snapshot_id].snapshot_id;
+  return snapshot_id;
 }
 
 absl::Status RomVersionManager::RestoreSnapshot(
@@ -131,15 +170,14 @@ absl::Status RomVersionManager::RestoreSnapshot(
     return absl::FailedPreconditionError("ROM not loaded");
   }
 
-  const RomSnapshot& snapshot = it->second;
-
-  // Decompress if needed
-  std::vector<uint8_t> rom_data;
-  if (config_.compress_snapshots) {
-    rom_data = DecompressData(snapshot.rom_data);
-  } else {
-    rom_data = snapshot.rom_data;
+  // Copy out what we need: the pre-restore backup below may prune snapshots
+  const std::string rom_hash = it->second.rom_hash;
+  auto data_result = chunk_store_->ReadImage(it->second.chunks,
+                                             it->second.rom_size);
+  if (!data_result.ok()) {
+    return data_result.status();
   }
+  std::vector<uint8_t> rom_data = std::move(*data_result);
 
   // Verify size matches
   if (rom_data.size() != rom_->size()) {
@@ -159,7 +197,7 @@ absl::Status RomVersionManager::RestoreSnapshot(
     return restore_status;
   }
 
-  last_known_hash_ = snapshot.rom_hash;
+  last_known_hash_ = rom_hash;
 
   return absl::OkStatus();
 }
@@ -203,6 +241,15 @@ absl::StatusOr<RomSnapshot> RomVersionManager::GetSnapshot(
   return it->second;
 }
 
+absl::StatusOr<std::vector<uint8_t>> RomVersionManager::GetSnapshotData(
+    const std::string& snapshot_id) const {
+  auto it = snapshots_.find(snapshot_id);
+  if (it == snapshots_.end()) {
+    return absl::NotFoundError("Snapshot not found");
+  }
+  return chunk_store_->ReadImage(it->second.chunks, it->second.rom_size);
+}
+
 absl::Status RomVersionManager::DeleteSnapshot(const std::string& snapshot_id) {
   auto it = snapshots_.find(snapshot_id);
   if (it == snapshots_.end()) {
@@ -214,10 +261,49 @@ absl::Status RomVersionManager::DeleteSnapshot(const std::string& snapshot_id) {
     return absl::FailedPreconditionError("Cannot delete safe point");
   }
 
-  snapshots_.erase(it);
+  EraseSnapshot(it);
   return absl::OkStatus();
 }
 
+absl::StatusOr<VersionDiff> RomVersionManager::GenerateDiff(
+    const std::string& from_id, const std::string& to_id) const {
+  auto from_it = snapshots_.find(from_id);
+  auto to_it = snapshots_.find(to_id);
+  if (from_it == snapshots_.end() || to_it == snapshots_.end()) {
+    return absl::NotFoundError("Snapshot not found");
+  }
+  const RomSnapshot& from = from_it->second;
+  const RomSnapshot& to = to_it->second;
+
+  VersionDiff diff;
+  diff.from_snapshot_id = from_id;
+  diff.to_snapshot_id = to_id;
+  diff.total_bytes_changed = 0;
+
+  // Equal chunk ids mean equal bytes, so only differing chunks are inflated
+  const size_t chunk_size = chunk_store_->chunk_size();
+  for (size_t i = 0; i < to.chunks.size(); ++i) {
+    const bool in_from = i < from.chunks.size();
+    if (in_from && from.chunks[i] == to.chunks[i]) {
+      continue;
+    }
+    auto to_bytes = chunk_store_->ReadChunk(to.chunks[i]);
+    if (!to_bytes.ok()) {
+      return to_bytes.status();
+    }
+    std::vector<uint8_t> from_bytes;
+    if (in_from) {
+      auto result = chunk_store_->ReadChunk(from.chunks[i]);
+      if (!result.ok()) {
+        return result.status();
+      }
+      from_bytes = std::move(*result);
+    }
+    AppendChangedRuns(i * chunk_size, from_bytes, *to_bytes, diff);
+  }
+  return diff;
+}
+
 absl::StatusOr<bool> RomVersionManager::DetectCorruption() {
   if (!config_.enable_corruption_detection) {
     return false;
@@ -228,9 +314,7 @@ absl::StatusOr<bool> RomVersionManager::DetectCorruption() {
   }
 
   // Compute current hash
-  std::vector<uint8_t> current_data(rom_->size());
-  std::memcpy(current_data.data(), rom_->data(), rom_->size());
-  std::string current_hash = ComputeHash(current_data);
+  std::string current_hash = ComputeRomHash();
 
   // Basic integrity checks
   auto integrity_status = ValidateRomIntegrity();
@@ -260,13 +344,7 @@ absl::Status RomVersionManager::AutoRecover() {
 }
 
 std::string RomVersionManager::GetCurrentHash() const {
-  if (!rom_ || !rom_->is_loaded()) {
-    return "";
-  }
-
-  std::vector<uint8_t> data(rom_->size());
-  std::memcpy(data.data(), rom_->data(), rom_->size());
-  return ComputeHash(data);
+  return ComputeRomHash();
 }
 
 absl::Status RomVersionManager::CleanupOldSnapshots() {
@@ -283,17 +361,14 @@ absl::Status RomVersionManager::CleanupOldSnapshots() {
   // Sort by timestamp (oldest first)
   std::sort(auto_backups.begin(), auto_backups.end());
 
-  // Delete oldest until within limits
-  while (snapshots_.size() > config_.max_snapshots && !auto_backups.empty()) {
-    snapshots_.erase(auto_backups.front().second);
-    auto_backups.erase(auto_backups.begin());
-  }
-
-  // Check storage limit
-  while (GetTotalStorageUsed() > config_.max_storage_mb * 1024 * 1024 &&
-         !auto_backups.empty()) {
-    snapshots_.erase(auto_backups.front().second);
-    auto_backups.erase(auto_backups.begin());
+  // Delete oldest until within limits. Storage is measured on the shared
+  // chunk store, so dropping a snapshot only frees chunks no other snapshot
+  // still references.
+  size_t next = 0;
+  while (next < auto_backups.size() &&
+         (snapshots_.size() > config_.max_snapshots ||
+          GetTotalStorageUsed() > config_.max_storage_mb * 1024 * 1024)) {
+    EraseSnapshot(snapshots_.find(auto_backups[next++].second));
   }
 
   return absl::OkStatus();
@@ -310,7 +385,6 @@ RomVersionManager::Stats RomVersionManager::GetStats() const {
       stats.manual_checkpoints++;
     if (!snapshot.is_checkpoint)
       stats.auto_backups++;
-    stats.total_storage_bytes += snapshot.compressed_size;
 
     if (stats.oldest_snapshot_timestamp == 0 ||
         snapshot.timestamp < stats.oldest_snapshot_timestamp) {
@@ -322,6 +396,7 @@ RomVersionManager::Stats RomVersionManager::GetStats() const {
     }
   }
 
+  stats.total_storage_bytes = GetTotalStorageUsed();
   return stats;
 }
 
@@ -332,22 +407,16 @@ std::string RomVersionManager::ComputeRomHash() const {
     return "";
   }
 
-  std::vector<uint8_t> data(rom_->size());
-  std::memcpy(data.data(), rom_->data(), rom_->size());
-  return ComputeHash(data);
+  return ComputeHash(std::span<const uint8_t>(rom_->data(), rom_->size()));
 }
 
-std::vector<uint8_t> RomVersionManager::CompressData(
-    const std::vector<uint8_t>& data) const {
-  // Placeholder: In production, use zlib or similar
-  // For now, just return the data as-is
-  return data;
-}
-
-std::vector<uint8_t> RomVersionManager::DecompressData(
-    const std::vector<uint8_t>& compressed) const {
-  // Placeholder: In production, use zlib or similar
-  return compressed;
+void RomVersionManager::EraseSnapshot(
+    std::map<std::string, RomSnapshot>::iterator it) {
+  if (it == snapshots_.end()) {
+    return;
+  }
+  chunk_store_->Release(it->second.chunks);
+  snapshots_.erase(it);
 }
 
 absl::Status RomVersionManager::ValidateRomIntegrity() const {
@@ -370,11 +439,7 @@ absl::Status RomVersionManager::ValidateRomIntegrity() const {
 }
 
 size_t RomVersionManager::GetTotalStorageUsed() const {
-  size_t total = 0;
-  for (const auto& [id, snapshot] : snapshots_) {
-    total += snapshot.compressed_size;
-  }
-  return total;
+  return chunk_store_->stored_bytes();
 }
 
 // ============================================================================
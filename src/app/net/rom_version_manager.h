@@ -8,6 +8,7 @@
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "app/net/snapshot_chunk_store.h"
 #include "rom/rom.h"
 
 #ifdef YAZE_WITH_JSON
@@ -21,14 +22,18 @@ namespace net {
 /**
  * @struct RomSnapshot
  * @brief Represents a versioned snapshot of ROM state
+ *
+ * ROM bytes live in the manager's SnapshotChunkStore; a snapshot only holds
+ * the chunk ids. Use RomVersionManager::GetSnapshotData() for the bytes.
  */
 struct RomSnapshot {
   std::string snapshot_id;
   std::string description;
   int64_t timestamp;
   std::string rom_hash;
-  std::vector<uint8_t> rom_data;
-  size_t compressed_size;
+  std::vector<SnapshotChunkStore::ChunkId> chunks;
+  size_t rom_size = 0;
+  size_t compressed_size;  // Bytes of new chunks this snapshot stored
 
   // Metadata
   std::string creator;
@@ -72,6 +77,10 @@ class RomVersionManager {
     size_t max_storage_mb = 500;  // 500MB max for all snapshots
     bool compress_snapshots = true;
     bool enable_corruption_detection = true;
+    size_t snapshot_chunk_size = 4096;
+    // Chunks beyond max_resident_mb are written here (empty = never spill)
+    std::string spill_directory;
+    size_t max_resident_mb = 0;
   };
 
   explicit RomVersionManager(Rom* rom);
@@ -109,13 +118,19 @@ class RomVersionManager {
    */
   absl::StatusOr<RomSnapshot> GetSnapshot(const std::string& snapshot_id) const;
 
+  /**
+   * Reassemble the ROM bytes of a snapshot
+   */
+  absl::StatusOr<std::vector<uint8_t>> GetSnapshotData(
+      const std::string& snapshot_id) const;
+
   /**
    * Delete a snapshot
    */
   absl::Status DeleteSnapshot(const std::string& snapshot_id);
 
   /**
-   * Generate diff between two snapshots
+   * Generate diff between two snapshots (only chunks that differ are read)
    */
   absl::StatusOr<VersionDiff> GenerateDiff(const std::string& from_id,
                                            const std::string& to_id) const;
@@ -169,14 +184,13 @@ class RomVersionManager {
   Rom* rom_;
   Config config_;
   std::map<std::string, RomSnapshot> snapshots_;
+  std::unique_ptr<SnapshotChunkStore> chunk_store_;
   std::string last_known_hash_;
   int64_t last_backup_time_;
 
   // Helper functions
   std::string ComputeRomHash() const;
-  std::vector<uint8_t> CompressData(const std::vector<uint8_t>& data) const;
-  std::vector<uint8_t> DecompressData(
-      const std::vector<uint8_t>& compressed) const;
+  void EraseSnapshot(std::map<std::string, RomSnapshot>::iterator it);
   absl::Status ValidateRomIntegrity() const;
   size_t GetTotalStorageUsed() const;
   void PruneOldSnapshots();
@@ -0,0 +1,239 @@
+#include "app/net/snapshot_chunk_store.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include "absl/strings/str_format.h"
+#include "miniz.h"
+#include "util/log.h"
+
+namespace yaze {
+
+namespace net {
+
+namespace {
+
+uint64_t Mix64(uint64_t value) {
+  value ^= value >> 33;
+  value *= 0xFF51AFD7ED558CCDULL;
+  value ^= value >> 33;
+  value *= 0xC4CEB9FE1A85EC53ULL;
+  value ^= value >> 33;
+  return value;
+}
+
+}  // namespace
+
+SnapshotChunkStore::SnapshotChunkStore() : SnapshotChunkStore(Options{}) {}
+
+SnapshotChunkStore::SnapshotChunkStore(Options options)
+    : options_(std::move(options)) {
+  options_.chunk_size = std::max<size_t>(options_.chunk_size, 64);
+  options_.compression_level = std::clamp(options_.compression_level, 0, 10);
+}
+
+SnapshotChunkStore::~SnapshotChunkStore() {
+  for (const auto& [id, chunk] : chunks_) {
+    if (chunk.spilled) {
+      std::error_code ec;
+      std::filesystem::remove(SpillPath(id), ec);
+    }
+  }
+}
+
+SnapshotChunkStore::ChunkId SnapshotChunkStore::HashChunk(
+    std::span<const uint8_t> data) {
+  // Two independent 64-bit lanes over 8-byte words; collisions across the
+  // full 128 bits are not a practical concern for snapshot-sized stores.
+  uint64_t a = 0x9E3779B97F4A7C15ULL ^ data.size();
+  uint64_t b = 0xC2B2AE3D27D4EB4FULL + data.size();
+  size_t i = 0;
+  for (; i + 8 <= data.size(); i += 8) {
+    uint64_t word;
+    std::memcpy(&word, data.data() + i, sizeof(word));
+    a = std::rotl((a ^ word) * 0x100000001B3ULL, 29);
+    b = (b + word) * 0xFF51AFD7ED558CCDULL;
+    b ^= b >> 31;
+  }
+  for (; i < data.size(); ++i) {
+    a = std::rotl((a ^ data[i]) * 0x100000001B3ULL, 29);
+    b = (b + data[i]) * 0xFF51AFD7ED558CCDULL;
+    b ^= b >> 31;
+  }
+  return {Mix64(a ^ (b >> 17)), Mix64(b + a)};
+}
+
+std::vector<SnapshotChunkStore::ChunkId> SnapshotChunkStore::AddImage(
+    std::span<const uint8_t> data, size_t* added_bytes) {
+  std::vector<ChunkId> ids;
+  ids.reserve((data.size() + options_.chunk_size - 1) / options_.chunk_size);
+  size_t added = 0;
+
+  const size_t chunk_size = options_.chunk_size;
+  for (size_t offset = 0; offset < data.size(); offset += chunk_size) {
+    const auto piece =
+        data.subspan(offset, std::min(chunk_size, data.size() - offset));
+    const ChunkId id = HashChunk(piece);
+    ids.push_back(id);
+
+    auto [it, inserted] = chunks_.try_emplace(id);
+    Chunk& chunk = it->second;
+    ++chunk.refs;
+    if (!inserted) {
+      continue;
+    }
+
+    chunk.raw_size = static_cast<uint32_t>(piece.size());
+    chunk.sequence = next_sequence_++;
+    if (options_.compression_level > 0) {
+      mz_ulong packed_size = mz_compressBound(piece.size());
+      chunk.data.resize(packed_size);
+      const int result =
+          mz_compress2(chunk.data.data(), &packed_size, piece.data(),
+                       piece.size(), options_.compression_level);
+      if (result == MZ_OK && packed_size < piece.size()) {
+        chunk.data.resize(packed_size);
+        chunk.compressed = true;
+      }
+    }
+    if (!chunk.compressed) {
+      chunk.data.assign(piece.begin(), piece.end());
+    }
+    chunk.data.shrink_to_fit();
+    chunk.stored_size = static_cast<uint32_t>(chunk.data.size());
+    resident_bytes_ += chunk.stored_size;
+    added += chunk.stored_size;
+  }
+
+  if (added_bytes) {
+    *added_bytes = added;
+  }
+  SpillIfNeeded();
+  return ids;
+}
+
+void SnapshotChunkStore::Release(std::span<const ChunkId> chunks) {
+  for (const ChunkId& id : chunks) {
+    auto it = chunks_.find(id);
+    if (it == chunks_.end() || --it->second.refs > 0) {
+      continue;
+    }
+    if (it->second.spilled) {
+      spilled_bytes_ -= it->second.stored_size;
+      std::error_code ec;
+      std::filesystem::remove(SpillPath(id), ec);
+    } else {
+      resident_bytes_ -= it->second.stored_size;
+    }
+    chunks_.erase(it);
+  }
+}
+
+absl::StatusOr<std::vector<uint8_t>> SnapshotChunkStore::ReadChunk(
+    const ChunkId& id) const {
+  auto it = chunks_.find(id);
+  if (it == chunks_.end()) {
+    return absl::NotFoundError(absl::StrFormat(
+        "Snapshot chunk %016x%016x not found", id.high, id.low));
+  }
+  const Chunk& chunk = it->second;
+
+  std::vector<uint8_t> spilled;
+  const std::vector<uint8_t>* stored = &chunk.data;
+  if (chunk.spilled) {
+    std::ifstream file(SpillPath(id), std::ios::binary);
+    spilled.resize(chunk.stored_size);
+    if (!file.read(reinterpret_cast<char*>(spilled.data()), spilled.size())) {
+      return absl::DataLossError(absl::StrFormat(
+          "Failed to read spilled chunk %s", SpillPath(id).string()));
+    }
+    stored = &spilled;
+  }
+
+  if (!chunk.compressed) {
+    return *stored;
+  }
+  std::vector<uint8_t> raw(chunk.raw_size);
+  mz_ulong raw_size = chunk.raw_size;
+  if (mz_uncompress(raw.data(), &raw_size, stored->data(), stored->size()) !=
+          MZ_OK ||
+      raw_size != chunk.raw_size) {
+    return absl::DataLossError("Snapshot chunk failed to decompress");
+  }
+  return raw;
+}
+
+absl::StatusOr<std::vector<uint8_t>> SnapshotChunkStore::ReadImage(
+    std::span<const ChunkId> chunks, size_t size) const {
+  std::vector<uint8_t> image;
+  image.reserve(size);
+  for (const ChunkId& id : chunks) {
+    auto chunk = ReadChunk(id);
+    if (!chunk.ok()) {
+      return chunk.status();
+    }
+    image.insert(image.end(), chunk->begin(), chunk->end());
+  }
+  if (image.size() != size) {
+    return absl::DataLossError(
+        absl::StrFormat("Snapshot image is %d bytes, expected %d",
+                        image.size(), size));
+  }
+  return image;
+}
+
+std::filesystem::path SnapshotChunkStore::SpillPath(const ChunkId& id) const {
+  return options_.spill_directory /
+         absl::StrFormat("%016x%016x.chunk", id.high, id.low);
+}
+
+void SnapshotChunkStore::SpillIfNeeded() {
+  if (options_.max_resident_bytes == 0 || options_.spill_directory.empty() ||
+      resident_bytes_ <= options_.max_resident_bytes) {
+    return;
+  }
+
+  std::error_code ec;
+  std::filesystem::create_directories(options_.spill_directory, ec);
+  if (ec) {
+    LOG_WARN("SnapshotChunkStore", "Cannot create spill directory %s: %s",
+             options_.spill_directory.string(), ec.message());
+    return;
+  }
+
+  // Oldest chunks first: recent snapshots are the likeliest to be restored
+  std::vector<std::pair<uint64_t, ChunkId>> resident;
+  for (const auto& [id, chunk] : chunks_) {
+    if (!chunk.spilled) {
+      resident.emplace_back(chunk.sequence, id);
+    }
+  }
+  std::sort(resident.begin(), resident.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+
+  for (const auto& [sequence, id] : resident) {
+    if (resident_bytes_ <= options_.max_resident_bytes) {
+      break;
+    }
+    Chunk& chunk = chunks_.at(id);
+    std::ofstream file(SpillPath(id), std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(chunk.data.data()),
+               chunk.data.size());
+    if (!file) {
+      LOG_WARN("SnapshotChunkStore", "Failed to spill chunk to %s",
+               SpillPath(id).string());
+      return;
+    }
+    chunk.spilled = true;
+    chunk.data = {};
+    resident_bytes_ -= chunk.stored_size;
+    spilled_bytes_ += chunk.stored_size;
+  }
+}
+
+}  // namespace net
+
+}  // namespace yaze
@@ -0,0 +1,112 @@
+#ifndef YAZE_APP_NET_SNAPSHOT_CHUNK_STORE_H_
+#define YAZE_APP_NET_SNAPSHOT_CHUNK_STORE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "absl/status/statusor.h"
+
+namespace yaze {
+
+namespace net {
+
+/**
+ * @class SnapshotChunkStore
+ * @brief Content-addressed, refcounted store for ROM snapshot chunks
+ *
+ * Images are split into fixed-size chunks keyed by a 128-bit content hash.
+ * Identical chunks (across snapshots, or repeated within one image) are kept
+ * once and reference counted, and each unique chunk is deflated with miniz.
+ * A snapshot is then just its list of chunk ids, so N snapshots of a ROM
+ * that differ in a few places cost one ROM plus the changed chunks.
+ *
+ * When a resident byte budget and spill directory are configured, the oldest
+ * chunks are written to disk and read back on demand.
+ *
+ * Not thread-safe; owned by a single RomVersionManager.
+ */
+class SnapshotChunkStore {
+ public:
+  struct ChunkId {
+    uint64_t high = 0;
+    uint64_t low = 0;
+
+    bool operator==(const ChunkId& other) const = default;
+  };
+
+  struct Options {
+    size_t chunk_size = 4096;
+    int compression_level = 6;  // miniz level, 0 stores chunks raw
+    std::filesystem::path spill_directory;
+    size_t max_resident_bytes = 0;  // 0 keeps every chunk in memory
+  };
+
+  SnapshotChunkStore();
+  explicit SnapshotChunkStore(Options options);
+  ~SnapshotChunkStore();
+
+  SnapshotChunkStore(const SnapshotChunkStore&) = delete;
+  SnapshotChunkStore& operator=(const SnapshotChunkStore&) = delete;
+
+  /**
+   * @brief Split @p data into chunks, storing any not already present
+   * @param added_bytes If set, receives the stored size of new chunks
+   * @return One id per chunk; each holds a reference until Release()
+   */
+  std::vector<ChunkId> AddImage(std::span<const uint8_t> data,
+                                size_t* added_bytes = nullptr);
+
+  /// Drop one reference per id; chunks reaching zero are freed.
+  void Release(std::span<const ChunkId> chunks);
+
+  absl::StatusOr<std::vector<uint8_t>> ReadChunk(const ChunkId& id) const;
+
+  /// Reassemble an image of @p size bytes from its chunk list.
+  absl::StatusOr<std::vector<uint8_t>> ReadImage(
+      std::span<const ChunkId> chunks, size_t size) const;
+
+  static ChunkId HashChunk(std::span<const uint8_t> data);
+
+  size_t chunk_size() const { return options_.chunk_size; }
+  size_t unique_chunks() const { return chunks_.size(); }
+  /// Stored (compressed) bytes, resident plus spilled.
+  size_t stored_bytes() const { return resident_bytes_ + spilled_bytes_; }
+  size_t resident_bytes() const { return resident_bytes_; }
+  size_t spilled_bytes() const { return spilled_bytes_; }
+
+ private:
+  struct ChunkIdHash {
+    size_t operator()(const ChunkId& id) const {
+      return static_cast<size_t>(id.low ^ (id.high * 0x9E3779B97F4A7C15ULL));
+    }
+  };
+
+  struct Chunk {
+    std::vector<uint8_t> data;  // Deflated, or raw when !compressed
+    uint32_t raw_size = 0;
+    uint32_t stored_size = 0;
+    uint32_t refs = 0;
+    uint64_t sequence = 0;
+    bool compressed = false;
+    bool spilled = false;
+  };
+
+  std::filesystem::path SpillPath(const ChunkId& id) const;
+  void SpillIfNeeded();
+
+  Options options_;
+  std::unordered_map<ChunkId, Chunk, ChunkIdHash> chunks_;
+  size_t resident_bytes_ = 0;
+  size_t spilled_bytes_ = 0;
+  uint64_t next_sequence_ = 0;
+};
+
+}  // namespace net
+
+}  // namespace yaze
+
+#endif  // YAZE_APP_NET_SNAPSHOT_CHUNK_STORE_H_
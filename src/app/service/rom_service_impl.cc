@@ -747,7 +747,7 @@ grpc::Status RomServiceImpl::ListSnapshots(
     info->set_timestamp(snapshot.timestamp);
     info->set_is_checkpoint(snapshot.is_checkpoint);
     info->set_is_safe_point(snapshot.is_safe_point);
-    info->set_size_bytes(snapshot.rom_data.size());
+    info->set_size_bytes(snapshot.rom_size);
   }
 
   return grpc::Status::OK;
@@ -6,10 +6,16 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/match.h"
+#include "absl/flags/declare.h"
+#include "absl/flags/flag.h"
 #include "cli/handlers/command_handlers.h"
 #include "cli/service/command_registry.h"
+#include "cli/service/command_server.h"
 #include "cli/z3ed_ascii_logo.h"
 
+ABSL_DECLARE_FLAG(std::string, rom);
+ABSL_DECLARE_FLAG(bool, mock_rom);
+
 namespace yaze {
 namespace cli {
 
@@ -105,6 +111,44 @@ absl::Status ModernCLI::Run(int argc, char* argv[]) {
 #endif
   }
 
+  // Special case: "serve" keeps the ROM resident and runs commands from
+  // JSON-lines requests on stdin or a Unix socket.
+  if (args[0] == "serve") {
+    std::vector<std::string> serve_args(args.begin() + 1, args.end());
+    resources::ArgumentParser parser(serve_args);
+    if (parser.HasFlag("help") || parser.HasFlag("h")) {
+      std::cout << "\n\033[1;36mServe mode:\033[0m\n";
+      std::cout << "  z3ed serve --rom=<path> [--socket=<path>] "
+                   "[--symbols=<path>] [--project-context=<path>]\n\n";
+      std::cout << "Reads one JSON request per line from stdin (or each "
+                   "socket connection):\n";
+      std::cout << "  {\"id\": 1, \"command\": \"hex-read\", "
+                   "\"args\": [\"--address=0x7FC0\"]}\n";
+      std::cout << "Mutating commands run on a copy of the resident ROM; "
+                   "add \"commit\": true to keep the edit.\n";
+      std::cout << "Built-ins: ping, status, reload, save, shutdown.\n";
+      return absl::OkStatus();
+    }
+
+    CommandServer::Options options;
+    options.rom_path =
+        parser.GetString("rom").value_or(absl::GetFlag(FLAGS_rom));
+    options.use_mock_rom =
+        parser.HasFlag("mock-rom") || absl::GetFlag(FLAGS_mock_rom);
+    options.symbols_path = parser.GetString("symbols");
+    options.project_context_path = parser.GetString("project-context");
+
+    CommandServer server(registry);
+    RETURN_IF_ERROR(server.Open(options));
+    if (auto socket_path = parser.GetString("socket");
+        socket_path.has_value()) {
+      std::cerr << "z3ed serve: listening on " << *socket_path << "\n";
+      return server.ServeUnixSocket(*socket_path);
+    }
+    std::cerr << "z3ed serve: reading requests from stdin\n";
+    return server.ServeStream(std::cin, std::cout);
+  }
+
   // Special case: "rom" subcommands (rom read/write/info/validate/etc.)
   if (args[0] == "rom") {
     if (args.size() < 2 || args[1] == "--help" || args[1] == "-h") {
@@ -12,8 +12,10 @@ endif()
 set(YAZE_CLI_CORE_SOURCES
   cli/flags.cc
   cli/service/command_registry.cc
+  cli/service/command_server.cc
   cli/service/resources/command_context.cc
   cli/service/resources/command_handler.cc
+  cli/service/resources/resident_world_cache.cc
   cli/service/agent/tools/project_graph_tool.cc
   cli/service/resources/resource_catalog.cc
   cli/service/resources/resource_context_builder.cc
@@ -58,6 +60,7 @@ set(YAZE_CLI_CORE_SOURCES
   cli/handlers/rom/project_commands.cc
   cli/handlers/rom/rom_commands.cc
 
+  cli/handlers/tools/doctor_pipeline.cc
   cli/handlers/tools/dungeon_doctor_commands.cc
   cli/handlers/tools/dungeon_object_validate_commands.cc
   cli/handlers/tools/graphics_doctor_commands.cc
@@ -98,10 +101,7 @@ if(YAZE_ENABLE_GRPC)
   )
 endif()
 
-# miniz (public domain, single-file zip library for bundle pack/unpack)
-set(MINIZ_SOURCES ${CMAKE_SOURCE_DIR}/ext/miniz/miniz.c)
-
-add_library(yaze_cli_core STATIC ${YAZE_CLI_CORE_SOURCES} ${MINIZ_SOURCES})
+add_library(yaze_cli_core STATIC ${YAZE_CLI_CORE_SOURCES})
 
 set_target_properties(yaze_cli_core PROPERTIES POSITION_INDEPENDENT_CODE ON)
 
@@ -109,12 +109,12 @@ target_include_directories(yaze_cli_core PUBLIC
   ${CMAKE_SOURCE_DIR}/src
   ${CMAKE_SOURCE_DIR}/inc
   ${CMAKE_BINARY_DIR}/gens
-  ${CMAKE_SOURCE_DIR}/ext/miniz
 )
 
 target_link_libraries(yaze_cli_core PUBLIC
   yaze_common
   yaze_util
+  yaze_miniz
   yaze_core_lib
   yaze_rom
   yaze_gfx
@@ -190,7 +190,8 @@ void PrintCompactHelp() {
   std::cout << "  z3ed debug state\n";
   std::cout
       << "  z3ed message-search --rom=zelda3.sfc --query=\"Master Sword\"\n";
-  std::cout << "  z3ed dungeon-export --rom=zelda3.sfc --id=1\n\n";
+  std::cout << "  z3ed dungeon-export --rom=zelda3.sfc --id=1\n";
+  std::cout << "  z3ed serve --rom=zelda3.sfc     # JSON-lines daemon\n\n";
 
   std::cout << "For detailed help: z3ed help <command>\n";
   std::cout << "For all commands:  z3ed --list-commands\n\n";
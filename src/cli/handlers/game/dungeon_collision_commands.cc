@@ -1091,8 +1091,10 @@ absl::Status DungeonExportCustomCollisionJsonCommandHandler::ExecuteWithContext(
     std::vector<zelda3::CustomCollisionRoomEntry> export_rooms;
     export_rooms.reserve(room_ids.size());
 
-    for (int room_id : room_ids) {
-      ASSIGN_OR_RETURN(auto map, zelda3::LoadCustomCollisionMap(rom, room_id));
+    auto maps = zelda3::LoadCustomCollisionMaps(rom, room_ids);
+    for (size_t i = 0; i < room_ids.size(); ++i) {
+      const int room_id = room_ids[i];
+      ASSIGN_OR_RETURN(auto map, std::move(maps[i]));
       if (!map.has_data) {
         continue;
       }
@@ -1220,6 +1222,28 @@ absl::Status DungeonImportCustomCollisionJsonCommandHandler::Execute(
       rooms.emplace_back(room_id, rom, nullptr);
     }
 
+    // Decode every room the import or --replace-all may compare against in
+    // one parallel pass.
+    std::vector<int> current_room_ids;
+    if (replace_all) {
+      current_room_ids.resize(zelda3::kNumberOfRooms);
+      for (int room_id = 0; room_id < zelda3::kNumberOfRooms; ++room_id) {
+        current_room_ids[room_id] = room_id;
+      }
+    } else {
+      for (const auto& imported : imported_rooms) {
+        current_room_ids.push_back(imported.room_id);
+      }
+    }
+    std::unordered_map<int, absl::StatusOr<zelda3::CustomCollisionMap>>
+        current_maps;
+    {
+      auto maps = zelda3::LoadCustomCollisionMaps(rom, current_room_ids);
+      for (size_t i = 0; i < current_room_ids.size(); ++i) {
+        current_maps.insert_or_assign(current_room_ids[i], std::move(maps[i]));
+      }
+    }
+
     int populated_rooms = 0;
     int cleared_rooms = 0;
     int changed_rooms = 0;
@@ -1247,8 +1271,7 @@ absl::Status DungeonImportCustomCollisionJsonCommandHandler::Execute(
         ++cleared_rooms;
       }
 
-      ASSIGN_OR_RETURN(const auto current,
-                       zelda3::LoadCustomCollisionMap(rom, imported.room_id));
+      ASSIGN_OR_RETURN(const auto current, current_maps.at(imported.room_id));
       if (current.has_data == desired.has_data &&
           current.tiles == desired.tiles) {
         ++unchanged_rooms;
@@ -1267,8 +1290,7 @@ absl::Status DungeonImportCustomCollisionJsonCommandHandler::Execute(
         if (touched_rooms.contains(room_id)) {
           continue;
         }
-        ASSIGN_OR_RETURN(const auto current,
-                         zelda3::LoadCustomCollisionMap(rom, room_id));
+        ASSIGN_OR_RETURN(const auto current, current_maps.at(room_id));
         if (!current.has_data) {
           continue;
         }
@@ -12,6 +12,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_split.h"
+#include "cli/service/resources/resident_world_cache.h"
 #include "cli/util/hex_util.h"
 #include "core/dungeon_stream_layout_adapter.h"
 #include "core/hack_manifest.h"
@@ -22,6 +23,7 @@
 #include "zelda3/dungeon/custom_collision.h"
 #include "zelda3/dungeon/dungeon_editor_system.h"
 #include "zelda3/dungeon/dungeon_rom_addresses.h"
+#include "zelda3/dungeon/dungeon_room_index.h"
 #include "zelda3/dungeon/dungeon_spawn_point.h"
 #include "zelda3/dungeon/room.h"
 #include "zelda3/dungeon/room_entrance.h"
@@ -37,13 +39,6 @@ using util::ParseHexString;
 
 namespace {
 
-constexpr uint8_t kStopTileMin = 0xB7;
-constexpr uint8_t kStopTileMax = 0xBA;
-
-bool IsStopTile(uint8_t v) {
-  return v >= kStopTileMin && v <= kStopTileMax;
-}
-
 bool IsEncodedRoomStreamObject(const zelda3::RoomObject& object) {
   // Lightable torches and pushable blocks are synthesized from separate
   // global tables after the encoded room object stream has been parsed.
@@ -195,18 +190,6 @@ absl::Status ValidateRoomHeaderManifestConflicts(
   return ValidateManifestWriteRanges(manifest, ranges);
 }
 
-// Merge stop tiles from |existing| into |generated| without overwriting
-// track tiles that were just produced. Stop tiles in |existing| that sit on
-// cells that are zero in |generated| are copied across unchanged.
-void MergeStopTiles(const zelda3::CustomCollisionMap& existing,
-                    zelda3::CustomCollisionMap& generated) {
-  for (int i = 0; i < static_cast<int>(existing.tiles.size()); ++i) {
-    if (IsStopTile(existing.tiles[i]) && generated.tiles[i] == 0) {
-      generated.tiles[i] = existing.tiles[i];
-    }
-  }
-}
-
 absl::Status SaveTrackCollisionRom(Rom* rom,
                                    const resources::ArgumentParser& parser,
                                    resources::OutputFormatter& formatter) {
@@ -378,8 +361,10 @@ absl::Status DungeonDescribeRoomCommandHandler::Execute(
 
   formatter.AddField("room_id", room_id);
 
-  // Load full room to get objects, doors, and stairs
-  zelda3::Room room = zelda3::LoadRoomFromRom(rom, room_id);
+  // Load full room to get objects, doors, and stairs. Under `z3ed serve` the
+  // room stays decoded until the ROM changes.
+  ASSIGN_OR_RETURN(zelda3::Room * loaded, World(rom).GetRoom(room_id));
+  zelda3::Room& room = *loaded;
   const bool include_objects = parser.HasFlag("include-objects");
   const auto& tile_objects = room.GetTileObjects();
 
@@ -1060,12 +1045,35 @@ absl::Status DungeonGenerateTrackCollisionCommandHandler::Execute(
   bool do_preserve_stops = parser.HasFlag("preserve-stops");
   bool do_visualize = parser.HasFlag("visualize");
 
-  // Determine room list: --rooms (batch) or --room (single)
+  // Determine room list: --all, --dungeon or --rooms (batch) or --room
+  // (single)
   std::vector<int> room_ids;
   auto rooms_arg = parser.GetString("rooms");
   auto room_arg = parser.GetString("room");
-
-  if (rooms_arg.has_value()) {
+  auto dungeon_arg = parser.GetString("dungeon");
+  const bool all_rooms = parser.HasFlag("all");
+  // Sweeps pick rooms for the caller, so they leave trackless rooms alone.
+  const bool sweep = all_rooms || dungeon_arg.has_value();
+
+  if (all_rooms) {
+    room_ids.reserve(zelda3::kNumberOfRooms);
+    for (int room_id = 0; room_id < zelda3::kNumberOfRooms; ++room_id) {
+      room_ids.push_back(room_id);
+    }
+  } else if (dungeon_arg.has_value()) {
+    int dungeon_id;
+    if (!ParseHexString(dungeon_arg.value(), &dungeon_id)) {
+      return absl::InvalidArgumentError(
+          "Invalid dungeon ID format. Must be hex (e.g., 0x02).");
+    }
+    ASSIGN_OR_RETURN(const auto index, zelda3::BuildDungeonRoomIndex(*rom));
+    room_ids = index.RoomsOf(dungeon_id);
+    if (room_ids.empty()) {
+      return absl::NotFoundError(absl::StrFormat(
+          "No entrance or spawn point leads into dungeon 0x%02X.",
+          dungeon_id));
+    }
+  } else if (rooms_arg.has_value()) {
     // Batch mode: parse comma-separated hex room IDs
     for (absl::string_view token :
          absl::StrSplit(rooms_arg.value(), ',', absl::SkipEmpty())) {
@@ -1088,21 +1096,46 @@ absl::Status DungeonGenerateTrackCollisionCommandHandler::Execute(
     }
     room_ids.push_back(rid);
   } else {
-    return absl::InvalidArgumentError("Either --room or --rooms is required.");
+    return absl::InvalidArgumentError(
+        "Either --room, --rooms, --dungeon or --all is required.");
   }
 
-  bool is_batch = room_ids.size() > 1;
+  bool is_batch = sweep || room_ids.size() > 1;
   std::unique_ptr<ScopedRomTransaction> transaction;
   if (do_write) {
     transaction = std::make_unique<ScopedRomTransaction>(*rom);
   }
 
   if (is_batch) {
-    // Batch mode: aggregate results with per-room detail
+    // Batch mode: generate every room in parallel, then write only the rooms
+    // whose map differs from the ROM in one all-or-nothing batch.
+    zelda3::TrackCollisionBatchOptions batch_options;
+    batch_options.generator = options;
+    batch_options.preserve_stops = do_preserve_stops;
+    // A sweep must not clear collision in trackless rooms.
+    batch_options.skip_rooms_without_track = sweep;
+
     formatter.BeginObject("Batch Track Collision Generation");
     formatter.AddField("mode", do_write ? "write" : "dry-run");
     formatter.AddField("room_count", static_cast<int>(room_ids.size()));
 
+    auto batch =
+        zelda3::GenerateTrackCollisionBatch(rom, room_ids, batch_options);
+    if (!batch.ok()) {
+      formatter.AddField("error", std::string(batch.status().message()));
+      formatter.EndObject();
+      return batch.status();
+    }
+
+    if (do_write) {
+      auto write_status = zelda3::WriteTrackCollisionBatch(rom, *batch);
+      if (!write_status.ok()) {
+        formatter.AddField("write_error", std::string(write_status.message()));
+        formatter.EndObject();
+        return write_status;
+      }
+    }
+
     int total_tiles = 0;
     int total_stops = 0;
     int total_corners = 0;
@@ -1110,65 +1143,36 @@ absl::Status DungeonGenerateTrackCollisionCommandHandler::Execute(
     int rooms_succeeded = 0;
 
     formatter.BeginArray("rooms");
-    for (int room_id : room_ids) {
-      zelda3::Room room = zelda3::LoadRoomHeaderFromRom(rom, room_id);
-      room.LoadObjects();
-
-      auto result = zelda3::GenerateTrackCollision(&room, options);
-      if (!result.ok()) {
-        // Stop on first error and report which room failed
-        formatter.EndArray();
-        formatter.AddHexField("failed_room", room_id, 3);
-        formatter.AddField("error", std::string(result.status().message()));
-        formatter.EndObject();
-        return absl::InternalError(
-            absl::StrFormat("Generation failed for room 0x%03X: %s", room_id,
-                            result.status().message()));
-      }
-
-      if (do_preserve_stops && do_write) {
-        auto existing = zelda3::LoadCustomCollisionMap(rom, room_id);
-        if (existing.ok() && existing->has_data) {
-          MergeStopTiles(*existing, result->collision_map);
-        }
+    for (const auto& room : batch->rooms) {
+      const auto& result = room.result;
+      if (sweep && result.tiles_generated == 0) {
+        continue;
       }
 
       formatter.BeginObject();
-      formatter.AddHexField("room_id", room_id, 3);
-      formatter.AddField("tiles_generated", result->tiles_generated);
-      formatter.AddField("stop_count", result->stop_count);
-      formatter.AddField("corner_count", result->corner_count);
-      formatter.AddField("switch_count", result->switch_count);
+      formatter.AddHexField("room_id", result.room_id, 3);
+      formatter.AddField("tiles_generated", result.tiles_generated);
+      formatter.AddField("stop_count", result.stop_count);
+      formatter.AddField("corner_count", result.corner_count);
+      formatter.AddField("switch_count", result.switch_count);
+      formatter.AddField("changed", room.changed);
       if (do_preserve_stops) {
         formatter.AddField("stops_preserved", true);
       }
 
       if (do_visualize) {
-        formatter.AddField("visualization", result->ascii_visualization);
+        formatter.AddField("visualization", result.ascii_visualization);
       }
 
       if (do_write) {
-        auto write_status =
-            zelda3::WriteTrackCollision(rom, room_id, result->collision_map);
-        if (!write_status.ok()) {
-          // Stop on first write error
-          formatter.AddField("write_error",
-                             std::string(write_status.message()));
-          formatter.EndObject();
-          formatter.EndArray();
-          formatter.EndObject();
-          return absl::Status(
-              write_status.code(),
-              absl::StrFormat("Write failed for room 0x%03X: %s", room_id,
-                              write_status.message()));
-        }
-        formatter.AddField("write_status", "success");
+        formatter.AddField("write_status",
+                           room.changed ? "success" : "unchanged");
       }
 
-      total_tiles += result->tiles_generated;
-      total_stops += result->stop_count;
-      total_corners += result->corner_count;
-      total_switches += result->switch_count;
+      total_tiles += result.tiles_generated;
+      total_stops += result.stop_count;
+      total_corners += result.corner_count;
+      total_switches += result.switch_count;
       rooms_succeeded++;
 
       formatter.EndObject();
@@ -1188,6 +1192,7 @@ absl::Status DungeonGenerateTrackCollisionCommandHandler::Execute(
     // Aggregated totals
     formatter.BeginObject("totals");
     formatter.AddField("rooms_succeeded", rooms_succeeded);
+    formatter.AddField("rooms_changed", batch->changed_count);
     formatter.AddField("tiles_generated", total_tiles);
     formatter.AddField("stop_count", total_stops);
     formatter.AddField("corner_count", total_corners);
@@ -1210,7 +1215,7 @@ absl::Status DungeonGenerateTrackCollisionCommandHandler::Execute(
     if (do_preserve_stops && do_write) {
       auto existing = zelda3::LoadCustomCollisionMap(rom, room_id);
       if (existing.ok() && existing->has_data) {
-        MergeStopTiles(*existing, result->collision_map);
+        zelda3::MergeTrackStopTiles(*existing, result->collision_map);
       }
     }
 
@@ -51,6 +51,8 @@ class DungeonDescribeRoomCommandHandler : public resources::CommandHandler {
            "[--include-objects] [--format <json|text>]";
   }
 
+  bool ReadsRomOnly() const override { return true; }
+
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
     return parser.RequireArgs({"room"});
   }
@@ -225,19 +227,21 @@ class DungeonGenerateTrackCollisionCommandHandler
   }
   std::string GetUsage() const {
     return "dungeon-generate-track-collision --room <room_id> | "
-           "--rooms <hex,hex,...> "
+           "--rooms <hex,hex,...> | --dungeon <hex> | --all "
            "[--write] [--preserve-stops] [--visualize] [--promote-switch X,Y] "
            "[--project-context <path.yaze|path.yazeproj>] "
            "[--format <json|text>]";
   }
 
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
-    // Accept either --room (single) or --rooms (batch)
+    // Accept --room (single), --rooms, --dungeon or --all (batch)
     if (parser.GetString("room").has_value() ||
-        parser.GetString("rooms").has_value()) {
+        parser.GetString("rooms").has_value() ||
+        parser.GetString("dungeon").has_value() || parser.HasFlag("all")) {
       return absl::OkStatus();
     }
-    return absl::InvalidArgumentError("Either --room or --rooms is required");
+    return absl::InvalidArgumentError(
+        "Either --room, --rooms, --dungeon or --all is required");
   }
 
   absl::Status Execute(Rom* rom, const resources::ArgumentParser& parser,
@@ -9,9 +9,8 @@
 #include "absl/strings/str_format.h"
 #include "cli/util/hex_util.h"
 #include "rom/rom.h"
-#include "zelda3/dungeon/dungeon_spawn_point.h"
+#include "zelda3/dungeon/dungeon_room_index.h"
 #include "zelda3/dungeon/room.h"
-#include "zelda3/dungeon/room_entrance.h"
 
 namespace yaze {
 namespace cli {
@@ -22,12 +21,9 @@ using util::ParseHexString;
 namespace {
 
 // ROM addresses for dungeon tables
-constexpr int kEntranceDungeon = 0x1548B;    // Dungeon ID per entrance
 constexpr int kDungeonsStartRooms = 0x7939;  // Start room per dungeon
 constexpr int kDungeonsEndRooms = 0x792D;    // End room per dungeon (unused)
 constexpr int kDungeonsBossRooms = 0x10954;  // Boss room per dungeon
-constexpr int kNumberOfDungeons = 14;        // Vanilla dungeons
-constexpr int kNumberOfEntrances = 0x84;     // Total entrances
 
 // Dungeon names (vanilla + common custom slots)
 const std::vector<std::string> kDungeonNames = {
@@ -97,79 +93,44 @@ absl::Status DungeonGroupCommandHandler::Execute(
     }
   }
 
-  // Build dungeon info from ROM tables
-  std::map<int, DungeonInfo> dungeons;
-
-  // Read start rooms and boss rooms from ROM
-  for (int i = 0; i < kNumberOfDungeons; ++i) {
-    DungeonInfo info;
-    info.id = i;
-    info.name = GetDungeonName(i);
-
-    // Read start room (1 byte per dungeon)
-    info.start_room = rom->data()[kDungeonsStartRooms + i];
-
-    // Read boss room (2 bytes per dungeon)
-    uint16_t boss_room_addr = kDungeonsBossRooms + (i * 2);
-    info.boss_room =
-        rom->data()[boss_room_addr] | (rom->data()[boss_room_addr + 1] << 8);
-
-    // Boss room 0xFFFF means no boss
-    if (info.boss_room == 0xFFFF) {
-      info.boss_room = -1;
-    }
-
-    dungeons[i] = info;
+  auto index_or = zelda3::BuildDungeonRoomIndex(*rom);
+  if (!index_or.ok()) {
+    return index_or.status();
   }
+  const auto& index = index_or.value();
 
-  // Scan entrances to find room->dungeon mappings
-  std::map<int, int> room_to_dungeon;
-  for (int entrance_id = 0; entrance_id < kNumberOfEntrances; ++entrance_id) {
-    zelda3::RoomEntrance entrance(rom, static_cast<uint8_t>(entrance_id),
-                                  false);
-
-    int dungeon_id = entrance.dungeon_id_;
-    int room_id = entrance.room_;
-
-    // Track the room's dungeon assignment
-    room_to_dungeon[room_id] = dungeon_id;
-
-    // Add room to dungeon's room set
-    if (dungeons.find(dungeon_id) == dungeons.end()) {
-      // Create entry for custom dungeons discovered via entrances
-      DungeonInfo info;
-      info.id = dungeon_id;
-      info.name = GetDungeonName(dungeon_id);
-      info.start_room = -1;
-      info.boss_room = -1;
-      dungeons[dungeon_id] = info;
-    }
-    dungeons[dungeon_id].rooms.insert(room_id);
-  }
-
-  // Also scan spawn points for additional room mappings
-  for (int spawn_id = 0; spawn_id < zelda3::kNumDungeonSpawnPoints;
-       ++spawn_id) {
-    auto spawn_or = zelda3::DungeonSpawnPoint::Load(*rom, spawn_id);
-    if (!spawn_or.ok()) {
-      return spawn_or.status();
+  // Build dungeon info from the room index and ROM tables
+  std::map<int, DungeonInfo> dungeons;
+  for (const auto& [id, rooms] : index.rooms_by_dungeon) {
+    DungeonInfo info;
+    info.id = id;
+    info.name = GetDungeonName(id);
+    info.start_room = -1;
+    info.boss_room = -1;
+    info.rooms = rooms;
+
+    if (id < zelda3::kNumVanillaDungeons) {
+      // Read start room (1 byte per dungeon)
+      info.start_room = rom->data()[kDungeonsStartRooms + id];
+
+      // Read boss room (2 bytes per dungeon)
+      uint16_t boss_room_addr = kDungeonsBossRooms + (id * 2);
+      info.boss_room =
+          rom->data()[boss_room_addr] | (rom->data()[boss_room_addr + 1] << 8);
+
+      // Boss room 0xFFFF means no boss
+      if (info.boss_room == 0xFFFF) {
+        info.boss_room = -1;
+      }
     }
-    const auto& spawn = spawn_or.value();
-
-    int dungeon_id = spawn.dungeon_id;
-    int room_id = spawn.room_id;
 
-    room_to_dungeon[room_id] = dungeon_id;
-
-    if (dungeons.find(dungeon_id) != dungeons.end()) {
-      dungeons[dungeon_id].rooms.insert(room_id);
-    }
+    dungeons[id] = info;
   }
 
   // Find rooms not assigned to any dungeon
   std::set<int> unassigned_rooms;
   for (int room_id = 0; room_id < zelda3::kNumberOfRooms; ++room_id) {
-    if (room_to_dungeon.find(room_id) == room_to_dungeon.end()) {
+    if (!index.dungeon_by_room.contains(room_id)) {
       unassigned_rooms.insert(room_id);
     }
   }
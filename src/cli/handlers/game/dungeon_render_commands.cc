@@ -8,6 +8,7 @@
 #include "absl/strings/str_format.h"
 #include "app/service/render_service.h"
 #include "cli/service/resources/command_context.h"
+#include "cli/service/resources/resident_world_cache.h"
 #include "rom/rom.h"
 #include "zelda3/game_data.h"
 
@@ -90,16 +91,16 @@ absl::Status DungeonRenderCommandHandler::Execute(
     }
   }
 
-  // Load GameData (palette groups, tileset tables).
-  zelda3::GameData game_data;
-  auto gd_status = zelda3::LoadGameData(*rom, game_data);
-  if (!gd_status.ok()) {
-    return absl::InternalError(
-        absl::StrFormat("Failed to load game data: %s", gd_status.message()));
+  // Load GameData (palette groups, tileset tables); reused across requests
+  // under `z3ed serve`.
+  auto game_data = World(rom).GetGameData();
+  if (!game_data.ok()) {
+    return absl::InternalError(absl::StrFormat(
+        "Failed to load game data: %s", game_data.status().message()));
   }
 
   // Render.
-  app::service::RenderService render_service(rom, &game_data);
+  app::service::RenderService render_service(rom, *game_data);
   app::service::RenderRequest req;
   req.room_id = room_id;
   req.overlay_flags = overlay_flags;
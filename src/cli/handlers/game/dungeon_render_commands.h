@@ -24,6 +24,7 @@ class DungeonRenderCommandHandler : public resources::CommandHandler {
            "[--overlays=collision,track,sprites,objects,grid,camera,all] "
            "[--scale=<float>]";
   }
+  bool ReadsRomOnly() const override { return true; }
 
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override;
   absl::Status Execute(Rom* rom, const resources::ArgumentParser& parser,
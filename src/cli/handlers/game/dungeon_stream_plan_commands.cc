@@ -1,7 +1,7 @@
 #include "cli/handlers/game/dungeon_stream_plan_commands.h"
 
 #include <cstdint>
-#include <map>
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -111,10 +111,31 @@ void AddIntervals(resources::OutputFormatter& formatter,
   formatter.EndArray();
 }
 
-struct UniqueStream {
-  uint32_t end_pc = 0;
-  std::vector<uint32_t> room_ids;
-};
+void AddRepackCost(resources::OutputFormatter& formatter,
+                   const zelda3::DungeonStreamRepackCost& cost) {
+  formatter.AddField("repack_unique_payloads",
+                     static_cast<uint64_t>(cost.unique_payloads));
+  formatter.AddField("repack_deduplicated_rooms",
+                     static_cast<uint64_t>(cost.deduplicated_rooms));
+  formatter.AddField("repack_payload_bytes",
+                     static_cast<uint64_t>(cost.payload_bytes));
+  formatter.AddField("repack_kept_payloads",
+                     static_cast<uint64_t>(cost.kept_payloads));
+  formatter.AddField("repack_moved_payloads",
+                     static_cast<uint64_t>(cost.moved_payloads));
+  formatter.AddField("repack_moved_bytes",
+                     static_cast<uint64_t>(cost.moved_bytes));
+  formatter.AddField("repack_evicted_payloads",
+                     static_cast<uint64_t>(cost.evicted_payloads));
+  formatter.AddField("repack_repointed_rooms",
+                     static_cast<uint64_t>(cost.repointed_rooms));
+  formatter.AddField("repack_free_bytes",
+                     static_cast<uint64_t>(cost.free_bytes));
+  formatter.AddField("repack_free_fragments",
+                     static_cast<uint64_t>(cost.free_fragments));
+  formatter.AddField("repack_largest_free_fragment",
+                     static_cast<uint64_t>(cost.largest_free_fragment));
+}
 
 }  // namespace
 
@@ -152,16 +173,9 @@ absl::Status DungeonStreamPlanCommandHandler::Execute(
   ASSIGN_OR_RETURN(inventory,
                    zelda3::InventoryDungeonStreams(*rom, allocator_layout));
 
-  std::map<uint32_t, UniqueStream> unique_streams;
   uint64_t valid_stream_slots = 0;
-  for (const auto& stream : inventory.streams) {
-    if (!stream.valid) {
-      continue;
-    }
-    ++valid_stream_slots;
-    auto& unique = unique_streams[stream.data_pc];
-    unique.end_pc = stream.logical_end_pc;
-    unique.room_ids.push_back(stream.room_id);
+  for (const auto& extent : inventory.extents) {
+    valid_stream_slots += extent.room_ids.size();
   }
 
   uint64_t suffix_overlaps = 0;
@@ -201,7 +215,7 @@ absl::Status DungeonStreamPlanCommandHandler::Execute(
                      static_cast<uint64_t>(inventory.streams.size()));
   formatter.AddField("valid_stream_slot_count", valid_stream_slots);
   formatter.AddField("unique_stream_count",
-                     static_cast<uint64_t>(unique_streams.size()));
+                     static_cast<uint64_t>(inventory.extents.size()));
   formatter.AddField("exact_alias_group_count",
                      static_cast<uint64_t>(inventory.aliases.size()));
   formatter.AddField("exact_aliased_room_count", exact_aliased_rooms);
@@ -217,12 +231,14 @@ absl::Status DungeonStreamPlanCommandHandler::Execute(
                      SumIntervalBytes(inventory.allocatable_free_intervals));
 
   formatter.BeginArray("unique_streams");
-  for (const auto& [data_pc, stream] : unique_streams) {
+  for (const auto& extent : inventory.extents) {
     formatter.BeginObject();
-    formatter.AddHexField("data_pc", data_pc, 6);
-    formatter.AddHexField("end_pc", stream.end_pc, 6);
-    formatter.AddField("bytes", static_cast<uint64_t>(stream.end_pc) - data_pc);
-    AddRoomIds(formatter, stream.room_ids);
+    formatter.AddHexField("data_pc", extent.data_pc, 6);
+    formatter.AddHexField("end_pc", extent.logical_end_pc, 6);
+    formatter.AddField("bytes", static_cast<uint64_t>(extent.size()));
+    formatter.AddField("capacity_bytes",
+                       static_cast<uint64_t>(extent.capacity()));
+    AddRoomIds(formatter, extent.room_ids);
     formatter.EndObject();
   }
   formatter.EndArray();
@@ -231,11 +247,13 @@ absl::Status DungeonStreamPlanCommandHandler::Execute(
   for (const auto& alias : inventory.aliases) {
     formatter.BeginObject();
     formatter.AddHexField("data_pc", alias.data_pc, 6);
-    const auto unique = unique_streams.find(alias.data_pc);
-    if (unique != unique_streams.end()) {
-      formatter.AddHexField("end_pc", unique->second.end_pc, 6);
-      formatter.AddField("bytes", static_cast<uint64_t>(unique->second.end_pc) -
-                                      alias.data_pc);
+    const auto extent = std::lower_bound(
+        inventory.extents.begin(), inventory.extents.end(), alias.data_pc,
+        [](const auto& e, uint32_t pc) { return e.data_pc < pc; });
+    if (extent != inventory.extents.end() &&
+        extent->data_pc == alias.data_pc) {
+      formatter.AddHexField("end_pc", extent->logical_end_pc, 6);
+      formatter.AddField("bytes", static_cast<uint64_t>(extent->size()));
     }
     AddRoomIds(formatter, alias.room_ids);
     formatter.EndObject();
@@ -281,6 +299,18 @@ absl::Status DungeonStreamPlanCommandHandler::Execute(
   AddIntervals(formatter, "allocatable_intervals",
                inventory.allocatable_free_intervals);
 
+  if (inventory.ok() &&
+      manifest_layout->strategy == core::DungeonWriteStrategy::kRepackAll) {
+    // What a save would disturb if it had to repack the unedited layout.
+    auto repack = zelda3::PlanDungeonStreamRepack(inventory, {});
+    formatter.AddField("repack_status",
+                       repack.ok() ? std::string("ok")
+                                   : std::string(repack.status().message()));
+    if (repack.ok()) {
+      AddRepackCost(formatter, repack->repack_cost);
+    }
+  }
+
   if (!inventory.ok()) {
     return absl::FailedPreconditionError(
         absl::StrFormat("Dungeon stream inventory contains %zu issue(s)",
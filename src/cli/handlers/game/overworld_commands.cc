@@ -2,6 +2,7 @@
 
 #include "absl/strings/str_format.h"
 #include "cli/handlers/game/overworld_inspect.h"
+#include "cli/service/resources/resident_world_cache.h"
 #include "cli/util/hex_util.h"
 #include "util/macro.h"
 #include "zelda3/overworld/overworld.h"
@@ -64,11 +65,10 @@ absl::Status OverworldGetTileCommandHandler::Execute(
   RETURN_IF_ERROR(ValidateMapId(map_id));
   RETURN_IF_ERROR(ValidateTileCoordinates(x, y));
 
-  zelda3::Overworld overworld(rom);
-  RETURN_IF_ERROR(overworld.Load(rom));
-  RETURN_IF_ERROR(SetOverworldContextForMap(map_id, &overworld));
+  ASSIGN_OR_RETURN(zelda3::Overworld * overworld, World(rom).GetOverworld());
+  RETURN_IF_ERROR(SetOverworldContextForMap(map_id, overworld));
 
-  const uint16_t tile = overworld.GetTile(x, y);
+  const uint16_t tile = overworld->GetTile(x, y);
   formatter.BeginObject("Overworld Tile");
   formatter.AddHexField("map_id", map_id, 2);
   formatter.AddField("x", x);
@@ -139,12 +139,9 @@ absl::Status OverworldFindTileCommandHandler::Execute(
     return absl::InvalidArgumentError("Invalid tile ID format. Must be hex.");
   }
 
-  // Load the Overworld from ROM
-  zelda3::Overworld overworld(rom);
-  auto ow_status = overworld.Load(rom);
-  if (!ow_status.ok()) {
-    return ow_status;
-  }
+  // Decoded once per ROM revision when served from `z3ed serve`
+  ASSIGN_OR_RETURN(zelda3::Overworld * loaded, World(rom).GetOverworld());
+  zelda3::Overworld& overworld = *loaded;
 
   // Call the helper function to find tile matches
   auto matches_or = overworld::FindTileMatches(overworld, tile_id);
@@ -185,12 +182,9 @@ absl::Status OverworldDescribeMapCommandHandler::Execute(
     return absl::InvalidArgumentError("Invalid screen ID format. Must be hex.");
   }
 
-  // Load the Overworld from ROM
-  zelda3::Overworld overworld(rom);
-  auto ow_status = overworld.Load(rom);
-  if (!ow_status.ok()) {
-    return ow_status;
-  }
+  // Decoded once per ROM revision when served from `z3ed serve`
+  ASSIGN_OR_RETURN(zelda3::Overworld * loaded, World(rom).GetOverworld());
+  zelda3::Overworld& overworld = *loaded;
 
   // Call the helper function to build the map summary
   auto summary_or = overworld::BuildMapSummary(overworld, screen_id);
@@ -317,12 +311,9 @@ absl::Status OverworldListWarpsCommandHandler::Execute(
     resources::OutputFormatter& formatter) {
   auto screen_id_str = parser.GetString("screen").value_or("all");
 
-  // Load the Overworld from ROM
-  zelda3::Overworld overworld(rom);
-  auto ow_status = overworld.Load(rom);
-  if (!ow_status.ok()) {
-    return ow_status;
-  }
+  // Decoded once per ROM revision when served from `z3ed serve`
+  ASSIGN_OR_RETURN(zelda3::Overworld * loaded, World(rom).GetOverworld());
+  zelda3::Overworld& overworld = *loaded;
 
   // Build the query
   overworld::WarpQuery query;
@@ -384,12 +375,9 @@ absl::Status OverworldListSpritesCommandHandler::Execute(
     resources::OutputFormatter& formatter) {
   auto screen_id_str = parser.GetString("screen").value_or("all");
 
-  // Load the Overworld from ROM
-  zelda3::Overworld overworld(rom);
-  auto ow_status = overworld.Load(rom);
-  if (!ow_status.ok()) {
-    return ow_status;
-  }
+  // Decoded once per ROM revision when served from `z3ed serve`
+  ASSIGN_OR_RETURN(zelda3::Overworld * loaded, World(rom).GetOverworld());
+  zelda3::Overworld& overworld = *loaded;
 
   // Build the query
   overworld::SpriteQuery query;
@@ -441,12 +429,9 @@ absl::Status OverworldListItemsCommandHandler::Execute(
     resources::OutputFormatter& formatter) {
   auto screen_id_str = parser.GetString("screen").value_or("all");
 
-  // Load the Overworld from ROM
-  zelda3::Overworld overworld(rom);
-  auto ow_status = overworld.Load(rom);
-  if (!ow_status.ok()) {
-    return ow_status;
-  }
+  // Decoded once per ROM revision when served from `z3ed serve`
+  ASSIGN_OR_RETURN(zelda3::Overworld * loaded, World(rom).GetOverworld());
+  zelda3::Overworld& overworld = *loaded;
 
   // Optional screen filter
   std::optional<int> map_filter;
@@ -516,12 +501,9 @@ absl::Status OverworldGetEntranceCommandHandler::Execute(
         "Invalid entrance ID format. Must be hex.");
   }
 
-  // Load the Overworld from ROM
-  zelda3::Overworld overworld(rom);
-  auto ow_status = overworld.Load(rom);
-  if (!ow_status.ok()) {
-    return ow_status;
-  }
+  // Decoded once per ROM revision when served from `z3ed serve`
+  ASSIGN_OR_RETURN(zelda3::Overworld * loaded, World(rom).GetOverworld());
+  zelda3::Overworld& overworld = *loaded;
 
   // Call the helper function to get entrance details
   auto details_or = overworld::GetEntranceDetails(overworld, entrance_id);
@@ -557,12 +539,9 @@ absl::Status OverworldTileStatsCommandHandler::Execute(
     resources::OutputFormatter& formatter) {
   auto screen_id_str = parser.GetString("screen").value_or("all");
 
-  // Load the Overworld from ROM
-  zelda3::Overworld overworld(rom);
-  auto ow_status = overworld.Load(rom);
-  if (!ow_status.ok()) {
-    return ow_status;
-  }
+  // Decoded once per ROM revision when served from `z3ed serve`
+  ASSIGN_OR_RETURN(zelda3::Overworld * loaded, World(rom).GetOverworld());
+  zelda3::Overworld& overworld = *loaded;
 
   // TODO: Implement comprehensive tile statistics
   // The AnalyzeTileUsage helper requires a specific tile_id,
@@ -17,6 +17,8 @@ class OverworldGetTileCommandHandler : public resources::CommandHandler {
     return "overworld-get-tile --map <map_id> --x <x> --y <y>";
   }
 
+  bool ReadsRomOnly() const override { return true; }
+
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
     return parser.RequireArgs({"map", "x", "y"});
   }
@@ -56,6 +58,8 @@ class OverworldFindTileCommandHandler : public resources::CommandHandler {
     return "overworld-find-tile --tile <tile_id> [--format <json|text>]";
   }
 
+  bool ReadsRomOnly() const override { return true; }
+
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
     return parser.RequireArgs({"tile"});
   }
@@ -77,6 +81,8 @@ class OverworldDescribeMapCommandHandler : public resources::CommandHandler {
     return "overworld-describe-map --screen <screen_id> [--format <json|text>]";
   }
 
+  bool ReadsRomOnly() const override { return true; }
+
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
     return parser.RequireArgs({"screen"});
   }
@@ -98,6 +104,8 @@ class OverworldListWarpsCommandHandler : public resources::CommandHandler {
     return "overworld-list-warps [--screen <screen_id>] [--format <json|text>]";
   }
 
+  bool ReadsRomOnly() const override { return true; }
+
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
     return absl::OkStatus();  // No required args
   }
@@ -120,6 +128,8 @@ class OverworldListSpritesCommandHandler : public resources::CommandHandler {
            "<json|text>]";
   }
 
+  bool ReadsRomOnly() const override { return true; }
+
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
     return absl::OkStatus();  // No required args
   }
@@ -142,6 +152,8 @@ class OverworldListItemsCommandHandler : public resources::CommandHandler {
            "<json|text>]";
   }
 
+  bool ReadsRomOnly() const override { return true; }
+
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
     return absl::OkStatus();  // No required args
   }
@@ -164,6 +176,8 @@ class OverworldGetEntranceCommandHandler : public resources::CommandHandler {
            "<json|text>]";
   }
 
+  bool ReadsRomOnly() const override { return true; }
+
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
     return parser.RequireArgs({"entrance"});
   }
@@ -185,6 +199,8 @@ class OverworldTileStatsCommandHandler : public resources::CommandHandler {
     return "overworld-tile-stats [--screen <screen_id>] [--format <json|text>]";
   }
 
+  bool ReadsRomOnly() const override { return true; }
+
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
     return absl::OkStatus();  // No required args
   }
@@ -1,9 +1,15 @@
 #include "cli/handlers/graphics/hex_commands.h"
 
+#include <algorithm>
 #include <cctype>
+#include <fstream>
+#include <limits>
+#include <sstream>
 
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_split.h"
+#include "rom/byte_pattern_search.h"
+#include "util/macro.h"
 
 namespace yaze {
 namespace cli {
@@ -142,10 +148,19 @@ absl::Status HexWriteCommandHandler::Execute(
   return absl::OkStatus();
 }
 
+absl::Status HexSearchCommandHandler::ValidateArgs(
+    const resources::ArgumentParser& parser) {
+  if (!parser.GetString("pattern").has_value() &&
+      !parser.GetString("patterns-file").has_value()) {
+    return absl::InvalidArgumentError(
+        "hex-search requires --pattern or --patterns-file");
+  }
+  return absl::OkStatus();
+}
+
 absl::Status HexSearchCommandHandler::Execute(
     Rom* rom, const resources::ArgumentParser& parser,
     resources::OutputFormatter& formatter) {
-  auto pattern_str = parser.GetString("pattern").value();
   auto start_str = parser.GetString("start").value_or("0x000000");
   auto end_str = parser.GetString("end").value_or(
       absl::StrFormat("0x%06X", static_cast<int>(rom->size())));
@@ -159,49 +174,69 @@ absl::Status HexSearchCommandHandler::Execute(
     return absl::InvalidArgumentError(
         absl::StrFormat("Invalid address format: %s", e.what()));
   }
+  end_address = std::min<uint32_t>(end_address, rom->size());
+  if (start_address > end_address) {
+    return absl::InvalidArgumentError(absl::StrFormat(
+        "Start 0x%06X is past end 0x%06X", start_address, end_address));
+  }
+  ASSIGN_OR_RETURN(auto data,
+                   rom->ReadSpan(start_address, end_address - start_address));
 
-  // Parse pattern
-  std::vector<std::string> byte_strs = absl::StrSplit(pattern_str, ' ');
-  std::vector<std::pair<uint8_t, bool>> pattern;  // (value, is_wildcard)
+  int max_matches = parser.GetInt("max-matches").value_or(0);
 
-  for (const auto& byte_str : byte_strs) {
-    if (byte_str.empty())
-      continue;
-    if (byte_str == "??" || byte_str == "**") {
-      pattern.push_back({0, true});  // Wildcard
-    } else {
-      try {
-        uint8_t value = static_cast<uint8_t>(std::stoul(byte_str, nullptr, 16));
-        pattern.push_back({value, false});
-      } catch (const std::exception& e) {
-        return absl::InvalidArgumentError(absl::StrFormat(
-            "Invalid pattern byte '%s': %s", byte_str, e.what()));
-      }
+  if (auto patterns_path = parser.GetString("patterns-file");
+      patterns_path.has_value()) {
+    std::ifstream file(*patterns_path);
+    if (!file) {
+      return absl::NotFoundError(
+          absl::StrFormat("Cannot open patterns file: %s", *patterns_path));
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    ASSIGN_OR_RETURN(auto patterns, rom::ParseBytePatternList(buffer.str()));
+    if (patterns.empty()) {
+      return absl::InvalidArgumentError(
+          absl::StrFormat("No patterns in %s", *patterns_path));
     }
-  }
 
-  if (pattern.empty()) {
-    return absl::InvalidArgumentError("Empty pattern");
-  }
+    rom::MultiPatternSearcher searcher(std::move(patterns));
+    auto matches = searcher.FindAll(data);
+    if (max_matches > 0 && matches.size() > static_cast<size_t>(max_matches)) {
+      matches.resize(max_matches);
+    }
 
-  // Search for pattern
-  std::vector<uint32_t> matches;
-  const uint8_t* rom_data = rom->data();
-
-  for (uint32_t i = start_address; i <= end_address - pattern.size(); ++i) {
-    bool match = true;
-    for (size_t j = 0; j < pattern.size(); ++j) {
-      if (!pattern[j].second &&  // If not wildcard
-          rom_data[i + j] != pattern[j].first) {
-        match = false;
-        break;
+    formatter.BeginObject("Hex Search Results");
+    formatter.AddField("patterns_file", *patterns_path);
+    formatter.AddField("pattern_count",
+                       static_cast<int>(searcher.patterns().size()));
+    formatter.AddHexField("start_address", start_address, 6);
+    formatter.AddHexField("end_address", end_address, 6);
+    formatter.AddField("matches_found", static_cast<int>(matches.size()));
+
+    formatter.BeginArray("matches");
+    for (const auto& match : matches) {
+      const auto& pattern = searcher.patterns()[match.pattern];
+      formatter.BeginObject();
+      formatter.AddHexField("address", start_address + match.offset, 6);
+      formatter.AddField("pattern", static_cast<int>(match.pattern));
+      if (!pattern.label.empty()) {
+        formatter.AddField("label", pattern.label);
       }
+      formatter.EndObject();
     }
-    if (match) {
-      matches.push_back(i);
-    }
+    formatter.EndArray();
+    formatter.EndObject();
+    return absl::OkStatus();
   }
 
+  auto pattern_str = parser.GetString("pattern").value();
+  ASSIGN_OR_RETURN(auto pattern, rom::ParseBytePattern(pattern_str));
+
+  rom::PatternSearcher searcher(std::move(pattern));
+  const auto matches = searcher.FindAll(
+      data, max_matches > 0 ? static_cast<size_t>(max_matches)
+                            : std::numeric_limits<size_t>::max());
+
   formatter.BeginObject("Hex Search Results");
   formatter.AddField("pattern", pattern_str);
   formatter.AddHexField("start_address", start_address, 6);
@@ -210,7 +245,7 @@ absl::Status HexSearchCommandHandler::Execute(
 
   formatter.BeginArray("matches");
   for (uint32_t match : matches) {
-    formatter.AddArrayItem(absl::StrFormat("0x%06X", match));
+    formatter.AddArrayItem(absl::StrFormat("0x%06X", start_address + match));
   }
   formatter.EndArray();
   formatter.EndObject();
@@ -52,6 +52,9 @@ class HexWriteCommandHandler : public resources::CommandHandler {
 
 /**
  * @brief Command handler for searching hex patterns in ROM
+ *
+ * --pattern takes one pattern ("A9 ?? 8D"); --patterns-file takes one pattern
+ * per line ("label: A9 ?? 8D") and searches them all in a single pass.
  */
 class HexSearchCommandHandler : public resources::CommandHandler {
  public:
@@ -60,12 +63,14 @@ class HexSearchCommandHandler : public resources::CommandHandler {
     return "Search for hex patterns in ROM";
   }
   std::string GetUsage() const {
-    return "hex-search --pattern <pattern> [--start <start>] [--end <end>]";
+    return "hex-search (--pattern <pattern> | --patterns-file <path>) "
+           "[--start <start>] [--end <end>] [--max-matches <n>]";
   }
 
-  absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
-    return parser.RequireArgs({"pattern"});
-  }
+  // Searching never writes, so the ROM can be memory-mapped.
+  bool ReadsRomOnly() const override { return true; }
+
+  absl::Status ValidateArgs(const resources::ArgumentParser& parser) override;
 
   absl::Status Execute(Rom* rom, const resources::ArgumentParser& parser,
                        resources::OutputFormatter& formatter) override;
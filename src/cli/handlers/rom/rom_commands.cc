@@ -6,6 +6,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_split.h"
 #include "cli/util/hex_util.h"
+#include "rom/rom_diff.h"
 #include "util/macro.h"
 
 namespace yaze {
@@ -41,7 +42,7 @@ absl::Status RomReadCommandHandler::Execute(
         "Read beyond ROM: 0x%X+%d > %zu", address, length, rom->size()));
   }
 
-  const uint8_t* data = rom->data() + address;
+  ASSIGN_OR_RETURN(auto data, rom->ReadSpan(address, length));
 
   formatter.AddHexField("address", address, 6);
   formatter.AddField("length", length);
@@ -199,14 +200,18 @@ absl::Status RomDiffCommandHandler::Execute(
   std::string rom_a_path = rom_a_opt.value();
   std::string rom_b_path = rom_b_opt.value();
 
+  // Both ROMs are only read, so map them instead of copying.
+  Rom::LoadOptions load_options;
+  load_options.memory_map = true;
+
   Rom rom_a;
-  auto status_a = rom_a.LoadFromFile(rom_a_path);
+  auto status_a = rom_a.LoadFromFile(rom_a_path, load_options);
   if (!status_a.ok()) {
     return status_a;
   }
 
   Rom rom_b;
-  auto status_b = rom_b.LoadFromFile(rom_b_path);
+  auto status_b = rom_b.LoadFromFile(rom_b_path, load_options);
   if (!status_b.ok()) {
     return status_b;
   }
@@ -221,14 +226,15 @@ absl::Status RomDiffCommandHandler::Execute(
   int differences = 0;
   std::vector<std::string> diff_details;
 
-  for (size_t i = 0; i < rom_a.size(); ++i) {
-    if (rom_a.vector()[i] != rom_b.vector()[i]) {
-      differences++;
-      if (differences <= 10) {  // Limit output to first 10 differences
-        diff_details.push_back(absl::StrFormat("0x%08X: 0x%02X vs 0x%02X", i,
-                                               rom_a.vector()[i],
-                                               rom_b.vector()[i]));
-      }
+  const auto diff = rom::ComputeRomDiff(rom_a, rom_b);
+  differences = static_cast<int>(diff.total_bytes_changed);
+  for (const auto& range : diff.ranges) {
+    // Limit output to first 10 differences
+    for (uint32_t i = range.start; i < range.end && diff_details.size() < 10;
+         ++i) {
+      diff_details.push_back(absl::StrFormat("0x%08X: 0x%02X vs 0x%02X", i,
+                                             rom_a.data()[i],
+                                             rom_b.data()[i]));
     }
   }
 
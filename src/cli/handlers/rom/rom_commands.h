@@ -20,6 +20,7 @@ class RomReadCommandHandler : public resources::CommandHandler {
     return "rom-read --address <hex> [--length <bytes>] "
            "[--data-format <hex|ascii|both>] [--format <json|text>]";
   }
+  bool ReadsRomOnly() const override { return true; }
 
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
     return parser.RequireArgs({"address"});
@@ -58,6 +59,7 @@ class RomInfoCommandHandler : public resources::CommandHandler {
   std::string GetName() const override { return "rom-info"; }
   std::string GetDescription() const { return "Display ROM information"; }
   std::string GetUsage() const override { return "rom-info"; }
+  bool ReadsRomOnly() const override { return true; }
 
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
     return absl::OkStatus();
@@ -75,6 +77,7 @@ class RomValidateCommandHandler : public resources::CommandHandler {
   std::string GetName() const override { return "rom-validate"; }
   std::string GetDescription() const { return "Validate ROM file integrity"; }
   std::string GetUsage() const override { return "rom-validate"; }
+  bool ReadsRomOnly() const override { return true; }
 
   absl::Status ValidateArgs(const resources::ArgumentParser& parser) override {
     return absl::OkStatus();
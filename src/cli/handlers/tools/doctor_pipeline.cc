@@ -0,0 +1,309 @@
+#include "cli/handlers/tools/doctor_pipeline.h"
+
+#include <algorithm>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include "absl/strings/str_format.h"
+#include "app/gfx/util/compression.h"
+#include "util/lru_cache.h"
+#include "util/rom_hash.h"
+#include "util/task_scheduler.h"
+#include "zelda3/dungeon/dungeon_rom_addresses.h"
+#include "zelda3/dungeon/room.h"
+
+namespace yaze::cli {
+
+namespace {
+
+// Enough for every check of every doctor, including one per dungeon room,
+// across a few ROM revisions.
+constexpr size_t kResultCacheCapacity = 1024;
+
+constexpr int kNumGfxSheets = 223;
+constexpr uint32_t kUncompressedSheetSize = 0x0800;
+
+std::mutex& CacheMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+util::LruCache<std::string, DoctorCheckResult>& ResultCache() {
+  static util::LruCache<std::string, DoctorCheckResult> cache(
+      kResultCacheCapacity);
+  return cache;
+}
+
+std::string CacheKey(const DoctorCheck& check, uint64_t fingerprint) {
+  return absl::StrFormat("%s@%d#%016x", check.id, check.version, fingerprint);
+}
+
+RomFeatures DetectFeatures(const Rom& rom) {
+  RomFeatures features;
+  const uint8_t* data = rom.data();
+
+  if (kZSCustomVersionPos < rom.size()) {
+    features.zs_custom_version = data[kZSCustomVersionPos];
+    features.is_vanilla = (features.zs_custom_version == 0xFF ||
+                           features.zs_custom_version == 0x00);
+    features.is_v2 = (!features.is_vanilla && features.zs_custom_version == 2);
+    features.is_v3 = (!features.is_vanilla && features.zs_custom_version >= 3);
+  } else {
+    features.is_vanilla = true;
+  }
+
+  if (!features.is_vanilla) {
+    if (kMap16ExpandedFlagPos < rom.size()) {
+      features.has_expanded_tile16 = (data[kMap16ExpandedFlagPos] != 0x0F);
+    }
+    if (kMap32ExpandedFlagPos < rom.size()) {
+      features.has_expanded_tile32 = (data[kMap32ExpandedFlagPos] != 0x04);
+    }
+  }
+
+  if (kExpandedPtrTableMarker < rom.size()) {
+    features.has_expanded_pointer_tables =
+        (data[kExpandedPtrTableMarker] == kExpandedPtrTableMagic);
+  }
+
+  return features;
+}
+
+// PC offset of a graphics sheet from the bank/high/low pointer tables.
+uint32_t GetGfxAddress(const uint8_t* data, uint8_t sheet_id) {
+  const uint32_t ptr_base = zelda3::kGfxGroupsPointer;
+  const uint8_t bank = data[ptr_base + sheet_id];
+  const uint8_t high = data[ptr_base + 0x100 + sheet_id];
+  const uint8_t low = data[ptr_base + 0x200 + sheet_id];
+  const uint32_t snes_addr = (bank << 16) | (high << 8) | low;
+  // LoROM conversion: bank * 0x8000 + (addr & 0x7FFF)
+  return ((bank & 0x7F) * 0x8000) + (snes_addr & 0x7FFF);
+}
+
+void RunCheck(const DoctorCheck& check, const DoctorSnapshot& snapshot,
+              DoctorCheckResult& result) {
+  try {
+    check.run(snapshot, result);
+  } catch (const std::exception& e) {
+    DiagnosticFinding finding;
+    finding.id = "doctor_check_failed";
+    finding.severity = DiagnosticSeverity::kError;
+    finding.message =
+        absl::StrFormat("Check '%s' failed: %s", check.id, e.what());
+    finding.location = check.id;
+    finding.fixable = false;
+    result.findings.push_back(finding);
+  }
+}
+
+}  // namespace
+
+DoctorSnapshot::DoctorSnapshot(const Rom& rom)
+    : rom_(rom),
+      room_once_(std::make_unique<std::once_flag[]>(zelda3::kNumberOfRooms)),
+      rooms_(zelda3::kNumberOfRooms) {
+  // Build the contiguous view up front so concurrent checks only ever read it.
+  rom_.data();
+  features_ = DetectFeatures(rom_);
+}
+
+DoctorSnapshot::~DoctorSnapshot() = default;
+
+const std::vector<editor::MessageData>& DoctorSnapshot::messages() const {
+  std::call_once(messages_once_, [this]() {
+    try {
+      // The parser takes a mutable pointer; hand it a private copy. Bound
+      // parsing to the ROM size: dummy or damaged ROMs may lack terminators.
+      std::vector<uint8_t> copy = rom_.vector();
+      messages_ = editor::ReadAllTextData(copy.data(), editor::kTextData,
+                                          static_cast<int>(copy.size()));
+    } catch (...) {
+      messages_.clear();
+    }
+  });
+  return messages_;
+}
+
+const std::vector<DoctorSheet>& DoctorSnapshot::sheets() const {
+  std::call_once(sheets_once_, [this]() {
+    if (zelda3::kGfxGroupsPointer + 0x300 >= size()) {
+      return;
+    }
+    sheets_.resize(kNumGfxSheets);
+    util::TaskGroup group;
+    group.RunEach(kNumGfxSheets, [this](int i) {
+      DoctorSheet& sheet = sheets_[i];
+      const uint32_t addr = GetGfxAddress(data(), static_cast<uint8_t>(i));
+      if (addr == 0 || addr >= size()) {
+        sheet.status = absl::OutOfRangeError(
+            absl::StrFormat("Sheet %d pointer 0x%06X is invalid", i, addr));
+        return absl::OkStatus();
+      }
+      sheet.address = addr;
+      auto decoded = gfx::lc_lz2::DecompressV2(
+          data(), addr, kUncompressedSheetSize, 1, size());
+      if (decoded.ok()) {
+        sheet.data = std::move(decoded).value();
+      } else {
+        sheet.status = decoded.status();
+      }
+      return absl::OkStatus();
+    });
+    group.Wait().IgnoreError();
+  });
+  return sheets_;
+}
+
+const zelda3::Room& DoctorSnapshot::room(int room_id) const {
+  std::call_once(room_once_[room_id], [this, room_id]() {
+    auto room = std::make_unique<zelda3::Room>(
+        zelda3::LoadRoomHeaderFromRom(decode_rom(), room_id));
+    room->LoadObjects();
+    room->LoadSprites();
+    rooms_[room_id] = std::move(room);
+  });
+  return *rooms_[room_id];
+}
+
+const DoctorMaps& DoctorSnapshot::maps() const {
+  std::call_once(maps_once_, [this]() {
+    Rom* rom = decode_rom();
+    maps_.maps.reserve(zelda3::kNumOverworldMaps);
+    for (int i = 0; i < zelda3::kNumOverworldMaps; ++i) {
+      maps_.maps.emplace_back(i, rom);
+    }
+    auto exits = zelda3::LoadExits(rom);
+    auto entrances = zelda3::LoadEntrances(rom);
+    auto items = zelda3::LoadItems(rom, maps_.maps);
+    for (const absl::Status& status :
+         {exits.status(), entrances.status(), items.status()}) {
+      maps_.status.Update(status);
+    }
+    if (exits.ok()) {
+      maps_.exits = *std::move(exits);
+    }
+    if (entrances.ok()) {
+      maps_.entrances = *std::move(entrances);
+    }
+    if (items.ok()) {
+      maps_.items = *std::move(items);
+    }
+  });
+  return maps_;
+}
+
+uint64_t DoctorSnapshot::Fingerprint(
+    const std::vector<DoctorInputRange>& inputs) const {
+  constexpr uint64_t kPrime = 0x100000001B3ULL;
+  auto hash_range = [this](uint32_t begin, uint32_t end) -> uint64_t {
+    end = static_cast<uint32_t>(std::min<size_t>(end, size()));
+    if (begin >= end) {
+      return 0;
+    }
+    const uint64_t crc = util::CalculateCrc32(data() + begin, end - begin);
+    return (crc << 32) ^ (end - begin);
+  };
+
+  if (inputs.empty()) {
+    std::call_once(whole_rom_once_, [&]() {
+      whole_rom_fingerprint_ =
+          hash_range(0, static_cast<uint32_t>(size())) * kPrime ^ size();
+    });
+    return whole_rom_fingerprint_;
+  }
+
+  // The ROM size is mixed in because most checks clamp to it.
+  uint64_t hash = 0xCBF29CE484222325ULL ^ size();
+  for (const auto& range : inputs) {
+    hash = (hash ^ range.begin) * kPrime;
+    hash = (hash ^ hash_range(range.begin, range.end)) * kPrime;
+  }
+  return hash;
+}
+
+std::vector<DoctorInputRange> DoctorSnapshot::FeatureInputs() {
+  return {{kMap32ExpandedFlagPos, kMap32ExpandedFlagPos + 1},
+          {kMap16ExpandedFlagPos, kMap16ExpandedFlagPos + 1},
+          {kZSCustomVersionPos, kZSCustomVersionPos + 1},
+          {kExpandedPtrTableMarker, kExpandedPtrTableMarker + 1}};
+}
+
+const int* DoctorCheckResult::FindMetric(const std::string& name) const {
+  for (const auto& [key, value] : metrics) {
+    if (key == name) {
+      return &value;
+    }
+  }
+  return nullptr;
+}
+
+DoctorPipeline& DoctorPipeline::AddCheck(DoctorCheck check) {
+  checks_.push_back(std::move(check));
+  return *this;
+}
+
+std::vector<DoctorCheckResult> DoctorPipeline::Run(
+    const DoctorSnapshot& snapshot, const Options& options) const {
+  std::vector<DoctorCheckResult> results(checks_.size());
+  std::vector<std::string> keys(checks_.size());
+  std::vector<size_t> pending;
+
+  for (size_t i = 0; i < checks_.size(); ++i) {
+    results[i].check_id = checks_[i].id;
+    if (!options.use_cache) {
+      pending.push_back(i);
+      continue;
+    }
+    keys[i] = CacheKey(checks_[i], snapshot.Fingerprint(checks_[i].inputs));
+    std::lock_guard<std::mutex> lock(CacheMutex());
+    if (const DoctorCheckResult* hit = ResultCache().Get(keys[i])) {
+      results[i] = *hit;
+      results[i].cached = true;
+    } else {
+      pending.push_back(i);
+    }
+  }
+
+  if (pending.empty()) {
+    return results;
+  }
+
+  // The waiting thread runs checks too, so a private pool needs one thread
+  // fewer than the requested count.
+  std::optional<util::TaskScheduler> private_pool;
+  if (options.worker_count > 0) {
+    private_pool.emplace(options.worker_count - 1);
+  }
+  {
+    util::TaskGroup group(
+        private_pool ? *private_pool : util::TaskScheduler::Get(),
+        util::TaskPriority::kNormal);
+    group.RunEach(static_cast<int>(pending.size()), [&](int i) {
+      const size_t index = pending[i];
+      RunCheck(checks_[index], snapshot, results[index]);
+      return absl::OkStatus();
+    });
+    group.Wait().IgnoreError();
+  }
+
+  if (options.use_cache) {
+    std::lock_guard<std::mutex> lock(CacheMutex());
+    for (size_t index : pending) {
+      ResultCache().Insert(keys[index], results[index]);
+    }
+  }
+  return results;
+}
+
+void DoctorPipeline::ClearCache() {
+  std::lock_guard<std::mutex> lock(CacheMutex());
+  ResultCache().Clear();
+}
+
+size_t DoctorPipeline::CacheSize() {
+  std::lock_guard<std::mutex> lock(CacheMutex());
+  return ResultCache().Size();
+}
+
+}  // namespace yaze::cli
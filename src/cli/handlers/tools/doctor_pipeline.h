@@ -0,0 +1,189 @@
+#ifndef YAZE_CLI_HANDLERS_TOOLS_DOCTOR_PIPELINE_H
+#define YAZE_CLI_HANDLERS_TOOLS_DOCTOR_PIPELINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "app/editor/message/message_data.h"
+#include "cli/handlers/tools/diagnostic_types.h"
+#include "rom/rom.h"
+#include "zelda3/overworld/overworld_entrance.h"
+#include "zelda3/overworld/overworld_exit.h"
+#include "zelda3/overworld/overworld_item.h"
+#include "zelda3/overworld/overworld_map.h"
+
+namespace yaze::zelda3 {
+class Room;
+}  // namespace yaze::zelda3
+
+namespace yaze::cli {
+
+/**
+ * @brief Half-open PC byte range a doctor check reads
+ */
+struct DoctorInputRange {
+  uint32_t begin = 0;
+  uint32_t end = 0;
+};
+
+/**
+ * @brief One graphics sheet as the ROM's sheet pointer table describes it
+ */
+struct DoctorSheet {
+  uint32_t address = 0;  // PC offset; 0 when the pointer is invalid
+  absl::Status status;   // Decompression result
+  std::vector<uint8_t> data;
+};
+
+/**
+ * @brief Overworld maps with the entities placed on them
+ */
+struct DoctorMaps {
+  absl::Status status;  // First load error; the vectors may then be partial
+  std::vector<zelda3::OverworldMap> maps;
+  std::vector<zelda3::OverworldExit> exits;
+  std::vector<zelda3::OverworldEntrance> entrances;
+  std::vector<zelda3::OverworldItem> items;
+};
+
+/**
+ * @brief Immutable ROM state shared by every check of one doctor run
+ *
+ * Holds a copy-on-write clone of the ROM, so later edits to the caller's ROM
+ * (e.g. a resident ROM in `z3ed serve`) never race with running checks.
+ * Expensive domains are decoded at most once, on first use, no matter how
+ * many checks ask for them; all accessors are safe to call concurrently.
+ */
+class DoctorSnapshot {
+ public:
+  explicit DoctorSnapshot(const Rom& rom);
+  ~DoctorSnapshot();
+
+  const Rom& rom() const { return rom_; }
+  const uint8_t* data() const { return rom_.data(); }
+  size_t size() const { return rom_.size(); }
+
+  /// ZSCustomOverworld version and expansion flags from the header bytes.
+  const RomFeatures& features() const { return features_; }
+
+  /// All messages of the main text bank, parsed. Empty when decoding failed.
+  const std::vector<editor::MessageData>& messages() const;
+
+  /// Every graphics sheet, decompressed in parallel on first use. Empty when
+  /// the sheet pointer table lies beyond the ROM.
+  const std::vector<DoctorSheet>& sheets() const;
+
+  /// Room header, objects and sprites. Each room is decoded on first use;
+  /// `room_id` must be below zelda3::kNumberOfRooms.
+  const zelda3::Room& room(int room_id) const;
+
+  /// Overworld map headers, exits, entrances and hidden items.
+  const DoctorMaps& maps() const;
+
+  /// Stable hash of the given ranges (clamped to the ROM); empty means the
+  /// whole ROM. Used as the cache key for check results.
+  uint64_t Fingerprint(const std::vector<DoctorInputRange>& inputs) const;
+
+  /// Bytes that features() is derived from; checks reading features() list
+  /// these as inputs.
+  static std::vector<DoctorInputRange> FeatureInputs();
+
+ private:
+  Rom rom_;
+  RomFeatures features_;
+
+  // Decoders take a mutable Rom; they only read through it.
+  Rom* decode_rom() const { return const_cast<Rom*>(&rom_); }
+
+  mutable std::once_flag messages_once_;
+  mutable std::vector<editor::MessageData> messages_;
+
+  mutable std::once_flag sheets_once_;
+  mutable std::vector<DoctorSheet> sheets_;
+
+  mutable std::unique_ptr<std::once_flag[]> room_once_;
+  mutable std::vector<std::unique_ptr<zelda3::Room>> rooms_;
+
+  mutable std::once_flag maps_once_;
+  mutable DoctorMaps maps_;
+
+  mutable std::once_flag whole_rom_once_;
+  mutable uint64_t whole_rom_fingerprint_ = 0;
+};
+
+/**
+ * @brief Output of one doctor check
+ */
+struct DoctorCheckResult {
+  std::string check_id;
+  std::vector<DiagnosticFinding> findings;
+  // Named values for the command's output, e.g. {"free_space_estimate", n}.
+  std::vector<std::pair<std::string, int>> metrics;
+  // True when the result came from the cache instead of running the check.
+  bool cached = false;
+
+  const int* FindMetric(const std::string& name) const;
+};
+
+/**
+ * @brief A single independent analysis step
+ *
+ * `run` must only read the snapshot. `inputs` lists every byte range the
+ * check's result depends on (empty means the whole ROM); together with `id`
+ * and `version` it keys the result cache, so bump `version` whenever the
+ * check's logic or output changes.
+ */
+struct DoctorCheck {
+  std::string id;
+  int version = 1;
+  std::vector<DoctorInputRange> inputs;
+  std::function<void(const DoctorSnapshot&, DoctorCheckResult&)> run;
+};
+
+/**
+ * @class DoctorPipeline
+ * @brief Runs doctor checks in parallel over one snapshot, with caching
+ *
+ * Results are looked up in a process-wide cache keyed by check id, version
+ * and the fingerprint of the check's inputs, so after an edit only checks
+ * whose input ranges changed run again. Cache misses run as one
+ * util::TaskGroup on the shared util::TaskScheduler. Results are returned in
+ * registration order regardless of which thread produced them, keeping doctor
+ * output deterministic.
+ */
+class DoctorPipeline {
+ public:
+  struct Options {
+    // <= 0: the shared scheduler. Otherwise a private pool of this many
+    // threads, counting the caller (1 runs every check on the caller).
+    int worker_count = 0;
+    bool use_cache = true;
+  };
+
+  DoctorPipeline& AddCheck(DoctorCheck check);
+  size_t check_count() const { return checks_.size(); }
+
+  std::vector<DoctorCheckResult> Run(const DoctorSnapshot& snapshot) const {
+    return Run(snapshot, Options{});
+  }
+  std::vector<DoctorCheckResult> Run(const DoctorSnapshot& snapshot,
+                                     const Options& options) const;
+
+  /// Drops every cached result (all pipelines share the cache).
+  static void ClearCache();
+  static size_t CacheSize();
+
+ private:
+  std::vector<DoctorCheck> checks_;
+};
+
+}  // namespace yaze::cli
+
+#endif  // YAZE_CLI_HANDLERS_TOOLS_DOCTOR_PIPELINE_H
@@ -6,6 +6,7 @@
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "cli/handlers/tools/diagnostic_types.h"
+#include "cli/handlers/tools/doctor_pipeline.h"
 #include "rom/rom.h"
 #include "zelda3/dungeon/dungeon_validator.h"
 #include "zelda3/dungeon/object_layer_semantics.h"
@@ -19,9 +20,6 @@ namespace {
 // Number of rooms in vanilla ALTTP
 constexpr int kNumRooms = 296;
 
-// Room header pointer table location
-constexpr uint32_t kRoomHeaderPointer = 0x882D;
-
 struct RoomDiagnostic {
   int room_id = 0;
   bool header_valid = false;
@@ -54,31 +52,17 @@ struct RoomDiagnostic {
   }
 };
 
-RoomDiagnostic DiagnoseRoom(Rom* rom, int room_id) {
-  RoomDiagnostic diag;
-  diag.room_id = room_id;
-
-  // Try to load room header
-  zelda3::Room room = zelda3::LoadRoomHeaderFromRom(rom, room_id);
-
-  // Check if header loaded correctly
-  diag.header_valid =
-      true;  // LoadRoomHeaderFromRom doesn't fail, it just returns empty
-
-  // Load objects
-  room.LoadObjects();
-  diag.object_count = static_cast<int>(room.GetTileObjects().size());
-
-  // Load sprites
-  room.LoadSprites();
-  diag.sprite_count = static_cast<int>(room.GetSprites().size());
+// One room's findings and counts. The snapshot decodes the room header,
+// objects and sprites; LoadRoomHeaderFromRom doesn't fail, so the header is
+// always reported valid.
+void DiagnoseRoom(const DoctorSnapshot& snapshot, int room_id,
+                  DoctorCheckResult& check_result) {
+  const zelda3::Room& room = snapshot.room(room_id);
 
   // Use DungeonValidator for detailed checks
   zelda3::DungeonValidator validator;
   auto result = validator.ValidateRoom(room);
-
-  diag.objects_valid = result.is_valid;
-  diag.sprites_valid = result.is_valid;
+  bool objects_valid = result.is_valid;
 
   // Convert validation warnings to findings
   for (const auto& warning : result.warnings) {
@@ -88,7 +72,7 @@ RoomDiagnostic DiagnoseRoom(Rom* rom, int room_id) {
     finding.message = warning;
     finding.location = absl::StrFormat("Room 0x%02X", room_id);
     finding.fixable = false;
-    diag.findings.push_back(finding);
+    check_result.findings.push_back(finding);
   }
 
   // Convert validation errors to findings
@@ -99,18 +83,56 @@ RoomDiagnostic DiagnoseRoom(Rom* rom, int room_id) {
     finding.message = error;
     finding.location = absl::StrFormat("Room 0x%02X", room_id);
     finding.fixable = false;
-    diag.findings.push_back(finding);
-    diag.objects_valid = false;
+    check_result.findings.push_back(finding);
+    objects_valid = false;
   }
 
   // Count chests
+  int chest_count = 0;
   for (const auto& obj : room.GetTileObjects()) {
     if (zelda3::UsesRoomObjectStream(obj) &&
         zelda3::IsStatefulChestObjectId(obj.id_)) {
-      diag.chest_count++;
+      chest_count++;
     }
   }
 
+  check_result.metrics.emplace_back(
+      "object_count", static_cast<int>(room.GetTileObjects().size()));
+  check_result.metrics.emplace_back(
+      "sprite_count", static_cast<int>(room.GetSprites().size()));
+  check_result.metrics.emplace_back("chest_count", chest_count);
+  check_result.metrics.emplace_back("objects_valid", objects_valid ? 1 : 0);
+  check_result.metrics.emplace_back("sprites_valid", result.is_valid ? 1 : 0);
+}
+
+// One check per room so rooms are validated in parallel. Room data can live
+// anywhere in the ROM, so every check depends on the whole ROM.
+DoctorPipeline BuildDungeonDoctorPipeline(const std::vector<int>& room_ids) {
+  DoctorPipeline pipeline;
+  for (int room_id : room_ids) {
+    pipeline.AddCheck({absl::StrFormat("dungeon_room_%03X", room_id), 1, {},
+                       [room_id](const DoctorSnapshot& snapshot,
+                                 DoctorCheckResult& result) {
+                         DiagnoseRoom(snapshot, room_id, result);
+                       }});
+  }
+  return pipeline;
+}
+
+RoomDiagnostic ToRoomDiagnostic(int room_id, const DoctorCheckResult& result) {
+  auto metric = [&result](const char* name) {
+    const int* value = result.FindMetric(name);
+    return value != nullptr ? *value : 0;
+  };
+  RoomDiagnostic diag;
+  diag.room_id = room_id;
+  diag.header_valid = true;
+  diag.objects_valid = metric("objects_valid") != 0;
+  diag.sprites_valid = metric("sprites_valid") != 0;
+  diag.object_count = metric("object_count");
+  diag.sprite_count = metric("sprite_count");
+  diag.chest_count = metric("chest_count");
+  diag.findings = result.findings;
   return diag;
 }
 
@@ -189,6 +211,7 @@ absl::Status DungeonDoctorCommandHandler::Execute(
   int warning_rooms = 0;
   int error_rooms = 0;
 
+  std::vector<int> room_ids;
   if (room_id_arg.ok()) {
     // Single room mode
     int room_id = room_id_arg.value();
@@ -196,63 +219,14 @@ absl::Status DungeonDoctorCommandHandler::Execute(
       return absl::InvalidArgumentError(
           absl::StrFormat("Room ID must be between 0 and %d", kNumRooms - 1));
     }
-
-    auto diag = DiagnoseRoom(rom, room_id);
-    diagnostics.push_back(diag);
-    total_objects = diag.object_count;
-    total_sprites = diag.sprite_count;
-
-    if (diag.IsValid() && diag.findings.empty()) {
-      valid_rooms = 1;
-    } else {
-      bool has_errors = false;
-      bool has_warnings = false;
-      for (const auto& finding : diag.findings) {
-        if (finding.severity == DiagnosticSeverity::kError ||
-            finding.severity == DiagnosticSeverity::kCritical) {
-          has_errors = true;
-        } else if (finding.severity == DiagnosticSeverity::kWarning) {
-          has_warnings = true;
-        }
-      }
-      if (has_errors)
-        error_rooms = 1;
-      else if (has_warnings)
-        warning_rooms = 1;
-      else
-        valid_rooms = 1;
-    }
-
+    room_ids.push_back(room_id);
   } else if (all_rooms) {
     // All rooms mode
     if (!is_json) {
       std::cout << "\nAnalyzing all " << kNumRooms << " rooms...\n";
     }
-
     for (int room_id = 0; room_id < kNumRooms; ++room_id) {
-      auto diag = DiagnoseRoom(rom, room_id);
-      diagnostics.push_back(diag);
-      total_objects += diag.object_count;
-      total_sprites += diag.sprite_count;
-
-      bool has_errors = false;
-      bool has_warnings = false;
-      for (const auto& finding : diag.findings) {
-        if (finding.severity == DiagnosticSeverity::kError ||
-            finding.severity == DiagnosticSeverity::kCritical) {
-          has_errors = true;
-        } else if (finding.severity == DiagnosticSeverity::kWarning) {
-          has_warnings = true;
-        }
-      }
-
-      if (has_errors) {
-        error_rooms++;
-      } else if (has_warnings) {
-        warning_rooms++;
-      } else {
-        valid_rooms++;
-      }
+      room_ids.push_back(room_id);
     }
   } else {
     // Default: sample key rooms
@@ -267,34 +241,40 @@ absl::Status DungeonDoctorCommandHandler::Execute(
                 << " sample rooms...\n";
       std::cout << "(Use --all to analyze all " << kNumRooms << " rooms)\n";
     }
-
     for (int room_id : sample_rooms) {
-      if (room_id >= kNumRooms)
-        continue;
-      auto diag = DiagnoseRoom(rom, room_id);
-      diagnostics.push_back(diag);
-      total_objects += diag.object_count;
-      total_sprites += diag.sprite_count;
-
-      bool has_errors = false;
-      bool has_warnings = false;
-      for (const auto& finding : diag.findings) {
-        if (finding.severity == DiagnosticSeverity::kError ||
-            finding.severity == DiagnosticSeverity::kCritical) {
-          has_errors = true;
-        } else if (finding.severity == DiagnosticSeverity::kWarning) {
-          has_warnings = true;
-        }
+      if (room_id < kNumRooms) {
+        room_ids.push_back(room_id);
       }
+    }
+  }
+
+  DoctorSnapshot snapshot(*rom);
+  std::vector<DoctorCheckResult> results =
+      BuildDungeonDoctorPipeline(room_ids).Run(snapshot);
+  for (size_t i = 0; i < results.size(); ++i) {
+    auto diag = ToRoomDiagnostic(room_ids[i], results[i]);
+    diagnostics.push_back(diag);
+    total_objects += diag.object_count;
+    total_sprites += diag.sprite_count;
 
-      if (has_errors) {
-        error_rooms++;
-      } else if (has_warnings) {
-        warning_rooms++;
-      } else {
-        valid_rooms++;
+    bool has_errors = false;
+    bool has_warnings = false;
+    for (const auto& finding : diag.findings) {
+      if (finding.severity == DiagnosticSeverity::kError ||
+          finding.severity == DiagnosticSeverity::kCritical) {
+        has_errors = true;
+      } else if (finding.severity == DiagnosticSeverity::kWarning) {
+        has_warnings = true;
       }
     }
+
+    if (has_errors) {
+      error_rooms++;
+    } else if (has_warnings) {
+      warning_rooms++;
+    } else {
+      valid_rooms++;
+    }
   }
 
   // Deep scan analysis
@@ -1,11 +1,13 @@
 #include "cli/handlers/tools/graphics_doctor_commands.h"
 
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
-#include "app/gfx/util/compression.h"
 #include "cli/handlers/tools/diagnostic_types.h"
+#include "cli/handlers/tools/doctor_pipeline.h"
 #include "rom/rom.h"
 #include "zelda3/dungeon/dungeon_rom_addresses.h"
 #include "zelda3/game_data.h"
@@ -19,6 +21,7 @@ constexpr uint32_t kNumGfxSheets = 223;
 constexpr uint32_t kNumMainBlocksets = 37;
 constexpr uint32_t kNumRoomBlocksets = 82;
 constexpr uint32_t kUncompressedSheetSize = 0x0800;  // 2048 bytes
+constexpr uint32_t kRoomBlocksetTable = 0x50C0;      // Approximate location
 
 // Get graphics address for a sheet (adapted from zelda3::GetGraphicsAddress)
 uint32_t GetGfxAddress(const uint8_t* data, uint8_t sheet_id, size_t rom_size) {
@@ -42,42 +45,38 @@ uint32_t GetGfxAddress(const uint8_t* data, uint8_t sheet_id, size_t rom_size) {
 }
 
 // Validate graphics pointer table
-void ValidateGraphicsPointerTable(Rom* rom, DiagnosticReport& report,
-                                  std::vector<uint32_t>& valid_addresses) {
-  const auto& data = rom->vector();
+void ValidateGraphicsPointerTable(const DoctorSnapshot& snapshot,
+                                  DoctorCheckResult& result) {
   uint32_t ptr_base = zelda3::kGfxGroupsPointer;
 
-  if (ptr_base + 0x300 >= rom->size()) {
+  if (ptr_base + 0x300 >= snapshot.size()) {
     DiagnosticFinding finding;
     finding.id = "gfx_ptr_table_missing";
     finding.severity = DiagnosticSeverity::kCritical;
     finding.message = "Graphics pointer table beyond ROM bounds";
     finding.location = absl::StrFormat("0x%06X", ptr_base);
     finding.fixable = false;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
     return;
   }
 
   int invalid_count = 0;
   for (uint32_t i = 0; i < kNumGfxSheets; ++i) {
-    uint32_t addr = GetGfxAddress(data.data(), i, rom->size());
+    uint32_t addr = GetGfxAddress(snapshot.data(), i, snapshot.size());
 
-    if (addr == 0 || addr >= rom->size()) {
+    if (addr == 0 || addr >= snapshot.size()) {
       if (invalid_count < 10) {
         DiagnosticFinding finding;
         finding.id = "invalid_gfx_ptr";
         finding.severity = DiagnosticSeverity::kError;
         finding.message = absl::StrFormat(
             "Sheet %d has invalid pointer 0x%06X (ROM size: 0x%zX)", i, addr,
-            rom->size());
+            snapshot.size());
         finding.location = absl::StrFormat("Sheet %d", i);
         finding.fixable = false;
-        report.AddFinding(finding);
+        result.findings.push_back(finding);
       }
       invalid_count++;
-      valid_addresses.push_back(0);  // Mark as invalid
-    } else {
-      valid_addresses.push_back(addr);
     }
   }
 
@@ -89,64 +88,66 @@ void ValidateGraphicsPointerTable(Rom* rom, DiagnosticReport& report,
         absl::StrFormat("Found %d sheets with invalid pointers", invalid_count);
     finding.location = "Graphics Pointer Table";
     finding.fixable = false;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
   }
 }
 
 // Test decompression for sheets
-void ValidateCompression(Rom* rom, const std::vector<uint32_t>& addresses,
-                         DiagnosticReport& report, bool verbose,
-                         int& successful_decomp, int& failed_decomp) {
-  const auto& data = rom->vector();
+void ValidateCompression(const DoctorSnapshot& snapshot,
+                         DoctorCheckResult& result, bool verbose) {
+  const std::vector<DoctorSheet>& sheets = snapshot.sheets();
+  int successful_decomp = 0;
+  int failed_decomp = 0;
 
   for (uint32_t i = 0; i < kNumGfxSheets; ++i) {
-    if (i >= addresses.size() || addresses[i] == 0) {
+    if (i >= sheets.size() || sheets[i].address == 0) {
       failed_decomp++;
       continue;
     }
 
-    uint32_t addr = addresses[i];
+    const DoctorSheet& sheet = sheets[i];
+    const uint32_t addr = sheet.address;
 
-    // Try to decompress
-    auto result = gfx::lc_lz2::DecompressV2(
-        data.data(), addr, kUncompressedSheetSize, 1, rom->size());
-
-    if (!result.ok()) {
+    if (!sheet.status.ok()) {
       if (verbose || failed_decomp < 10) {
         DiagnosticFinding finding;
         finding.id = "decompression_failed";
         finding.severity = DiagnosticSeverity::kError;
         finding.message =
             absl::StrFormat("Sheet %d decompression failed at 0x%06X: %s", i,
-                            addr, std::string(result.status().message()));
+                            addr, std::string(sheet.status.message()));
         finding.location = absl::StrFormat("Sheet %d", i);
         finding.fixable = false;
-        report.AddFinding(finding);
+        result.findings.push_back(finding);
       }
       failed_decomp++;
     } else {
       // Check decompressed size
-      if (result->size() != kUncompressedSheetSize) {
+      if (sheet.data.size() != kUncompressedSheetSize) {
         if (verbose || failed_decomp < 10) {
           DiagnosticFinding finding;
           finding.id = "unexpected_sheet_size";
           finding.severity = DiagnosticSeverity::kWarning;
           finding.message = absl::StrFormat(
               "Sheet %d decompressed to %zu bytes (expected %d)", i,
-              result->size(), kUncompressedSheetSize);
+              sheet.data.size(), kUncompressedSheetSize);
           finding.location = absl::StrFormat("Sheet %d", i);
           finding.fixable = false;
-          report.AddFinding(finding);
+          result.findings.push_back(finding);
         }
       }
       successful_decomp++;
     }
   }
+
+  result.metrics.emplace_back("successful_decompressions", successful_decomp);
+  result.metrics.emplace_back("failed_decompressions", failed_decomp);
 }
 
 // Validate blockset references
-void ValidateBlocksets(Rom* rom, DiagnosticReport& report) {
-  const auto& data = rom->vector();
+void ValidateBlocksets(const DoctorSnapshot& snapshot,
+                       DoctorCheckResult& result) {
+  const uint8_t* data = snapshot.data();
 
   // Main blocksets pointer
   // Main blocksets: 37 sets, 8 bytes each (8 sheet IDs)
@@ -159,13 +160,13 @@ void ValidateBlocksets(Rom* rom, DiagnosticReport& report) {
 
   // Check a sample of known blockset-like structures
   // Room blocksets at different locations - simplified check
-  uint32_t room_blockset_ptr = 0x50C0;  // Approximate location
+  uint32_t room_blockset_ptr = kRoomBlocksetTable;
 
-  if (room_blockset_ptr + (kNumRoomBlocksets * 4) < rom->size()) {
+  if (room_blockset_ptr + (kNumRoomBlocksets * 4) < snapshot.size()) {
     for (uint32_t i = 0; i < kNumRoomBlocksets; ++i) {
       for (int slot = 0; slot < 4; ++slot) {
         uint32_t addr = room_blockset_ptr + (i * 4) + slot;
-        if (addr >= rom->size())
+        if (addr >= snapshot.size())
           break;
 
         uint8_t sheet_id = data[addr];
@@ -179,7 +180,7 @@ void ValidateBlocksets(Rom* rom, DiagnosticReport& report) {
                 sheet_id);
             finding.location = absl::StrFormat("Room blockset %d", i);
             finding.fixable = false;
-            report.AddFinding(finding);
+            result.findings.push_back(finding);
           }
           invalid_refs++;
         }
@@ -195,31 +196,25 @@ void ValidateBlocksets(Rom* rom, DiagnosticReport& report) {
         "Found %d invalid blockset sheet references", invalid_refs);
     finding.location = "Blockset Tables";
     finding.fixable = false;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
   }
 }
 
 // Check for empty/corrupted sheets
-void CheckSheetIntegrity(Rom* rom, const std::vector<uint32_t>& addresses,
-                         DiagnosticReport& report, bool verbose,
-                         int& empty_sheets, int& suspicious_sheets) {
-  const auto& data = rom->vector();
+void CheckSheetIntegrity(const DoctorSnapshot& snapshot,
+                         DoctorCheckResult& result, bool verbose) {
+  const std::vector<DoctorSheet>& sheets = snapshot.sheets();
+  int empty_sheets = 0;
+  int suspicious_sheets = 0;
 
   for (uint32_t i = 0; i < kNumGfxSheets; ++i) {
-    if (i >= addresses.size() || addresses[i] == 0) {
+    if (i >= sheets.size() || sheets[i].address == 0 ||
+        !sheets[i].status.ok()) {
       continue;
     }
 
-    uint32_t addr = addresses[i];
-
-    // Try to decompress first
-    auto result = gfx::lc_lz2::DecompressV2(
-        data.data(), addr, kUncompressedSheetSize, 1, rom->size());
-
-    if (!result.ok())
-      continue;
-
-    const auto& sheet_data = *result;
+    const uint32_t addr = sheets[i].address;
+    const auto& sheet_data = sheets[i].data;
 
     // Check for all-zeros (empty)
     bool all_zero = true;
@@ -241,7 +236,7 @@ void CheckSheetIntegrity(Rom* rom, const std::vector<uint32_t>& addresses,
         finding.message = absl::StrFormat("Sheet %d is all zeros (empty)", i);
         finding.location = absl::StrFormat("Sheet %d at 0x%06X", i, addr);
         finding.fixable = false;
-        report.AddFinding(finding);
+        result.findings.push_back(finding);
       }
       empty_sheets++;
     } else if (all_ff) {
@@ -254,11 +249,45 @@ void CheckSheetIntegrity(Rom* rom, const std::vector<uint32_t>& addresses,
         finding.location = absl::StrFormat("Sheet %d at 0x%06X", i, addr);
         finding.suggested_action = "Sheet may need to be restored";
         finding.fixable = false;
-        report.AddFinding(finding);
+        result.findings.push_back(finding);
       }
       suspicious_sheets++;
     }
   }
+
+  result.metrics.emplace_back("empty_sheets", empty_sheets);
+  result.metrics.emplace_back("suspicious_sheets", suspicious_sheets);
+}
+
+// Checks in report order. Decompression results depend on sheet data
+// anywhere in the ROM, so those checks read the whole ROM; both share the
+// snapshot's decompressed sheets. `verbose` lifts
+// the finding caps, so it gets its own check ids.
+DoctorPipeline BuildGraphicsDoctorPipeline(bool scan_sheets, bool verbose) {
+  const uint32_t ptr_base = zelda3::kGfxGroupsPointer;
+  const std::string suffix = verbose ? "_verbose" : "";
+
+  DoctorPipeline pipeline;
+  pipeline.AddCheck({"gfx_pointer_table", 1, {{ptr_base, ptr_base + 0x300}},
+                     ValidateGraphicsPointerTable});
+  if (scan_sheets) {
+    pipeline.AddCheck({"gfx_decompression" + suffix, 1, {},
+                       [verbose](const DoctorSnapshot& snapshot,
+                                 DoctorCheckResult& result) {
+                         ValidateCompression(snapshot, result, verbose);
+                       }});
+  }
+  pipeline.AddCheck({"gfx_blocksets",
+                     1,
+                     {{kRoomBlocksetTable,
+                       kRoomBlocksetTable + kNumRoomBlocksets * 4}},
+                     ValidateBlocksets});
+  pipeline.AddCheck({"gfx_sheet_integrity" + suffix, 1, {},
+                     [verbose](const DoctorSnapshot& snapshot,
+                               DoctorCheckResult& result) {
+                       CheckSheetIntegrity(snapshot, result, verbose);
+                     }});
+  return pipeline;
 }
 
 }  // namespace
@@ -267,7 +296,6 @@ absl::Status GraphicsDoctorCommandHandler::Execute(
     Rom* rom, const resources::ArgumentParser& parser,
     resources::OutputFormatter& formatter) {
   bool verbose = parser.HasFlag("verbose");
-  bool scan_all = parser.HasFlag("all");
 
   DiagnosticReport report;
 
@@ -287,43 +315,52 @@ absl::Status GraphicsDoctorCommandHandler::Execute(
     }
   }
 
-  // 1. Validate graphics pointer table
-  std::vector<uint32_t> valid_addresses;
-  ValidateGraphicsPointerTable(rom, report, valid_addresses);
+  DoctorSnapshot snapshot(*rom);
 
-  // 2. Test decompression
+  // Report a single sheet inline; a full scan runs as a check. Either way
+  // the sheets are decompressed once, by the snapshot.
   int successful_decomp = 0;
   int failed_decomp = 0;
 
   if (single_sheet) {
-    // Just test the one sheet
-    if (target_sheet < static_cast<int>(valid_addresses.size()) &&
-        valid_addresses[target_sheet] != 0) {
-      const auto& data = rom->vector();
-      auto result =
-          gfx::lc_lz2::DecompressV2(data.data(), valid_addresses[target_sheet],
-                                    kUncompressedSheetSize, 1, rom->size());
-      if (result.ok()) {
+    const std::vector<DoctorSheet>& sheets = snapshot.sheets();
+    if (target_sheet < static_cast<int>(sheets.size()) &&
+        sheets[target_sheet].address != 0) {
+      const DoctorSheet& sheet = sheets[target_sheet];
+      if (sheet.status.ok()) {
         successful_decomp = 1;
         formatter.AddField("decompressed_size",
-                           static_cast<int>(result->size()));
+                           static_cast<int>(sheet.data.size()));
       } else {
         failed_decomp = 1;
       }
     }
-  } else if (scan_all || !single_sheet) {
-    ValidateCompression(rom, valid_addresses, report, verbose,
-                        successful_decomp, failed_decomp);
   }
 
-  // 3. Validate blocksets
-  ValidateBlocksets(rom, report);
-
-  // 4. Check sheet integrity
+  // Pointer table, decompression, blockset and integrity checks run in
+  // parallel; unchanged inputs reuse cached results.
   int empty_sheets = 0;
   int suspicious_sheets = 0;
-  CheckSheetIntegrity(rom, valid_addresses, report, verbose, empty_sheets,
-                      suspicious_sheets);
+  auto results =
+      BuildGraphicsDoctorPipeline(/*scan_sheets=*/!single_sheet, verbose)
+          .Run(snapshot);
+  for (const auto& result : results) {
+    for (const auto& finding : result.findings) {
+      report.AddFinding(finding);
+    }
+    if (const int* count = result.FindMetric("successful_decompressions")) {
+      successful_decomp = *count;
+    }
+    if (const int* count = result.FindMetric("failed_decompressions")) {
+      failed_decomp = *count;
+    }
+    if (const int* count = result.FindMetric("empty_sheets")) {
+      empty_sheets = *count;
+    }
+    if (const int* count = result.FindMetric("suspicious_sheets")) {
+      suspicious_sheets = *count;
+    }
+  }
 
   // Output results
   formatter.AddField("total_sheets", static_cast<int>(kNumGfxSheets));
@@ -28,6 +28,7 @@ class GraphicsDoctorCommandHandler : public resources::CommandHandler {
   std::string GetOutputTitle() const override { return "Graphics Doctor"; }
 
   bool RequiresRom() const override { return true; }
+  bool ReadsRomOnly() const override { return true; }
 
   Descriptor Describe() const override {
     Descriptor desc;
@@ -2,6 +2,7 @@
 
 #include <iomanip>
 #include <iostream>
+#include <span>
 #include <vector>
 
 #include "absl/strings/numbers.h"
@@ -10,6 +11,7 @@
 #include "absl/strings/str_split.h"
 #include "cli/service/resources/command_context.h"
 #include "rom/rom.h"
+#include "rom/rom_diff.h"
 
 namespace yaze {
 namespace cli {
@@ -31,7 +33,14 @@ int SnesToPcLoRom(int bank, int addr) {
   return pc_addr;
 }
 
-void PrintHexDump(const std::vector<uint8_t>& data, int offset, int size,
+// The inspectors only read, so map the file instead of copying it.
+Rom::LoadOptions InspectLoadOptions() {
+  Rom::LoadOptions options;
+  options.memory_map = true;
+  return options;
+}
+
+void PrintHexDump(std::span<const uint8_t> data, int offset, int size,
                   AddressMode mode,
                   [[maybe_unused]] resources::OutputFormatter& formatter) {
   std::string output;
@@ -153,7 +162,7 @@ absl::Status HexDumpCommandHandler::Execute(
 
   // Load ROM locally since RequiresRom() is false (to allow inspecting any file)
   Rom local_rom;
-  auto status = local_rom.LoadFromFile(rom_path);
+  auto status = local_rom.LoadFromFile(rom_path, InspectLoadOptions());
   if (!status.ok()) {
     return status;
   }
@@ -168,13 +177,12 @@ absl::Status HexDumpCommandHandler::Execute(
     size = static_cast<int>(local_rom.size() - static_cast<size_t>(offset));
   }
 
-  std::vector<uint8_t> buffer(size);
-  const auto& rom_data = local_rom.vector();
-  for (int i = 0; i < size; ++i) {
-    buffer[i] = rom_data[offset + i];
+  auto view = local_rom.ReadSpan(offset, size);
+  if (!view.ok()) {
+    return view.status();
   }
 
-  PrintHexDump(buffer, offset, size, mode, formatter);
+  PrintHexDump(*view, offset, size, mode, formatter);
   return absl::OkStatus();
 }
 
@@ -231,13 +239,13 @@ absl::Status HexCompareCommandHandler::Execute(
 
   // Load both ROMs
   Rom rom1, rom2;
-  auto status1 = rom1.LoadFromFile(rom1_path);
+  auto status1 = rom1.LoadFromFile(rom1_path, InspectLoadOptions());
   if (!status1.ok()) {
     return absl::InvalidArgumentError("Failed to load ROM 1: " +
                                       std::string(status1.message()));
   }
 
-  auto status2 = rom2.LoadFromFile(rom2_path);
+  auto status2 = rom2.LoadFromFile(rom2_path, InspectLoadOptions());
   if (!status2.ok()) {
     return absl::InvalidArgumentError("Failed to load ROM 2: " +
                                       std::string(status2.message()));
@@ -258,15 +266,17 @@ absl::Status HexCompareCommandHandler::Execute(
   int total_diffs = 0;
   const int max_diff_display = 20;
 
-  const auto& data1 = rom1.vector();
-  const auto& data2 = rom2.vector();
-
-  for (size_t i = start_offset; i < compare_size; ++i) {
-    if (data1[i] != data2[i]) {
-      total_diffs++;
-      if (diff_offsets.size() < max_diff_display) {
-        diff_offsets.push_back(static_cast<uint32_t>(i));
-      }
+  const uint8_t* data1 = rom1.data();
+  const uint8_t* data2 = rom2.data();
+  const size_t length = compare_size - start_offset;
+  const auto diff =
+      rom::ComputeRomDiff(std::span(data1 + start_offset, length),
+                          std::span(data2 + start_offset, length));
+  total_diffs = static_cast<int>(diff.total_bytes_changed);
+  for (const auto& range : diff.ranges) {
+    for (uint32_t i = range.start;
+         i < range.end && diff_offsets.size() < max_diff_display; ++i) {
+      diff_offsets.push_back(static_cast<uint32_t>(start_offset + i));
     }
   }
 
@@ -498,7 +508,7 @@ absl::Status HexAnnotateCommandHandler::Execute(
 
   // Load ROM
   Rom local_rom;
-  auto status = local_rom.LoadFromFile(rom_path);
+  auto status = local_rom.LoadFromFile(rom_path, InspectLoadOptions());
   if (!status.ok()) {
     return status;
   }
@@ -540,11 +550,11 @@ absl::Status HexAnnotateCommandHandler::Execute(
   // Read data
   int read_size = std::min(structure->total_size,
                            static_cast<int>(local_rom.size() - offset));
-  std::vector<uint8_t> buffer(read_size);
-  const auto& rom_data = local_rom.vector();
-  for (int i = 0; i < read_size; ++i) {
-    buffer[i] = rom_data[offset + i];
+  auto read_result = local_rom.ReadByteVector(offset, read_size);
+  if (!read_result.ok()) {
+    return read_result.status();
   }
+  const std::vector<uint8_t>& buffer = *read_result;
 
   // Output
   formatter.AddField("rom_path", rom_path);
@@ -1,11 +1,14 @@
 #include "cli/handlers/tools/message_doctor_commands.h"
 
 #include <iostream>
+#include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "app/editor/message/message_data.h"
 #include "cli/handlers/tools/diagnostic_types.h"
+#include "cli/handlers/tools/doctor_pipeline.h"
 #include "rom/rom.h"
 
 namespace yaze {
@@ -15,7 +18,7 @@ namespace {
 
 // Validate control codes in message data
 void ValidateControlCodes(const editor::MessageData& msg,
-                          DiagnosticReport& report) {
+                          DoctorCheckResult& result) {
   for (size_t i = 0; i < msg.Data.size(); ++i) {
     uint8_t byte = msg.Data[i];
     // Control codes are in range 0x67-0x80
@@ -29,7 +32,7 @@ void ValidateControlCodes(const editor::MessageData& msg,
             "Unknown control code 0x%02X in message %d", byte, msg.ID);
         finding.location = absl::StrFormat("Message %d offset %zu", msg.ID, i);
         finding.fixable = false;
-        report.AddFinding(finding);
+        result.findings.push_back(finding);
       } else if (cmd->HasArgument) {
         // Check if command argument follows when required
         if (i + 1 >= msg.Data.size()) {
@@ -42,7 +45,7 @@ void ValidateControlCodes(const editor::MessageData& msg,
           finding.location =
               absl::StrFormat("Message %d offset %zu", msg.ID, i);
           finding.fixable = false;
-          report.AddFinding(finding);
+          result.findings.push_back(finding);
         } else {
           // Skip the argument byte
           ++i;
@@ -54,7 +57,7 @@ void ValidateControlCodes(const editor::MessageData& msg,
 
 // Check for missing terminators
 void ValidateTerminators(const editor::MessageData& msg,
-                         DiagnosticReport& report) {
+                         DoctorCheckResult& result) {
   if (msg.Data.empty()) {
     DiagnosticFinding finding;
     finding.id = "empty_message";
@@ -62,7 +65,7 @@ void ValidateTerminators(const editor::MessageData& msg,
     finding.message = absl::StrFormat("Message %d is empty", msg.ID);
     finding.location = absl::StrFormat("Message %d", msg.ID);
     finding.fixable = false;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
     return;
   }
 
@@ -77,14 +80,14 @@ void ValidateTerminators(const editor::MessageData& msg,
     finding.location = absl::StrFormat("Message %d", msg.ID);
     finding.suggested_action = "Add 0x7F terminator to end of message";
     finding.fixable = true;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
   }
 }
 
 // Validate dictionary references
 void ValidateDictionaryRefs(const editor::MessageData& msg,
                             const std::vector<editor::DictionaryEntry>& dict,
-                            DiagnosticReport& report) {
+                            DoctorCheckResult& result) {
   for (size_t i = 0; i < msg.Data.size(); ++i) {
     uint8_t byte = msg.Data[i];
     if (byte >= editor::DICTOFF) {
@@ -99,7 +102,7 @@ void ValidateDictionaryRefs(const editor::MessageData& msg,
             dict_idx, msg.ID, static_cast<int>(dict.size()) - 1);
         finding.location = absl::StrFormat("Message %d offset %zu", msg.ID, i);
         finding.fixable = false;
-        report.AddFinding(finding);
+        result.findings.push_back(finding);
       }
     }
   }
@@ -107,7 +110,7 @@ void ValidateDictionaryRefs(const editor::MessageData& msg,
 
 // Check for common corruption patterns
 void CheckCorruptionPatterns(const editor::MessageData& msg,
-                             DiagnosticReport& report) {
+                             DoctorCheckResult& result) {
   // Check for large runs of 0x00 or 0xFF
   int zero_run = 0;
   int ff_run = 0;
@@ -134,7 +137,7 @@ void CheckCorruptionPatterns(const editor::MessageData& msg,
       finding.location = absl::StrFormat("Message %d", msg.ID);
       finding.suggested_action = "Check if message data is corrupted";
       finding.fixable = false;
-      report.AddFinding(finding);
+      result.findings.push_back(finding);
       break;  // Only report once per message
     }
 
@@ -147,7 +150,7 @@ void CheckCorruptionPatterns(const editor::MessageData& msg,
       finding.location = absl::StrFormat("Message %d", msg.ID);
       finding.suggested_action = "Check if message data is corrupted or erased";
       finding.fixable = false;
-      report.AddFinding(finding);
+      result.findings.push_back(finding);
       break;  // Only report once per message
     }
   }
@@ -155,7 +158,7 @@ void CheckCorruptionPatterns(const editor::MessageData& msg,
 
 // Validate line widths in messages
 void ValidateLineWidths(const editor::MessageData& msg,
-                        DiagnosticReport& report) {
+                        DoctorCheckResult& result) {
   auto warnings = editor::ValidateMessageLineWidths(msg.ContentsParsed);
   for (const auto& warning : warnings) {
     DiagnosticFinding finding;
@@ -166,10 +169,45 @@ void ValidateLineWidths(const editor::MessageData& msg,
     finding.location = absl::StrFormat("Message %d", msg.ID);
     finding.suggested_action = "Shorten line or add a line break command";
     finding.fixable = true;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
   }
 }
 
+// Each check walks every non-empty message of the snapshot. Parsed messages
+// span both text banks and the dictionary, so every check reads the whole ROM.
+DoctorPipeline BuildMessageDoctorPipeline(
+    std::vector<editor::DictionaryEntry> dictionary) {
+  auto for_each_message = [](auto validate) {
+    return [validate](const DoctorSnapshot& snapshot,
+                      DoctorCheckResult& result) {
+      for (const auto& msg : snapshot.messages()) {
+        if (!msg.Data.empty()) {
+          validate(msg, result);
+        }
+      }
+    };
+  };
+
+  // Note: ValidateTerminators is not registered because ReadAllTextData
+  // strips the 0x7F terminator from stored Data (it's used as the delimiter).
+  // Messages returned by the parser are guaranteed to be properly terminated.
+  DoctorPipeline pipeline;
+  pipeline.AddCheck({"message_control_codes", 1, {},
+                     for_each_message(ValidateControlCodes)});
+  pipeline.AddCheck(
+      {"message_dictionary_refs", 1, {},
+       for_each_message([dictionary = std::move(dictionary)](
+                            const editor::MessageData& msg,
+                            DoctorCheckResult& result) {
+         ValidateDictionaryRefs(msg, dictionary, result);
+       })});
+  pipeline.AddCheck({"message_corruption", 1, {},
+                     for_each_message(CheckCorruptionPatterns)});
+  pipeline.AddCheck({"message_line_widths", 1, {},
+                     for_each_message(ValidateLineWidths)});
+  return pipeline;
+}
+
 }  // namespace
 
 absl::Status MessageDoctorCommandHandler::Execute(
@@ -183,10 +221,12 @@ absl::Status MessageDoctorCommandHandler::Execute(
     return absl::InvalidArgumentError("ROM not loaded");
   }
 
+  DoctorSnapshot snapshot(*rom);
+
   // 1. Build Dictionary
   std::vector<editor::DictionaryEntry> dictionary;
   try {
-    dictionary = editor::BuildDictionaryEntries(rom);
+    dictionary = editor::BuildDictionaryEntries(&snapshot.rom());
   } catch (const std::exception& e) {
     DiagnosticFinding finding;
     finding.id = "dictionary_build_failed";
@@ -202,51 +242,45 @@ absl::Status MessageDoctorCommandHandler::Execute(
     formatter.AddField("critical_count", report.critical_count);
     return absl::OkStatus();
   }
+  const int dictionary_size = static_cast<int>(dictionary.size());
 
-  // 2. Scan Messages
-  std::vector<editor::MessageData> messages;
-  try {
-    uint8_t* mutable_data = const_cast<uint8_t*>(rom->data());
-    messages = editor::ReadAllTextData(mutable_data, editor::kTextData,
-                                       editor::kTextDataEnd);
-
-  } catch (const std::exception& e) {
+  // 2. Scan Messages (decoded once by the snapshot; empty when parsing failed)
+  const auto& messages = snapshot.messages();
+  if (messages.empty()) {
     DiagnosticFinding finding;
     finding.id = "message_scan_failed";
     finding.severity = DiagnosticSeverity::kCritical;
-    finding.message = absl::StrFormat("Failed to scan messages: %s", e.what());
+    finding.message = "Failed to scan messages: no messages decoded";
     finding.location = "Message Data Region";
     finding.fixable = false;
     report.AddFinding(finding);
   }
 
-  // 3. Analyze Each Message
+  // 3. Analyze Each Message; checks run in parallel and unchanged ROMs reuse
+  // cached results.
   int valid_count = 0;
   int empty_count = 0;
-
   for (const auto& msg : messages) {
     if (msg.Data.empty()) {
       empty_count++;
-      continue;
+    } else {
+      valid_count++;
     }
+  }
 
-    // Run all validations
-    // Note: ValidateTerminators is skipped because ReadAllTextData strips
-    // the 0x7F terminator from stored Data (it's used as the delimiter).
-    // Messages returned by the parser are guaranteed to be properly terminated.
-    ValidateControlCodes(msg, report);
-    ValidateDictionaryRefs(msg, dictionary, report);
-    CheckCorruptionPatterns(msg, report);
-    ValidateLineWidths(msg, report);
-
-    valid_count++;
+  auto results =
+      BuildMessageDoctorPipeline(std::move(dictionary)).Run(snapshot);
+  for (const auto& result : results) {
+    for (const auto& finding : result.findings) {
+      report.AddFinding(finding);
+    }
   }
 
   // 4. Output results
   formatter.AddField("messages_scanned", static_cast<int>(messages.size()));
   formatter.AddField("valid_messages", valid_count);
   formatter.AddField("empty_messages", empty_count);
-  formatter.AddField("dictionary_entries", static_cast<int>(dictionary.size()));
+  formatter.AddField("dictionary_entries", dictionary_size);
   formatter.AddField("total_findings", report.TotalFindings());
   formatter.AddField("critical_count", report.critical_count);
   formatter.AddField("error_count", report.error_count);
@@ -277,7 +311,7 @@ absl::Status MessageDoctorCommandHandler::Execute(
     std::cout << absl::StrFormat("║  Valid Messages: %-44d ║\n", valid_count);
     std::cout << absl::StrFormat("║  Empty Messages: %-44d ║\n", empty_count);
     std::cout << absl::StrFormat("║  Dictionary Entries: %-40d ║\n",
-                                 static_cast<int>(dictionary.size()));
+                                 dictionary_size);
     std::cout << "╠════════════════════════════════════════════════════════════"
                  "═══╣\n";
     std::cout << absl::StrFormat(
@@ -10,12 +10,9 @@
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "cli/handlers/tools/diagnostic_types.h"
+#include "cli/handlers/tools/doctor_pipeline.h"
 #include "core/asar_wrapper.h"
 #include "rom/rom.h"
-#include "zelda3/overworld/overworld_entrance.h"
-#include "zelda3/overworld/overworld_exit.h"
-#include "zelda3/overworld/overworld_item.h"
-#include "zelda3/overworld/overworld_map.h"
 
 namespace yaze::cli {
 
@@ -105,43 +102,45 @@ RomFeatures DetectRomFeatures(Rom* rom) {
 // Map Pointer Validation
 // =============================================================================
 
-void ValidateMapPointers(Rom* rom, DiagnosticReport& report) {
-  report.map_status.lw_dw_maps_valid = true;
-  report.map_status.sw_maps_valid = true;
+void ValidateMapPointers(const DoctorSnapshot& snapshot,
+                         DoctorCheckResult& result) {
+  const uint8_t* data = snapshot.data();
+  const size_t size = snapshot.size();
+  bool lw_dw_maps_valid = true;
+  bool sw_maps_valid = true;
+  int invalid_map_count = 0;
 
   for (int map_id = 0; map_id < kVanillaMapCount; ++map_id) {
     uint32_t ptr_low_addr = kPtrTableLowBase + (3 * map_id);
     uint32_t ptr_high_addr = kPtrTableHighBase + (3 * map_id);
 
-    if (ptr_low_addr + 3 > rom->size() || ptr_high_addr + 3 > rom->size()) {
-      report.map_status.invalid_map_count++;
+    if (ptr_low_addr + 3 > size || ptr_high_addr + 3 > size) {
+      invalid_map_count++;
       if (map_id < 0x80) {
-        report.map_status.lw_dw_maps_valid = false;
+        lw_dw_maps_valid = false;
       } else {
-        report.map_status.sw_maps_valid = false;
+        sw_maps_valid = false;
       }
       continue;
     }
 
-    uint32_t snes_low = rom->data()[ptr_low_addr] |
-                        (rom->data()[ptr_low_addr + 1] << 8) |
-                        (rom->data()[ptr_low_addr + 2] << 16);
-    uint32_t snes_high = rom->data()[ptr_high_addr] |
-                         (rom->data()[ptr_high_addr + 1] << 8) |
-                         (rom->data()[ptr_high_addr + 2] << 16);
+    uint32_t snes_low = data[ptr_low_addr] | (data[ptr_low_addr + 1] << 8) |
+                        (data[ptr_low_addr + 2] << 16);
+    uint32_t snes_high = data[ptr_high_addr] | (data[ptr_high_addr + 1] << 8) |
+                         (data[ptr_high_addr + 2] << 16);
 
     uint32_t pc_low = SnesToPc(snes_low);
     uint32_t pc_high = SnesToPc(snes_high);
 
-    bool low_valid = (pc_low > 0 && pc_low < rom->size());
-    bool high_valid = (pc_high > 0 && pc_high < rom->size());
+    bool low_valid = (pc_low > 0 && pc_low < size);
+    bool high_valid = (pc_high > 0 && pc_high < size);
 
     if (!low_valid || !high_valid) {
-      report.map_status.invalid_map_count++;
+      invalid_map_count++;
       if (map_id < 0x80) {
-        report.map_status.lw_dw_maps_valid = false;
+        lw_dw_maps_valid = false;
       } else {
-        report.map_status.sw_maps_valid = false;
+        sw_maps_valid = false;
       }
 
       DiagnosticFinding finding;
@@ -152,18 +151,12 @@ void ValidateMapPointers(Rom* rom, DiagnosticReport& report) {
       finding.location = absl::StrFormat("0x%06X", ptr_low_addr);
       finding.suggested_action = "Restore from baseline ROM";
       finding.fixable = false;
-      report.AddFinding(finding);
+      result.findings.push_back(finding);
     }
   }
 
-  // Tail maps status
-  report.map_status.tail_maps_valid =
-      report.features.has_expanded_pointer_tables;
-  report.map_status.can_support_tail =
-      report.features.has_expanded_pointer_tables;
-
   // Add finding if map pointer corruption detected
-  if (!report.map_status.lw_dw_maps_valid) {
+  if (!lw_dw_maps_valid) {
     DiagnosticFinding finding;
     finding.id = "lw_dw_corruption";
     finding.severity = DiagnosticSeverity::kCritical;
@@ -173,10 +166,10 @@ void ValidateMapPointers(Rom* rom, DiagnosticReport& report) {
     finding.suggested_action =
         "ROM may be severely damaged. Restore from backup.";
     finding.fixable = false;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
   }
 
-  if (!report.map_status.sw_maps_valid) {
+  if (!sw_maps_valid) {
     DiagnosticFinding finding;
     finding.id = "sw_corruption";
     finding.severity = DiagnosticSeverity::kError;
@@ -185,30 +178,36 @@ void ValidateMapPointers(Rom* rom, DiagnosticReport& report) {
         "0x%06X-0x%06X", kPtrTableLowBase + 0x180, kPtrTableHighBase);
     finding.suggested_action = "Restore Special World data from baseline";
     finding.fixable = false;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
   }
+
+  result.metrics.emplace_back("invalid_map_count", invalid_map_count);
+  result.metrics.emplace_back("lw_dw_maps_valid", lw_dw_maps_valid ? 1 : 0);
+  result.metrics.emplace_back("sw_maps_valid", sw_maps_valid ? 1 : 0);
 }
 
 // =============================================================================
 // Tile16 Corruption Check
 // =============================================================================
 
-void CheckTile16Corruption(Rom* rom, DiagnosticReport& report) {
-  report.tile16_status.uses_expanded = report.features.has_expanded_tile16;
-
-  if (!report.features.has_expanded_tile16) {
+// Reports each corrupted entry as a "corrupted_tile16_address" metric.
+void CheckTile16Corruption(const DoctorSnapshot& snapshot,
+                           DoctorCheckResult& result) {
+  if (!snapshot.features().has_expanded_tile16) {
     return;
   }
 
+  const uint8_t* data = snapshot.data();
+  const size_t size = snapshot.size();
+
   for (uint32_t addr : kProblemAddresses) {
     if (addr >= kMap16TilesExpanded && addr < kMap16TilesExpandedEnd) {
       int tile_offset = addr - kMap16TilesExpanded;
       int tile_index = tile_offset / 8;
 
       uint16_t tile_data[4];
-      for (int i = 0; i < 4 && (addr + i * 2 + 1) < rom->size(); ++i) {
-        tile_data[i] =
-            rom->data()[addr + i * 2] | (rom->data()[addr + i * 2 + 1] << 8);
+      for (int i = 0; i < 4 && (addr + i * 2 + 1) < size; ++i) {
+        tile_data[i] = data[addr + i * 2] | (data[addr + i * 2 + 1] << 8);
       }
 
       bool looks_valid = true;
@@ -220,9 +219,8 @@ void CheckTile16Corruption(Rom* rom, DiagnosticReport& report) {
       }
 
       if (!looks_valid) {
-        report.tile16_status.corruption_detected = true;
-        report.tile16_status.corrupted_addresses.push_back(addr);
-        report.tile16_status.corrupted_tile_count++;
+        result.metrics.emplace_back("corrupted_tile16_address",
+                                    static_cast<int>(addr));
 
         DiagnosticFinding finding;
         finding.id = "tile16_corruption";
@@ -231,10 +229,64 @@ void CheckTile16Corruption(Rom* rom, DiagnosticReport& report) {
         finding.location = absl::StrFormat("0x%06X", addr);
         finding.suggested_action = "Run with --fix to zero corrupted entries";
         finding.fixable = true;
-        report.AddFinding(finding);
+        result.findings.push_back(finding);
+      }
+    }
+  }
+}
+
+// Pointer tables of the vanilla maps, 3 bytes per map.
+std::vector<DoctorInputRange> MapPointerInputs() {
+  return {{kPtrTableLowBase, kPtrTableLowBase + 3 * kVanillaMapCount},
+          {kPtrTableHighBase, kPtrTableHighBase + 3 * kVanillaMapCount}};
+}
+
+// Feature flags plus the 8 bytes of each tile16 entry that is checked.
+std::vector<DoctorInputRange> Tile16Inputs() {
+  std::vector<DoctorInputRange> inputs = DoctorSnapshot::FeatureInputs();
+  for (uint32_t addr : kProblemAddresses) {
+    inputs.push_back({addr, addr + 8});
+  }
+  return inputs;
+}
+
+DoctorPipeline BuildOverworldDoctorPipeline() {
+  DoctorPipeline pipeline;
+  pipeline.AddCheck(
+      {"ow_map_pointers", 1, MapPointerInputs(), ValidateMapPointers});
+  pipeline.AddCheck(
+      {"ow_tile16_corruption", 1, Tile16Inputs(), CheckTile16Corruption});
+  return pipeline;
+}
+
+// Folds the check results into the report, in check order.
+void ApplyDoctorResults(const std::vector<DoctorCheckResult>& results,
+                        DiagnosticReport& report) {
+  for (const auto& result : results) {
+    for (const auto& finding : result.findings) {
+      report.AddFinding(finding);
+    }
+    for (const auto& [name, value] : result.metrics) {
+      if (name == "invalid_map_count") {
+        report.map_status.invalid_map_count = value;
+      } else if (name == "lw_dw_maps_valid") {
+        report.map_status.lw_dw_maps_valid = value != 0;
+      } else if (name == "sw_maps_valid") {
+        report.map_status.sw_maps_valid = value != 0;
+      } else if (name == "corrupted_tile16_address") {
+        report.tile16_status.corruption_detected = true;
+        report.tile16_status.corrupted_addresses.push_back(
+            static_cast<uint32_t>(value));
+        report.tile16_status.corrupted_tile_count++;
       }
     }
   }
+
+  report.tile16_status.uses_expanded = report.features.has_expanded_tile16;
+  report.map_status.tail_maps_valid =
+      report.features.has_expanded_pointer_tables;
+  report.map_status.can_support_tail =
+      report.features.has_expanded_pointer_tables;
 }
 
 // =============================================================================
@@ -295,15 +347,6 @@ MapDistributionStats BuildDistribution(const std::vector<T>& entries,
   return stats;
 }
 
-absl::StatusOr<std::vector<zelda3::OverworldMap>> BuildOverworldMaps(Rom* rom) {
-  std::vector<zelda3::OverworldMap> maps;
-  maps.reserve(zelda3::kNumOverworldMaps);
-  for (int i = 0; i < zelda3::kNumOverworldMaps; ++i) {
-    maps.emplace_back(i, rom);
-  }
-  return maps;
-}
-
 // =============================================================================
 // Repair Functions
 // =============================================================================
@@ -594,8 +637,8 @@ absl::Status OverworldDoctorCommandHandler::Execute(
   DiagnosticReport report;
   report.rom_path = rom->filename();
   report.features = DetectRomFeatures(rom);
-  ValidateMapPointers(rom, report);
-  CheckTile16Corruption(rom, report);
+  DoctorSnapshot snapshot(*rom);
+  ApplyDoctorResults(BuildOverworldDoctorPipeline().Run(snapshot), report);
 
   // Load baseline if provided
   std::string resolved_baseline;
@@ -639,18 +682,17 @@ absl::Status OverworldDoctorCommandHandler::Execute(
 
   // Entity coverage (text mode only for now)
   if (!is_json) {
-    ASSIGN_OR_RETURN(auto exits, zelda3::LoadExits(rom));
-    ASSIGN_OR_RETURN(auto entrances, zelda3::LoadEntrances(rom));
-    ASSIGN_OR_RETURN(auto maps, BuildOverworldMaps(rom));
-    ASSIGN_OR_RETURN(auto items, zelda3::LoadItems(rom, maps));
-
-    auto exit_stats =
-        BuildDistribution(exits, [](const auto& exit) { return exit.map_id_; });
-    auto entrance_stats = BuildDistribution(entrances, [](const auto& ent) {
-      return static_cast<uint16_t>(ent.map_id_);
-    });
-    auto item_stats =
-        BuildDistribution(items, [](const auto& item) { return item.map_id_; });
+    const DoctorMaps& maps = snapshot.maps();
+    RETURN_IF_ERROR(maps.status);
+
+    auto exit_stats = BuildDistribution(
+        maps.exits, [](const auto& exit) { return exit.map_id_; });
+    auto entrance_stats =
+        BuildDistribution(maps.entrances, [](const auto& ent) {
+          return static_cast<uint16_t>(ent.map_id_);
+        });
+    auto item_stats = BuildDistribution(
+        maps.items, [](const auto& item) { return item.map_id_; });
 
     std::cout << "\n=== Overworld Entity Coverage ===\n";
     std::cout << absl::StrFormat(
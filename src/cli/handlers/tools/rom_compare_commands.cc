@@ -4,12 +4,14 @@
 #include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <span>
 #include <vector>
 
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "cli/handlers/tools/diagnostic_types.h"
 #include "rom/rom.h"
+#include "rom/rom_diff.h"
 
 namespace yaze::cli {
 
@@ -113,31 +115,40 @@ void FindDiffRegions(const std::vector<uint8_t>& target,
   };
 
   if (scan_all) {
-    // Perform full ROM scan for differences
-    uint32_t start = 0;
-    bool in_diff = false;
-    size_t diff_count = 0;
-
-    for (uint32_t i = 0; i < min_size; ++i) {
-      if (is_ignored(i)) continue;
-
-      if (target[i] != baseline[i]) {
-        if (!in_diff) {
-          start = i;
-          in_diff = true;
-          diff_count = 0;
-        }
-        diff_count++;
-      } else if (in_diff) {
-        RomCompareResult::DiffRegion diff;
-        diff.start = start;
-        diff.end = i;
-        diff.diff_count = diff_count;
-        diff.region_name = "Modified Region";
-        diff.critical = false;
-        result.diff_regions.push_back(diff);
-        result.total_diff_bytes += diff_count;
-        in_diff = false;
+    // Full scan through the block diff; each changed run is labelled with
+    // the known regions it touches.
+    auto diff = rom::ComputeRomDiff(std::span(target).first(min_size),
+                                    std::span(baseline).first(min_size));
+    std::vector<rom::DiffRegionLabel> labels;
+    for (const auto& region : kCriticalRegions) {
+      labels.push_back({region.start, region.end, region.name});
+    }
+    rom::AnnotateDiff(diff, std::move(labels));
+
+    for (const auto& range : diff.ranges) {
+      // Ranges are exact runs, so every byte left after dropping the
+      // ignored ones differs.
+      uint32_t start = range.start;
+      while (start < range.end) {
+        while (start < range.end && is_ignored(start)) ++start;
+        uint32_t end = start;
+        while (end < range.end && !is_ignored(end)) ++end;
+        if (end == start) break;
+
+        RomCompareResult::DiffRegion region;
+        region.start = start;
+        region.end = end;
+        region.diff_count = end - start;
+        region.region_name =
+            range.region.empty() ? "Modified Region" : range.region;
+        region.critical = std::any_of(
+            std::begin(kCriticalRegions), std::end(kCriticalRegions),
+            [&](const RomRegion& r) {
+              return r.critical && r.start < end && start < r.end;
+            });
+        result.diff_regions.push_back(region);
+        result.total_diff_bytes += region.diff_count;
+        start = end;
       }
     }
     return;
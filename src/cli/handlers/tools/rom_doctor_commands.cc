@@ -8,8 +8,8 @@
 #include "absl/strings/match.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
-#include "app/editor/message/message_data.h"
 #include "cli/handlers/tools/diagnostic_types.h"
+#include "cli/handlers/tools/doctor_pipeline.h"
 #include "rom/hm_support.h"
 #include "rom/rom.h"
 #include "zelda3/dungeon/water_fill_zone.h"
@@ -124,39 +124,6 @@ void OutputTextBanner(bool is_json) {
       << "╚═══════════════════════════════════════════════════════════════╝\n";
 }
 
-RomFeatures DetectRomFeaturesLocal(Rom* rom) {
-  RomFeatures features;
-
-  if (kZSCustomVersionPos < rom->size()) {
-    features.zs_custom_version = rom->data()[kZSCustomVersionPos];
-    features.is_vanilla = (features.zs_custom_version == 0xFF ||
-                           features.zs_custom_version == 0x00);
-    features.is_v2 = (!features.is_vanilla && features.zs_custom_version == 2);
-    features.is_v3 = (!features.is_vanilla && features.zs_custom_version >= 3);
-  } else {
-    features.is_vanilla = true;
-  }
-
-  if (!features.is_vanilla) {
-    if (kMap16ExpandedFlagPos < rom->size()) {
-      uint8_t flag = rom->data()[kMap16ExpandedFlagPos];
-      features.has_expanded_tile16 = (flag != 0x0F);
-    }
-
-    if (kMap32ExpandedFlagPos < rom->size()) {
-      uint8_t flag = rom->data()[kMap32ExpandedFlagPos];
-      features.has_expanded_tile32 = (flag != 0x04);
-    }
-  }
-
-  if (kExpandedPtrTableMarker < rom->size()) {
-    features.has_expanded_pointer_tables =
-        (rom->data()[kExpandedPtrTableMarker] == kExpandedPtrTableMagic);
-  }
-
-  return features;
-}
-
 double CalculateEntropy(const uint8_t* data, size_t size) {
   if (size == 0)
     return 0.0;
@@ -175,9 +142,10 @@ double CalculateEntropy(const uint8_t* data, size_t size) {
   return entropy;
 }
 
-void CheckCorruptionHeuristics(Rom* rom, DiagnosticReport& report, bool deep) {
-  const auto* data = rom->data();
-  size_t size = rom->size();
+void CheckCorruptionHeuristics(const DoctorSnapshot& snapshot,
+                               DoctorCheckResult& result, bool deep) {
+  const auto* data = snapshot.data();
+  size_t size = snapshot.size();
 
   // Check known problematic addresses
   for (uint32_t addr : kProblemAddresses) {
@@ -193,14 +161,14 @@ void CheckCorruptionHeuristics(Rom* rom, DiagnosticReport& report, bool deep) {
         finding.suggested_action =
             "Check if this byte should be 0x00. If not, restore from backup.";
         finding.fixable = false;
-        report.AddFinding(finding);
+        result.findings.push_back(finding);
       }
     }
   }
 
   // Check for zero-filled blocks in critical code regions (Bank 00)
   int zero_run = 0;
-  for (uint32_t i = 0x0000; i < 0x1000; ++i) {
+  for (uint32_t i = 0x0000; i < 0x1000 && i < size; ++i) {
     if (data[i] == 0x00)
       zero_run++;
     else
@@ -215,7 +183,7 @@ void CheckCorruptionHeuristics(Rom* rom, DiagnosticReport& report, bool deep) {
       finding.suggested_action =
           "ROM is likely corrupted. Restore from backup.";
       finding.fixable = false;
-      report.AddFinding(finding);
+      result.findings.push_back(finding);
       break;
     }
   }
@@ -234,17 +202,18 @@ void CheckCorruptionHeuristics(Rom* rom, DiagnosticReport& report, bool deep) {
         finding.location = absl::StrFormat("Bank %02X", bank);
         finding.suggested_action = "Verify if this bank should contain data.";
         finding.fixable = false;
-        report.AddFinding(finding);
+        result.findings.push_back(finding);
       }
     }
 
     // Check for pointer chain integrity in overworld maps
+    const RomFeatures& features = snapshot.features();
     uint32_t high_table =
-        report.features.has_expanded_pointer_tables ? kExpandedPtrTableHigh : kPtrTableHighBase;
+        features.has_expanded_pointer_tables ? kExpandedPtrTableHigh : kPtrTableHighBase;
     uint32_t low_table =
-        report.features.has_expanded_pointer_tables ? kExpandedPtrTableLow : kPtrTableLowBase;
+        features.has_expanded_pointer_tables ? kExpandedPtrTableLow : kPtrTableLowBase;
     int map_count =
-        report.features.has_expanded_pointer_tables ? kExpandedMapCount : kVanillaMapCount;
+        features.has_expanded_pointer_tables ? kExpandedMapCount : kVanillaMapCount;
 
     if (high_table + map_count < size && low_table + map_count < size) {
       for (int i = 0; i < map_count; ++i) {
@@ -267,19 +236,20 @@ void CheckCorruptionHeuristics(Rom* rom, DiagnosticReport& report, bool deep) {
           finding.location = absl::StrFormat("Map %02X Pointer", i);
           finding.suggested_action = "Fix the pointer in the overworld editor.";
           finding.fixable = false;
-          report.AddFinding(finding);
+          result.findings.push_back(finding);
         }
       }
     }
   }
 }
 
-void ValidateExpandedTables(Rom* rom, DiagnosticReport& report) {
-  if (!report.features.has_expanded_tile16)
+void ValidateExpandedTables(const DoctorSnapshot& snapshot,
+                            DoctorCheckResult& result) {
+  if (!snapshot.features().has_expanded_tile16)
     return;
 
-  const auto* data = rom->data();
-  size_t size = rom->size();
+  const auto* data = snapshot.data();
+  size_t size = snapshot.size();
 
   // Check Tile16 expansion region (0x1E8000 - 0x1F0000)
   if (size >= kMap16TilesExpandedEnd) {
@@ -302,48 +272,40 @@ void ValidateExpandedTables(Rom* rom, DiagnosticReport& report) {
       finding.suggested_action =
           "Re-save Tile16 data from editor or re-apply expansion patch.";
       finding.fixable = false;
-      report.AddFinding(finding);
+      result.findings.push_back(finding);
     }
   }
 }
 
-void CheckParallelWorldsHeuristics(Rom* rom, DiagnosticReport& report) {
-  // 1. Search for "PARALLEL WORLDS" string in decoded messages
-  try {
-    std::vector<uint8_t> rom_data_copy = rom->vector();  // Copy for safety
-    // Safety: dummy/invalid ROMs may not contain proper message terminators.
-    // Bound parsing to the ROM size to avoid out-of-bounds reads (signals).
-    auto messages = yaze::editor::ReadAllTextData(
-        rom_data_copy.data(), yaze::editor::kTextData,
-        static_cast<int>(rom_data_copy.size()));
-
-    bool pw_string_found = false;
-    for (const auto& msg : messages) {
-      if (absl::StrContains(msg.ContentsParsed, "PARALLEL WORLDS") ||
-          absl::StrContains(msg.ContentsParsed, "Parallel Worlds")) {
-        pw_string_found = true;
-        break;
-      }
+void CheckParallelWorldsHeuristics(const DoctorSnapshot& snapshot,
+                                   DoctorCheckResult& result) {
+  // 1. Search for "PARALLEL WORLDS" string in decoded messages (parse errors
+  // leave the list empty)
+  bool pw_string_found = false;
+  for (const auto& msg : snapshot.messages()) {
+    if (absl::StrContains(msg.ContentsParsed, "PARALLEL WORLDS") ||
+        absl::StrContains(msg.ContentsParsed, "Parallel Worlds")) {
+      pw_string_found = true;
+      break;
     }
+  }
 
-    if (pw_string_found) {
-      DiagnosticFinding finding;
-      finding.id = "parallel_worlds_string";
-      finding.severity = DiagnosticSeverity::kInfo;
-      finding.message = "Found 'PARALLEL WORLDS' string in message data";
-      finding.location = "Message Data";
-      finding.suggested_action = "Confirmed Parallel Worlds ROM.";
-      finding.fixable = false;
-      report.AddFinding(finding);
-    }
-  } catch (...) {
-    // Ignore parsing errors
+  if (pw_string_found) {
+    DiagnosticFinding finding;
+    finding.id = "parallel_worlds_string";
+    finding.severity = DiagnosticSeverity::kInfo;
+    finding.message = "Found 'PARALLEL WORLDS' string in message data";
+    finding.location = "Message Data";
+    finding.suggested_action = "Confirmed Parallel Worlds ROM.";
+    finding.fixable = false;
+    result.findings.push_back(finding);
   }
 }
 
-void CheckZScreamHeuristics(Rom* rom, DiagnosticReport& report) {
-  const auto* data = rom->data();
-  size_t size = rom->size();
+void CheckZScreamHeuristics(const DoctorSnapshot& snapshot,
+                            DoctorCheckResult& result) {
+  const auto* data = snapshot.data();
+  size_t size = snapshot.size();
 
   bool has_zscustom_features = false;
   std::vector<std::string> features_found;
@@ -359,7 +321,7 @@ void CheckZScreamHeuristics(Rom* rom, DiagnosticReport& report) {
     features_found.push_back("Custom Palette");
   }
 
-  if (has_zscustom_features && report.features.is_vanilla) {
+  if (has_zscustom_features && snapshot.features().is_vanilla) {
     DiagnosticFinding finding;
     finding.id = "zscustom_features_detected";
     finding.severity = DiagnosticSeverity::kInfo;
@@ -369,11 +331,141 @@ void CheckZScreamHeuristics(Rom* rom, DiagnosticReport& report) {
     finding.location = "ZSCustom Flags";
     finding.suggested_action = "Treat as ZSCustom ROM.";
     finding.fixable = false;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
+
+    // Applied to the report by the command; the snapshot is immutable.
+    result.metrics.emplace_back("zscustom_detected", 1);
+  }
+}
+
+// Free space analysis (simplified): counts 0x00/0xFF bytes in the expansion
+// region of 2MB ROMs.
+void CheckFreeSpace(const DoctorSnapshot& snapshot, DoctorCheckResult& result) {
+  if (snapshot.size() < kExpandedSize) {
+    return;
+  }
+
+  const auto* data = snapshot.data();
+  size_t free_bytes = 0;
+  for (size_t i = 0x180000; i < 0x1E0000 && i < snapshot.size(); ++i) {
+    if (data[i] == 0x00 || data[i] == 0xFF) {
+      free_bytes++;
+    }
+  }
+  result.metrics.emplace_back("free_space_estimate",
+                              static_cast<int>(free_bytes));
+
+  DiagnosticFinding finding;
+  finding.id = "free_space_info";
+  finding.severity = DiagnosticSeverity::kInfo;
+  finding.message = absl::StrFormat(
+      "Estimated free space in expansion region: %zu bytes (%.1f KB)",
+      free_bytes, free_bytes / 1024.0);
+  finding.location = "0x180000-0x1E0000";
+  finding.fixable = false;
+  result.findings.push_back(finding);
+}
+
+// Hyrule Magic / Parallel Worlds header analysis
+void CheckHyruleMagic(const DoctorSnapshot& snapshot,
+                      DoctorCheckResult& result) {
+  // The validator only reads through its pointer.
+  yaze::rom::HyruleMagicValidator hm_validator(
+      const_cast<Rom*>(&snapshot.rom()));
+  if (hm_validator.IsParallelWorlds()) {
+    DiagnosticFinding finding;
+    finding.id = "parallel_worlds_detected";
+    finding.severity = DiagnosticSeverity::kInfo;
+    finding.message = "Parallel Worlds (1.5MB) detected (Header check)";
+    finding.location = "ROM Header";
+    finding.suggested_action =
+        "Use z3ed for editing. Custom pointer tables are supported.";
+    finding.fixable = false;
+    result.findings.push_back(finding);
+  } else if (hm_validator.HasBank00Erasure()) {
+    DiagnosticFinding finding;
+    finding.id = "hm_corruption_detected";
+    finding.severity = DiagnosticSeverity::kCritical;
+    finding.message = "Hyrule Magic corruption detected (Bank 00 erasure)";
+    finding.location = "Bank 00";
+    finding.suggested_action = "ROM is likely unstable. Restore from backup.";
+    finding.fixable = false;
+    result.findings.push_back(finding);
+  }
+}
+
+// Oracle of Secrets: validate WaterFill reserved region integrity.
+//
+// This is a ROM safety check for editor-authored water fill zones which
+// reserve a tail region inside the expanded custom collision bank. If custom
+// collision data overlaps that reserved tail, the ROM layout is incompatible
+// with the WaterFill table format and yaze must not attempt to use it.
+void CheckWaterFillTable(const DoctorSnapshot& snapshot,
+                         DoctorCheckResult& result) {
+  auto zones_or =
+      yaze::zelda3::LoadWaterFillTable(const_cast<Rom*>(&snapshot.rom()));
+  if (!zones_or.ok()) {
+    DiagnosticFinding finding;
+    finding.id = "water_fill_table_invalid";
+    finding.severity = DiagnosticSeverity::kWarning;
+    finding.message = absl::StrFormat("WaterFill table parse failed: %s",
+                                      zones_or.status().message());
+    finding.location = "Custom collision bank ($13:xxxx)";
+    finding.suggested_action =
+        "Restore from a known-good ROM or fix custom collision layout. "
+        "This must be resolved before using WaterFill authoring.";
+    finding.fixable = false;
+    result.findings.push_back(finding);
+  } else {
+    result.metrics.emplace_back("water_fill_zone_count",
+                                static_cast<int>(zones_or.value().size()));
+  }
+}
+
+// Checks in report order. Inputs name the bytes each result depends on so an
+// edit only invalidates the checks that read it; an empty list means the
+// whole ROM.
+DoctorPipeline BuildRomDoctorPipeline(bool deep) {
+  auto with_features = [](std::vector<DoctorInputRange> inputs) {
+    for (const auto& range : DoctorSnapshot::FeatureInputs()) {
+      inputs.push_back(range);
+    }
+    return inputs;
+  };
+
+  std::vector<DoctorInputRange> corruption_inputs = {{0x0000, 0x1000}};
+  for (uint32_t addr : kProblemAddresses) {
+    corruption_inputs.push_back({addr, addr + 1});
+  }
 
-    report.features.is_vanilla = false;
-    report.features.zs_custom_version = 0xFE;  // Unknown/Detected
+  DoctorPipeline pipeline;
+  pipeline.AddCheck({"free_space", 1, {{0x180000, 0x1E0000}}, CheckFreeSpace});
+  if (deep) {
+    pipeline.AddCheck({"corruption_heuristics_deep", 1, {},
+                       [](const DoctorSnapshot& snapshot,
+                          DoctorCheckResult& result) {
+                         CheckCorruptionHeuristics(snapshot, result, true);
+                       }});
+  } else {
+    pipeline.AddCheck({"corruption_heuristics", 1, corruption_inputs,
+                       [](const DoctorSnapshot& snapshot,
+                          DoctorCheckResult& result) {
+                         CheckCorruptionHeuristics(snapshot, result, false);
+                       }});
   }
+  pipeline.AddCheck({"hyrule_magic", 1, {{0x4B, 0x100}}, CheckHyruleMagic});
+  pipeline.AddCheck({"parallel_worlds_strings", 1, {},
+                     CheckParallelWorldsHeuristics});
+  pipeline.AddCheck(
+      {"zscustom_heuristics", 1,
+       with_features({{kCustomBGEnabledPos, kCustomMainPalettePos + 1}}),
+       CheckZScreamHeuristics});
+  pipeline.AddCheck(
+      {"expanded_tables", 1,
+       with_features({{kMap16TilesExpanded, kMap16TilesExpandedEnd}}),
+       ValidateExpandedTables});
+  pipeline.AddCheck({"water_fill_table", 1, {}, CheckWaterFillTable});
+  return pipeline;
 }
 
 }  // namespace
@@ -451,7 +543,8 @@ absl::Status RomDoctorCommandHandler::Execute(
   }
 
   // Detect ZSCustomOverworld version
-  report.features = DetectRomFeaturesLocal(rom);
+  DoctorSnapshot snapshot(*rom);
+  report.features = snapshot.features();
   formatter.AddField("zs_custom_version", report.features.GetVersionString());
   formatter.AddField("is_vanilla", report.features.is_vanilla);
   formatter.AddField("expanded_tile16", report.features.has_expanded_tile16);
@@ -459,85 +552,23 @@ absl::Status RomDoctorCommandHandler::Execute(
   formatter.AddField("expanded_pointer_tables",
                      report.features.has_expanded_pointer_tables);
 
-  // Free space analysis (simplified)
-  if (rom->size() >= kExpandedSize) {
-    // Check for free space in expansion region
-    size_t free_bytes = 0;
-    for (size_t i = 0x180000; i < 0x1E0000 && i < rom->size(); ++i) {
-      if (rom->data()[i] == 0x00 || rom->data()[i] == 0xFF) {
-        free_bytes++;
-      }
-    }
-    formatter.AddField("free_space_estimate", static_cast<int>(free_bytes));
-    formatter.AddField("free_space_region", "0x180000-0x1E0000");
-
-    DiagnosticFinding finding;
-    finding.id = "free_space_info";
-    finding.severity = DiagnosticSeverity::kInfo;
-    finding.message = absl::StrFormat(
-        "Estimated free space in expansion region: %zu bytes (%.1f KB)",
-        free_bytes, free_bytes / 1024.0);
-    finding.location = "0x180000-0x1E0000";
-    finding.fixable = false;
-    report.AddFinding(finding);
-  }
-
-  // 3. Check for corruption heuristics
-  CheckCorruptionHeuristics(rom, report, deep);
-
-  // 4. Hyrule Magic / Parallel Worlds Analysis
-  yaze::rom::HyruleMagicValidator hm_validator(rom);
-  if (hm_validator.IsParallelWorlds()) {
-    DiagnosticFinding finding;
-    finding.id = "parallel_worlds_detected";
-    finding.severity = DiagnosticSeverity::kInfo;
-    finding.message = "Parallel Worlds (1.5MB) detected (Header check)";
-    finding.location = "ROM Header";
-    finding.suggested_action =
-        "Use z3ed for editing. Custom pointer tables are supported.";
-    finding.fixable = false;
-    report.AddFinding(finding);
-  } else if (hm_validator.HasBank00Erasure()) {
-    DiagnosticFinding finding;
-    finding.id = "hm_corruption_detected";
-    finding.severity = DiagnosticSeverity::kCritical;
-    finding.message = "Hyrule Magic corruption detected (Bank 00 erasure)";
-    finding.location = "Bank 00";
-    finding.suggested_action = "ROM is likely unstable. Restore from backup.";
-    finding.fixable = false;
-    report.AddFinding(finding);
-  }
-
-  // Advanced Heuristics
-  CheckParallelWorldsHeuristics(rom, report);
-  CheckZScreamHeuristics(rom, report);
-
-  // 5. Validate expanded tables
-  ValidateExpandedTables(rom, report);
-
-  // 6. Oracle of Secrets: validate WaterFill reserved region integrity.
-  //
-  // This is a ROM safety check for editor-authored water fill zones which
-  // reserve a tail region inside the expanded custom collision bank. If custom
-  // collision data overlaps that reserved tail, the ROM layout is incompatible
-  // with the WaterFill table format and yaze must not attempt to use it.
-  {
-    auto zones_or = yaze::zelda3::LoadWaterFillTable(rom);
-    if (!zones_or.ok()) {
-      DiagnosticFinding finding;
-      finding.id = "water_fill_table_invalid";
-      finding.severity = DiagnosticSeverity::kWarning;
-      finding.message = absl::StrFormat("WaterFill table parse failed: %s",
-                                        zones_or.status().message());
-      finding.location = "Custom collision bank ($13:xxxx)";
-      finding.suggested_action =
-          "Restore from a known-good ROM or fix custom collision layout. "
-          "This must be resolved before using WaterFill authoring.";
-      finding.fixable = false;
+  // Content checks run in parallel; unchanged inputs reuse cached results.
+  auto results = BuildRomDoctorPipeline(deep).Run(snapshot);
+  for (const auto& result : results) {
+    for (const auto& finding : result.findings) {
       report.AddFinding(finding);
-    } else if (verbose) {
-      formatter.AddField("water_fill_zone_count",
-                         static_cast<int>(zones_or.value().size()));
+    }
+    if (const int* free_bytes = result.FindMetric("free_space_estimate")) {
+      formatter.AddField("free_space_estimate", *free_bytes);
+      formatter.AddField("free_space_region", "0x180000-0x1E0000");
+    }
+    if (result.FindMetric("zscustom_detected")) {
+      report.features.is_vanilla = false;
+      report.features.zs_custom_version = 0xFE;  // Unknown/Detected
+    }
+    if (const int* zones = result.FindMetric("water_fill_zone_count");
+        zones && verbose) {
+      formatter.AddField("water_fill_zone_count", *zones);
     }
   }
 
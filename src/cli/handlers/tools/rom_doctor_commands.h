@@ -33,6 +33,8 @@ class RomDoctorCommandHandler : public resources::CommandHandler {
 
   std::string GetOutputTitle() const override { return "ROM Doctor"; }
 
+  bool ReadsRomOnly() const override { return true; }
+
   Descriptor Describe() const override {
     Descriptor desc;
     desc.display_name = "rom-doctor";
@@ -1,10 +1,14 @@
 #include "cli/handlers/tools/sprite_doctor_commands.h"
 
 #include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "cli/handlers/tools/diagnostic_types.h"
+#include "cli/handlers/tools/doctor_pipeline.h"
 #include "rom/rom.h"
 #include "zelda3/dungeon/dungeon_rom_addresses.h"
 #include "zelda3/game_data.h"
@@ -14,17 +18,23 @@ namespace cli {
 
 namespace {
 
+constexpr int kNumSpritesets = 144;
+constexpr int kNumGfxSheets = 223;
+constexpr int kMaxSpritesPerRoom = 32;  // Reasonable limit
+// Room sprite pointers are offsets into bank 09.
+constexpr uint32_t kSpriteDataBank = 0x090000;
+
 // Validate sprite pointer table entries
-void ValidateSpritePointerTable(Rom* rom, DiagnosticReport& report,
-                                bool verbose) {
-  const auto& data = rom->vector();
+void ValidateSpritePointerTable(const DoctorSnapshot& snapshot,
+                                DoctorCheckResult& result, bool verbose) {
+  const uint8_t* data = snapshot.data();
 
   // Check sprite pointers for all 296 rooms
   int invalid_count = 0;
   for (int room = 0; room < zelda3::kNumberOfRooms; ++room) {
     uint32_t ptr_addr = zelda3::kRoomsSpritePointer + (room * 2);
 
-    if (ptr_addr + 1 >= rom->size()) {
+    if (ptr_addr + 1 >= snapshot.size()) {
       DiagnosticFinding finding;
       finding.id = "sprite_ptr_out_of_bounds";
       finding.severity = DiagnosticSeverity::kCritical;
@@ -32,7 +42,7 @@ void ValidateSpritePointerTable(Rom* rom, DiagnosticReport& report,
           "Sprite pointer table address 0x%06X is beyond ROM size", ptr_addr);
       finding.location = absl::StrFormat("Room %d", room);
       finding.fixable = false;
-      report.AddFinding(finding);
+      result.findings.push_back(finding);
       return;
     }
 
@@ -40,7 +50,7 @@ void ValidateSpritePointerTable(Rom* rom, DiagnosticReport& report,
     uint16_t ptr = data[ptr_addr] | (data[ptr_addr + 1] << 8);
 
     // Pointers point into Bank 09 (0x090000)
-    uint32_t sprite_addr = 0x090000 + ptr;
+    uint32_t sprite_addr = kSpriteDataBank + ptr;
 
     // Validate pointer points to valid sprite data region
     if (sprite_addr < zelda3::kSpritesData ||
@@ -56,7 +66,7 @@ void ValidateSpritePointerTable(Rom* rom, DiagnosticReport& report,
             zelda3::kSpritesEndData);
         finding.location = absl::StrFormat("0x%06X", ptr_addr);
         finding.fixable = false;
-        report.AddFinding(finding);
+        result.findings.push_back(finding);
       }
       invalid_count++;
     }
@@ -71,26 +81,25 @@ void ValidateSpritePointerTable(Rom* rom, DiagnosticReport& report,
         invalid_count);
     finding.location = "Sprite Pointer Table";
     finding.fixable = false;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
   }
 }
 
 // Validate spriteset graphics references
-void ValidateSpritesets(Rom* rom, DiagnosticReport& report) {
-  const auto& data = rom->vector();
+void ValidateSpritesets(const DoctorSnapshot& snapshot,
+                        DoctorCheckResult& result) {
+  const uint8_t* data = snapshot.data();
 
   // Spriteset table at kSpriteBlocksetPointer
   // 144 spritesets, 4 bytes each (4 graphics sheet references)
   uint32_t spriteset_addr = zelda3::kSpriteBlocksetPointer;
-  constexpr int kNumSpritesets = 144;
-  constexpr int kNumGfxSheets = 223;
 
   int invalid_refs = 0;
 
   for (int set = 0; set < kNumSpritesets; ++set) {
     for (int slot = 0; slot < 4; ++slot) {
       uint32_t addr = spriteset_addr + (set * 4) + slot;
-      if (addr >= rom->size()) {
+      if (addr >= snapshot.size()) {
         DiagnosticFinding finding;
         finding.id = "spriteset_addr_out_of_bounds";
         finding.severity = DiagnosticSeverity::kError;
@@ -98,7 +107,7 @@ void ValidateSpritesets(Rom* rom, DiagnosticReport& report) {
             "Spriteset %d address 0x%06X beyond ROM size", set, addr);
         finding.location = absl::StrFormat("Spriteset %d", set);
         finding.fixable = false;
-        report.AddFinding(finding);
+        result.findings.push_back(finding);
         return;
       }
 
@@ -114,7 +123,7 @@ void ValidateSpritesets(Rom* rom, DiagnosticReport& report) {
               slot, sheet_id, kNumGfxSheets - 1);
           finding.location = absl::StrFormat("Spriteset %d slot %d", set, slot);
           finding.fixable = false;
-          report.AddFinding(finding);
+          result.findings.push_back(finding);
         }
         invalid_refs++;
       }
@@ -129,22 +138,23 @@ void ValidateSpritesets(Rom* rom, DiagnosticReport& report) {
         "Found %d invalid spriteset sheet references", invalid_refs);
     finding.location = "Spriteset Table";
     finding.fixable = false;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
   }
 }
 
 // Validate sprite data for a specific room
-void ValidateRoomSprites(Rom* rom, int room_id, DiagnosticReport& report,
-                         int& total_sprites, int& empty_rooms) {
-  const auto& data = rom->vector();
+void ValidateRoomSprites(const DoctorSnapshot& snapshot, int room_id,
+                         DoctorCheckResult& result, int& total_sprites,
+                         int& empty_rooms) {
+  const uint8_t* data = snapshot.data();
 
   // Get sprite pointer for this room
   uint32_t ptr_addr = zelda3::kRoomsSpritePointer + (room_id * 2);
-  if (ptr_addr + 1 >= rom->size())
+  if (ptr_addr + 1 >= snapshot.size())
     return;
 
   uint16_t ptr = data[ptr_addr] | (data[ptr_addr + 1] << 8);
-  uint32_t sprite_addr = 0x090000 + ptr;
+  uint32_t sprite_addr = kSpriteDataBank + ptr;
 
   // Empty room check
   if (sprite_addr == zelda3::kSpritesDataEmptyRoom) {
@@ -152,25 +162,25 @@ void ValidateRoomSprites(Rom* rom, int room_id, DiagnosticReport& report,
     return;
   }
 
-  if (sprite_addr >= rom->size())
+  if (sprite_addr >= snapshot.size())
     return;
 
   // Read sort byte
-  if (sprite_addr >= rom->size())
+  if (sprite_addr >= snapshot.size())
     return;
   // uint8_t sort_byte = data[sprite_addr];
   sprite_addr++;
 
   // Parse sprites (3 bytes each, terminated by 0xFF)
   int room_sprite_count = 0;
-  const int kMaxSpritesPerRoom = 32;  // Reasonable limit
 
-  while (sprite_addr < rom->size() && room_sprite_count < kMaxSpritesPerRoom) {
+  while (sprite_addr < snapshot.size() &&
+         room_sprite_count < kMaxSpritesPerRoom) {
     uint8_t y_pos = data[sprite_addr];
     if (y_pos == 0xFF)
       break;  // Terminator
 
-    if (sprite_addr + 2 >= rom->size()) {
+    if (sprite_addr + 2 >= snapshot.size()) {
       DiagnosticFinding finding;
       finding.id = "truncated_sprite_data";
       finding.severity = DiagnosticSeverity::kError;
@@ -178,7 +188,7 @@ void ValidateRoomSprites(Rom* rom, int room_id, DiagnosticReport& report,
           "Room %d sprite data truncated at 0x%06X", room_id, sprite_addr);
       finding.location = absl::StrFormat("Room %d", room_id);
       finding.fixable = false;
-      report.AddFinding(finding);
+      result.findings.push_back(finding);
       break;
     }
 
@@ -208,19 +218,20 @@ void ValidateRoomSprites(Rom* rom, int room_id, DiagnosticReport& report,
                         kMaxSpritesPerRoom);
     finding.location = absl::StrFormat("Room %d", room_id);
     finding.fixable = false;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
   }
 }
 
 // Check for common sprite issues
-void CheckCommonSpriteIssues(Rom* rom, DiagnosticReport& report) {
-  const auto& data = rom->vector();
+void CheckCommonSpriteIssues(const DoctorSnapshot& snapshot,
+                             DoctorCheckResult& result) {
+  const uint8_t* data = snapshot.data();
 
   // Check for zeroed sprite pointer table (corruption sign)
   int zero_pointers = 0;
   for (int room = 0; room < zelda3::kNumberOfRooms; ++room) {
     uint32_t ptr_addr = zelda3::kRoomsSpritePointer + (room * 2);
-    if (ptr_addr + 1 >= rom->size())
+    if (ptr_addr + 1 >= snapshot.size())
       break;
 
     uint16_t ptr = data[ptr_addr] | (data[ptr_addr + 1] << 8);
@@ -239,8 +250,60 @@ void CheckCommonSpriteIssues(Rom* rom, DiagnosticReport& report) {
     finding.location = "Sprite Pointer Table";
     finding.suggested_action = "Verify ROM integrity";
     finding.fixable = false;
-    report.AddFinding(finding);
+    result.findings.push_back(finding);
+  }
+}
+
+// Validate the sprite lists of the given rooms
+void ValidateRooms(const DoctorSnapshot& snapshot,
+                   const std::vector<int>& rooms, DoctorCheckResult& result) {
+  int total_sprites = 0;
+  int empty_rooms = 0;
+  for (int room : rooms) {
+    ValidateRoomSprites(snapshot, room, result, total_sprites, empty_rooms);
   }
+  result.metrics.emplace_back("rooms_scanned", static_cast<int>(rooms.size()));
+  result.metrics.emplace_back("total_sprites", total_sprites);
+  result.metrics.emplace_back("empty_rooms", empty_rooms);
+}
+
+// Checks in report order. `rooms_id` names the room selection so each
+// selection caches separately; `verbose` lifts the finding cap of the
+// pointer table check.
+DoctorPipeline BuildSpriteDoctorPipeline(std::vector<int> rooms,
+                                         const std::string& rooms_id,
+                                         bool verbose) {
+  const DoctorInputRange pointer_table = {
+      zelda3::kRoomsSpritePointer,
+      zelda3::kRoomsSpritePointer + zelda3::kNumberOfRooms * 2};
+  const DoctorInputRange spritesets = {
+      zelda3::kSpriteBlocksetPointer,
+      zelda3::kSpriteBlocksetPointer + kNumSpritesets * 4};
+  // A list starts up to 0xFFFF into the bank: one sort byte, then at most
+  // kMaxSpritesPerRoom entries and a terminator.
+  const DoctorInputRange sprite_lists = {
+      kSpriteDataBank, kSpriteDataBank + 0x10000 + 1 + kMaxSpritesPerRoom * 3};
+
+  DoctorPipeline pipeline;
+  pipeline.AddCheck({verbose ? "sprite_pointer_table_verbose"
+                             : "sprite_pointer_table",
+                     1,
+                     {pointer_table},
+                     [verbose](const DoctorSnapshot& snapshot,
+                               DoctorCheckResult& result) {
+                       ValidateSpritePointerTable(snapshot, result, verbose);
+                     }});
+  pipeline.AddCheck({"spritesets", 1, {spritesets}, ValidateSpritesets});
+  pipeline.AddCheck({"room_sprites_" + rooms_id,
+                     1,
+                     {pointer_table, sprite_lists},
+                     [rooms = std::move(rooms)](const DoctorSnapshot& snapshot,
+                                                DoctorCheckResult& result) {
+                       ValidateRooms(snapshot, rooms, result);
+                     }});
+  pipeline.AddCheck({"common_sprite_issues", 1, {pointer_table},
+                     CheckCommonSpriteIssues});
+  return pipeline;
 }
 
 }  // namespace
@@ -270,46 +333,55 @@ absl::Status SpriteDoctorCommandHandler::Execute(
     }
   }
 
-  // 1. Validate sprite pointer table
-  ValidateSpritePointerTable(rom, report, verbose);
-
-  // 2. Validate spriteset references
-  ValidateSpritesets(rom, report);
-
-  // 3. Validate room sprites
-  int total_sprites = 0;
-  int empty_rooms = 0;
-  int rooms_scanned = 0;
-
+  // Select rooms to scan
+  std::vector<int> rooms;
+  std::string rooms_id;
   if (single_room) {
-    ValidateRoomSprites(rom, target_room, report, total_sprites, empty_rooms);
-    rooms_scanned = 1;
+    rooms.push_back(target_room);
+    rooms_id = absl::StrFormat("room_%d", target_room);
   } else if (scan_all) {
     for (int room = 0; room < zelda3::kNumberOfRooms; ++room) {
-      ValidateRoomSprites(rom, room, report, total_sprites, empty_rooms);
-      rooms_scanned++;
+      rooms.push_back(room);
     }
+    rooms_id = "all";
   } else {
     // Sample rooms: first 20, some middle, some end
-    std::vector<int> sample_rooms;
     for (int i = 0; i < 20; ++i)
-      sample_rooms.push_back(i);
+      rooms.push_back(i);
     for (int i = 100; i < 110; ++i)
-      sample_rooms.push_back(i);
+      rooms.push_back(i);
     for (int i = 200; i < 210; ++i)
-      sample_rooms.push_back(i);
+      rooms.push_back(i);
+    std::erase_if(rooms,
+                  [](int room) { return room >= zelda3::kNumberOfRooms; });
+    rooms_id = "sample";
+  }
 
-    for (int room : sample_rooms) {
-      if (room < zelda3::kNumberOfRooms) {
-        ValidateRoomSprites(rom, room, report, total_sprites, empty_rooms);
-        rooms_scanned++;
-      }
+  // Pointer table, spriteset, room and common-issue checks run in parallel;
+  // unchanged inputs reuse cached results.
+  int total_sprites = 0;
+  int empty_rooms = 0;
+  int rooms_scanned = 0;
+
+  DoctorSnapshot snapshot(*rom);
+  auto results =
+      BuildSpriteDoctorPipeline(std::move(rooms), rooms_id, verbose)
+          .Run(snapshot);
+  for (const auto& result : results) {
+    for (const auto& finding : result.findings) {
+      report.AddFinding(finding);
+    }
+    if (const int* count = result.FindMetric("rooms_scanned")) {
+      rooms_scanned = *count;
+    }
+    if (const int* count = result.FindMetric("total_sprites")) {
+      total_sprites = *count;
+    }
+    if (const int* count = result.FindMetric("empty_rooms")) {
+      empty_rooms = *count;
     }
   }
 
-  // 4. Check common issues
-  CheckCommonSpriteIssues(rom, report);
-
   // Output results
   formatter.AddField("rooms_scanned", rooms_scanned);
   formatter.AddField("total_sprites", total_sprites);
@@ -9,6 +9,7 @@
 #include "cli/handlers/game/minecart_commands.h"
 #include "cli/handlers/game/music_commands.h"
 #include "cli/handlers/game/overworld_commands.h"
+#include "cli/handlers/graphics/hex_commands.h"
 #include "cli/handlers/graphics/sprite_commands.h"
 #include "cli/handlers/tools/test_helpers_commands.h"
 #include "cli/service/resources/command_context.h"
@@ -135,6 +136,20 @@ void RegisterBuiltinAgentTools(ToolRegistry& registry) {
       "resource-search --query=<query>", {"resource-search --query=castle"},
       true, false, ResourceSearchCommandHandler)
 
+  // Hex commands
+  REGISTER_BUILTIN_AGENT_TOOL(
+      "hex-read", "hex", "Read raw ROM bytes",
+      "hex-read --address=<hex> [--length=<n>]", {"hex-read --address=0x7FC0"},
+      true, false, HexReadCommandHandler)
+  REGISTER_BUILTIN_AGENT_TOOL(
+      "hex-search", "hex",
+      "Search ROM bytes for a wildcard pattern, or for every pattern in a "
+      "signature file in one pass",
+      "hex-search (--pattern=<bytes> | --patterns-file=<path>) "
+      "[--start=<hex>] [--end=<hex>] [--max-matches=<n>]",
+      {"hex-search --pattern=\"22 ?? ?? 00\""}, true, false,
+      HexSearchCommandHandler)
+
   // Dungeon commands
   REGISTER_BUILTIN_AGENT_TOOL("dungeon-list-sprites", "dungeon",
                               "List sprites in a dungeon room",
@@ -614,10 +614,10 @@ std::string CommandRegistry::GenerateCompleteHelp() const {
   return help.str();
 }
 
-absl::Status CommandRegistry::Execute(const std::string& name,
-                                      const std::vector<std::string>& args,
-                                      Rom* rom_context,
-                                      std::string* captured_output) {
+absl::Status CommandRegistry::Execute(
+    const std::string& name, const std::vector<std::string>& args,
+    Rom* rom_context, std::string* captured_output,
+    const resources::ResidentCommandState* resident) {
   auto* handler = Get(name);
   if (!handler) {
     return absl::NotFoundError(absl::StrFormat("Command '%s' not found", name));
@@ -636,7 +636,8 @@ absl::Status CommandRegistry::Execute(const std::string& name,
     return absl::OkStatus();
   }
 
-  absl::Status status = handler->Run(args, rom_context, captured_output);
+  absl::Status status =
+      handler->Run(args, rom_context, captured_output, resident);
 
   // If a command was invoked without its required arguments, surface full
   // command help in addition to the normal parser error/usage line.
@@ -104,10 +104,10 @@ class CommandRegistry {
   /**
    * @brief Execute a command by name
    */
-  absl::Status Execute(const std::string& name,
-                       const std::vector<std::string>& args,
-                       Rom* rom_context = nullptr,
-                       std::string* captured_output = nullptr);
+  absl::Status Execute(
+      const std::string& name, const std::vector<std::string>& args,
+      Rom* rom_context = nullptr, std::string* captured_output = nullptr,
+      const resources::ResidentCommandState* resident = nullptr);
 
   /**
    * @brief Check if command exists
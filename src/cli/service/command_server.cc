@@ -0,0 +1,392 @@
+#include "cli/service/command_server.h"
+
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+#include "nlohmann/json.hpp"
+#include "util/macro.h"
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+namespace yaze {
+namespace cli {
+
+namespace {
+
+using json = nlohmann::json;
+
+// Handlers that print straight to std::cout would interleave with the
+// response stream; collect that output and return it in the response.
+class ScopedStdoutCapture {
+ public:
+  ScopedStdoutCapture() : previous_(std::cout.rdbuf(buffer_.rdbuf())) {}
+  ~ScopedStdoutCapture() { std::cout.rdbuf(previous_); }
+
+  std::string str() const { return buffer_.str(); }
+
+ private:
+  std::ostringstream buffer_;
+  std::streambuf* previous_;
+};
+
+std::optional<std::filesystem::file_time_type> FileTimestamp(
+    const std::string& path) {
+  if (path.empty()) {
+    return std::nullopt;
+  }
+  std::error_code ec;
+  const auto timestamp = std::filesystem::last_write_time(path, ec);
+  if (ec) {
+    return std::nullopt;
+  }
+  return timestamp;
+}
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+// Removes a stale socket left at `path` by an earlier server. Anything that
+// is not a socket (a mistyped --socket=zelda3.sfc, say) is left alone and
+// reported, so bind() never costs the user a file.
+absl::Status RemoveStaleSocket(const std::string& path) {
+  struct stat info;
+  if (lstat(path.c_str(), &info) != 0) {
+    if (errno == ENOENT) {
+      return absl::OkStatus();
+    }
+    return absl::InternalError(
+        absl::StrFormat("Cannot stat %s: %s", path, strerror(errno)));
+  }
+  if (!S_ISSOCK(info.st_mode)) {
+    return absl::FailedPreconditionError(absl::StrFormat(
+        "Refusing to replace %s: it exists and is not a socket", path));
+  }
+  if (unlink(path.c_str()) != 0 && errno != ENOENT) {
+    return absl::InternalError(
+        absl::StrFormat("Cannot remove %s: %s", path, strerror(errno)));
+  }
+  return absl::OkStatus();
+}
+#endif
+
+}  // namespace
+
+CommandServer::CommandServer(CommandRegistry& registry)
+    : registry_(registry) {}
+
+CommandServer::~CommandServer() = default;
+
+absl::Status CommandServer::Open(const Options& options) {
+  resources::CommandContext::Config config;
+  if (!options.rom_path.empty()) {
+    config.rom_path = options.rom_path;
+  }
+  config.use_mock_rom = options.use_mock_rom;
+  config.symbols_path = options.symbols_path;
+  config.project_context_path = options.project_context_path;
+
+  auto context = std::make_unique<resources::CommandContext>(config);
+  RETURN_IF_ERROR(context->Initialize());
+  ASSIGN_OR_RETURN(Rom * rom, context->GetRom());
+  // Labels live on the Rom, so loading them once here covers every request.
+  context->EnsureLabelsLoaded(rom).IgnoreError();
+
+  context_ = std::move(context);
+  rom_ = rom;
+  resident_.symbol_provider = context_->GetSymbolProvider();
+  resident_.project = context_->GetProjectContext();
+  resident_.world = &world_;
+  RecordRomTimestamp();
+  AdvanceRomRevision();
+  return absl::OkStatus();
+}
+
+void CommandServer::Attach(Rom* rom) {
+  context_.reset();
+  rom_ = rom;
+  resident_ = {};
+  resident_.world = &world_;
+  RecordRomTimestamp();
+  AdvanceRomRevision();
+}
+
+void CommandServer::RecordRomTimestamp() {
+  rom_timestamp_ =
+      rom_ != nullptr ? FileTimestamp(rom_->filename()) : std::nullopt;
+}
+
+void CommandServer::AdvanceRomRevision() {
+  ++rom_revision_;
+  world_.Bind(rom_, rom_revision_);
+}
+
+absl::Status CommandServer::ReloadIfChangedOnDisk(bool force) {
+  if (rom_ == nullptr || rom_->filename().empty()) {
+    return force ? absl::FailedPreconditionError(
+                       "Resident ROM was not loaded from a file")
+                 : absl::OkStatus();
+  }
+  if (!force) {
+    // Keep unsaved committed edits; the next "save" or "reload" decides.
+    if (rom_->dirty() || FileTimestamp(rom_->filename()) == rom_timestamp_) {
+      return absl::OkStatus();
+    }
+  }
+  const std::string path = rom_->filename();
+  RETURN_IF_ERROR(rom_->LoadFromFile(path));
+  if (context_ != nullptr) {
+    context_->EnsureLabelsLoaded(rom_).IgnoreError();
+  }
+  RecordRomTimestamp();
+  AdvanceRomRevision();
+  return absl::OkStatus();
+}
+
+std::string CommandServer::HandleLine(absl::string_view line) {
+  ++requests_served_;
+  const auto start = std::chrono::steady_clock::now();
+  json response = json::object();
+
+  auto finish = [&](const absl::Status& status) {
+    response["ok"] = status.ok();
+    if (!status.ok()) {
+      response["error"] = std::string(status.message());
+      response["code"] = absl::StatusCodeToString(status.code());
+    }
+    response["elapsed_ms"] =
+        std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start)
+            .count();
+    return response.dump();
+  };
+
+  const json request = json::parse(line.begin(), line.end(), nullptr, false);
+  if (request.is_discarded() || !request.is_object()) {
+    return finish(absl::InvalidArgumentError(
+        "Malformed request: expected a JSON object per line"));
+  }
+  if (request.contains("id")) {
+    response["id"] = request["id"];
+  }
+
+  if (!request.contains("command") || !request["command"].is_string()) {
+    return finish(
+        absl::InvalidArgumentError("Request needs a \"command\" string"));
+  }
+  const std::string command = request["command"].get<std::string>();
+
+  std::vector<std::string> args;
+  if (request.contains("args")) {
+    if (!request["args"].is_array()) {
+      return finish(absl::InvalidArgumentError("\"args\" must be an array"));
+    }
+    for (const auto& arg : request["args"]) {
+      if (!arg.is_string()) {
+        return finish(
+            absl::InvalidArgumentError("\"args\" entries must be strings"));
+      }
+      args.push_back(arg.get<std::string>());
+    }
+  }
+  const bool commit = request.contains("commit") &&
+                      request["commit"].is_boolean() &&
+                      request["commit"].get<bool>();
+
+  // Built-in commands
+  if (command == "ping") {
+    return finish(absl::OkStatus());
+  }
+  if (command == "status") {
+    if (rom_ != nullptr) {
+      response["rom"] = rom_->filename();
+      response["rom_size"] = rom_->size();
+      response["rom_dirty"] = rom_->dirty();
+      response["dirty_pages"] = rom_->DirtyPages().size();
+    }
+    response["requests_served"] = requests_served_;
+    return finish(absl::OkStatus());
+  }
+  if (command == "reload") {
+    return finish(ReloadIfChangedOnDisk(/*force=*/true));
+  }
+  if (command == "save") {
+    if (rom_ == nullptr) {
+      return finish(absl::FailedPreconditionError("No resident ROM"));
+    }
+    auto status = rom_->SaveToFile({.save_new = false});
+    RecordRomTimestamp();
+    return finish(status);
+  }
+  if (command == "shutdown") {
+    shutdown_requested_ = true;
+    return finish(absl::OkStatus());
+  }
+
+  auto* handler = registry_.Get(command);
+  if (handler == nullptr) {
+    return finish(absl::NotFoundError(
+        absl::StrFormat("Command '%s' not found", command)));
+  }
+  if (handler->RequiresRom() && rom_ == nullptr) {
+    return finish(absl::FailedPreconditionError("No resident ROM"));
+  }
+  if (auto status = ReloadIfChangedOnDisk(/*force=*/false); !status.ok()) {
+    return finish(status);
+  }
+
+  // Per-request sandbox: a page-sharing clone, so the copy is cheap and the
+  // resident ROM only changes when the edit is kept.
+  std::optional<Rom> sandbox;
+  Rom* target = rom_;
+  if (rom_ != nullptr && handler->RequiresRom() && !handler->ReadsRomOnly()) {
+    sandbox.emplace(*rom_);
+    target = &*sandbox;
+  }
+
+  std::string output;
+  std::string stray_output;
+  absl::Status status;
+  {
+    ScopedStdoutCapture capture;
+    try {
+      status = registry_.Execute(command, args, target, &output, &resident_);
+    } catch (const std::exception& e) {
+      status = absl::InternalError(
+          absl::StrFormat("Command '%s' threw: %s", command, e.what()));
+    }
+    stray_output = capture.str();
+  }
+
+  if (!output.empty()) {
+    json parsed = json::parse(output, nullptr, false);
+    response["output"] = parsed.is_discarded() ? json(output) : parsed;
+  }
+  if (!stray_output.empty()) {
+    response["stdout"] = stray_output;
+  }
+
+  if (sandbox.has_value()) {
+    const bool changed = sandbox->size() != rom_->size() ||
+                         !Rom::ChangedPages(*rom_, *sandbox).empty();
+    // A command that saved its own edits has already changed the file, so
+    // the resident copy must follow regardless of "commit".
+    const bool saved = FileTimestamp(rom_->filename()) != rom_timestamp_;
+    const bool keep = changed && (saved || (commit && status.ok()));
+    if (keep) {
+      *rom_ = *sandbox;
+      AdvanceRomRevision();
+    }
+    if (saved) {
+      RecordRomTimestamp();
+    }
+    response["rom_changed"] = changed;
+    response["committed"] = keep;
+  }
+  return finish(status);
+}
+
+absl::Status CommandServer::ServeStream(std::istream& in, std::ostream& out) {
+  std::string line;
+  while (!shutdown_requested_ && std::getline(in, line)) {
+    if (line.find_first_not_of(" \t\r") == std::string::npos) {
+      continue;
+    }
+    out << HandleLine(line) << '\n' << std::flush;
+  }
+  return absl::OkStatus();
+}
+
+absl::Status CommandServer::ServeUnixSocket(const std::string& path) {
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+  (void)path;
+  return absl::UnimplementedError(
+      "Unix sockets are not available on this platform; use --stdio");
+#else
+  sockaddr_un addr{};
+  if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+    return absl::InvalidArgumentError(
+        absl::StrFormat("Invalid socket path '%s'", path));
+  }
+  addr.sun_family = AF_UNIX;
+  std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+
+  RETURN_IF_ERROR(RemoveStaleSocket(path));
+  const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listener < 0) {
+    return absl::InternalError("socket() failed");
+  }
+  if (bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+      listen(listener, 4) != 0) {
+    close(listener);
+    return absl::InternalError(
+        absl::StrFormat("Cannot listen on %s: %s", path, strerror(errno)));
+  }
+
+  auto send_all = [](int fd, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+#ifdef MSG_NOSIGNAL
+      const ssize_t n =
+          send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+#else
+      const ssize_t n = send(fd, data.data() + sent, data.size() - sent, 0);
+#endif
+      if (n <= 0) {
+        if (n < 0 && errno == EINTR) continue;
+        return false;
+      }
+      sent += static_cast<size_t>(n);
+    }
+    return true;
+  };
+
+  while (!shutdown_requested_) {
+    const int client = accept(listener, nullptr, nullptr);
+    if (client < 0) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    std::string pending;
+    char buffer[4096];
+    bool open = true;
+    while (open && !shutdown_requested_) {
+      const ssize_t n = recv(client, buffer, sizeof(buffer), 0);
+      if (n <= 0) {
+        if (n < 0 && errno == EINTR) continue;
+        break;
+      }
+      pending.append(buffer, static_cast<size_t>(n));
+      size_t newline;
+      while (open && (newline = pending.find('\n')) != std::string::npos) {
+        const std::string line = pending.substr(0, newline);
+        pending.erase(0, newline + 1);
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+          continue;
+        }
+        open = send_all(client, HandleLine(line) + "\n");
+        if (shutdown_requested_) break;
+      }
+    }
+    close(client);
+  }
+
+  close(listener);
+  RemoveStaleSocket(path).IgnoreError();
+  return absl::OkStatus();
+#endif
+}
+
+}  // namespace cli
+}  // namespace yaze
@@ -0,0 +1,113 @@
+#ifndef YAZE_CLI_SERVICE_COMMAND_SERVER_H_
+#define YAZE_CLI_SERVICE_COMMAND_SERVER_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "cli/service/command_registry.h"
+#include "cli/service/resources/command_context.h"
+#include "cli/service/resources/command_handler.h"
+#include "cli/service/resources/resident_world_cache.h"
+#include "rom/rom.h"
+
+namespace yaze {
+namespace cli {
+
+/**
+ * @class CommandServer
+ * @brief Long-lived command host behind `z3ed serve`
+ *
+ * Keeps one ROM resident, together with its labels, symbols and an optional
+ * project context. Registered CommandHandlers run against it from JSON-lines
+ * requests, so agent loops skip the per-invocation ROM load and context
+ * setup. A request looks like:
+ *
+ *   {"id": 1, "command": "hex-search", "args": ["--pattern=A9 ?? 8D"]}
+ *
+ * Read-only commands (CommandHandler::ReadsRomOnly) run on the resident ROM
+ * and share a ResidentWorldCache with it, so the GameData, overworld and
+ * rooms they ask for are decoded once per ROM revision. The revision
+ * advances whenever the resident ROM changes (open, reload, commit). All
+ * other commands run on a copy-on-write clone of it (the per-request
+ * sandbox). The clone's edits are kept only when the request sets
+ * "commit": true, or when the command saved them to disk itself.
+ *
+ * Built-in commands: "ping", "status", "reload", "save" and "shutdown".
+ */
+class CommandServer {
+ public:
+  struct Options {
+    std::string rom_path;
+    bool use_mock_rom = false;
+    std::optional<std::string> symbols_path;
+    std::optional<std::string> project_context_path;
+  };
+
+  explicit CommandServer(
+      CommandRegistry& registry = CommandRegistry::Instance());
+  ~CommandServer();
+
+  CommandServer(const CommandServer&) = delete;
+  CommandServer& operator=(const CommandServer&) = delete;
+
+  /**
+   * @brief Load the resident ROM, labels, symbols and project context
+   */
+  absl::Status Open(const Options& options);
+
+  /**
+   * @brief Serve an already loaded ROM instead (embedding, tests)
+   */
+  void Attach(Rom* rom);
+
+  /**
+   * @brief Handle one request line and return the response line
+   *
+   * The response has no trailing newline. Malformed requests produce an
+   * error response rather than a failed status.
+   */
+  std::string HandleLine(absl::string_view line);
+
+  /**
+   * @brief Serve requests from `in` until EOF or "shutdown"
+   */
+  absl::Status ServeStream(std::istream& in, std::ostream& out);
+
+  /**
+   * @brief Serve on a Unix domain socket, one connection at a time
+   *
+   * Returns Unimplemented on Windows and Emscripten.
+   */
+  absl::Status ServeUnixSocket(const std::string& path);
+
+  bool shutdown_requested() const { return shutdown_requested_; }
+  Rom* rom() const { return rom_; }
+  uint64_t rom_revision() const { return rom_revision_; }
+  const resources::ResidentWorldCache& world() const { return world_; }
+
+ private:
+  void RecordRomTimestamp();
+  void AdvanceRomRevision();
+  absl::Status ReloadIfChangedOnDisk(bool force);
+
+  CommandRegistry& registry_;
+  std::unique_ptr<resources::CommandContext> context_;
+  Rom* rom_ = nullptr;
+  resources::ResidentCommandState resident_;
+  resources::ResidentWorldCache world_;
+  uint64_t rom_revision_ = 0;
+  std::optional<std::filesystem::file_time_type> rom_timestamp_;
+  uint64_t requests_served_ = 0;
+  bool shutdown_requested_ = false;
+};
+
+}  // namespace cli
+}  // namespace yaze
+
+#endif  // YAZE_CLI_SERVICE_COMMAND_SERVER_H_
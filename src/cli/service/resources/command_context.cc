@@ -97,7 +97,9 @@ absl::Status CommandContext::Initialize() {
     }
     active_rom_ = &rom_storage_;
   } else if (!rom_path.empty()) {
-    auto status = rom_storage_.LoadFromFile(rom_path);
+    Rom::LoadOptions load_options;
+    load_options.memory_map = config_.memory_map_rom;
+    auto status = rom_storage_.LoadFromFile(rom_path, load_options);
     if (!status.ok()) {
       return absl::FailedPreconditionError(absl::StrFormat(
           "Failed to load ROM from '%s': %s", rom_path, status.message()));
@@ -118,7 +120,9 @@ absl::Status CommandContext::Initialize() {
   // Auto-load symbols if available
   std::string symbols_path =
       config_.symbols_path.has_value() ? *config_.symbols_path : "";
-  if (symbols_path.empty() && !rom_path.empty()) {
+  if (config_.external_symbol_provider != nullptr && symbols_path.empty()) {
+    // Resident symbols from the host; nothing to probe.
+  } else if (symbols_path.empty() && !rom_path.empty()) {
     // Try ROM name with .mlb or .sym
     std::string base = rom_path;
     size_t last_dot = base.find_last_of('.');
@@ -170,6 +174,10 @@ emu::debug::SymbolProvider* CommandContext::GetSymbolProvider() {
   if (!initialized_) {
     Initialize().IgnoreError();
   }
+  if (config_.external_symbol_provider != nullptr &&
+      !config_.symbols_path.has_value()) {
+    return config_.external_symbol_provider;
+  }
   return &symbol_provider_;
 }
 
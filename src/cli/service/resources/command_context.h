@@ -36,9 +36,14 @@ class CommandContext {
     bool use_mock_rom = false;
     std::string format = "json";  // "json" or "text"
     bool verbose = false;
+    // Memory-map a ROM loaded from rom_path (read-only commands)
+    bool memory_map_rom = false;
 
     // ROM context can be provided externally (e.g., from Agent class)
     Rom* external_rom_context = nullptr;
+    // Symbols already loaded by a long-lived host (z3ed serve); skips the
+    // per-command symbol file probe.
+    emu::debug::SymbolProvider* external_symbol_provider = nullptr;
   };
 
   explicit CommandContext(const Config& config);
@@ -1,12 +1,14 @@
 #include "cli/service/resources/command_handler.h"
 
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <utility>
 
 #include "absl/flags/declare.h"
 #include "absl/flags/flag.h"
 #include "absl/strings/str_format.h"
+#include "cli/service/resources/resident_world_cache.h"
 #include "cli/service/rom/rom_sandbox_manager.h"
 #include "util/macro.h"
 
@@ -41,9 +43,24 @@ absl::StatusOr<std::filesystem::path> CaptureRomPathIdentity(
 
 }  // namespace
 
+CommandHandler::CommandHandler() = default;
+CommandHandler::~CommandHandler() = default;
+
+ResidentWorldCache& CommandHandler::World(Rom* rom) {
+  if (resident_world_ != nullptr && resident_world_->rom() == rom) {
+    return *resident_world_;
+  }
+  if (local_world_ == nullptr) {
+    local_world_ = std::make_unique<ResidentWorldCache>();
+  }
+  local_world_->Bind(rom, rom != nullptr ? rom->object_tile_revision() : 0);
+  return *local_world_;
+}
+
 absl::Status CommandHandler::Run(const std::vector<std::string>& args,
                                  Rom* rom_context,
-                                 std::string* captured_output) {
+                                 std::string* captured_output,
+                                 const ResidentCommandState* resident) {
   // 1. Parse arguments
   ArgumentParser parser(args);
 
@@ -77,6 +94,10 @@ absl::Status CommandHandler::Run(const std::vector<std::string>& args,
   config.external_rom_context = rom_context;
   config.format = format_str;
   config.verbose = parser.HasFlag("verbose");
+  config.memory_map_rom = ReadsRomOnly();
+  if (resident != nullptr) {
+    config.external_symbol_provider = resident->symbol_provider;
+  }
 
   // Check for --rom override
   if (auto rom_path = parser.GetString("rom"); rom_path.has_value()) {
@@ -121,6 +142,10 @@ absl::Status CommandHandler::Run(const std::vector<std::string>& args,
     }
     SetRomContext(rom);
     SetProjectContext(context.GetProjectContext());
+    if (context.GetProjectContext() == nullptr && resident != nullptr &&
+        resident->project != nullptr) {
+      SetProjectContext(resident->project);
+    }
 
     if (absl::GetFlag(FLAGS_sandbox) || parser.HasFlag("sandbox")) {
       sandbox_enabled = true;
@@ -157,8 +182,11 @@ absl::Status CommandHandler::Run(const std::vector<std::string>& args,
   formatter.BeginObject(GetOutputTitle());
 
   // 9. Execute command business logic
+  resident_world_ = resident != nullptr ? resident->world : nullptr;
   auto execute_status =
       ExecuteWithContext(rom, parser, formatter, invocation_context);
+  resident_world_ = nullptr;
+  local_world_.reset();
   if (!execute_status.ok()) {
     // Preserve structured output for failing commands so callers can inspect
     // machine-readable diagnostics even when status is non-OK.
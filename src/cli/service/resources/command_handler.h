@@ -3,6 +3,7 @@
 
 #include <filesystem>
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -17,6 +18,8 @@ namespace yaze {
 namespace cli {
 namespace resources {
 
+class ResidentWorldCache;
+
 // Immutable ROM path identity captured for one CommandHandler::Run invocation.
 // The source path remains the caller's ROM when sandbox mode swaps the active
 // path to a command-local copy.
@@ -26,6 +29,16 @@ struct CommandInvocationContext {
   bool sandbox_enabled = false;
 };
 
+// State a long-lived host (z3ed serve) keeps loaded across Run() calls so
+// each command does not reload it. Null members fall back to the normal
+// per-command behavior.
+struct ResidentCommandState {
+  emu::debug::SymbolProvider* symbol_provider = nullptr;
+  project::YazeProject* project = nullptr;
+  // Decoded game state for the host's ROM; see CommandHandler::World().
+  ResidentWorldCache* world = nullptr;
+};
+
 /**
  * @class CommandHandler
  * @brief Base class for CLI command handlers
@@ -56,7 +69,8 @@ struct CommandInvocationContext {
  */
 class CommandHandler {
  public:
-  virtual ~CommandHandler() = default;
+  CommandHandler();
+  virtual ~CommandHandler();
 
   struct DescriptorEntry {
     std::string name;
@@ -82,7 +96,8 @@ class CommandHandler {
    * 5. Output formatting
    */
   absl::Status Run(const std::vector<std::string>& args, Rom* rom_context,
-                   std::string* captured_output = nullptr);
+                   std::string* captured_output = nullptr,
+                   const ResidentCommandState* resident = nullptr);
 
   /**
    * @brief Get the command name
@@ -116,6 +131,14 @@ class CommandHandler {
    */
   virtual bool RequiresLabels() const { return false; }
 
+  /**
+   * @brief Check if the command only reads the ROM
+   *
+   * Override to return true for analysis commands. A ROM loaded from --rom
+   * is then memory-mapped rather than read into memory.
+   */
+  virtual bool ReadsRomOnly() const { return false; }
+
   /**
    * @brief Set the YazeProject context.
    * Default implementation does nothing, override if tool needs project info.
@@ -191,12 +214,27 @@ class CommandHandler {
    */
   virtual std::string GetOutputTitle() const { return "Result"; }
 
+  /**
+   * @brief Decoded GameData, overworld and rooms for @p rom
+   *
+   * When @p rom is the resident ROM of a long-lived host, this is the host's
+   * cache and is shared with later requests until the ROM changes. Otherwise
+   * it is a cache local to the current Run(). Handlers opt in by calling this
+   * instead of loading the state themselves, and must not modify what it
+   * returns.
+   */
+  ResidentWorldCache& World(Rom* rom);
+
   Rom* rom_ = nullptr;
   emu::debug::SymbolProvider* symbol_provider_ = nullptr;
   project::YazeProject* project_ = nullptr;
   core::AsarWrapper* asar_wrapper_ = nullptr;
   const std::map<std::string, core::AsarSymbol>* assembly_symbol_table_ =
       nullptr;
+
+ private:
+  ResidentWorldCache* resident_world_ = nullptr;
+  std::unique_ptr<ResidentWorldCache> local_world_;
 };
 
 /**
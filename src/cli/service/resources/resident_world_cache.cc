@@ -0,0 +1,73 @@
+#include "cli/service/resources/resident_world_cache.h"
+
+#include <utility>
+
+#include "absl/strings/str_format.h"
+#include "util/macro.h"
+#include "zelda3/dungeon/dungeon_rom_addresses.h"
+
+namespace yaze {
+namespace cli {
+namespace resources {
+
+void ResidentWorldCache::Bind(Rom* rom, uint64_t revision) {
+  if (rom == rom_ && revision == revision_) {
+    return;
+  }
+  Clear();
+  rom_ = rom;
+  revision_ = revision;
+}
+
+void ResidentWorldCache::Clear() {
+  rooms_.clear();
+  overworld_.reset();
+  game_data_.reset();
+}
+
+absl::StatusOr<zelda3::GameData*> ResidentWorldCache::GetGameData() {
+  if (rom_ == nullptr || !rom_->is_loaded()) {
+    return absl::FailedPreconditionError("ROM not loaded");
+  }
+  if (game_data_ == nullptr) {
+    auto game_data = std::make_unique<zelda3::GameData>(rom_);
+    // Resizing the ROM here would change what the next request sees.
+    zelda3::LoadOptions options;
+    options.expand_rom = false;
+    RETURN_IF_ERROR(zelda3::LoadGameData(*rom_, *game_data, options));
+    game_data_ = std::move(game_data);
+  }
+  return game_data_.get();
+}
+
+absl::StatusOr<zelda3::Overworld*> ResidentWorldCache::GetOverworld() {
+  if (rom_ == nullptr || !rom_->is_loaded()) {
+    return absl::FailedPreconditionError("ROM not loaded");
+  }
+  if (overworld_ == nullptr) {
+    auto overworld = std::make_unique<zelda3::Overworld>(rom_);
+    RETURN_IF_ERROR(overworld->Load(rom_));
+    overworld_ = std::move(overworld);
+  }
+  return overworld_.get();
+}
+
+absl::StatusOr<zelda3::Room*> ResidentWorldCache::GetRoom(int room_id) {
+  if (rom_ == nullptr || !rom_->is_loaded()) {
+    return absl::FailedPreconditionError("ROM not loaded");
+  }
+  if (room_id < 0 || room_id >= zelda3::kNumberOfRooms) {
+    return absl::InvalidArgumentError(
+        absl::StrFormat("Room ID out of range: 0x%03X", room_id));
+  }
+  auto& room = rooms_[room_id];
+  if (room == nullptr) {
+    room = std::make_unique<zelda3::Room>(
+        zelda3::LoadRoomFromRom(rom_, room_id));
+  }
+  return room.get();
+}
+
+}  // namespace resources
+}  // namespace cli
+}  // namespace yaze
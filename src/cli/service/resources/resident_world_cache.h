@@ -0,0 +1,69 @@
+#ifndef YAZE_CLI_SERVICE_RESOURCES_RESIDENT_WORLD_CACHE_H_
+#define YAZE_CLI_SERVICE_RESOURCES_RESIDENT_WORLD_CACHE_H_
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "absl/status/statusor.h"
+#include "rom/rom.h"
+#include "zelda3/dungeon/room.h"
+#include "zelda3/game_data.h"
+#include "zelda3/overworld/overworld.h"
+
+namespace yaze {
+namespace cli {
+namespace resources {
+
+/**
+ * @class ResidentWorldCache
+ * @brief Game state decoded from one ROM, built lazily and reused
+ *
+ * `z3ed serve` keeps one of these next to the resident ROM so the
+ * GameData, the Overworld and every room a request touches are decoded
+ * once rather than per request. Everything is keyed by (ROM, revision):
+ * Bind() with a different ROM or revision drops what was decoded before.
+ *
+ * Handed-out pointers stay valid until the next Bind() that changes the key.
+ * Callers must treat the state as read-only; commands that edit the ROM run
+ * on a sandbox clone and never see the resident cache.
+ */
+class ResidentWorldCache {
+ public:
+  void Bind(Rom* rom, uint64_t revision);
+
+  Rom* rom() const { return rom_; }
+  uint64_t revision() const { return revision_; }
+
+  /**
+   * @brief Palettes, gfx groups and graphics sheets (no ROM expansion)
+   */
+  absl::StatusOr<zelda3::GameData*> GetGameData();
+
+  /**
+   * @brief Fully loaded overworld (maps, tiles, entrances, sprites)
+   */
+  absl::StatusOr<zelda3::Overworld*> GetOverworld();
+
+  /**
+   * @brief Room loaded with LoadRoomFromRom (objects, chests, pots, etc.)
+   */
+  absl::StatusOr<zelda3::Room*> GetRoom(int room_id);
+
+  size_t cached_room_count() const { return rooms_.size(); }
+
+ private:
+  void Clear();
+
+  Rom* rom_ = nullptr;
+  uint64_t revision_ = 0;
+  std::unique_ptr<zelda3::GameData> game_data_;
+  std::unique_ptr<zelda3::Overworld> overworld_;
+  std::unordered_map<int, std::unique_ptr<zelda3::Room>> rooms_;
+};
+
+}  // namespace resources
+}  // namespace cli
+}  // namespace yaze
+
+#endif  // YAZE_CLI_SERVICE_RESOURCES_RESIDENT_WORLD_CACHE_H_
@@ -0,0 +1,305 @@
+#include "rom/byte_pattern_search.h"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <tuple>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/str_split.h"
+
+namespace yaze::rom {
+
+namespace {
+
+// Longest run of literal bytes as (offset, length); length 0 when the
+// pattern is all wildcards.
+std::pair<size_t, size_t> FindAnchor(const BytePattern& pattern) {
+  size_t best_offset = 0;
+  size_t best_length = 0;
+  size_t run_start = 0;
+  for (size_t i = 0; i <= pattern.size(); ++i) {
+    if (i < pattern.size() && !pattern.wildcard[i]) {
+      continue;
+    }
+    if (i - run_start > best_length) {
+      best_offset = run_start;
+      best_length = i - run_start;
+    }
+    run_start = i + 1;
+  }
+  return {best_offset, best_length};
+}
+
+bool MatchesAt(std::span<const uint8_t> data, size_t start,
+               const BytePattern& pattern) {
+  const uint8_t* bytes = data.data() + start;
+  for (size_t j = 0; j < pattern.size(); ++j) {
+    if (!pattern.wildcard[j] && bytes[j] != pattern.bytes[j]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+absl::StatusOr<BytePattern> ParseBytePattern(absl::string_view text) {
+  BytePattern pattern;
+  for (absl::string_view token :
+       absl::StrSplit(text, absl::ByAnyChar(" \t,"), absl::SkipEmpty())) {
+    if (token == "??" || token == "**") {
+      pattern.bytes.push_back(0);
+      pattern.wildcard.push_back(true);
+      continue;
+    }
+    uint32_t value = 0;
+    if (!absl::SimpleHexAtoi(token, &value) || value > 0xFF) {
+      return absl::InvalidArgumentError(
+          absl::StrFormat("Invalid pattern byte '%s'", token));
+    }
+    pattern.bytes.push_back(static_cast<uint8_t>(value));
+    pattern.wildcard.push_back(false);
+  }
+  if (pattern.bytes.empty()) {
+    return absl::InvalidArgumentError("Empty pattern");
+  }
+  return pattern;
+}
+
+absl::StatusOr<std::vector<BytePattern>> ParseBytePatternList(
+    absl::string_view text) {
+  std::vector<BytePattern> patterns;
+  int line_number = 0;
+  for (absl::string_view line : absl::StrSplit(text, '\n')) {
+    ++line_number;
+    line = absl::StripAsciiWhitespace(line);
+    if (line.empty() || line.front() == '#') {
+      continue;
+    }
+    std::string label;
+    if (const size_t colon = line.find(':'); colon != line.npos) {
+      label = std::string(absl::StripAsciiWhitespace(line.substr(0, colon)));
+      line = line.substr(colon + 1);
+    }
+    auto pattern = ParseBytePattern(line);
+    if (!pattern.ok()) {
+      return absl::InvalidArgumentError(absl::StrFormat(
+          "Line %d: %s", line_number, pattern.status().message()));
+    }
+    pattern->label = std::move(label);
+    patterns.push_back(*std::move(pattern));
+  }
+  return patterns;
+}
+
+// ---------------------------------------------------------------------------
+// PatternSearcher
+// ---------------------------------------------------------------------------
+
+PatternSearcher::PatternSearcher(BytePattern pattern)
+    : pattern_(std::move(pattern)) {
+  std::tie(anchor_offset_, anchor_length_) = FindAnchor(pattern_);
+  shift_.fill(static_cast<uint32_t>(std::max<size_t>(anchor_length_, 1)));
+  for (size_t j = 0; j + 1 < anchor_length_; ++j) {
+    shift_[pattern_.bytes[anchor_offset_ + j]] =
+        static_cast<uint32_t>(anchor_length_ - 1 - j);
+  }
+}
+
+std::vector<uint32_t> PatternSearcher::FindAll(std::span<const uint8_t> data,
+                                               size_t max_matches) const {
+  std::vector<uint32_t> matches;
+  const size_t m = pattern_.size();
+  const size_t n = data.size();
+  if (m == 0 || m > n || max_matches == 0) {
+    return matches;
+  }
+
+  auto add = [&](size_t start) {
+    matches.push_back(static_cast<uint32_t>(start));
+    return matches.size() < max_matches;
+  };
+
+  const size_t last_start = n - m;
+  if (anchor_length_ == 0) {
+    for (size_t start = 0; start <= last_start; ++start) {
+      if (!add(start)) break;
+    }
+    return matches;
+  }
+
+  const uint8_t* anchor = pattern_.bytes.data() + anchor_offset_;
+  const size_t k = anchor_length_;
+  // The anchor sits at start + anchor_offset_ for every candidate start.
+  const uint8_t* text = data.data() + anchor_offset_;
+  const size_t text_length = last_start + k;
+
+  if (k == 1) {
+    const uint8_t* p = text;
+    const uint8_t* end = text + text_length;
+    while ((p = static_cast<const uint8_t*>(
+                std::memchr(p, anchor[0], end - p))) != nullptr) {
+      const size_t start = p - text;
+      if (MatchesAt(data, start, pattern_) && !add(start)) break;
+      ++p;
+    }
+    return matches;
+  }
+
+  const uint8_t last = anchor[k - 1];
+  for (size_t t = 0; t + k <= text_length;) {
+    const uint8_t tail = text[t + k - 1];
+    if (tail == last && std::memcmp(text + t, anchor, k - 1) == 0 &&
+        MatchesAt(data, t, pattern_) && !add(t)) {
+      break;
+    }
+    t += shift_[tail];
+  }
+  return matches;
+}
+
+// ---------------------------------------------------------------------------
+// MultiPatternSearcher
+// ---------------------------------------------------------------------------
+
+MultiPatternSearcher::MultiPatternSearcher(std::vector<BytePattern> patterns)
+    : patterns_(std::move(patterns)) {
+  // Trie over the anchors, with sorted sparse children while building.
+  std::vector<std::vector<std::pair<uint8_t, int32_t>>> children(1);
+  std::vector<std::vector<uint32_t>> outputs(1);
+  anchor_ends_.resize(patterns_.size());
+
+  for (uint32_t p = 0; p < patterns_.size(); ++p) {
+    const auto [offset, length] = FindAnchor(patterns_[p]);
+    anchor_ends_[p] = offset + length;
+    if (length == 0) {
+      wildcard_only_.push_back(p);
+      continue;
+    }
+    int32_t state = 0;
+    for (size_t j = offset; j < offset + length; ++j) {
+      const uint8_t byte = patterns_[p].bytes[j];
+      auto& kids = children[state];
+      auto it = std::lower_bound(
+          kids.begin(), kids.end(), byte,
+          [](const auto& edge, uint8_t b) { return edge.first < b; });
+      if (it != kids.end() && it->first == byte) {
+        state = it->second;
+        continue;
+      }
+      const auto next = static_cast<int32_t>(children.size());
+      kids.insert(it, {byte, next});
+      children.emplace_back();
+      outputs.emplace_back();
+      state = next;
+    }
+    outputs[state].push_back(p);
+  }
+
+  nodes_.resize(children.size());
+  for (size_t s = 0; s < children.size(); ++s) {
+    Node& node = nodes_[s];
+    node.first_edge = static_cast<uint32_t>(edges_.size());
+    node.edge_count = static_cast<uint32_t>(children[s].size());
+    for (const auto& [byte, target] : children[s]) {
+      edges_.push_back({byte, target});
+    }
+    node.first_output = static_cast<uint32_t>(outputs_.size());
+    node.output_count = static_cast<uint32_t>(outputs[s].size());
+    outputs_.insert(outputs_.end(), outputs[s].begin(), outputs[s].end());
+  }
+  root_.fill(0);
+  for (const auto& [byte, target] : children[0]) {
+    root_[byte] = target;
+  }
+
+  // Breadth-first fail links; the root's dense table never misses, so the
+  // fail walk always terminates there.
+  std::deque<int32_t> queue;
+  for (const auto& [byte, target] : children[0]) {
+    queue.push_back(target);
+  }
+  while (!queue.empty()) {
+    const int32_t u = queue.front();
+    queue.pop_front();
+    for (const auto& [byte, v] : children[u]) {
+      int32_t f = nodes_[u].fail;
+      int32_t g;
+      while ((g = Goto(f, byte)) < 0) {
+        f = nodes_[f].fail;
+      }
+      nodes_[v].fail = g;
+      nodes_[v].output_link =
+          nodes_[g].output_count != 0 ? g : nodes_[g].output_link;
+      queue.push_back(v);
+    }
+  }
+}
+
+int32_t MultiPatternSearcher::Goto(int32_t state, uint8_t byte) const {
+  if (state == 0) {
+    return root_[byte];
+  }
+  const Node& node = nodes_[state];
+  const Edge* begin = edges_.data() + node.first_edge;
+  const Edge* end = begin + node.edge_count;
+  const Edge* it = std::lower_bound(
+      begin, end, byte, [](const Edge& e, uint8_t b) { return e.byte < b; });
+  return (it != end && it->byte == byte) ? it->target : -1;
+}
+
+std::vector<PatternMatch> MultiPatternSearcher::FindAll(
+    std::span<const uint8_t> data) const {
+  std::vector<PatternMatch> matches;
+  const size_t n = data.size();
+
+  int32_t state = 0;
+  for (size_t i = 0; i < n; ++i) {
+    const uint8_t byte = data[i];
+    int32_t next;
+    while ((next = Goto(state, byte)) < 0) {
+      state = nodes_[state].fail;
+    }
+    state = next;
+
+    for (int32_t s = nodes_[state].output_count != 0
+                         ? state
+                         : nodes_[state].output_link;
+         s >= 0; s = nodes_[s].output_link) {
+      const Node& node = nodes_[s];
+      for (uint32_t o = 0; o < node.output_count; ++o) {
+        const uint32_t p = outputs_[node.first_output + o];
+        const size_t anchor_end = anchor_ends_[p];
+        if (i + 1 < anchor_end) {
+          continue;
+        }
+        const size_t start = i + 1 - anchor_end;
+        if (start + patterns_[p].size() <= n &&
+            MatchesAt(data, start, patterns_[p])) {
+          matches.push_back({static_cast<uint32_t>(start), p});
+        }
+      }
+    }
+  }
+
+  for (const uint32_t p : wildcard_only_) {
+    const size_t m = patterns_[p].size();
+    for (size_t start = 0; start + m <= n; ++start) {
+      matches.push_back({static_cast<uint32_t>(start), p});
+    }
+  }
+
+  std::sort(matches.begin(), matches.end(),
+            [](const PatternMatch& a, const PatternMatch& b) {
+              return a.offset != b.offset ? a.offset < b.offset
+                                          : a.pattern < b.pattern;
+            });
+  return matches;
+}
+
+}  // namespace yaze::rom
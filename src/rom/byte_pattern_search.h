@@ -0,0 +1,106 @@
+#ifndef YAZE_ROM_BYTE_PATTERN_SEARCH_H
+#define YAZE_ROM_BYTE_PATTERN_SEARCH_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace yaze::rom {
+
+// A byte pattern where some positions match any byte.
+struct BytePattern {
+  std::vector<uint8_t> bytes;
+  // One entry per byte; true means the position is a wildcard.
+  std::vector<bool> wildcard;
+  // Optional name reported with matches (signature lists, hook names).
+  std::string label;
+
+  size_t size() const { return bytes.size(); }
+};
+
+// Parse space-separated hex bytes, e.g. "A9 ?? 8D 00 21". "??" and "**" are
+// wildcards.
+absl::StatusOr<BytePattern> ParseBytePattern(absl::string_view text);
+
+// Parse one pattern per line. Blank lines and lines starting with '#' are
+// skipped; "label: A9 ?? 8D" sets the pattern label.
+absl::StatusOr<std::vector<BytePattern>> ParseBytePatternList(
+    absl::string_view text);
+
+// Single-pattern search. Horspool runs over the longest wildcard-free run of
+// the pattern (the anchor); the whole pattern is only checked where the
+// anchor matches, so wildcards never shrink the skip distance.
+class PatternSearcher {
+ public:
+  explicit PatternSearcher(BytePattern pattern);
+
+  // Offsets of all (possibly overlapping) matches in `data`, ascending.
+  std::vector<uint32_t> FindAll(
+      std::span<const uint8_t> data,
+      size_t max_matches = std::numeric_limits<size_t>::max()) const;
+
+  const BytePattern& pattern() const { return pattern_; }
+
+ private:
+  BytePattern pattern_;
+  size_t anchor_offset_ = 0;
+  size_t anchor_length_ = 0;
+  std::array<uint32_t, 256> shift_{};
+};
+
+struct PatternMatch {
+  uint32_t offset = 0;
+  uint32_t pattern = 0;  // Index into MultiPatternSearcher::patterns()
+};
+
+// Many-pattern search in a single pass. An Aho-Corasick automaton is built
+// over each pattern's anchor (as in PatternSearcher) and hits are verified
+// against the full pattern, so search time does not grow with the number of
+// patterns.
+class MultiPatternSearcher {
+ public:
+  explicit MultiPatternSearcher(std::vector<BytePattern> patterns);
+
+  // All matches ordered by offset, then pattern index.
+  std::vector<PatternMatch> FindAll(std::span<const uint8_t> data) const;
+
+  const std::vector<BytePattern>& patterns() const { return patterns_; }
+
+ private:
+  struct Node {
+    uint32_t first_edge = 0;
+    uint32_t edge_count = 0;
+    int32_t fail = 0;
+    // Nearest state on the fail chain that ends an anchor, or -1.
+    int32_t output_link = -1;
+    uint32_t first_output = 0;
+    uint32_t output_count = 0;
+  };
+  struct Edge {
+    uint8_t byte = 0;
+    int32_t target = 0;
+  };
+
+  int32_t Goto(int32_t state, uint8_t byte) const;
+
+  std::vector<BytePattern> patterns_;
+  // End of each pattern's anchor within the pattern.
+  std::vector<size_t> anchor_ends_;
+  std::vector<Node> nodes_;
+  std::vector<Edge> edges_;
+  std::vector<uint32_t> outputs_;  // Pattern indices, grouped by state
+  std::array<int32_t, 256> root_{};
+  // Patterns without any literal byte; they match everywhere they fit.
+  std::vector<uint32_t> wildcard_only_;
+};
+
+}  // namespace yaze::rom
+
+#endif  // YAZE_ROM_BYTE_PATTERN_SEARCH_H
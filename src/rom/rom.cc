@@ -9,7 +9,9 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <new>
+#include <span>
 #include <string>
 #include <system_error>
 #include <vector>
@@ -25,6 +27,7 @@
 #include "util/hex.h"
 #include "util/log.h"
 #include "util/macro.h"
+#include "util/mapped_file.h"
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
@@ -58,9 +61,12 @@ constexpr size_t kHeaderSize = 0x200;  // 512 bytes
 // SMC Header Detection and Removal
 // ============================================================================
 
+bool HasSmcHeader(size_t size) {
+  return size % kBaseRomSize == kHeaderSize && size >= kHeaderSize;
+}
+
 void MaybeStripSmcHeader(std::vector<uint8_t>& rom_data, unsigned long& size) {
-  if (size % kBaseRomSize == kHeaderSize && size >= kHeaderSize &&
-      rom_data.size() >= kHeaderSize) {
+  if (HasSmcHeader(size) && rom_data.size() >= kHeaderSize) {
     rom_data.erase(rom_data.begin(), rom_data.begin() + kHeaderSize);
     size -= kHeaderSize;
     LOG_INFO("Rom", "Stripped SMC header from ROM (new size: %lu)", size);
@@ -229,10 +235,15 @@ Rom::Rom(const Rom& other)
       title_(other.title_),
       filename_(other.filename_),
       short_name_(other.short_name_),
-      rom_data_(other.rom_data_),
       resource_label_manager_(other.resource_label_manager_),
       dirty_(other.dirty_),
       object_tile_revision_(other.object_tile_revision_) {
+  // Sharing the page table is the whole copy; pages are unshared lazily by
+  // whichever side writes first.
+  other.SyncPages();
+  pages_ = other.pages_;
+  pages_.ClearDirtyPages();
+
   // Write fences are non-owning, instance-local transaction state. A new Rom
   // must never inherit pointers owned by active scopes on `other`.
 }
@@ -247,7 +258,10 @@ Rom& Rom::operator=(const Rom& other) {
   title_ = other.title_;
   filename_ = other.filename_;
   short_name_ = other.short_name_;
-  rom_data_ = other.rom_data_;
+  other.SyncPages();
+  pages_ = other.pages_;
+  pages_.ClearDirtyPages();
+  RefreshFlatView();
   resource_label_manager_ = other.resource_label_manager_;
   dirty_ = other.dirty_;
 
@@ -267,6 +281,116 @@ Rom& Rom::operator=(Rom&& other) {
   return operator=(static_cast<const Rom&>(other));
 }
 
+void Rom::Expand(int size) {
+  const bool size_changed = content_size() != static_cast<size_t>(size);
+  if (raw_access_) {
+    rom_data_.resize(size);
+  } else {
+    pages_.Resize(size);
+    if (flat_valid_.load(std::memory_order_acquire)) {
+      rom_data_.resize(size);
+    }
+  }
+  size_ = size;
+  if (size_changed) {
+    AdvanceObjectTileRevision();
+  }
+}
+
+void Rom::Close() {
+  const bool had_data = is_loaded();
+  pages_.Clear();
+  rom_data_.clear();
+  flat_valid_.store(false, std::memory_order_release);
+  raw_access_ = false;
+  size_ = 0;
+  if (had_data) {
+    AdvanceObjectTileRevision();
+  }
+}
+
+void Rom::MaterializeFlat() const {
+  std::lock_guard<std::mutex> lock(flat_mutex_);
+  if (flat_valid_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  rom_data_.resize(pages_.size());
+  pages_.CopyTo(rom_data_);
+  flat_valid_.store(true, std::memory_order_release);
+}
+
+void Rom::SyncPages() const {
+  if (!raw_access_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(flat_mutex_);
+  pages_.SyncFrom(rom_data_);
+}
+
+void Rom::RefreshFlatView() {
+  // Callers may hold pointers into an existing contiguous view (they could
+  // when the Rom was a plain vector), so refill it in place rather than
+  // dropping it.
+  if (flat_valid_.load(std::memory_order_acquire)) {
+    rom_data_.resize(pages_.size());
+    pages_.CopyTo(rom_data_);
+  }
+}
+
+void Rom::StoreBytes(size_t offset, std::span<const uint8_t> bytes) {
+  const bool flat = flat_valid_.load(std::memory_order_acquire);
+  if (flat) {
+    std::memcpy(rom_data_.data() + offset, bytes.data(), bytes.size());
+  }
+  if (!raw_access_) {
+    pages_.Write(offset, bytes);
+  }
+}
+
+void Rom::StoreBytesJournaled(size_t offset, std::span<const uint8_t> bytes,
+                              uint8_t* originals) {
+  if (bytes.empty()) {
+    return;
+  }
+#ifdef __EMSCRIPTEN__
+  std::vector<uint8_t> old_bytes(bytes.size());
+  for (size_t i = 0; i < bytes.size(); ++i) {
+    old_bytes[i] = LoadByte(offset + i);
+  }
+#endif
+  if (originals != nullptr) {
+    if (flat_valid_.load(std::memory_order_acquire)) {
+      std::memcpy(originals, rom_data_.data() + offset, bytes.size());
+    } else {
+      pages_.Read(offset, {originals, bytes.size()});
+    }
+  }
+  StoreBytes(offset, bytes);
+#ifdef __EMSCRIPTEN__
+  MaybeBroadcastChange(static_cast<uint32_t>(offset), old_bytes,
+                       std::vector<uint8_t>(bytes.begin(), bytes.end()));
+#endif
+}
+
+std::vector<uint32_t> Rom::DirtyPages() const {
+  SyncPages();
+  return pages_.DirtyPages();
+}
+
+void Rom::ClearDirtyPages() {
+  SyncPages();
+  pages_.ClearDirtyPages();
+}
+
+const rom::RomPages& Rom::pages() const {
+  SyncPages();
+  return pages_;
+}
+
+std::vector<uint32_t> Rom::ChangedPages(const Rom& a, const Rom& b) {
+  return rom::RomPages::ChangedPages(a.pages(), b.pages());
+}
+
 absl::Status Rom::LoadFromFile(const std::string& filename,
                                const LoadOptions& options) {
   if (filename.empty()) {
@@ -325,40 +449,67 @@ absl::Status Rom::LoadFromFile(const std::string& filename,
         "ROM file too large (%zu bytes), maximum is 16MB", size_));
   }
 
-  try {
-    rom_data_.resize(size_);
-    file.seekg(0, std::ios::beg);
-    file.read(reinterpret_cast<char*>(rom_data_.data()), size_);
-  } catch (const std::bad_alloc& e) {
-    return absl::ResourceExhaustedError(absl::StrFormat(
-        "Failed to allocate memory for ROM (%zu bytes)", size_));
+  std::shared_ptr<const util::MappedFile> mapped;
+  if (options.memory_map) {
+    auto mapped_or = util::MappedFile::Open(filename_);
+    if (mapped_or.ok()) {
+      mapped = *std::move(mapped_or);
+    } else {
+      LOG_WARN("Rom", "Memory mapping unavailable, reading instead: %s",
+               mapped_or.status().message());
+    }
   }
 
-  file.close();
+  std::vector<uint8_t> buffer;
+  std::span<const uint8_t> image;
+  if (mapped) {
+    file.close();
+    size_t header = 0;
+    if (options.strip_header && HasSmcHeader(mapped->size())) {
+      header = kHeaderSize;
+      LOG_INFO("Rom", "Skipping SMC header in mapped ROM");
+    }
+    image = mapped->bytes().subspan(header);
+    pages_.AssignShared(mapped, image, mapped->mapped_size() - header);
+  } else {
+    try {
+      buffer.resize(size_);
+      file.seekg(0, std::ios::beg);
+      file.read(reinterpret_cast<char*>(buffer.data()), size_);
+    } catch (const std::bad_alloc& e) {
+      return absl::ResourceExhaustedError(absl::StrFormat(
+          "Failed to allocate memory for ROM (%zu bytes)", size_));
+    }
 
-  if (options.strip_header) {
-    MaybeStripSmcHeader(rom_data_, size_);
+    file.close();
+
+    if (options.strip_header) {
+      MaybeStripSmcHeader(buffer, size_);
+    }
+    image = buffer;
+    pages_.Assign(image);
   }
-  size_ = rom_data_.size();
+  size_ = image.size();
+  RefreshFlatView();
 
   if (options.load_resource_labels) {
     resource_label_manager_.LoadLabels(absl::StrFormat("%s.labels", filename));
   }
 
   // Parse SNES Header for Title
-  if (rom_data_.size() >= 0x8000) {
+  if (image.size() >= 0x8000) {
     // Check LoROM (0x7FC0) vs HiROM (0xFFC0)
     // Simple heuristic: Z3 is LoROM
     size_t header_offset = 0x7FC0;
-    if (rom_data_.size() >= 0x10000) {
+    if (image.size() >= 0x10000) {
       // Compute checksums to verify?
       // For now default to LoROM
     }
 
-    if (header_offset + 21 <= rom_data_.size()) {
+    if (header_offset + 21 <= image.size()) {
       char buffer[22] = {0};
       for (int i = 0; i < 21; ++i) {
-        uint8_t c = rom_data_[header_offset + i];
+        uint8_t c = image[header_offset + i];
         buffer[i] = (c >= 32 && c <= 126) ? c : ' ';
       }
       title_ = std::string(buffer);
@@ -382,21 +533,23 @@ absl::Status Rom::LoadFromData(const std::vector<uint8_t>& data,
     return absl::InvalidArgumentError(
         "Could not load ROM: parameter `data` is empty.");
   }
-  rom_data_ = data;
+  std::vector<uint8_t> image = data;
   size_ = data.size();
 
   if (options.strip_header) {
-    MaybeStripSmcHeader(rom_data_, size_);
+    MaybeStripSmcHeader(image, size_);
   }
-  size_ = rom_data_.size();
+  size_ = image.size();
+  pages_.Assign(image);
+  RefreshFlatView();
 
   // Parse SNES Header for Title
-  if (rom_data_.size() >= 0x8000) {
+  if (image.size() >= 0x8000) {
     size_t header_offset = 0x7FC0;
-    if (header_offset + 21 <= rom_data_.size()) {
+    if (header_offset + 21 <= image.size()) {
       char buffer[22] = {0};
       for (int i = 0; i < 21; ++i) {
-        uint8_t c = rom_data_[header_offset + i];
+        uint8_t c = image[header_offset + i];
         buffer[i] = (c >= 32 && c <= 126) ? c : ' ';
       }
       title_ = std::string(buffer);
@@ -414,7 +567,7 @@ absl::Status Rom::LoadFromData(const std::vector<uint8_t>& data,
 }
 
 absl::Status Rom::SaveToFile(const SaveSettings& settings) {
-  if (rom_data_.empty()) {
+  if (!is_loaded()) {
     return absl::InternalError("ROM data is empty.");
   }
 
@@ -483,7 +636,11 @@ absl::Status Rom::SaveToFile(const SaveSettings& settings) {
         "Could not open temp ROM file for writing: ", temp_path.string()));
   }
 
-  file.write(reinterpret_cast<const char*>(rom_data_.data()), rom_data_.size());
+  SyncPages();
+  for (size_t page = 0; page < pages_.page_count(); ++page) {
+    const auto bytes = pages_.PageBytes(page);
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  }
   file.flush();
   if (!file) {
     file.close();
@@ -561,41 +718,58 @@ void Rom::PopWriteFence(rom::WriteFence* fence) {
 }
 
 absl::StatusOr<uint8_t> Rom::ReadByte(int offset) const {
-  if (offset < 0 || offset >= static_cast<int>(rom_data_.size())) {
+  if (offset < 0 || offset >= static_cast<int>(content_size())) {
     return absl::OutOfRangeError(absl::StrFormat(
-        "Offset %d out of range (size: %d)", offset, rom_data_.size()));
+        "Offset %d out of range (size: %d)", offset, content_size()));
   }
-  return rom_data_[offset];
+  return LoadByte(offset);
 }
 
 absl::StatusOr<uint16_t> Rom::ReadWord(int offset) const {
-  if (offset < 0 || offset + 1 >= static_cast<int>(rom_data_.size())) {
+  if (offset < 0 || offset + 1 >= static_cast<int>(content_size())) {
     return absl::OutOfRangeError("Offset out of range");
   }
-  return (uint16_t)(rom_data_[offset] | (rom_data_[offset + 1] << 8));
+  return (uint16_t)(LoadByte(offset) | (LoadByte(offset + 1) << 8));
 }
 
 absl::StatusOr<uint32_t> Rom::ReadLong(int offset) const {
-  if (offset < 0 || offset + 2 >= static_cast<int>(rom_data_.size())) {
+  if (offset < 0 || offset + 2 >= static_cast<int>(content_size())) {
     return absl::OutOfRangeError("Offset out of range");
   }
-  return (uint32_t)(rom_data_[offset] | (rom_data_[offset + 1] << 8) |
-                    (rom_data_[offset + 2] << 16));
+  return (uint32_t)(LoadByte(offset) | (LoadByte(offset + 1) << 8) |
+                    (LoadByte(offset + 2) << 16));
 }
 
 absl::StatusOr<std::vector<uint8_t>> Rom::ReadByteVector(
     uint32_t offset, uint32_t length) const {
-  if (offset + length > static_cast<uint32_t>(rom_data_.size())) {
+  if (offset + length > static_cast<uint32_t>(content_size())) {
     return absl::OutOfRangeError("Offset and length out of range");
   }
-  std::vector<uint8_t> result;
-  result.reserve(length);
-  for (uint32_t i = offset; i < offset + length; i++) {
-    result.push_back(rom_data_[i]);
+  std::vector<uint8_t> result(length);
+  if (flat_valid_.load(std::memory_order_acquire)) {
+    std::memcpy(result.data(), rom_data_.data() + offset, length);
+  } else {
+    pages_.Read(offset, result);
   }
   return result;
 }
 
+absl::StatusOr<std::span<const uint8_t>> Rom::ReadSpan(uint32_t offset,
+                                                       uint32_t length) const {
+  if (static_cast<uint64_t>(offset) + length > content_size()) {
+    return absl::OutOfRangeError("Offset and length out of range");
+  }
+  if (length == 0) {
+    return std::span<const uint8_t>();
+  }
+  if (!flat_valid_.load(std::memory_order_acquire)) {
+    if (const uint8_t* range = pages_.ContiguousRange(offset, length)) {
+      return std::span<const uint8_t>(range, length);
+    }
+  }
+  return std::span<const uint8_t>(FlatData().data() + offset, length);
+}
+
 absl::StatusOr<gfx::Tile16> Rom::ReadTile16(uint32_t tile16_id,
                                             uint32_t tile16_ptr) {
   // Skip 8 bytes per tile.
@@ -629,14 +803,16 @@ absl::Status Rom::WriteTile16(int tile16_id, uint32_t tile16_ptr,
 }
 
 absl::Status Rom::WriteByte(int addr, uint8_t value) {
-  if (addr < 0 || addr >= static_cast<int>(rom_data_.size())) {
+  if (addr < 0 || addr >= static_cast<int>(content_size())) {
     return absl::OutOfRangeError("Address out of range");
   }
   for (auto* fence : write_fence_stack_) {
     RETURN_IF_ERROR(fence->Check(static_cast<uint32_t>(addr), 1, "WriteByte"));
   }
-  const uint8_t old_val = rom_data_[addr];
-  rom_data_[addr] = value;
+#ifdef __EMSCRIPTEN__
+  const uint8_t old_val = LoadByte(addr);
+#endif
+  StoreBytes(addr, {&value, 1});
   dirty_ = true;
 #ifdef __EMSCRIPTEN__
   MaybeBroadcastChange(addr, {old_val}, {value});
@@ -648,16 +824,19 @@ absl::Status Rom::WriteByte(int addr, uint8_t value) {
 }
 
 absl::Status Rom::WriteWord(int addr, uint16_t value) {
-  if (addr < 0 || addr + 1 >= static_cast<int>(rom_data_.size())) {
+  if (addr < 0 || addr + 1 >= static_cast<int>(content_size())) {
     return absl::OutOfRangeError("Address out of range");
   }
   for (auto* fence : write_fence_stack_) {
     RETURN_IF_ERROR(fence->Check(static_cast<uint32_t>(addr), 2, "WriteWord"));
   }
-  const uint8_t old0 = rom_data_[addr];
-  const uint8_t old1 = rom_data_[addr + 1];
-  rom_data_[addr] = (uint8_t)(value & 0xFF);
-  rom_data_[addr + 1] = (uint8_t)((value >> 8) & 0xFF);
+#ifdef __EMSCRIPTEN__
+  const uint8_t old0 = LoadByte(addr);
+  const uint8_t old1 = LoadByte(addr + 1);
+#endif
+  const uint8_t bytes[2] = {(uint8_t)(value & 0xFF),
+                            (uint8_t)((value >> 8) & 0xFF)};
+  StoreBytes(addr, bytes);
   dirty_ = true;
 #ifdef __EMSCRIPTEN__
   MaybeBroadcastChange(addr, {old0, old1},
@@ -675,18 +854,21 @@ absl::Status Rom::WriteShort(int addr, uint16_t value) {
 }
 
 absl::Status Rom::WriteLong(uint32_t addr, uint32_t value) {
-  if (addr + 2 >= static_cast<uint32_t>(rom_data_.size())) {
+  if (addr + 2 >= static_cast<uint32_t>(content_size())) {
     return absl::OutOfRangeError("Address out of range");
   }
   for (auto* fence : write_fence_stack_) {
     RETURN_IF_ERROR(fence->Check(addr, 3, "WriteLong"));
   }
-  const uint8_t old0 = rom_data_[addr];
-  const uint8_t old1 = rom_data_[addr + 1];
-  const uint8_t old2 = rom_data_[addr + 2];
-  rom_data_[addr] = (uint8_t)(value & 0xFF);
-  rom_data_[addr + 1] = (uint8_t)((value >> 8) & 0xFF);
-  rom_data_[addr + 2] = (uint8_t)((value >> 16) & 0xFF);
+#ifdef __EMSCRIPTEN__
+  const uint8_t old0 = LoadByte(addr);
+  const uint8_t old1 = LoadByte(addr + 1);
+  const uint8_t old2 = LoadByte(addr + 2);
+#endif
+  const uint8_t bytes[3] = {(uint8_t)(value & 0xFF),
+                            (uint8_t)((value >> 8) & 0xFF),
+                            (uint8_t)((value >> 16) & 0xFF)};
+  StoreBytes(addr, bytes);
   dirty_ = true;
 #ifdef __EMSCRIPTEN__
   MaybeBroadcastChange(addr, {old0, old1, old2},
@@ -705,7 +887,7 @@ absl::Status Rom::WriteVector(int addr, std::vector<uint8_t> data) {
     return absl::OutOfRangeError("Address out of range");
   }
   if (addr + static_cast<int>(data.size()) >
-      static_cast<int>(rom_data_.size())) {
+      static_cast<int>(content_size())) {
     return absl::OutOfRangeError("Address out of range");
   }
   for (auto* fence : write_fence_stack_) {
@@ -713,12 +895,14 @@ absl::Status Rom::WriteVector(int addr, std::vector<uint8_t> data) {
                                  static_cast<uint32_t>(data.size()),
                                  "WriteVector"));
   }
+#ifdef __EMSCRIPTEN__
   std::vector<uint8_t> old_data;
   old_data.reserve(data.size());
   for (int i = 0; i < static_cast<int>(data.size()); i++) {
-    old_data.push_back(rom_data_[addr + i]);
-    rom_data_[addr + i] = data[i];
+    old_data.push_back(LoadByte(addr + i));
   }
+#endif
+  StoreBytes(addr, data);
   dirty_ = true;
 #ifdef __EMSCRIPTEN__
   MaybeBroadcastChange(addr, old_data, data);
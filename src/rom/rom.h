@@ -1,9 +1,12 @@
 #ifndef YAZE_ROM_ROM_H
 #define YAZE_ROM_ROM_H
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <map>
+#include <mutex>
+#include <span>
 #include <string>
 #include <variant>
 #include <vector>
@@ -14,16 +17,27 @@
 #include "app/gfx/types/snes_tile.h"
 #include "core/project.h"
 #include "rom/rom_diagnostics.h"
+#include "rom/rom_pages.h"
 
 namespace yaze {
 
 namespace rom {
+class WriteBatch;
 class WriteFence;
+class WriteJournal;
 }  // namespace rom
 
 /**
  * @brief The Rom class is used to load, save, and modify Rom data.
  * This is a generic SNES ROM container and does not contain game-specific logic.
+ *
+ * Bytes live in a copy-on-write page table (rom::RomPages), so copying a Rom
+ * shares every page and costs O(pages); Write* calls unshare only the pages
+ * they touch. The contiguous data()/vector() view is built on first use.
+ * Once mutable raw access (mutable_data(), mutable_vector(), begin(),
+ * operator[]) has been handed out, that buffer becomes authoritative until
+ * the contents are next replaced, and pages are re-synced from it (sharing
+ * unchanged pages) whenever they are needed.
  */
 class Rom {
  public:
@@ -41,6 +55,12 @@ class Rom {
   struct LoadOptions {
     bool strip_header = true;
     bool load_resource_labels = true;
+    // Map the file read-only instead of reading it into memory. Pages alias
+    // the mapping until written, and data()/ReadSpan() return pointers into
+    // it, so a load costs no copy. Meant for analysis-only callers: a
+    // data() pointer taken before a write keeps seeing the file's bytes.
+    // Falls back to a buffered read where mapping is unavailable.
+    bool memory_map = false;
 
     static LoadOptions Defaults() { return LoadOptions{}; }
   };
@@ -60,23 +80,8 @@ class Rom {
 
   absl::Status SaveToFile(const SaveSettings& settings);
 
-  void Expand(int size) {
-    const bool size_changed = rom_data_.size() != static_cast<size_t>(size);
-    rom_data_.resize(size);
-    size_ = size;
-    if (size_changed) {
-      AdvanceObjectTileRevision();
-    }
-  }
-
-  void Close() {
-    const bool had_data = !rom_data_.empty();
-    rom_data_.clear();
-    size_ = 0;
-    if (had_data) {
-      AdvanceObjectTileRevision();
-    }
-  }
+  void Expand(int size);
+  void Close();
 
   // Raw access
   absl::StatusOr<uint8_t> ReadByte(int offset) const;
@@ -84,6 +89,11 @@ class Rom {
   absl::StatusOr<uint32_t> ReadLong(int offset) const;
   absl::StatusOr<std::vector<uint8_t>> ReadByteVector(uint32_t offset,
                                                       uint32_t length) const;
+  // Zero-copy view of [offset, offset + length), valid until the next write,
+  // resize or load. Ranges that cross separately allocated pages are served
+  // from the contiguous view, which is built on first need.
+  absl::StatusOr<std::span<const uint8_t>> ReadSpan(uint32_t offset,
+                                                    uint32_t length) const;
   absl::StatusOr<gfx::Tile16> ReadTile16(uint32_t tile16_id,
                                          uint32_t tile16_ptr);
 
@@ -149,10 +159,10 @@ class Rom {
   uint8_t& operator[](unsigned long i) {
     if (i >= size_)
       throw std::out_of_range("Rom index out of range");
-    return rom_data_[i];
+    return MutableFlatData()[i];
   }
 
-  bool is_loaded() const { return !rom_data_.empty(); }
+  bool is_loaded() const { return content_size() != 0; }
   bool dirty() const { return dirty_; }
   void set_dirty(bool dirty) { dirty_ = dirty; }
   void ClearDirty() { dirty_ = false; }
@@ -166,12 +176,19 @@ class Rom {
 
   auto title() const { return title_; }
   auto size() const { return size_; }
-  auto data() const { return rom_data_.data(); }
-  auto mutable_data() { return rom_data_.data(); }
-  auto begin() { return rom_data_.begin(); }
-  auto end() { return rom_data_.end(); }
-  const auto& vector() const { return rom_data_; }
-  auto& mutable_vector() { return rom_data_; }
+  const uint8_t* data() const {
+    if (!flat_valid_.load(std::memory_order_acquire)) {
+      if (const uint8_t* mapped = pages_.contiguous_data()) {
+        return mapped;
+      }
+    }
+    return FlatData().data();
+  }
+  auto mutable_data() { return MutableFlatData().data(); }
+  auto begin() { return MutableFlatData().begin(); }
+  auto end() { return MutableFlatData().end(); }
+  const auto& vector() const { return FlatData(); }
+  auto& mutable_vector() { return MutableFlatData(); }
   auto filename() const { return filename_; }
   auto set_filename(std::string_view name) { filename_ = name; }
   auto short_name() const { return short_name_; }
@@ -181,6 +198,19 @@ class Rom {
     return &resource_label_manager_;
   }
 
+  // Copy-on-write pages.
+  //
+  // Dirty pages are those written by this instance since it was loaded,
+  // copied or last cleared; a copy starts with none. Raw-buffer writes are
+  // picked up here too, by comparing against the previous page contents.
+  std::vector<uint32_t> DirtyPages() const;
+  void ClearDirtyPages();
+  const rom::RomPages& pages() const;
+
+  // Pages whose contents differ between two ROMs. Pages still shared between
+  // clones are skipped without being read.
+  static std::vector<uint32_t> ChangedPages(const Rom& a, const Rom& b);
+
   // ROM write fence stack.
   //
   // When one or more fences are active, Rom::Write* calls must be allowed by
@@ -191,6 +221,9 @@ class Rom {
   size_t write_fence_depth() const { return write_fence_stack_.size(); }
 
  private:
+  friend class rom::WriteBatch;
+  friend class rom::WriteJournal;
+
   // Size of the ROM data.
   unsigned long size_ = 0;
 
@@ -203,8 +236,47 @@ class Rom {
   // Short name of the ROM
   std::string short_name_;
 
-  // Full contiguous rom space
-  std::vector<uint8_t> rom_data_;
+  size_t content_size() const {
+    return raw_access_ ? rom_data_.size() : pages_.size();
+  }
+  const std::vector<uint8_t>& FlatData() const {
+    if (!flat_valid_.load(std::memory_order_acquire)) {
+      MaterializeFlat();
+    }
+    return rom_data_;
+  }
+  std::vector<uint8_t>& MutableFlatData() {
+    if (!raw_access_) {
+      MaterializeFlat();
+      raw_access_ = true;
+    }
+    return rom_data_;
+  }
+  void MaterializeFlat() const;
+  void SyncPages() const;
+  void RefreshFlatView();
+  uint8_t LoadByte(size_t offset) const {
+    return flat_valid_.load(std::memory_order_acquire) ? rom_data_[offset]
+                                                       : pages_.Get(offset);
+  }
+  void StoreBytes(size_t offset, std::span<const uint8_t> bytes);
+  // Bounds-checked batch path: copies the replaced bytes to `originals` (when
+  // non-null) before storing, without fence checks or dirty bookkeeping.
+  void StoreBytesJournaled(size_t offset, std::span<const uint8_t> bytes,
+                           uint8_t* originals);
+
+  // Canonical storage, except while raw_access_ is set; see class comment.
+  mutable rom::RomPages pages_;
+
+  // Contiguous view of pages_, valid when flat_valid_ is set. MaterializeFlat
+  // publishes it with a release store, so lock-free readers load the flag
+  // with acquire before touching rom_data_.
+  mutable std::vector<uint8_t> rom_data_;
+  mutable std::atomic<bool> flat_valid_ = false;
+  mutable std::mutex flat_mutex_;
+
+  // Mutable raw access was handed out: rom_data_ leads, pages_ may be stale.
+  bool raw_access_ = false;
 
   // Label manager for unique resource names.
   project::ResourceLabelManager resource_label_manager_;
@@ -1,68 +1,284 @@
 #include "rom/rom_diff.h"
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "absl/strings/str_cat.h"
+#include "core/hack_manifest.h"
+#include "rom/rom.h"
+#include "rom/snes.h"
+#include "rom/write_fence.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define YAZE_ROM_DIFF_SSE2 1
+#endif
+
 namespace yaze::rom {
 
+namespace {
+
+constexpr size_t kBlockSize = 64;
+
+// Bit i set when a[i] != b[i], for one 64-byte block.
+uint64_t DiffMask64(const uint8_t* a, const uint8_t* b) {
+#if defined(YAZE_ROM_DIFF_SSE2)
+  uint64_t mask = 0;
+  for (int i = 0; i < 4; ++i) {
+    const __m128i va =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i * 16));
+    const __m128i vb =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i * 16));
+    const uint32_t equal =
+        static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+    mask |= static_cast<uint64_t>(~equal & 0xFFFF) << (i * 16);
+  }
+  return mask;
+#else
+  uint64_t mask = 0;
+  if constexpr (std::endian::native == std::endian::little) {
+    constexpr uint64_t kLow7 = 0x7F7F7F7F7F7F7F7FULL;
+    constexpr uint64_t kHigh = 0x8080808080808080ULL;
+    for (int w = 0; w < 8; ++w) {
+      uint64_t x, y;
+      std::memcpy(&x, a + w * 8, 8);
+      std::memcpy(&y, b + w * 8, 8);
+      const uint64_t d = x ^ y;
+      if (d == 0) {
+        continue;
+      }
+      // High bit of each nonzero byte, then gather those 8 bits into one
+      // byte (byte k -> bit k).
+      const uint64_t nonzero = (((d & kLow7) + kLow7) | d) & kHigh;
+      const uint64_t bits = ((nonzero >> 7) * 0x0102040810204080ULL) >> 56;
+      mask |= bits << (w * 8);
+    }
+  } else {
+    for (size_t i = 0; i < kBlockSize; ++i) {
+      mask |= static_cast<uint64_t>(a[i] != b[i]) << i;
+    }
+  }
+  return mask;
+#endif
+}
+
+// Collects exact changed runs in ascending order and derives the merged
+// ranges and change map from them.
+class DiffBuilder {
+ public:
+  void Scan(const uint8_t* a, const uint8_t* b, size_t base, size_t length) {
+    size_t i = 0;
+    for (; i + kBlockSize <= length; i += kBlockSize) {
+      AddMask(DiffMask64(a + i, b + i), base + i);
+    }
+    uint64_t mask = 0;
+    for (size_t j = 0; i + j < length; ++j) {
+      mask |= static_cast<uint64_t>(a[i + j] != b[i + j]) << j;
+    }
+    AddMask(mask, base + i);
+  }
+
+  void AddRun(size_t start, size_t end) {
+    if (!runs_.empty() && runs_.back().second == start) {
+      runs_.back().second = static_cast<uint32_t>(end);
+    } else {
+      runs_.emplace_back(static_cast<uint32_t>(start),
+                         static_cast<uint32_t>(end));
+    }
+  }
+
+  RomDiff Finish(const DiffOptions& options) const {
+    RomDiff diff;
+    for (const auto& [start, end] : runs_) {
+      diff.total_bytes_changed += end - start;
+      if (!diff.ranges.empty() &&
+          start - diff.ranges.back().end <= options.merge_gap) {
+        diff.ranges.back().end = end;
+        diff.ranges.back().bytes_changed += end - start;
+      } else {
+        diff.ranges.push_back({start, end, end - start, {}});
+      }
+    }
+    if (options.build_change_map) {
+      BuildChangeMap(diff.change_map);
+    }
+    return diff;
+  }
+
+ private:
+  void AddMask(uint64_t mask, size_t base) {
+    while (mask != 0) {
+      const int start = std::countr_zero(mask);
+      const int length = std::countr_one(mask >> start);
+      AddRun(base + start, base + start + length);
+      if (start + length >= 64) {
+        break;
+      }
+      mask &= ~0ULL << (start + length);
+    }
+  }
+
+  void BuildChangeMap(std::vector<DiffBank>& banks) const {
+    for (auto [start, end] : runs_) {
+      while (start < end) {
+        const uint32_t page = start / kDiffPageSize;
+        const uint32_t piece_end = std::min(end, (page + 1) * kDiffPageSize);
+        const uint32_t bank = start / kDiffBankSize;
+        if (banks.empty() || banks.back().bank != bank) {
+          banks.push_back({bank, 0, {}});
+        }
+        auto& pages = banks.back().pages;
+        if (pages.empty() || pages.back().page != page) {
+          pages.push_back({page, 0, {}});
+        }
+        pages.back().ranges.emplace_back(start, piece_end);
+        pages.back().bytes_changed += piece_end - start;
+        banks.back().bytes_changed += piece_end - start;
+        start = piece_end;
+      }
+    }
+  }
+
+  std::vector<std::pair<uint32_t, uint32_t>> runs_;
+};
+
+}  // namespace
+
 DiffSummary ComputeDiffRanges(const std::vector<uint8_t>& before,
                               const std::vector<uint8_t>& after) {
+  const RomDiff diff = ComputeRomDiff(before, after);
   DiffSummary summary;
+  summary.total_bytes_changed = diff.total_bytes_changed;
+  summary.ranges.reserve(diff.ranges.size());
+  for (const auto& range : diff.ranges) {
+    summary.ranges.emplace_back(range.start, range.end);
+  }
+  return summary;
+}
 
+RomDiff ComputeRomDiff(std::span<const uint8_t> before,
+                       std::span<const uint8_t> after,
+                       const DiffOptions& options) {
   const size_t min_size = std::min(before.size(), after.size());
   const size_t max_size = std::max(before.size(), after.size());
 
-  bool in_diff = false;
-  uint32_t diff_start = 0;
+  DiffBuilder builder;
+  builder.Scan(before.data(), after.data(), 0, min_size);
+  if (min_size != max_size) {
+    // Treat the size delta as a single tail diff.
+    builder.AddRun(min_size, max_size);
+  }
+  return builder.Finish(options);
+}
 
-  for (size_t i = 0; i < min_size; ++i) {
-    if (before[i] != after[i]) {
-      if (!in_diff) {
-        in_diff = true;
-        diff_start = static_cast<uint32_t>(i);
-      }
-      summary.total_bytes_changed++;
-      continue;
-    }
+RomDiff ComputeRomDiff(const Rom& before, const Rom& after,
+                       const DiffOptions& options) {
+  const size_t min_size = std::min<size_t>(before.size(), after.size());
+  const size_t max_size = std::max<size_t>(before.size(), after.size());
 
-    if (in_diff) {
-      summary.ranges.emplace_back(diff_start, static_cast<uint32_t>(i));
-      in_diff = false;
+  DiffBuilder builder;
+  for (const uint32_t page : Rom::ChangedPages(before, after)) {
+    const size_t start = static_cast<size_t>(page) * kDiffPageSize;
+    if (start >= min_size) {
+      break;
     }
+    const auto length =
+        static_cast<uint32_t>(std::min<size_t>(kDiffPageSize, min_size - start));
+    auto a = before.ReadSpan(static_cast<uint32_t>(start), length);
+    auto b = after.ReadSpan(static_cast<uint32_t>(start), length);
+    if (a.ok() && b.ok()) {
+      builder.Scan(a->data(), b->data(), start, length);
+    }
+  }
+  if (min_size != max_size) {
+    builder.AddRun(min_size, max_size);
   }
+  return builder.Finish(options);
+}
 
-  if (in_diff) {
-    summary.ranges.emplace_back(diff_start, static_cast<uint32_t>(min_size));
+void AnnotateDiff(RomDiff& diff, std::vector<DiffRegionLabel> regions) {
+  std::erase_if(regions,
+                [](const DiffRegionLabel& r) { return r.start >= r.end; });
+  if (regions.empty()) {
+    return;
+  }
+  std::sort(regions.begin(), regions.end(),
+            [](const DiffRegionLabel& a, const DiffRegionLabel& b) {
+              return a.start < b.start;
+            });
+  // max_end[i] bounds the backwards walk: once no earlier region reaches
+  // past the range start, none can overlap it.
+  std::vector<uint32_t> max_end(regions.size());
+  uint32_t running = 0;
+  for (size_t i = 0; i < regions.size(); ++i) {
+    running = std::max(running, regions[i].end);
+    max_end[i] = running;
   }
 
-  if (before.size() != after.size()) {
-    // Treat the size delta as a single tail diff.
-    summary.ranges.emplace_back(static_cast<uint32_t>(min_size),
-                                static_cast<uint32_t>(max_size));
-    summary.total_bytes_changed += (max_size - min_size);
-  }
-
-  // Merge adjacent ranges (possible when a diff ends exactly at min_size and we
-  // also add a tail diff due to size delta).
-  if (summary.ranges.size() > 1) {
-    std::sort(summary.ranges.begin(), summary.ranges.end());
-    std::vector<std::pair<uint32_t, uint32_t>> merged;
-    merged.reserve(summary.ranges.size());
-    for (const auto& r : summary.ranges) {
-      if (merged.empty() || merged.back().second < r.first) {
-        merged.push_back(r);
+  std::vector<const DiffRegionLabel*> hits;
+  std::vector<std::string_view> seen;
+  for (auto& range : diff.ranges) {
+    hits.clear();
+    seen.clear();
+    auto upper = std::lower_bound(
+        regions.begin(), regions.end(), range.end,
+        [](const DiffRegionLabel& r, uint32_t end) { return r.start < end; });
+    for (size_t i = static_cast<size_t>(upper - regions.begin()); i-- > 0;) {
+      if (max_end[i] <= range.start) {
+        break;
+      }
+      if (regions[i].end > range.start) {
+        hits.push_back(&regions[i]);
+      }
+    }
+    range.region.clear();
+    for (auto it = hits.rbegin(); it != hits.rend(); ++it) {
+      const std::string_view label = (*it)->label;
+      if (std::find(seen.begin(), seen.end(), label) != seen.end()) {
         continue;
       }
-      merged.back().second = std::max(merged.back().second, r.second);
+      seen.push_back(label);
+      if (!range.region.empty()) {
+        range.region += ", ";
+      }
+      range.region += label;
     }
-    summary.ranges = std::move(merged);
   }
+}
 
-  return summary;
+std::vector<DiffRegionLabel> RegionLabelsFromWriteFence(
+    const WriteFence& fence) {
+  std::vector<DiffRegionLabel> labels;
+  for (const auto& range : fence.allowed_ranges()) {
+    labels.push_back({range.start, range.end, range.label});
+  }
+  return labels;
 }
 
-}  // namespace yaze::rom
+std::vector<DiffRegionLabel> RegionLabelsFromHackManifest(
+    const core::HackManifest& manifest) {
+  std::vector<DiffRegionLabel> labels;
+  for (const auto& region : manifest.protected_regions()) {
+    labels.push_back({SnesToPc(region.start), SnesToPc(region.end),
+                      absl::StrCat("hook:", region.module)});
+  }
+  for (const auto& [bank, owned] : manifest.owned_banks()) {
+    const uint32_t start = SnesToPc((static_cast<uint32_t>(bank) << 16) |
+                                    0x8000);
+    std::string label = core::AddressOwnershipToString(owned.ownership);
+    if (!owned.ownership_note.empty()) {
+      absl::StrAppend(&label, " (", owned.ownership_note, ")");
+    }
+    labels.push_back({start, start + kDiffBankSize, std::move(label)});
+  }
+  return labels;
+}
 
+}  // namespace yaze::rom
@@ -3,11 +3,22 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <string>
 #include <utility>
 #include <vector>
 
+namespace yaze {
+class Rom;
+namespace core {
+class HackManifest;
+}  // namespace core
+}  // namespace yaze
+
 namespace yaze::rom {
 
+class WriteFence;
+
 // Summary of byte-level differences between two ROM buffers.
 //
 // Ranges use PC offsets with half-open semantics: [start, end).
@@ -25,7 +36,82 @@ struct DiffSummary {
 DiffSummary ComputeDiffRanges(const std::vector<uint8_t>& before,
                               const std::vector<uint8_t>& after);
 
+// ---------------------------------------------------------------------------
+// Detailed diff
+// ---------------------------------------------------------------------------
+
+// Half-open PC range with a label, used to say who owns a changed range.
+struct DiffRegionLabel {
+  uint32_t start = 0;
+  uint32_t end = 0;
+  std::string label;
+};
+
+struct DiffRange {
+  uint32_t start = 0;
+  uint32_t end = 0;
+  // Differing positions inside [start, end); less than end - start when
+  // nearby ranges were coalesced by DiffOptions::merge_gap.
+  uint32_t bytes_changed = 0;
+  // Labels of the regions overlapping this range, comma separated. Filled
+  // by AnnotateDiff().
+  std::string region;
+};
+
+// Change map levels: LoROM bank (32 KB of PC space) -> 4 KB page -> exact
+// changed ranges clipped to the page, so a UI can draw a heat map from the
+// top level and only expand what is on screen.
+struct DiffPage {
+  uint32_t page = 0;  // PC offset >> 12
+  uint32_t bytes_changed = 0;
+  std::vector<std::pair<uint32_t, uint32_t>> ranges;
+};
+
+struct DiffBank {
+  uint32_t bank = 0;  // PC offset >> 15
+  uint32_t bytes_changed = 0;
+  std::vector<DiffPage> pages;
+};
+
+struct DiffOptions {
+  // Coalesce ranges separated by at most this many unchanged bytes.
+  uint32_t merge_gap = 0;
+  bool build_change_map = false;
+};
+
+struct RomDiff {
+  size_t total_bytes_changed = 0;
+  std::vector<DiffRange> ranges;
+  // Empty unless DiffOptions::build_change_map.
+  std::vector<DiffBank> change_map;
+};
+
+inline constexpr uint32_t kDiffBankSize = 0x8000;
+inline constexpr uint32_t kDiffPageSize = 0x1000;
+
+// Compares 64 bytes per step (SSE2 where available, 64-bit words
+// elsewhere), so unchanged stretches cost a few instructions per block.
+RomDiff ComputeRomDiff(std::span<const uint8_t> before,
+                       std::span<const uint8_t> after,
+                       const DiffOptions& options = {});
+
+// Same result for two Roms, but pages the ROMs still share (e.g. a ROM and
+// a snapshot copied from it) are skipped without being read.
+RomDiff ComputeRomDiff(const Rom& before, const Rom& after,
+                       const DiffOptions& options = {});
+
+// Label each range with the regions it overlaps. `regions` need not be
+// sorted and may overlap.
+void AnnotateDiff(RomDiff& diff, std::vector<DiffRegionLabel> regions);
+
+// Region sources for AnnotateDiff().
+std::vector<DiffRegionLabel> RegionLabelsFromWriteFence(
+    const WriteFence& fence);
+// Hook regions ("hook:<module>") and owned banks (by ownership), converted
+// from LoROM SNES addresses to PC offsets.
+std::vector<DiffRegionLabel> RegionLabelsFromHackManifest(
+    const core::HackManifest& manifest);
+
 }  // namespace yaze::rom
 
 #endif  // YAZE_ROM_ROM_DIFF_H
-
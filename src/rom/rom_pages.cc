@@ -0,0 +1,215 @@
+#include "rom/rom_pages.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace yaze::rom {
+
+namespace {
+
+size_t PagesFor(size_t size) {
+  return (size + RomPages::kPageSize - 1) >> RomPages::kPageShift;
+}
+
+}  // namespace
+
+void RomPages::Assign(std::span<const uint8_t> data) {
+  pages_.clear();
+  pages_.reserve(PagesFor(data.size()));
+  for (size_t offset = 0; offset < data.size(); offset += kPageSize) {
+    const size_t n = std::min(kPageSize, data.size() - offset);
+    auto page = std::make_shared<Page>();
+    std::memcpy(page->data(), data.data() + offset, n);
+    pages_.push_back(std::move(page));
+  }
+  size_ = data.size();
+  dirty_flags_.assign(pages_.size(), 0);
+  dirty_list_.clear();
+  backing_.reset();
+  contiguous_ = nullptr;
+}
+
+void RomPages::AssignShared(std::shared_ptr<const void> owner,
+                            std::span<const uint8_t> data,
+                            size_t readable_size) {
+  Assign({});
+  pages_.reserve(PagesFor(data.size()));
+  bool aliased_all = true;
+  for (size_t offset = 0; offset < data.size(); offset += kPageSize) {
+    if (offset + kPageSize <= readable_size) {
+      // Aliasing constructor: shares `owner`'s control block, so the page
+      // keeps the mapping alive and is never uniquely owned (backing_ holds
+      // another reference), which routes every write through a copy.
+      auto* page = reinterpret_cast<Page*>(
+          const_cast<uint8_t*>(data.data() + offset));
+      pages_.push_back(std::shared_ptr<Page>(
+          std::const_pointer_cast<void>(owner), page));
+      continue;
+    }
+    const size_t n = std::min(kPageSize, data.size() - offset);
+    auto page = std::make_shared<Page>();
+    std::memcpy(page->data(), data.data() + offset, n);
+    pages_.push_back(std::move(page));
+    aliased_all = false;
+  }
+  size_ = data.size();
+  dirty_flags_.assign(pages_.size(), 0);
+  backing_ = std::move(owner);
+  contiguous_ = aliased_all && !data.empty() ? data.data() : nullptr;
+}
+
+void RomPages::SyncFrom(std::span<const uint8_t> data) {
+  const size_t count = PagesFor(data.size());
+  Resize(data.size());
+  for (size_t p = 0; p < count; ++p) {
+    const size_t offset = p << kPageShift;
+    const size_t n = std::min(kPageSize, data.size() - offset);
+    if (std::memcmp(pages_[p]->data(), data.data() + offset, n) == 0) {
+      continue;
+    }
+    // A fresh page rather than MutablePage(): the old one may be shared, and
+    // copying it first would be wasted work since every byte is replaced.
+    auto page = std::make_shared<Page>();
+    std::memcpy(page->data(), data.data() + offset, n);
+    pages_[p] = std::move(page);
+    contiguous_ = nullptr;
+    MarkDirty(p);
+  }
+}
+
+void RomPages::Resize(size_t size) {
+  const size_t old_count = pages_.size();
+  const size_t count = PagesFor(size);
+
+  if (count < old_count) {
+    pages_.resize(count);
+    dirty_flags_.resize(count);
+    std::erase_if(dirty_list_, [count](uint32_t p) { return p >= count; });
+  } else if (count > old_count) {
+    contiguous_ = nullptr;
+    pages_.reserve(count);
+    for (size_t p = old_count; p < count; ++p) {
+      pages_.push_back(std::make_shared<Page>());
+      MarkDirty(p);
+    }
+  }
+
+  // Keep the invariant that bytes past size() are zero.
+  const size_t tail = size & (kPageSize - 1);
+  if (size < size_ && tail != 0) {
+    const Page& last = *pages_.back();
+    if (std::any_of(last.begin() + tail, last.end(),
+                    [](uint8_t b) { return b != 0; })) {
+      Page& page = MutablePage(count - 1);
+      std::fill(page.begin() + tail, page.end(), 0);
+    }
+  }
+  size_ = size;
+}
+
+void RomPages::Clear() {
+  pages_.clear();
+  dirty_flags_.clear();
+  dirty_list_.clear();
+  size_ = 0;
+  backing_.reset();
+  contiguous_ = nullptr;
+}
+
+void RomPages::Read(size_t offset, std::span<uint8_t> out) const {
+  size_t done = 0;
+  while (done < out.size()) {
+    const size_t pos = offset + done;
+    const size_t in_page = pos & (kPageSize - 1);
+    const size_t n = std::min(kPageSize - in_page, out.size() - done);
+    std::memcpy(out.data() + done, pages_[pos >> kPageShift]->data() + in_page,
+                n);
+    done += n;
+  }
+}
+
+const uint8_t* RomPages::ContiguousRange(size_t offset, size_t length) const {
+  if (contiguous_ != nullptr) {
+    return contiguous_ + offset;
+  }
+  const size_t first = offset >> kPageShift;
+  const size_t last = (offset + std::max<size_t>(length, 1) - 1) >> kPageShift;
+  for (size_t p = first; p < last; ++p) {
+    if (pages_[p]->data() + kPageSize != pages_[p + 1]->data()) {
+      return nullptr;
+    }
+  }
+  return pages_[first]->data() + (offset & (kPageSize - 1));
+}
+
+void RomPages::Write(size_t offset, std::span<const uint8_t> data) {
+  size_t done = 0;
+  while (done < data.size()) {
+    const size_t pos = offset + done;
+    const size_t in_page = pos & (kPageSize - 1);
+    const size_t n = std::min(kPageSize - in_page, data.size() - done);
+    Page& page = MutablePage(pos >> kPageShift);
+    std::memcpy(page.data() + in_page, data.data() + done, n);
+    done += n;
+  }
+}
+
+std::vector<uint32_t> RomPages::DirtyPages() const {
+  std::vector<uint32_t> pages = dirty_list_;
+  std::sort(pages.begin(), pages.end());
+  return pages;
+}
+
+void RomPages::ClearDirtyPages() {
+  for (uint32_t p : dirty_list_) {
+    dirty_flags_[p] = 0;
+  }
+  dirty_list_.clear();
+}
+
+size_t RomPages::SharedPageCount() const {
+  return static_cast<size_t>(
+      std::count_if(pages_.begin(), pages_.end(),
+                    [](const auto& page) { return page.use_count() > 1; }));
+}
+
+std::vector<uint32_t> RomPages::ChangedPages(const RomPages& a,
+                                             const RomPages& b) {
+  std::vector<uint32_t> changed;
+  const size_t common = std::min(a.pages_.size(), b.pages_.size());
+  for (size_t p = 0; p < common; ++p) {
+    if (a.pages_[p] == b.pages_[p]) {
+      continue;
+    }
+    if (*a.pages_[p] != *b.pages_[p]) {
+      changed.push_back(static_cast<uint32_t>(p));
+    }
+  }
+  const size_t total = std::max(a.pages_.size(), b.pages_.size());
+  for (size_t p = common; p < total; ++p) {
+    changed.push_back(static_cast<uint32_t>(p));
+  }
+  return changed;
+}
+
+RomPages::Page& RomPages::MutablePage(size_t page) {
+  auto& slot = pages_[page];
+  if (slot.use_count() > 1) {
+    slot = std::make_shared<Page>(*slot);
+    contiguous_ = nullptr;
+  }
+  MarkDirty(page);
+  return *slot;
+}
+
+void RomPages::MarkDirty(size_t page) {
+  if (dirty_flags_.size() <= page) {
+    dirty_flags_.resize(pages_.size(), 0);
+  }
+  if (!dirty_flags_[page]) {
+    dirty_flags_[page] = 1;
+    dirty_list_.push_back(static_cast<uint32_t>(page));
+  }
+}
+
+}  // namespace yaze::rom
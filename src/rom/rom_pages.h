@@ -0,0 +1,115 @@
+#ifndef YAZE_ROM_ROM_PAGES_H
+#define YAZE_ROM_ROM_PAGES_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace yaze::rom {
+
+// Copy-on-write paged backing store for ROM bytes.
+//
+// The image is split into fixed 4 KB pages held by shared_ptr. Copying a
+// RomPages copies the page table only, so clones of a ROM share every page
+// until one side writes to it; the writer then takes a private copy of that
+// one page. Pages written since the last ClearDirtyPages() are tracked so
+// callers can enumerate exactly what an instance changed.
+//
+// Bytes past size() in the final page are always zero, so pages can be
+// compared whole.
+class RomPages {
+ public:
+  static constexpr size_t kPageSize = 4096;
+  static constexpr size_t kPageShift = 12;
+  using Page = std::array<uint8_t, kPageSize>;
+
+  RomPages() = default;
+  explicit RomPages(std::span<const uint8_t> data) { Assign(data); }
+
+  // Replace the contents with `data`. All pages become private and clean.
+  void Assign(std::span<const uint8_t> data);
+
+  // Replace the contents with pages that alias `data` in place, kept alive
+  // by `owner` (e.g. a file mapping) and never written through: they count
+  // as shared, so the first write to one takes a private copy. Only pages
+  // lying within `readable_size` bytes of data.data() are aliased; a short
+  // final page past that is copied.
+  void AssignShared(std::shared_ptr<const void> owner,
+                    std::span<const uint8_t> data, size_t readable_size);
+
+  // Re-page from a contiguous image of the same logical ROM. Pages whose
+  // bytes are unchanged stay shared; changed pages are replaced and marked
+  // dirty. `data` may differ in size.
+  void SyncFrom(std::span<const uint8_t> data);
+
+  // Grow (zero-filled) or shrink the image.
+  void Resize(size_t size);
+  void Clear();
+
+  uint8_t Get(size_t offset) const {
+    return (*pages_[offset >> kPageShift])[offset & (kPageSize - 1)];
+  }
+  // Copy [offset, offset + out.size()) into `out`. Caller checks bounds.
+  void Read(size_t offset, std::span<uint8_t> out) const;
+  // Copy `data` to `offset`, unsharing and dirtying each touched page.
+  // Caller checks bounds.
+  void Write(size_t offset, std::span<const uint8_t> data);
+  void CopyTo(std::span<uint8_t> out) const { Read(0, out.first(size_)); }
+  // Valid bytes of one page (shorter than kPageSize only for the last).
+  std::span<const uint8_t> PageBytes(size_t page) const {
+    const size_t start = page << kPageShift;
+    return {pages_[page]->data(), std::min(kPageSize, size_ - start)};
+  }
+
+  // Start of the image while every page is still an in-place alias of one
+  // buffer (see AssignShared()), else null.
+  const uint8_t* contiguous_data() const { return contiguous_; }
+  // Pointer to [offset, offset + length) if the range lies in one page, or
+  // spans pages that are adjacent in memory; else null. Caller checks bounds.
+  const uint8_t* ContiguousRange(size_t offset, size_t length) const;
+
+  size_t size() const { return size_; }
+  size_t page_count() const { return pages_.size(); }
+  bool empty() const { return size_ == 0; }
+
+  // Page indices written since load, clone or ClearDirtyPages(), ascending.
+  std::vector<uint32_t> DirtyPages() const;
+  size_t dirty_page_count() const { return dirty_list_.size(); }
+  bool IsPageDirty(size_t page) const {
+    return page < dirty_flags_.size() && dirty_flags_[page] != 0;
+  }
+  void ClearDirtyPages();
+
+  // True if both stores reference the same physical page at `page`.
+  bool SharesPage(const RomPages& other, size_t page) const {
+    return page < pages_.size() && page < other.pages_.size() &&
+           pages_[page] == other.pages_[page];
+  }
+  // Number of pages also referenced by at least one other store.
+  size_t SharedPageCount() const;
+
+  // Indices of pages whose contents differ between `a` and `b`. Shared pages
+  // are skipped without reading them; pages present in only one store are
+  // always reported.
+  static std::vector<uint32_t> ChangedPages(const RomPages& a,
+                                            const RomPages& b);
+
+ private:
+  Page& MutablePage(size_t page);
+  void MarkDirty(size_t page);
+
+  std::vector<std::shared_ptr<Page>> pages_;
+  std::vector<uint8_t> dirty_flags_;
+  std::vector<uint32_t> dirty_list_;
+  size_t size_ = 0;
+  std::shared_ptr<const void> backing_;
+  const uint8_t* contiguous_ = nullptr;
+};
+
+}  // namespace yaze::rom
+
+#endif  // YAZE_ROM_ROM_PAGES_H
@@ -11,98 +11,53 @@
 
 #include <cstdint>
 #include <string>
-#include <variant>
+#include <utility>
 #include <vector>
 
 #include "absl/status/status.h"
 #include "app/gfx/types/snes_color.h"
 #include "rom/rom.h"
+#include "rom/write_batch.h"
 
 namespace yaze {
 
+// Each write lands immediately as a one-write rom::WriteBatch. The batch's
+// WriteJournal captures the bytes it replaced, so no separate read is needed
+// to remember the originals.
 class Transaction {
  public:
   explicit Transaction(Rom& rom) : rom_(rom) {}
 
   Transaction& WriteByte(int address, uint8_t value) {
-    if (!status_.ok())
-      return *this;
-    auto original = rom_.ReadByte(address);
-    if (!original.ok()) {
-      status_ = original.status();
-      return *this;
-    }
-    status_ = rom_.WriteByte(address, value);
-    if (status_.ok()) {
-      operations_.push_back({address, static_cast<uint8_t>(*original),
-                             OperationType::kWriteByte});
-    }
-    return *this;
+    rom::WriteBatch batch;
+    batch.WriteByte(static_cast<uint32_t>(address), value);
+    return Apply(batch);
   }
 
   Transaction& WriteWord(int address, uint16_t value) {
-    if (!status_.ok())
-      return *this;
-    auto original = rom_.ReadWord(address);
-    if (!original.ok()) {
-      status_ = original.status();
-      return *this;
-    }
-    status_ = rom_.WriteWord(address, value);
-    if (status_.ok()) {
-      operations_.push_back({address, static_cast<uint16_t>(*original),
-                             OperationType::kWriteWord});
-    }
-    return *this;
+    rom::WriteBatch batch;
+    batch.WriteWord(static_cast<uint32_t>(address), value);
+    return Apply(batch);
   }
 
   Transaction& WriteLong(int address, uint32_t value) {
-    if (!status_.ok())
-      return *this;
-    auto original = rom_.ReadLong(address);
-    if (!original.ok()) {
-      status_ = original.status();
-      return *this;
-    }
-    status_ = rom_.WriteLong(address, value);
-    if (status_.ok()) {
-      operations_.push_back({address, static_cast<uint32_t>(*original),
-                             OperationType::kWriteLong});
-    }
-    return *this;
+    rom::WriteBatch batch;
+    batch.WriteLong(static_cast<uint32_t>(address), value);
+    return Apply(batch);
   }
 
   Transaction& WriteVector(int address, const std::vector<uint8_t>& data) {
-    if (!status_.ok())
-      return *this;
-    auto original =
-        rom_.ReadByteVector(address, static_cast<uint32_t>(data.size()));
-    if (!original.ok()) {
-      status_ = original.status();
-      return *this;
-    }
-    status_ = rom_.WriteVector(address, data);
-    if (status_.ok()) {
-      operations_.push_back({address, *original, OperationType::kWriteVector});
-    }
-    return *this;
+    rom::WriteBatch batch;
+    batch.WriteVector(static_cast<uint32_t>(address), data);
+    return Apply(batch);
   }
 
   Transaction& WriteColor(int address, const gfx::SnesColor& color) {
-    if (!status_.ok())
-      return *this;
-    // Store original raw 16-bit value for rollback via WriteWord.
-    auto original_word = rom_.ReadWord(address);
-    if (!original_word.ok()) {
-      status_ = original_word.status();
-      return *this;
-    }
-    status_ = rom_.WriteColor(address, color);
-    if (status_.ok()) {
-      operations_.push_back({address, static_cast<uint16_t>(*original_word),
-                             OperationType::kWriteColor});
-    }
-    return *this;
+    // Same BGR555 packing as Rom::WriteColor.
+    const uint16_t snes = color.snes();
+    const uint16_t bgr = ((snes >> 10) & 0x1F) | ((snes & 0x1F) << 10) |
+                         (snes & 0x7C00);
+    return WriteWord(address, bgr);
   }
 
   absl::Status Commit() {
@@ -112,54 +67,31 @@ class Transaction {
     return status_;
   }
 
+  // Restores the replaced bytes, newest write first, which also brings back
+  // the ROM's dirty flag from before the first write.
   void Rollback() {
-    for (auto it = operations_.rbegin(); it != operations_.rend(); ++it) {
-      const auto& op = *it;
-      switch (op.type) {
-        case OperationType::kWriteByte:
-          (void)rom_.WriteByte(op.address,
-                               std::get<uint8_t>(op.original_value));
-          break;
-        case OperationType::kWriteWord:
-          (void)rom_.WriteWord(op.address,
-                               std::get<uint16_t>(op.original_value));
-          break;
-        case OperationType::kWriteLong:
-          (void)rom_.WriteLong(op.address,
-                               std::get<uint32_t>(op.original_value));
-          break;
-        case OperationType::kWriteVector:
-          (void)rom_.WriteVector(
-              op.address, std::get<std::vector<uint8_t>>(op.original_value));
-          break;
-        case OperationType::kWriteColor:
-          (void)rom_.WriteWord(op.address,
-                               std::get<uint16_t>(op.original_value));
-          break;
-      }
+    for (auto it = journals_.rbegin(); it != journals_.rend(); ++it) {
+      it->Rollback(rom_).IgnoreError();
     }
-    operations_.clear();
+    journals_.clear();
   }
 
  private:
-  enum class OperationType {
-    kWriteByte,
-    kWriteWord,
-    kWriteLong,
-    kWriteVector,
-    kWriteColor
-  };
-
-  struct Operation {
-    int address;
-    std::variant<uint8_t, uint16_t, uint32_t, std::vector<uint8_t>>
-        original_value;
-    OperationType type;
-  };
+  Transaction& Apply(rom::WriteBatch& batch) {
+    if (!status_.ok())
+      return *this;
+    auto journal = batch.Commit(rom_);
+    if (!journal.ok()) {
+      status_ = journal.status();
+      return *this;
+    }
+    journals_.push_back(*std::move(journal));
+    return *this;
+  }
 
   Rom& rom_;
   absl::Status status_;
-  std::vector<Operation> operations_;
+  std::vector<rom::WriteJournal> journals_;
 };
 
 // Whole-buffer transaction used by coordinated editor saves. Individual
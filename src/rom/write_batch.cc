@@ -0,0 +1,192 @@
+#include "rom/write_batch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "absl/strings/str_format.h"
+#include "rom/write_fence.h"
+#include "util/macro.h"
+
+namespace yaze::rom {
+
+absl::Status WriteJournal::Rollback(Rom& rom) const {
+  if (rom.size() != rom_size_) {
+    return absl::FailedPreconditionError(
+        "ROM was resized since the batch was committed");
+  }
+  for (const auto& range : ranges_) {
+    rom.StoreBytesJournaled(
+        range.offset, {original_.data() + range.data_offset, range.length},
+        nullptr);
+  }
+  rom.dirty_ = was_dirty_;
+  return absl::OkStatus();
+}
+
+WriteBatch& WriteBatch::WriteByte(uint32_t offset, uint8_t value) {
+  return WriteVector(offset, {&value, 1});
+}
+
+WriteBatch& WriteBatch::WriteWord(uint32_t offset, uint16_t value) {
+  const uint8_t bytes[2] = {static_cast<uint8_t>(value & 0xFF),
+                            static_cast<uint8_t>((value >> 8) & 0xFF)};
+  return WriteVector(offset, bytes);
+}
+
+WriteBatch& WriteBatch::WriteLong(uint32_t offset, uint32_t value) {
+  const uint8_t bytes[3] = {static_cast<uint8_t>(value & 0xFF),
+                            static_cast<uint8_t>((value >> 8) & 0xFF),
+                            static_cast<uint8_t>((value >> 16) & 0xFF)};
+  return WriteVector(offset, bytes);
+}
+
+WriteBatch& WriteBatch::WriteVector(uint32_t offset,
+                                    std::span<const uint8_t> bytes) {
+  if (bytes.empty()) {
+    return *this;
+  }
+  writes_.push_back({offset, static_cast<uint32_t>(bytes.size()),
+                     pool_.size()});
+  pool_.insert(pool_.end(), bytes.begin(), bytes.end());
+  return *this;
+}
+
+absl::Status WriteBatch::StageChanges(const Rom& base, const Rom& edited) {
+  if (base.size() != edited.size()) {
+    return absl::FailedPreconditionError(absl::StrFormat(
+        "Cannot stage changes between ROMs of different sizes (%zu, %zu)",
+        static_cast<size_t>(base.size()), static_cast<size_t>(edited.size())));
+  }
+  const RomPages& before = base.pages();
+  const RomPages& after = edited.pages();
+  for (uint32_t page : Rom::ChangedPages(base, edited)) {
+    const auto old_bytes = before.PageBytes(page);
+    const auto new_bytes = after.PageBytes(page);
+    const uint32_t page_start = page << RomPages::kPageShift;
+    size_t i = 0;
+    while (i < new_bytes.size()) {
+      if (old_bytes[i] == new_bytes[i]) {
+        ++i;
+        continue;
+      }
+      const size_t run_start = i;
+      while (i < new_bytes.size() && old_bytes[i] != new_bytes[i]) {
+        ++i;
+      }
+      WriteVector(page_start + static_cast<uint32_t>(run_start),
+                  new_bytes.subspan(run_start, i - run_start));
+    }
+  }
+  return absl::OkStatus();
+}
+
+void WriteBatch::Clear() {
+  writes_.clear();
+  pool_.clear();
+  advance_object_tile_revision_ = false;
+}
+
+absl::Status WriteBatch::CheckFences(const Rom& rom,
+                                     const std::vector<size_t>& order) const {
+  for (const WriteFence* fence : rom.write_fence_stack_) {
+    // Allowed ranges are sorted and disjoint, so the only candidate for a
+    // write is the last range starting at or before it; both lists advance
+    // together.
+    const auto& allowed = fence->allowed_ranges();
+    size_t candidate = 0;
+    for (size_t index : order) {
+      const auto& write = writes_[index];
+      const uint64_t end = static_cast<uint64_t>(write.offset) + write.length;
+      while (candidate + 1 < allowed.size() &&
+             allowed[candidate + 1].start <= write.offset) {
+        ++candidate;
+      }
+      const bool ok = candidate < allowed.size() &&
+                      allowed[candidate].start <= write.offset &&
+                      end <= allowed[candidate].end;
+      if (!ok) {
+        return absl::PermissionDeniedError(absl::StrFormat(
+            "ROM write fence blocked WriteBatch at [0x%06X, 0x%06X)",
+            write.offset, end));
+      }
+    }
+  }
+  return absl::OkStatus();
+}
+
+absl::StatusOr<WriteJournal> WriteBatch::Commit(Rom& rom) {
+  WriteJournal journal;
+  journal.rom_size_ = rom.size();
+  journal.was_dirty_ = rom.dirty();
+  if (writes_.empty()) {
+    Clear();
+    return journal;
+  }
+
+  for (const auto& write : writes_) {
+    if (static_cast<uint64_t>(write.offset) + write.length > rom.size()) {
+      return absl::OutOfRangeError(absl::StrFormat(
+          "Batched write [0x%06X, +%u) is past the end of the ROM (%zu)",
+          write.offset, write.length, static_cast<size_t>(rom.size())));
+    }
+  }
+
+  std::vector<size_t> order(writes_.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return writes_[a].offset < writes_[b].offset;
+  });
+  RETURN_IF_ERROR(CheckFences(rom, order));
+
+  // Coalesce overlapping or touching writes into disjoint ranges.
+  std::vector<BatchRange>& ranges = journal.ranges_;
+  size_t total = 0;
+  for (size_t index : order) {
+    const auto& write = writes_[index];
+    const uint32_t end = write.offset + write.length;
+    if (!ranges.empty() && write.offset <= ranges.back().offset +
+                                               ranges.back().length) {
+      auto& back = ranges.back();
+      const uint32_t back_end = std::max(back.offset + back.length, end);
+      total += back_end - (back.offset + back.length);
+      back.length = back_end - back.offset;
+    } else {
+      ranges.push_back({write.offset, write.length, total});
+      total += write.length;
+    }
+  }
+
+  // Replay in staging order so later writes win where they overlap.
+  std::vector<uint8_t> merged(total);
+  for (const auto& write : writes_) {
+    auto it = std::upper_bound(
+        ranges.begin(), ranges.end(), write.offset,
+        [](uint32_t offset, const BatchRange& r) { return offset < r.offset; });
+    const BatchRange& range = *std::prev(it);
+    std::memcpy(merged.data() + range.data_offset +
+                    (write.offset - range.offset),
+                pool_.data() + write.data_offset, write.length);
+  }
+
+  journal.original_.resize(total);
+  for (const auto& range : ranges) {
+    rom.StoreBytesJournaled(
+        range.offset, {merged.data() + range.data_offset, range.length},
+        journal.original_.data() + range.data_offset);
+  }
+
+  rom.dirty_ = true;
+  for (WriteFence* fence : rom.write_fence_stack_) {
+    for (const auto& range : ranges) {
+      fence->RecordWrite(range.offset, range.length);
+    }
+  }
+  if (advance_object_tile_revision_) {
+    rom.AdvanceObjectTileRevision();
+  }
+  Clear();
+  return journal;
+}
+
+}  // namespace yaze::rom
@@ -0,0 +1,96 @@
+#ifndef YAZE_ROM_WRITE_BATCH_H
+#define YAZE_ROM_WRITE_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "rom/rom.h"
+
+namespace yaze::rom {
+
+// Contiguous PC range with its bytes stored at `data_offset` in a pool.
+struct BatchRange {
+  uint32_t offset = 0;
+  uint32_t length = 0;
+  size_t data_offset = 0;
+};
+
+// Bytes a committed WriteBatch replaced, for undo or rollback.
+//
+// Holds only the written ranges (coalesced), not a ROM snapshot.
+class WriteJournal {
+ public:
+  // Restores the original bytes and the ROM's previous dirty flag. Active
+  // write fences are not consulted: this reverts writes they already allowed.
+  absl::Status Rollback(Rom& rom) const;
+
+  const std::vector<BatchRange>& ranges() const { return ranges_; }
+  size_t byte_count() const { return original_.size(); }
+  bool empty() const { return ranges_.empty(); }
+
+ private:
+  friend class WriteBatch;
+
+  std::vector<BatchRange> ranges_;
+  std::vector<uint8_t> original_;
+  size_t rom_size_ = 0;
+  bool was_dirty_ = false;
+};
+
+// Collects ROM writes and applies them all at once.
+//
+// Usage:
+//   rom::WriteBatch batch;
+//   batch.WriteVector(table_pc, table).WriteWord(pointer_pc, pointer);
+//   ASSIGN_OR_RETURN(auto journal, batch.Commit(rom));
+//
+// Commit checks bounds and every active WriteFence for all staged writes
+// (one sorted sweep per fence) before any byte changes, so a rejected batch
+// leaves the ROM untouched. Overlapping writes resolve in staging order.
+// Accepted writes are coalesced and copied range by range; the dirty flag,
+// fence bookkeeping and (on request) the object tile revision are updated
+// once per batch instead of once per write.
+class WriteBatch {
+ public:
+  WriteBatch& WriteByte(uint32_t offset, uint8_t value);
+  WriteBatch& WriteWord(uint32_t offset, uint16_t value);
+  WriteBatch& WriteLong(uint32_t offset, uint32_t value);
+  WriteBatch& WriteVector(uint32_t offset, std::span<const uint8_t> bytes);
+
+  // Stages every byte where `edited` differs from `base`, one write per run
+  // of changed bytes, so committing onto `base` reproduces `edited`. Pages
+  // the two ROMs still share are skipped without being read; `edited` is
+  // typically a copy-on-write clone of `base` that a serializer wrote to.
+  absl::Status StageChanges(const Rom& base, const Rom& edited);
+
+  // Advance Rom::object_tile_revision() once the batch commits.
+  WriteBatch& AdvanceObjectTileRevision() {
+    advance_object_tile_revision_ = true;
+    return *this;
+  }
+
+  size_t write_count() const { return writes_.size(); }
+  size_t staged_bytes() const { return pool_.size(); }
+  bool empty() const { return writes_.empty(); }
+  void Clear();
+
+  // Applies every staged write or none. The batch is cleared on success.
+  absl::StatusOr<WriteJournal> Commit(Rom& rom);
+
+ private:
+  // `order` lists writes_ indices sorted by offset.
+  absl::Status CheckFences(const Rom& rom,
+                           const std::vector<size_t>& order) const;
+
+  std::vector<BatchRange> writes_;
+  std::vector<uint8_t> pool_;
+  bool advance_object_tile_revision_ = false;
+};
+
+}  // namespace yaze::rom
+
+#endif  // YAZE_ROM_WRITE_BATCH_H
@@ -1,28 +1,47 @@
 #include "bps.h"
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <istream>
 #include <vector>
 
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/str_format.h"
+#include "util/macro.h"
 
 namespace yaze {
 namespace util {
 
 namespace {
 
-uint32_t CalculateCrc32(const uint8_t* data, size_t size) {
-  uint32_t crc = 0xFFFFFFFF;
-  for (size_t i = 0; i < size; ++i) {
-    crc ^= data[i];
+constexpr std::array<uint32_t, 256> MakeCrc32Table() {
+  std::array<uint32_t, 256> table{};
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint32_t crc = i;
     for (int bit = 0; bit < 8; ++bit) {
-      if (crc & 1) {
-        crc = (crc >> 1) ^ 0xEDB88320u;
-      } else {
-        crc >>= 1;
-      }
+      crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
     }
+    table[i] = crc;
   }
-  return ~crc;
+  return table;
+}
+
+constexpr auto kCrc32Table = MakeCrc32Table();
+
+// Running CRC32 state; start at 0xFFFFFFFF and invert when done.
+uint32_t UpdateCrc32(uint32_t crc, const uint8_t* data, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    crc = kCrc32Table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return crc;
+}
+
+uint32_t CalculateCrc32(const uint8_t* data, size_t size) {
+  return ~UpdateCrc32(0xFFFFFFFF, data, size);
 }
 
 uint32_t CalculateCrc32(const std::vector<uint8_t>& data) {
@@ -70,6 +89,522 @@ void WriteLE32(std::vector<uint8_t>& output, uint32_t value) {
   output.push_back((value >> 24) & 0xFF);
 }
 
+// Relative offsets are stored as (magnitude << 1) | sign.
+int64_t DecodeRelativeOffset(uint64_t data) {
+  const auto magnitude = static_cast<int64_t>(data >> 1);
+  return (data & 1) ? -magnitude : magnitude;
+}
+
+uint64_t EncodeRelativeOffset(int64_t relative) {
+  return relative < 0 ? (static_cast<uint64_t>(-relative) << 1) | 1
+                      : static_cast<uint64_t>(relative) << 1;
+}
+
+size_t VariableLengthSize(uint64_t value) {
+  size_t size = 1;
+  while (value >>= 7) {
+    value--;
+    ++size;
+  }
+  return size;
+}
+
+enum BpsAction : uint64_t {
+  kSourceRead = 0,
+  kTargetRead = 1,
+  kSourceCopy = 2,
+  kTargetCopy = 3,
+};
+
+void WriteAction(std::vector<uint8_t>& patch, BpsAction action,
+                 size_t length) {
+  WriteVariableLength(patch, (static_cast<uint64_t>(length - 1) << 2) | action);
+}
+
+void WriteHeader(std::vector<uint8_t>& patch, size_t source_size,
+                 size_t target_size) {
+  patch.clear();
+  patch.push_back('B');
+  patch.push_back('P');
+  patch.push_back('S');
+  patch.push_back('1');
+  WriteVariableLength(patch, source_size);
+  WriteVariableLength(patch, target_size);
+  WriteVariableLength(patch, 0);  // Metadata size (0 = no metadata)
+}
+
+void WriteFooter(std::vector<uint8_t>& patch,
+                 const std::vector<uint8_t>& source,
+                 const std::vector<uint8_t>& target) {
+  WriteLE32(patch, CalculateCrc32(source));
+  WriteLE32(patch, CalculateCrc32(target));
+  // Patch CRC32 covers everything written so far
+  WriteLE32(patch, CalculateCrc32(patch));
+}
+
+// ---------------------------------------------------------------------------
+// Delta encoder
+// ---------------------------------------------------------------------------
+
+constexpr size_t kMinMatch = 4;
+// Matches at least this long are taken without searching further.
+constexpr size_t kNiceMatch = 1024;
+constexpr uint32_t kNoPosition = 0xFFFFFFFF;
+
+size_t MatchLength(const uint8_t* a, const uint8_t* b, size_t max_length) {
+  size_t length = 0;
+  while (length + 8 <= max_length) {
+    uint64_t x, y;
+    std::memcpy(&x, a + length, 8);
+    std::memcpy(&y, b + length, 8);
+    if (x != y) {
+      if constexpr (std::endian::native == std::endian::little) {
+        return length + (std::countr_zero(x ^ y) >> 3);
+      }
+      break;
+    }
+    length += 8;
+  }
+  while (length < max_length && a[length] == b[length]) {
+    ++length;
+  }
+  return length;
+}
+
+// Hash chains keyed on the next kMinMatch bytes; newest position first.
+class MatchIndex {
+ public:
+  MatchIndex(const std::vector<uint8_t>& data, int hash_bits)
+      : data_(data),
+        hash_shift_(32 - hash_bits),
+        head_(size_t{1} << hash_bits, kNoPosition),
+        prev_(data.size(), kNoPosition) {}
+
+  uint32_t Hash(const uint8_t* bytes) const {
+    uint32_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    return (word * 2654435761u) >> hash_shift_;
+  }
+
+  void Insert(size_t pos) {
+    if (pos + kMinMatch > data_.size()) {
+      return;
+    }
+    uint32_t& head = head_[Hash(data_.data() + pos)];
+    prev_[pos] = head;
+    head = static_cast<uint32_t>(pos);
+  }
+
+  uint32_t Head(const uint8_t* bytes) const { return head_[Hash(bytes)]; }
+  uint32_t Next(uint32_t pos) const { return prev_[pos]; }
+
+ private:
+  const std::vector<uint8_t>& data_;
+  int hash_shift_;
+  std::vector<uint32_t> head_;
+  std::vector<uint32_t> prev_;
+};
+
+int HashBitsFor(size_t size) {
+  return std::clamp(static_cast<int>(std::bit_width(size)), 10, 20);
+}
+
+struct Match {
+  BpsAction action = kTargetRead;
+  size_t length = 0;
+  size_t from = 0;  // Source or target position for copies
+  int64_t score = 0;
+};
+
+class DeltaEncoder {
+ public:
+  DeltaEncoder(const std::vector<uint8_t>& source,
+               const std::vector<uint8_t>& target,
+               const BpsEncodeOptions& options)
+      : source_(source),
+        target_(target),
+        max_chain_(std::max(options.max_chain, 1)),
+        lazy_(options.lazy_matching),
+        source_index_(source, HashBitsFor(source.size())),
+        target_index_(target, HashBitsFor(target.size())) {
+    for (size_t i = 0; i < source.size(); ++i) {
+      source_index_.Insert(i);
+    }
+  }
+
+  void Encode(std::vector<uint8_t>& patch) {
+    size_t pos = 0;
+    size_t literal_start = 0;
+    while (pos < target_.size()) {
+      IndexTargetUntil(pos);
+      Match match = FindBest(pos);
+      if (match.score > 0 && lazy_ && match.length < kNiceMatch &&
+          pos + 1 < target_.size()) {
+        IndexTargetUntil(pos + 1);
+        if (FindBest(pos + 1).score > match.score + 1) {
+          ++pos;
+          continue;
+        }
+      }
+      if (match.score <= 0) {
+        ++pos;
+        continue;
+      }
+
+      FlushLiterals(patch, literal_start, pos);
+      Emit(patch, match);
+      pos += match.length;
+      literal_start = pos;
+    }
+    FlushLiterals(patch, literal_start, pos);
+  }
+
+ private:
+  void IndexTargetUntil(size_t end) {
+    for (; target_indexed_ < end; ++target_indexed_) {
+      target_index_.Insert(target_indexed_);
+    }
+  }
+
+  // Bytes saved over emitting the same range as literals. One extra byte is
+  // charged for the TargetRead header a match usually splits off.
+  static int64_t Score(size_t length, size_t cost) {
+    return static_cast<int64_t>(length) - static_cast<int64_t>(cost) - 1;
+  }
+
+  void Consider(Match& best, BpsAction action, size_t from, size_t length,
+                int64_t relative_to) {
+    size_t cost = VariableLengthSize((uint64_t{length} - 1) << 2);
+    if (action != kSourceRead) {
+      cost += VariableLengthSize(EncodeRelativeOffset(
+          static_cast<int64_t>(from) - relative_to));
+    }
+    const int64_t score = Score(length, cost);
+    if (score > best.score) {
+      best = {action, length, from, score};
+    }
+  }
+
+  Match FindBest(size_t pos) {
+    Match best;
+    const size_t remaining = target_.size() - pos;
+    const uint8_t* want = target_.data() + pos;
+
+    if (pos < source_.size()) {
+      const size_t length = MatchLength(source_.data() + pos, want,
+                                        std::min(remaining,
+                                                 source_.size() - pos));
+      if (length > 0) {
+        Consider(best, kSourceRead, pos, length, 0);
+      }
+      if (length >= kNiceMatch || length == remaining) {
+        return best;
+      }
+    }
+    if (remaining < kMinMatch) {
+      return best;
+    }
+
+    int chain = max_chain_;
+    for (uint32_t cand = source_index_.Head(want);
+         cand != kNoPosition && chain-- > 0; cand = source_index_.Next(cand)) {
+      if (cand == pos) {
+        continue;  // Same as SourceRead, which is cheaper
+      }
+      const size_t max_length = std::min(remaining, source_.size() - cand);
+      if (best.length < max_length &&
+          source_[cand + best.length] != want[best.length]) {
+        continue;
+      }
+      const size_t length = MatchLength(source_.data() + cand, want,
+                                        max_length);
+      if (length >= kMinMatch) {
+        Consider(best, kSourceCopy, cand, length, source_relative_);
+        if (length >= kNiceMatch) {
+          break;  // Still worth checking whether the target repeats further
+        }
+      }
+    }
+
+    chain = max_chain_;
+    for (uint32_t cand = target_index_.Head(want);
+         cand != kNoPosition && chain-- > 0; cand = target_index_.Next(cand)) {
+      // Overlapping copies are valid: the applier copies byte by byte
+      if (best.length < remaining &&
+          target_[cand + best.length] != want[best.length]) {
+        continue;
+      }
+      const size_t length = MatchLength(target_.data() + cand, want, remaining);
+      if (length >= kMinMatch) {
+        Consider(best, kTargetCopy, cand, length, target_relative_);
+        if (length >= kNiceMatch) {
+          break;
+        }
+      }
+    }
+    return best;
+  }
+
+  void FlushLiterals(std::vector<uint8_t>& patch, size_t start, size_t end) {
+    if (start == end) {
+      return;
+    }
+    WriteAction(patch, kTargetRead, end - start);
+    patch.insert(patch.end(), target_.begin() + start, target_.begin() + end);
+  }
+
+  void Emit(std::vector<uint8_t>& patch, const Match& match) {
+    WriteAction(patch, match.action, match.length);
+    const auto from = static_cast<int64_t>(match.from);
+    const auto end = static_cast<int64_t>(match.from + match.length);
+    if (match.action == kSourceCopy) {
+      WriteVariableLength(patch, EncodeRelativeOffset(from - source_relative_));
+      source_relative_ = end;
+    } else if (match.action == kTargetCopy) {
+      WriteVariableLength(patch, EncodeRelativeOffset(from - target_relative_));
+      target_relative_ = end;
+    }
+  }
+
+  const std::vector<uint8_t>& source_;
+  const std::vector<uint8_t>& target_;
+  int max_chain_;
+  bool lazy_;
+  MatchIndex source_index_;
+  MatchIndex target_index_;
+  size_t target_indexed_ = 0;
+  int64_t source_relative_ = 0;
+  int64_t target_relative_ = 0;
+};
+
+void EncodeLinear(const std::vector<uint8_t>& source,
+                  const std::vector<uint8_t>& target,
+                  std::vector<uint8_t>& patch) {
+  // Where source and target match at the same offset, use SourceRead;
+  // where they differ, use TargetRead with literal bytes.
+  size_t output_offset = 0;
+
+  while (output_offset < target.size()) {
+    // Check how many bytes match at the current position (SourceRead)
+    size_t source_read_len = 0;
+    if (output_offset < source.size()) {
+      while (output_offset + source_read_len < target.size() &&
+             output_offset + source_read_len < source.size() &&
+             source[output_offset + source_read_len] ==
+                 target[output_offset + source_read_len]) {
+        ++source_read_len;
+      }
+    }
+
+    if (source_read_len >= 4 ||
+        (source_read_len > 0 &&
+         output_offset + source_read_len >= target.size())) {
+      // Use SourceRead for a run of matching bytes
+      WriteAction(patch, kSourceRead, source_read_len);
+      output_offset += source_read_len;
+    } else {
+      // Use TargetRead for literal bytes until the next good SourceRead match
+      size_t target_read_len = 1;
+      while (output_offset + target_read_len < target.size()) {
+        // Check if the next position has a good SourceRead match
+        if (output_offset + target_read_len < source.size()) {
+          size_t match_len = 0;
+          while (output_offset + target_read_len + match_len < target.size() &&
+                 output_offset + target_read_len + match_len < source.size() &&
+                 source[output_offset + target_read_len + match_len] ==
+                     target[output_offset + target_read_len + match_len]) {
+            ++match_len;
+          }
+          if (match_len >= 4) {
+            break;  // Found a good match ahead, stop the literal run
+          }
+        }
+        ++target_read_len;
+      }
+
+      WriteAction(patch, kTargetRead, target_read_len);
+      patch.insert(patch.end(), target.begin() + output_offset,
+                   target.begin() + output_offset + target_read_len);
+      output_offset += target_read_len;
+    }
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Streaming applier
+// ---------------------------------------------------------------------------
+
+constexpr size_t kStreamChunk = 64 * 1024;
+
+absl::StatusOr<uint64_t> StreamSize(std::istream& in) {
+  in.clear();
+  in.seekg(0, std::ios::end);
+  const std::streamoff size = in.tellg();
+  if (!in || size < 0) {
+    return absl::InternalError("Stream is not seekable");
+  }
+  return static_cast<uint64_t>(size);
+}
+
+absl::StatusOr<uint32_t> StreamCrc32(std::istream& in, uint64_t size) {
+  std::vector<uint8_t> buffer(kStreamChunk);
+  in.clear();
+  in.seekg(0);
+  uint32_t crc = 0xFFFFFFFF;
+  while (size > 0) {
+    const size_t chunk =
+        static_cast<size_t>(std::min<uint64_t>(size, kStreamChunk));
+    if (!in.read(reinterpret_cast<char*>(buffer.data()), chunk)) {
+      return absl::DataLossError("Unexpected end of stream");
+    }
+    crc = UpdateCrc32(crc, buffer.data(), chunk);
+    size -= chunk;
+  }
+  return ~crc;
+}
+
+// Random-access reads through a one-chunk cache.
+class ChunkedReader {
+ public:
+  explicit ChunkedReader(std::istream& in) : in_(in) {}
+
+  // Byte at @p pos; positions at or past @p limit read as 0.
+  uint8_t Get(uint64_t pos, uint64_t limit) {
+    if (pos >= limit) {
+      return 0;
+    }
+    if (pos < start_ || pos >= start_ + cache_.size()) {
+      const size_t count =
+          static_cast<size_t>(std::min<uint64_t>(limit - pos, kStreamChunk));
+      cache_.resize(count);
+      in_.clear();
+      in_.seekg(static_cast<std::streamoff>(pos));
+      in_.read(reinterpret_cast<char*>(cache_.data()), count);
+      if (static_cast<size_t>(in_.gcount()) != count) {
+        failed_ = true;
+        cache_.clear();
+        return 0;
+      }
+      start_ = pos;
+    }
+    return cache_[pos - start_];
+  }
+
+  bool failed() const { return failed_; }
+
+ private:
+  std::istream& in_;
+  std::vector<uint8_t> cache_;
+  uint64_t start_ = 0;
+  bool failed_ = false;
+};
+
+// Sequential reads over [start, end) of the patch stream.
+class PatchStreamReader {
+ public:
+  PatchStreamReader(std::istream& in, uint64_t start, uint64_t end)
+      : in_(in), pos_(start), end_(end) {
+    in_.clear();
+    in_.seekg(static_cast<std::streamoff>(start));
+  }
+
+  bool ReadByte(uint8_t& value) {
+    if (next_ == buffer_.size()) {
+      const size_t count =
+          static_cast<size_t>(std::min<uint64_t>(end_ - pos_, kStreamChunk));
+      if (count == 0) {
+        return false;
+      }
+      buffer_.resize(count);
+      if (!in_.read(reinterpret_cast<char*>(buffer_.data()), count)) {
+        return false;
+      }
+      next_ = 0;
+    }
+    value = buffer_[next_++];
+    ++pos_;
+    return true;
+  }
+
+  bool ReadVariableLength(uint64_t& result) {
+    result = 0;
+    uint64_t shift = 1;
+    uint8_t byte = 0;
+    while (ReadByte(byte)) {
+      result += (byte & 0x7F) * shift;
+      if (byte & 0x80) {
+        return true;
+      }
+      shift <<= 7;
+      result += shift;
+    }
+    return false;
+  }
+
+  bool Skip(uint64_t count) {
+    uint8_t unused;
+    for (uint64_t i = 0; i < count; ++i) {
+      if (!ReadByte(unused)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool at_end() const { return pos_ >= end_; }
+
+ private:
+  std::istream& in_;
+  std::vector<uint8_t> buffer_;
+  size_t next_ = 0;
+  uint64_t pos_;
+  uint64_t end_;
+};
+
+// Appends target bytes, keeping the unflushed tail in memory and reading
+// older bytes back from the stream for TargetCopy.
+class TargetStreamWriter {
+ public:
+  explicit TargetStreamWriter(std::iostream& out) : out_(out), reader_(out) {}
+
+  bool Put(uint8_t value) {
+    pending_.push_back(value);
+    return pending_.size() < kStreamChunk || Flush();
+  }
+
+  uint8_t Get(uint64_t pos) {
+    if (pos >= flushed_) {
+      return pending_[pos - flushed_];
+    }
+    return reader_.Get(pos, flushed_);
+  }
+
+  bool Flush() {
+    if (pending_.empty()) {
+      return true;
+    }
+    crc_ = UpdateCrc32(crc_, pending_.data(), pending_.size());
+    out_.clear();
+    out_.seekp(static_cast<std::streamoff>(flushed_));
+    out_.write(reinterpret_cast<const char*>(pending_.data()),
+               pending_.size());
+    flushed_ += pending_.size();
+    pending_.clear();
+    return static_cast<bool>(out_);
+  }
+
+  uint64_t size() const { return flushed_ + pending_.size(); }
+  bool failed() const { return reader_.failed(); }
+  uint32_t crc() const { return ~crc_; }  // Valid after Flush()
+
+ private:
+  std::iostream& out_;
+  ChunkedReader reader_;
+  std::vector<uint8_t> pending_;
+  uint64_t flushed_ = 0;
+  uint32_t crc_ = 0xFFFFFFFF;
+};
+
 }  // namespace
 
 absl::Status ApplyBpsPatch(const std::vector<uint8_t>& source,
@@ -167,9 +702,7 @@ absl::Status ApplyBpsPatch(const std::vector<uint8_t>& source,
         // SourceCopy: copy length bytes from source at sourceRelativeOffset
         uint64_t offset_data =
             ReadVariableLength(patch.data(), patch.size(), offset);
-        int64_t relative = (offset_data & 1)
-                               ? -(static_cast<int64_t>(offset_data >> 1) + 1)
-                               : static_cast<int64_t>(offset_data >> 1);
+        int64_t relative = DecodeRelativeOffset(offset_data);
         source_relative_offset += relative;
         for (uint64_t i = 0; i < length; ++i) {
           if (output_offset >= target_size) {
@@ -190,9 +723,7 @@ absl::Status ApplyBpsPatch(const std::vector<uint8_t>& source,
         // TargetCopy: copy length bytes from output at targetRelativeOffset
         uint64_t offset_data =
             ReadVariableLength(patch.data(), patch.size(), offset);
-        int64_t relative = (offset_data & 1)
-                               ? -(static_cast<int64_t>(offset_data >> 1) + 1)
-                               : static_cast<int64_t>(offset_data >> 1);
+        int64_t relative = DecodeRelativeOffset(offset_data);
         target_relative_offset += relative;
         for (uint64_t i = 0; i < length; ++i) {
           if (output_offset >= target_size) {
@@ -225,101 +756,201 @@ absl::Status ApplyBpsPatch(const std::vector<uint8_t>& source,
   return absl::OkStatus();
 }
 
-absl::Status CreateBpsPatch(const std::vector<uint8_t>& source,
-                            const std::vector<uint8_t>& target,
-                            std::vector<uint8_t>& patch) {
-  if (source.empty()) {
-    return absl::InvalidArgumentError("Source data is empty");
+absl::Status ApplyBpsPatchStream(std::istream& source, std::istream& patch,
+                                 std::iostream& target) {
+  ASSIGN_OR_RETURN(const uint64_t patch_size, StreamSize(patch));
+  if (patch_size < 16) {
+    return absl::InvalidArgumentError("Patch data is too small to be valid");
   }
-  if (target.empty()) {
-    return absl::InvalidArgumentError("Target data is empty");
+
+  std::array<uint8_t, 4> magic;
+  patch.seekg(0);
+  patch.read(reinterpret_cast<char*>(magic.data()), magic.size());
+  if (!patch || magic[0] != 'B' || magic[1] != 'P' || magic[2] != 'S' ||
+      magic[3] != '1') {
+    return absl::InvalidArgumentError(
+        "Invalid BPS patch header (expected BPS1)");
   }
 
-  patch.clear();
+  // Footer: source CRC32, target CRC32, patch CRC32
+  std::array<uint8_t, 12> footer;
+  patch.seekg(static_cast<std::streamoff>(patch_size - footer.size()));
+  patch.read(reinterpret_cast<char*>(footer.data()), footer.size());
+  if (!patch) {
+    return absl::DataLossError("Failed to read patch footer");
+  }
+  ASSIGN_OR_RETURN(const uint32_t computed_patch_crc,
+                   StreamCrc32(patch, patch_size - 4));
+  if (ReadLE32(&footer[8]) != computed_patch_crc) {
+    return absl::DataLossError("Patch CRC32 mismatch (corrupt patch file)");
+  }
 
-  // BPS header "BPS1"
-  patch.push_back('B');
-  patch.push_back('P');
-  patch.push_back('S');
-  patch.push_back('1');
+  PatchStreamReader reader(patch, 4, patch_size - footer.size());
+  uint64_t source_size = 0;
+  uint64_t target_size = 0;
+  uint64_t metadata_size = 0;
+  if (!reader.ReadVariableLength(source_size) ||
+      !reader.ReadVariableLength(target_size) ||
+      !reader.ReadVariableLength(metadata_size) ||
+      !reader.Skip(metadata_size)) {
+    return absl::DataLossError("Truncated BPS patch header");
+  }
 
-  // Source size
-  WriteVariableLength(patch, source.size());
-  // Target size
-  WriteVariableLength(patch, target.size());
-  // Metadata size (0 = no metadata)
-  WriteVariableLength(patch, 0);
-
-  // Generate patch actions using SourceRead and TargetRead
-  //
-  // BPS action types:
-  //   0 = SourceRead: copy n bytes from source at current outputOffset
-  //   1 = TargetRead: copy n literal bytes from the patch stream
-  //   2 = SourceCopy: copy n bytes from source at sourceRelativeOffset
-  //   3 = TargetCopy: copy n bytes from target at targetRelativeOffset
-  //
-  // We use a straightforward algorithm:
-  //   - Where source and target match at the same offset, use SourceRead
-  //   - Where they differ, use TargetRead with literal bytes
+  ASSIGN_OR_RETURN(const uint64_t actual_source_size, StreamSize(source));
+  if (actual_source_size == 0) {
+    return absl::InvalidArgumentError("Source data is empty");
+  }
+  if (actual_source_size != source_size) {
+    return absl::InvalidArgumentError(
+        absl::StrFormat("Source size mismatch: expected %llu, got %llu",
+                        source_size, actual_source_size));
+  }
+  ASSIGN_OR_RETURN(const uint32_t computed_source_crc,
+                   StreamCrc32(source, source_size));
+  if (ReadLE32(&footer[0]) != computed_source_crc) {
+    return absl::DataLossError("Source ROM CRC32 mismatch");
+  }
 
-  size_t output_offset = 0;
+  ChunkedReader source_reader(source);
+  TargetStreamWriter writer(target);
+  int64_t source_relative_offset = 0;
+  int64_t target_relative_offset = 0;
 
-  while (output_offset < target.size()) {
-    // Check how many bytes match at the current position (SourceRead)
-    size_t source_read_len = 0;
-    if (output_offset < source.size()) {
-      while (output_offset + source_read_len < target.size() &&
-             output_offset + source_read_len < source.size() &&
-             source[output_offset + source_read_len] ==
-                 target[output_offset + source_read_len]) {
-        ++source_read_len;
-      }
+  while (!reader.at_end()) {
+    uint64_t data = 0;
+    if (!reader.ReadVariableLength(data)) {
+      return absl::DataLossError("Truncated BPS action");
+    }
+    const uint64_t command = data & 3;
+    const uint64_t length = (data >> 2) + 1;
+    if (writer.size() + length > target_size) {
+      return absl::InternalError("BPS action overflows target");
     }
 
-    if (source_read_len >= 4 ||
-        (source_read_len > 0 &&
-         output_offset + source_read_len >= target.size())) {
-      // Use SourceRead for a run of matching bytes
-      uint64_t action = ((source_read_len - 1) << 2) | 0;
-      WriteVariableLength(patch, action);
-      output_offset += source_read_len;
-    } else {
-      // Use TargetRead for literal bytes until the next good SourceRead match
-      size_t target_read_len = 1;
-      while (output_offset + target_read_len < target.size()) {
-        // Check if the next position has a good SourceRead match
-        if (output_offset + target_read_len < source.size()) {
-          size_t match_len = 0;
-          while (output_offset + target_read_len + match_len < target.size() &&
-                 output_offset + target_read_len + match_len < source.size() &&
-                 source[output_offset + target_read_len + match_len] ==
-                     target[output_offset + target_read_len + match_len]) {
-            ++match_len;
-          }
-          if (match_len >= 4) {
-            break;  // Found a good match ahead, stop the literal run
+    uint64_t offset_data = 0;
+    if (command >= kSourceCopy && !reader.ReadVariableLength(offset_data)) {
+      return absl::DataLossError("Truncated BPS action offset");
+    }
+
+    bool ok = true;
+    switch (command) {
+      case kSourceRead:
+        for (uint64_t i = 0; i < length && ok; ++i) {
+          ok = writer.Put(source_reader.Get(writer.size(), source_size));
+        }
+        break;
+      case kTargetRead:
+        for (uint64_t i = 0; i < length && ok; ++i) {
+          uint8_t value = 0;
+          if (!reader.ReadByte(value)) {
+            return absl::InternalError("TargetRead: overflow");
           }
+          ok = writer.Put(value);
         }
-        ++target_read_len;
-      }
+        break;
+      case kSourceCopy:
+        source_relative_offset += DecodeRelativeOffset(offset_data);
+        for (uint64_t i = 0; i < length && ok; ++i) {
+          const uint8_t value =
+              source_relative_offset >= 0
+                  ? source_reader.Get(
+                        static_cast<uint64_t>(source_relative_offset),
+                        source_size)
+                  : 0;
+          ok = writer.Put(value);
+          source_relative_offset++;
+        }
+        break;
+      case kTargetCopy:
+        target_relative_offset += DecodeRelativeOffset(offset_data);
+        for (uint64_t i = 0; i < length && ok; ++i) {
+          const uint8_t value =
+              (target_relative_offset >= 0 &&
+               static_cast<uint64_t>(target_relative_offset) < writer.size())
+                  ? writer.Get(static_cast<uint64_t>(target_relative_offset))
+                  : 0;
+          ok = writer.Put(value);
+          target_relative_offset++;
+        }
+        break;
+    }
+    if (!ok || source_reader.failed() || writer.failed()) {
+      return absl::DataLossError("I/O error while applying BPS patch");
+    }
+  }
 
-      // Write TargetRead action
-      uint64_t action = ((target_read_len - 1) << 2) | 1;
-      WriteVariableLength(patch, action);
+  if (!writer.Flush()) {
+    return absl::DataLossError("Failed to write patched target");
+  }
+  target.flush();
+  if (writer.size() != target_size) {
+    return absl::DataLossError(
+        absl::StrFormat("Target size mismatch: expected %llu, got %llu",
+                        target_size, writer.size()));
+  }
+  if (ReadLE32(&footer[4]) != writer.crc()) {
+    return absl::DataLossError("Target CRC32 mismatch after patch application");
+  }
 
-      // Write the literal bytes
-      for (size_t i = 0; i < target_read_len; ++i) {
-        patch.push_back(target[output_offset + i]);
-      }
-      output_offset += target_read_len;
-    }
+  return absl::OkStatus();
+}
+
+absl::Status ApplyBpsPatchFile(const std::filesystem::path& source_path,
+                               const std::filesystem::path& patch_path,
+                               const std::filesystem::path& target_path) {
+  std::ifstream source(source_path, std::ios::binary);
+  if (!source) {
+    return absl::NotFoundError(
+        absl::StrFormat("Cannot open source: %s", source_path.string()));
+  }
+  std::ifstream patch(patch_path, std::ios::binary);
+  if (!patch) {
+    return absl::NotFoundError(
+        absl::StrFormat("Cannot open patch: %s", patch_path.string()));
+  }
+  std::fstream target(target_path, std::ios::binary | std::ios::in |
+                                       std::ios::out | std::ios::trunc);
+  if (!target) {
+    return absl::PermissionDeniedError(
+        absl::StrFormat("Cannot create target: %s", target_path.string()));
   }
 
-  // Write checksums (CRC32, little-endian)
-  WriteLE32(patch, CalculateCrc32(source));  // source CRC32
-  WriteLE32(patch, CalculateCrc32(target));  // target CRC32
-  WriteLE32(patch,
-            CalculateCrc32(patch));  // patch CRC32 (over everything so far)
+  auto status = ApplyBpsPatchStream(source, patch, target);
+  if (!status.ok()) {
+    target.close();
+    std::error_code ec;
+    std::filesystem::remove(target_path, ec);
+  }
+  return status;
+}
+
+absl::Status CreateBpsPatch(const std::vector<uint8_t>& source,
+                            const std::vector<uint8_t>& target,
+                            std::vector<uint8_t>& patch) {
+  return CreateBpsPatch(source, target, patch, BpsEncodeOptions{});
+}
+
+absl::Status CreateBpsPatch(const std::vector<uint8_t>& source,
+                            const std::vector<uint8_t>& target,
+                            std::vector<uint8_t>& patch,
+                            const BpsEncodeOptions& options) {
+  if (source.empty()) {
+    return absl::InvalidArgumentError("Source data is empty");
+  }
+  if (target.empty()) {
+    return absl::InvalidArgumentError("Target data is empty");
+  }
+  if (source.size() >= kNoPosition || target.size() >= kNoPosition) {
+    return absl::InvalidArgumentError("Data too large for BPS encoder");
+  }
+
+  WriteHeader(patch, source.size(), target.size());
+  if (options.mode == BpsEncodeMode::kDelta) {
+    DeltaEncoder(source, target, options).Encode(patch);
+  } else {
+    EncodeLinear(source, target, patch);
+  }
+  WriteFooter(patch, source, target);
 
   return absl::OkStatus();
 }
@@ -2,6 +2,8 @@
 #define YAZE_UTIL_BPS_H
 
 #include <cstdint>
+#include <filesystem>
+#include <iosfwd>
 #include <vector>
 
 #include "absl/status/status.h"
@@ -9,15 +11,60 @@
 namespace yaze {
 namespace util {
 
+enum class BpsEncodeMode {
+  // SourceRead/TargetRead only: fast, but moved or repeated data is stored
+  // as literal bytes.
+  kLinear,
+  // Also emits SourceCopy/TargetCopy found through a hash-chain index over
+  // source and target, so relocated tables and duplicated data become short
+  // copy actions.
+  kDelta,
+};
+
+struct BpsEncodeOptions {
+  BpsEncodeMode mode = BpsEncodeMode::kDelta;
+  // Candidates examined per hash chain lookup in delta mode. Higher values
+  // find longer matches (smaller patches) at the cost of encode time.
+  int max_chain = 64;
+  // Check whether the next byte starts a better match before committing to
+  // one (slower, smaller patches).
+  bool lazy_matching = true;
+
+  static BpsEncodeOptions Fast() { return {BpsEncodeMode::kDelta, 8, false}; }
+  static BpsEncodeOptions Smallest() {
+    return {BpsEncodeMode::kDelta, 1024, true};
+  }
+};
+
 absl::Status CreateBpsPatch(const std::vector<uint8_t>& source,
                             const std::vector<uint8_t>& target,
                             std::vector<uint8_t>& patch);
+absl::Status CreateBpsPatch(const std::vector<uint8_t>& source,
+                            const std::vector<uint8_t>& target,
+                            std::vector<uint8_t>& patch,
+                            const BpsEncodeOptions& options);
 
 absl::Status ApplyBpsPatch(const std::vector<uint8_t>& source,
                            const std::vector<uint8_t>& patch,
                            std::vector<uint8_t>& target);
 
+/**
+ * @brief Apply a patch without holding source, patch and target in memory
+ *
+ * The patch is read sequentially after a checksum pass; the source is read
+ * on demand (SourceCopy seeks), and the target is written in chunks and read
+ * back for TargetCopy actions that reach past the in-memory window. All three
+ * streams must be seekable.
+ */
+absl::Status ApplyBpsPatchStream(std::istream& source, std::istream& patch,
+                                 std::iostream& target);
+
+/// File-based wrapper around ApplyBpsPatchStream().
+absl::Status ApplyBpsPatchFile(const std::filesystem::path& source_path,
+                               const std::filesystem::path& patch_path,
+                               const std::filesystem::path& target_path);
+
 }  // namespace util
 }  // namespace yaze
 
-#endif  // YAZE_UTIL_BPS_H
\ No newline at end of file
+#endif  // YAZE_UTIL_BPS_H
@@ -0,0 +1,106 @@
+#include "util/mapped_file.h"
+
+#include <system_error>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace yaze {
+namespace util {
+
+namespace {
+
+[[maybe_unused]] size_t RoundUp(size_t value, size_t granularity) {
+  return (value + granularity - 1) / granularity * granularity;
+}
+
+}  // namespace
+
+absl::StatusOr<std::shared_ptr<const MappedFile>> MappedFile::Open(
+    const std::filesystem::path& path) {
+#if defined(__EMSCRIPTEN__)
+  return absl::UnimplementedError("Memory-mapped files are not supported");
+#else
+  std::error_code ec;
+  const auto file_size = std::filesystem::file_size(path, ec);
+  if (ec) {
+    return absl::NotFoundError(absl::StrFormat("Cannot stat %s: %s",
+                                               path.string(), ec.message()));
+  }
+  if (file_size == 0) {
+    return absl::InvalidArgumentError(
+        absl::StrFormat("Cannot map empty file %s", path.string()));
+  }
+
+  std::shared_ptr<MappedFile> mapped(new MappedFile());
+  mapped->size_ = static_cast<size_t>(file_size);
+
+#if defined(_WIN32)
+  HANDLE file =
+      CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ,
+                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return absl::NotFoundError(
+        absl::StrFormat("Cannot open %s for mapping", path.string()));
+  }
+  HANDLE mapping =
+      CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (mapping == nullptr) {
+    return absl::InternalError(
+        absl::StrFormat("CreateFileMapping failed for %s", path.string()));
+  }
+  void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (view == nullptr) {
+    CloseHandle(mapping);
+    return absl::InternalError(
+        absl::StrFormat("MapViewOfFile failed for %s", path.string()));
+  }
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  mapped->mapping_handle_ = mapping;
+  mapped->data_ = static_cast<const uint8_t*>(view);
+  mapped->mapped_size_ = RoundUp(mapped->size_, info.dwPageSize);
+#else
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return absl::NotFoundError(
+        absl::StrFormat("Cannot open %s for mapping", path.string()));
+  }
+  void* view = mmap(nullptr, mapped->size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  (void)close(fd);
+  if (view == MAP_FAILED) {
+    return absl::InternalError(
+        absl::StrFormat("mmap failed for %s", path.string()));
+  }
+  mapped->data_ = static_cast<const uint8_t*>(view);
+  mapped->mapped_size_ =
+      RoundUp(mapped->size_, static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+#endif
+  return std::shared_ptr<const MappedFile>(std::move(mapped));
+#endif  // __EMSCRIPTEN__
+}
+
+MappedFile::~MappedFile() {
+  if (data_ == nullptr) {
+    return;
+  }
+#if defined(_WIN32)
+  UnmapViewOfFile(data_);
+  CloseHandle(mapping_handle_);
+#elif !defined(__EMSCRIPTEN__)
+  munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+}
+
+}  // namespace util
+}  // namespace yaze
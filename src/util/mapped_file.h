@@ -0,0 +1,53 @@
+#ifndef YAZE_UTIL_MAPPED_FILE_H_
+#define YAZE_UTIL_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+#include "absl/status/statusor.h"
+
+namespace yaze {
+namespace util {
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file
+ *
+ * The mapping is private and read-only; writing through it faults. Bytes past
+ * the end of the file up to mapped_size() are readable zeros (the OS fills
+ * the last page), which lets callers alias fixed-size blocks that straddle
+ * EOF. Unavailable on Emscripten, where Open() returns Unimplemented.
+ */
+class MappedFile {
+ public:
+  static absl::StatusOr<std::shared_ptr<const MappedFile>> Open(
+      const std::filesystem::path& path);
+
+  ~MappedFile();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const uint8_t* data() const { return data_; }
+  size_t size() const { return size_; }
+  // Readable length, size() rounded up to the system page size.
+  size_t mapped_size() const { return mapped_size_; }
+  std::span<const uint8_t> bytes() const { return {data_, size_}; }
+
+ private:
+  MappedFile() = default;
+
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+  size_t mapped_size_ = 0;
+#if defined(_WIN32)
+  void* mapping_handle_ = nullptr;
+#endif
+};
+
+}  // namespace util
+}  // namespace yaze
+
+#endif  // YAZE_UTIL_MAPPED_FILE_H_
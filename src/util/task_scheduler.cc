@@ -0,0 +1,241 @@
+#include "util/task_scheduler.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace yaze {
+namespace util {
+
+namespace {
+
+thread_local const TaskScheduler* current_scheduler = nullptr;
+thread_local int current_worker = -1;
+
+int DefaultWorkerCount() {
+#ifdef __EMSCRIPTEN__
+  // Browser threads are Web Workers and blocking the main thread on them is
+  // unsafe; run tasks inline on the waiting thread instead.
+  return 0;
+#else
+  const int hardware = static_cast<int>(std::thread::hardware_concurrency());
+  return std::max(hardware - 1, 1);
+#endif
+}
+
+}  // namespace
+
+TaskScheduler& TaskScheduler::Get() {
+  static TaskScheduler instance(DefaultWorkerCount());
+  return instance;
+}
+
+TaskScheduler::TaskScheduler(int worker_count) {
+  for (int i = 0; i < worker_count; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  // Start threads only once every deque exists; workers steal from all.
+  for (int i = 0; i < worker_count; ++i) {
+    workers_[i]->thread = std::thread(&TaskScheduler::WorkerLoop, this, i);
+  }
+}
+
+TaskScheduler::~TaskScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (auto& worker : workers_) {
+    if (worker->thread.joinable()) {
+      worker->thread.join();
+    }
+  }
+}
+
+int TaskScheduler::CurrentWorkerIndex() const {
+  return current_scheduler == this ? current_worker : -1;
+}
+
+void TaskScheduler::Submit(Task task, TaskPriority priority) {
+  const int self = CurrentWorkerIndex();
+  if (priority == TaskPriority::kNormal && self >= 0) {
+    Worker& worker = *workers_[self];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.push_back(std::move(task));
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (priority != TaskPriority::kNormal || self < 0) {
+      shared_[static_cast<int>(priority)].push_back(std::move(task));
+    }
+    queued_.fetch_add(1);
+  }
+  wake_.notify_one();
+}
+
+std::optional<TaskScheduler::Task> TaskScheduler::TakeShared(
+    TaskPriority priority) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& queue = shared_[static_cast<int>(priority)];
+  if (queue.empty()) {
+    return std::nullopt;
+  }
+  Task task = std::move(queue.front());
+  queue.pop_front();
+  return task;
+}
+
+std::optional<TaskScheduler::Task> TaskScheduler::Take(int self) {
+  if (auto task = TakeShared(TaskPriority::kHigh)) {
+    return task;
+  }
+  if (self >= 0) {
+    Worker& worker = *workers_[self];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (!worker.tasks.empty()) {
+      Task task = std::move(worker.tasks.back());
+      worker.tasks.pop_back();
+      return task;
+    }
+  }
+  if (auto task = TakeShared(TaskPriority::kNormal)) {
+    return task;
+  }
+  // Steal the oldest task from the next busy worker.
+  const int count = worker_count();
+  for (int i = 1; i <= count; ++i) {
+    const int victim = (std::max(self, 0) + i) % count;
+    if (victim == self) {
+      continue;
+    }
+    Worker& worker = *workers_[victim];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (!worker.tasks.empty()) {
+      Task task = std::move(worker.tasks.front());
+      worker.tasks.pop_front();
+      return task;
+    }
+  }
+  return TakeShared(TaskPriority::kLow);
+}
+
+bool TaskScheduler::RunOne() {
+  auto task = Take(CurrentWorkerIndex());
+  if (!task) {
+    return false;
+  }
+  queued_.fetch_sub(1);
+
+  TaskGroup* group = task->group;
+  absl::Status status;
+  if (!group->cancelled()) {
+    // Release captures before the group can be seen as finished.
+    auto fn = std::move(task->fn);
+    status = fn();
+  }
+  group->Finish(std::move(status));
+  return true;
+}
+
+void TaskScheduler::NotifyAll() {
+  // Taking the lock orders this with a sleeper's predicate check.
+  { std::lock_guard<std::mutex> lock(mutex_); }
+  wake_.notify_all();
+}
+
+void TaskScheduler::WorkerLoop(int index) {
+  current_scheduler = this;
+  current_worker = index;
+  while (true) {
+    if (RunOne()) {
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.wait(lock, [this] { return stopping_ || queued_.load() > 0; });
+    if (stopping_) {
+      return;
+    }
+  }
+}
+
+TaskGroup::TaskGroup(TaskPriority priority)
+    : TaskGroup(TaskScheduler::Get(), priority) {}
+
+TaskGroup::TaskGroup(TaskScheduler& scheduler, TaskPriority priority)
+    : scheduler_(scheduler), priority_(priority) {}
+
+TaskGroup::~TaskGroup() {
+  Wait().IgnoreError();
+}
+
+void TaskGroup::Run(std::function<absl::Status()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++total_;
+  }
+  pending_.fetch_add(1);
+  scheduler_.Submit({this, std::move(task)}, priority_);
+}
+
+void TaskGroup::RunEach(int count, std::function<absl::Status(int)> task) {
+  auto shared = std::make_shared<std::function<absl::Status(int)>>(
+      std::move(task));
+  for (int i = 0; i < count; ++i) {
+    Run([shared, i]() { return (*shared)(i); });
+  }
+}
+
+void TaskGroup::SetProgressCallback(
+    std::function<void(int completed, int total)> cb) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  progress_ = std::move(cb);
+}
+
+void TaskGroup::Cancel() {
+  cancelled_.store(true, std::memory_order_relaxed);
+}
+
+void TaskGroup::Finish(absl::Status status) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!status.ok() && status_.ok()) {
+      status_ = std::move(status);
+      Cancel();
+    }
+    ++completed_;
+    if (progress_) {
+      progress_(completed_, total_);
+    }
+  }
+  // The waiter may destroy this group once pending_ reaches zero.
+  TaskScheduler& scheduler = scheduler_;
+  if (pending_.fetch_sub(1) == 1) {
+    scheduler.NotifyAll();
+  }
+}
+
+absl::Status TaskGroup::Wait() {
+  while (pending_.load() > 0) {
+    if (scheduler_.RunOne()) {
+      continue;
+    }
+    // Everything left is running elsewhere; sleep until it finishes or more
+    // work shows up to help with.
+    std::unique_lock<std::mutex> lock(scheduler_.mutex_);
+    scheduler_.wake_.wait(lock, [this] {
+      return pending_.load() == 0 || scheduler_.queued_.load() > 0;
+    });
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!status_.ok()) {
+    return status_;
+  }
+  if (cancelled()) {
+    return absl::CancelledError("Task group cancelled");
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace util
+}  // namespace yaze
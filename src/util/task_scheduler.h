@@ -0,0 +1,140 @@
+#ifndef YAZE_UTIL_TASK_SCHEDULER_H_
+#define YAZE_UTIL_TASK_SCHEDULER_H_
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "absl/status/status.h"
+
+namespace yaze {
+namespace util {
+
+enum class TaskPriority { kLow, kNormal, kHigh };
+
+class TaskGroup;
+
+/**
+ * @class TaskScheduler
+ * @brief Work-stealing thread pool shared by the ROM loaders
+ *
+ * Each worker owns a deque. Normal-priority tasks submitted from a worker go
+ * to the back of its own deque and are popped LIFO; idle workers steal from
+ * the front of the others. Tasks submitted from outside the pool, and high or
+ * low priority tasks, go to shared queues: high-priority tasks run before any
+ * local work and low-priority tasks only when nothing else is queued.
+ *
+ * Work is submitted through a TaskGroup. A thread waiting on a group runs
+ * queued tasks until the group drains, so groups may nest (a task may wait
+ * on a group of its own) without tying up workers. With zero workers, as on
+ * Emscripten, every task runs on the thread that waits for it.
+ */
+class TaskScheduler {
+ public:
+  // Process-wide pool: one worker per hardware thread, minus the thread that
+  // waits. Started on first use.
+  static TaskScheduler& Get();
+
+  explicit TaskScheduler(int worker_count);
+  ~TaskScheduler();
+  TaskScheduler(const TaskScheduler&) = delete;
+  TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+  int worker_count() const { return static_cast<int>(workers_.size()); }
+
+ private:
+  friend class TaskGroup;
+
+  struct Task {
+    TaskGroup* group = nullptr;
+    std::function<absl::Status()> fn;
+  };
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+    std::thread thread;
+  };
+
+  void Submit(Task task, TaskPriority priority);
+  // Runs one queued task on the calling thread; false when none is queued.
+  bool RunOne();
+  std::optional<Task> Take(int self);
+  std::optional<Task> TakeShared(TaskPriority priority);
+  int CurrentWorkerIndex() const;
+  void WorkerLoop(int index);
+  // Wakes threads sleeping in WorkerLoop() or TaskGroup::Wait().
+  void NotifyAll();
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+
+  // Guards shared_ and stopping_; wake_ signals new work or a drained group.
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::array<std::deque<Task>, 3> shared_;
+  bool stopping_ = false;
+  // Tasks in any queue. May briefly run ahead of the queues themselves.
+  std::atomic<int> queued_{0};
+};
+
+/**
+ * @class TaskGroup
+ * @brief A batch of tasks on a TaskScheduler that is waited on together
+ *
+ * The first task to fail cancels the rest of the group: queued tasks are
+ * skipped and Wait() returns that error. Running tasks can poll cancelled()
+ * to stop early. The destructor waits, so tasks may capture locals of the
+ * scope that owns the group.
+ */
+class TaskGroup {
+ public:
+  explicit TaskGroup(TaskPriority priority = TaskPriority::kNormal);
+  TaskGroup(TaskScheduler& scheduler, TaskPriority priority);
+  ~TaskGroup();
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+
+  void Run(std::function<absl::Status()> task);
+  // Queues task(0) .. task(count - 1) as separate tasks.
+  void RunEach(int count, std::function<absl::Status(int)> task);
+
+  // Called after each task finishes or is skipped, with the number done so
+  // far and the number queued. Calls are serialized but may come from any
+  // thread, including a worker.
+  void SetProgressCallback(std::function<void(int completed, int total)> cb);
+
+  void Cancel();
+  bool cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+  // Runs queued tasks until every task in the group has finished. Returns the
+  // first error, or Cancelled if Cancel() was called.
+  absl::Status Wait();
+
+ private:
+  friend class TaskScheduler;
+
+  void Finish(absl::Status status);
+
+  TaskScheduler& scheduler_;
+  const TaskPriority priority_;
+  std::atomic<int> pending_{0};
+  std::atomic<bool> cancelled_{false};
+
+  // Guards the fields below.
+  std::mutex mutex_;
+  absl::Status status_;
+  int completed_ = 0;
+  int total_ = 0;
+  std::function<void(int, int)> progress_;
+};
+
+}  // namespace util
+}  // namespace yaze
+
+#endif  // YAZE_UTIL_TASK_SCHEDULER_H_
@@ -18,7 +18,9 @@ set(YAZE_UTIL_SRC
   util/log.cc
   util/platform_paths.cc
   util/file_util.cc
+  util/mapped_file.cc
   util/rom_hash.cc
+  util/task_scheduler.cc
   util/hyrule_magic.cc  # Byte order utilities (moved from zelda3)
   util/i18n/translator.cc       # Runtime string translation (tr)
   util/i18n/language_manager.cc # Locale catalogs + active-language state
@@ -26,6 +28,13 @@ set(YAZE_UTIL_SRC
 
 add_library(yaze_util STATIC ${YAZE_UTIL_SRC})
 
+# miniz (public domain, single-file zlib/zip library). Shared by snapshot
+# compression (yaze_net) and bundle pack/unpack (yaze_cli_core), so it is
+# built once here instead of per consumer.
+add_library(yaze_miniz STATIC ${CMAKE_SOURCE_DIR}/ext/miniz/miniz.c)
+target_include_directories(yaze_miniz PUBLIC ${CMAKE_SOURCE_DIR}/ext/miniz)
+set_target_properties(yaze_miniz PROPERTIES POSITION_INDEPENDENT_CODE ON)
+
 # Note: PCH disabled for yaze_util to avoid circular dependency with Abseil
 # The log.h header requires Abseil, but Abseil is built after yaze_util
 # in the dependency chain. We could re-enable PCH after refactoring the
@@ -48,6 +57,10 @@ target_link_libraries(yaze_util PUBLIC
   yaze_common
 )
 
+# TaskScheduler owns the process-wide worker threads
+find_package(Threads REQUIRED)
+target_link_libraries(yaze_util PUBLIC Threads::Threads)
+
 # Add Abseil dependencies
 # When gRPC is enabled, we link to grpc++ which transitively provides Abseil
 # When gRPC is disabled, we use the standalone Abseil from absl.cmake
@@ -15,6 +15,7 @@
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "rom/snes.h"
+#include "util/task_scheduler.h"
 #include "zelda3/dungeon/dungeon_rom_addresses.h"
 #include "zelda3/dungeon/room.h"
 
@@ -142,6 +143,20 @@ absl::StatusOr<CustomCollisionMap> LoadCustomCollisionMap(Rom* rom,
   return result;
 }
 
+std::vector<absl::StatusOr<CustomCollisionMap>> LoadCustomCollisionMaps(
+    Rom* rom, const std::vector<int>& room_ids) {
+  std::vector<absl::StatusOr<CustomCollisionMap>> maps(
+      room_ids.size(), absl::UnknownError("Collision map not loaded"));
+  util::TaskGroup group;
+  group.RunEach(static_cast<int>(room_ids.size()), [&](int i) {
+    maps[i] = LoadCustomCollisionMap(rom, room_ids[i]);
+    return absl::OkStatus();
+  });
+  // Per-room failures live in `maps`; the tasks themselves never fail.
+  group.Wait().IgnoreError();
+  return maps;
+}
+
 absl::StatusOr<std::string> DumpCustomCollisionRoomsToJsonString(
     const std::vector<CustomCollisionRoomEntry>& rooms) {
 #if !defined(YAZE_WITH_JSON)
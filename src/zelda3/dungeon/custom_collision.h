@@ -22,6 +22,12 @@ struct CustomCollisionMap {
 absl::StatusOr<CustomCollisionMap> LoadCustomCollisionMap(Rom* rom,
                                                           int room_id);
 
+// Load the maps of many rooms, decoding them in parallel on the shared
+// util::TaskScheduler. Entry i is what LoadCustomCollisionMap returns for
+// room_ids[i], so one bad pointer does not hide the other rooms.
+std::vector<absl::StatusOr<CustomCollisionMap>> LoadCustomCollisionMaps(
+    Rom* rom, const std::vector<int>& room_ids);
+
 struct CustomCollisionTileEntry {
   uint16_t offset = 0;  // Y*64 + X (0..4095)
   uint8_t value = 0;    // Collision type (0..255). 0 typically means "unset".
@@ -10,32 +10,18 @@ namespace draw_routines {
 void DrawDownwards2x2_1to15or32(const DrawContext& ctx) {
   // Pattern: Draws 2x2 tiles downward (object 0x60)
   // Size byte determines how many times to repeat (1-15 or 32)
+  // Tiles are COLUMN-MAJOR (matching assembly). Assembly uses indirect
+  // pointers: $BF, $CB, $C2, $CE
+  // tiles[0] → $BF → (col 0, row 0) = top-left
+  // tiles[1] → $CB → (col 0, row 1) = bottom-left
+  // tiles[2] → $C2 → (col 1, row 0) = top-right
+  // tiles[3] → $CE → (col 1, row 1) = bottom-right
   int size = ctx.object.size_;
   if (size == 0)
     size = 32;  // Special case for object 0x60
 
-  for (int s = 0; s < size; s++) {
-    if (ctx.tiles.size() >= 4) {
-      // Draw 2x2 pattern in COLUMN-MAJOR order (matching assembly)
-      // Assembly uses indirect pointers: $BF, $CB, $C2, $CE
-      // tiles[0] → $BF → (col 0, row 0) = top-left
-      // tiles[1] → $CB → (col 0, row 1) = bottom-left
-      // tiles[2] → $C2 → (col 1, row 0) = top-right
-      // tiles[3] → $CE → (col 1, row 1) = bottom-right
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_,
-                                   ctx.object.y_ + (s * 2),
-                                   ctx.tiles[0]);  // col 0, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_,
-                                   ctx.object.y_ + (s * 2) + 1,
-                                   ctx.tiles[1]);  // col 0, row 1
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 1,
-                                   ctx.object.y_ + (s * 2),
-                                   ctx.tiles[2]);  // col 1, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 1,
-                                   ctx.object.y_ + (s * 2) + 1,
-                                   ctx.tiles[3]);  // col 1, row 1
-    }
-  }
+  DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kDownwards, 2, 2>(
+      ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, size, 2);
 }
 
 void DrawDownwards4x2_1to15or26(const DrawContext& ctx) {
@@ -45,38 +31,15 @@ void DrawDownwards4x2_1to15or26(const DrawContext& ctx) {
   if (size == 0)
     size = 26;  // Special case
 
-  for (int s = 0; s < size; s++) {
-    if (ctx.tiles.size() >= 8) {
-      // Draw 4x2 pattern in ROW-MAJOR order (matching ZScream)
-      // Row 0: tiles 0, 1, 2, 3 at x+0, x+1, x+2, x+3
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_,
-                                   ctx.object.y_ + (s * 2), ctx.tiles[0]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 1,
-                                   ctx.object.y_ + (s * 2), ctx.tiles[1]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 2,
-                                   ctx.object.y_ + (s * 2), ctx.tiles[2]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 3,
-                                   ctx.object.y_ + (s * 2), ctx.tiles[3]);
-      // Row 1: tiles 4, 5, 6, 7 at x+0, x+1, x+2, x+3
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_,
-                                   ctx.object.y_ + (s * 2) + 1, ctx.tiles[4]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 1,
-                                   ctx.object.y_ + (s * 2) + 1, ctx.tiles[5]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 2,
-                                   ctx.object.y_ + (s * 2) + 1, ctx.tiles[6]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 3,
-                                   ctx.object.y_ + (s * 2) + 1, ctx.tiles[7]);
-    } else if (ctx.tiles.size() >= 4) {
-      // Fallback: with 4 tiles draw 4x1 row pattern
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_,
-                                   ctx.object.y_ + (s * 2), ctx.tiles[0]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 1,
-                                   ctx.object.y_ + (s * 2), ctx.tiles[1]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 2,
-                                   ctx.object.y_ + (s * 2), ctx.tiles[2]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 3,
-                                   ctx.object.y_ + (s * 2), ctx.tiles[3]);
-    }
+  if (ctx.tiles.size() >= 8) {
+    DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kDownwards, 4, 2,
+                                        TileOrder::kRowMajor>(
+        ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, size, 2);
+  } else {
+    // Fallback: with 4 tiles draw 4x1 row pattern
+    DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kDownwards, 4, 1,
+                                        TileOrder::kRowMajor>(
+        ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, size, 2);
   }
 }
 
@@ -85,92 +48,39 @@ void DrawDownwards4x2_1to16_BothBG(const DrawContext& ctx) {
   // is the zero-based repeat count. ObjectDrawer dispatches this routine once
   // per background because the registry marks it as a BothBG writer.
   const int count = (ctx.object.size_ & 0x0F) + 1;
-  if (ctx.tiles.size() < 8) {
-    return;
-  }
-
-  for (int s = 0; s < count; ++s) {
-    const int y = ctx.object.y_ + (s * 2);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_, y, ctx.tiles[0]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 1, y,
-                                 ctx.tiles[1]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 2, y,
-                                 ctx.tiles[2]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 3, y,
-                                 ctx.tiles[3]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_, y + 1,
-                                 ctx.tiles[4]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 1, y + 1,
-                                 ctx.tiles[5]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 2, y + 1,
-                                 ctx.tiles[6]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 3, y + 1,
-                                 ctx.tiles[7]);
-  }
+  DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kDownwards, 4, 2,
+                                      TileOrder::kRowMajor>(
+      ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, count, 2);
 }
 
 void DrawDownwardsDecor4x2spaced4_1to16(const DrawContext& ctx) {
   // Pattern: Draws 4x2 decoration downward with spacing (objects 0x65-0x66)
   // This is 4 columns × 2 rows = 8 tiles in ROW-MAJOR order with 6-tile Y
-  // spacing.
+  // spacing: Row 0: tiles[0..3], Row 1: tiles[4..7].
   int size = ctx.object.size_ & 0x0F;
 
   // Assembly: GetSize_1to16, so count = size + 1
   int count = size + 1;
 
-  for (int s = 0; s < count; s++) {
-    if (ctx.tiles.size() >= 8) {
-      // Draw 4x2 pattern in ROW-MAJOR order:
-      // Row 0: tiles[0..3], Row 1: tiles[4..7].
-      const int base_y = ctx.object.y_ + (s * 6);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_, base_y,
-                                   ctx.tiles[0]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 1, base_y,
-                                   ctx.tiles[1]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 2, base_y,
-                                   ctx.tiles[2]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 3, base_y,
-                                   ctx.tiles[3]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_, base_y + 1,
-                                   ctx.tiles[4]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 1, base_y + 1,
-                                   ctx.tiles[5]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 2, base_y + 1,
-                                   ctx.tiles[6]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 3, base_y + 1,
-                                   ctx.tiles[7]);
-    }
-  }
+  DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kDownwards, 4, 2,
+                                      TileOrder::kRowMajor>(
+      ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, count, 6);
 }
 
 void DrawDownwards2x2_1to16(const DrawContext& ctx) {
   // Pattern: Draws 2x2 tiles downward (objects 0x67-0x68)
+  // Tiles are COLUMN-MAJOR (matching assembly):
+  // tiles[0] → col 0, row 0 = top-left
+  // tiles[1] → col 0, row 1 = bottom-left
+  // tiles[2] → col 1, row 0 = top-right
+  // tiles[3] → col 1, row 1 = bottom-right
   int size = ctx.object.size_ & 0x0F;
 
   // Assembly: GetSize_1to16, so count = size + 1
   int count = size + 1;
 
-  for (int s = 0; s < count; s++) {
-    if (ctx.tiles.size() >= 4) {
-      // Draw 2x2 pattern in COLUMN-MAJOR order (matching assembly)
-      // tiles[0] → col 0, row 0 = top-left
-      // tiles[1] → col 0, row 1 = bottom-left
-      // tiles[2] → col 1, row 0 = top-right
-      // tiles[3] → col 1, row 1 = bottom-right
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_,
-                                   ctx.object.y_ + (s * 2),
-                                   ctx.tiles[0]);  // col 0, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_,
-                                   ctx.object.y_ + (s * 2) + 1,
-                                   ctx.tiles[1]);  // col 0, row 1
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 1,
-                                   ctx.object.y_ + (s * 2),
-                                   ctx.tiles[2]);  // col 1, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + 1,
-                                   ctx.object.y_ + (s * 2) + 1,
-                                   ctx.tiles[3]);  // col 1, row 1
-    }
-  }
+  DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kDownwards, 2, 2>(
+      ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, count, 2);
 }
 
 void DrawDownwardsHasEdge1x1_1to16_plus3(const DrawContext& ctx) {
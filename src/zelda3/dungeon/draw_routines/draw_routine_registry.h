@@ -1,8 +1,8 @@
 #ifndef YAZE_ZELDA3_DUNGEON_DRAW_ROUTINES_DRAW_ROUTINE_REGISTRY_H
 #define YAZE_ZELDA3_DUNGEON_DRAW_ROUTINES_DRAW_ROUTINE_REGISTRY_H
 
+#include <array>
 #include <cstdint>
-#include <unordered_map>
 #include <vector>
 
 #include "zelda3/dungeon/draw_routines/draw_routine_types.h"
@@ -183,6 +183,9 @@ constexpr int kActual4x4 = 116;
 // Custom object routine.
 constexpr int kCustomObject = 130;
 
+// One past the highest routine ID; sizes routine-indexed tables.
+constexpr int kRoutineCount = kVitreousGooDamage + 1;
+
 }  // namespace DrawRoutineIds
 
 /**
@@ -221,13 +224,59 @@ class DrawRoutineRegistry {
   int GetRoutineIdForObject(int16_t object_id) const;
 
  private:
+  /**
+   * @brief Object ID -> routine ID, as flat per-subtype tables
+   *
+   * Every object the drawer, geometry and validation paths touch goes through
+   * this lookup, so it is a range check and an array index rather than a hash.
+   * Subtype 1 covers 0x000-0x0FF, subtype 2 0x100-0x13F and subtype 3
+   * 0xF80-0xFFF; unmapped slots hold -1.
+   */
+  class ObjectRoutineTable {
+   public:
+    ObjectRoutineTable() { Clear(); }
+    void Clear() { routines_.fill(-1); }
+    void Set(int object_id, int routine_id) {
+      if (const int index = Index(object_id); index >= 0) {
+        routines_[index] = static_cast<int16_t>(routine_id);
+      }
+    }
+    int Find(int object_id) const {
+      const int index = Index(object_id);
+      return index >= 0 ? routines_[index] : -1;
+    }
+
+   private:
+    static constexpr int kSubtype1Count = 0x100;
+    static constexpr int kSubtype2Count = 0x40;
+    static constexpr int kSubtype3Count = 0x80;
+
+    // Subtype tables stored back to back: [subtype 1][subtype 2][subtype 3].
+    static int Index(int object_id) {
+      if (object_id >= 0 && object_id < 0x100) {
+        return object_id;
+      }
+      if (object_id >= 0x100 && object_id < 0x140) {
+        return kSubtype1Count + (object_id - 0x100);
+      }
+      if (object_id >= 0xF80 && object_id < 0x1000) {
+        return kSubtype1Count + kSubtype2Count + (object_id - 0xF80);
+      }
+      return -1;
+    }
+
+    std::array<int16_t, kSubtype1Count + kSubtype2Count + kSubtype3Count>
+        routines_;
+  };
+
   DrawRoutineRegistry() = default;
   void BuildRegistry();
   void BuildObjectMapping();
 
   std::vector<DrawRoutineInfo> routines_;
-  std::unordered_map<int, const DrawRoutineInfo*> routine_map_;
-  std::unordered_map<int16_t, int> object_to_routine_map_;
+  // Indexed by routine ID; null for IDs with no registered routine.
+  std::vector<const DrawRoutineInfo*> routines_by_id_;
+  ObjectRoutineTable object_to_routine_map_;
   bool initialized_ = false;
 };
 
@@ -1,8 +1,8 @@
 #ifndef YAZE_ZELDA3_DUNGEON_DRAW_ROUTINES_DRAW_ROUTINE_TYPES_H
 #define YAZE_ZELDA3_DUNGEON_DRAW_ROUTINES_DRAW_ROUTINE_TYPES_H
 
+#include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <initializer_list>
 #include <span>
 #include <string>
@@ -48,8 +48,10 @@ struct DrawContext {
  *
  * All draw routines are static functions with this signature.
  * They receive all context via DrawContext and write tiles to target_bg.
+ * Routines never capture state, so a plain function pointer is enough and
+ * dispatch stays a single indirect call.
  */
-using DrawRoutineFn = std::function<void(const DrawContext& ctx)>;
+using DrawRoutineFn = void (*)(const DrawContext& ctx);
 
 /**
  * @brief Metadata about a draw routine
@@ -79,6 +81,10 @@ struct DrawRoutineInfo {
   Category category;
 };
 
+// Shape parameters for DrawRoutineUtils::DrawRepeatedBlock.
+enum class RepeatDirection : uint8_t { kRightwards, kDownwards };
+enum class TileOrder : uint8_t { kColumnMajor, kRowMajor };
+
 /**
  * @brief Utility functions for tile writing used by all routines
  */
@@ -91,6 +97,16 @@ using TraceHookFn = void (*)(gfx::BackgroundBuffer* bg, int tile_x, int tile_y,
 void SetTraceHook(TraceHookFn hook, void* user_data, bool trace_only);
 void ClearTraceHook();
 
+namespace internal {
+struct TraceState {
+  TraceHookFn hook = nullptr;
+  void* user_data = nullptr;
+  bool trace_only = false;
+};
+// Lives in the header so WriteTile8 can inline into routine loops.
+inline thread_local TraceState g_trace_state;
+}  // namespace internal
+
 inline uint16_t TileIdAt(const gfx::BackgroundBuffer& bg, int tile_x,
                          int tile_y) {
   return bg.GetTileAt(tile_x, tile_y) & 0x03FF;
@@ -124,8 +140,58 @@ inline bool IsValidTilePosition(int tile_x, int tile_y) {
  * @param tile_y Tile Y coordinate (0-63)
  * @param tile_info Tile information (ID, palette, flip flags)
  */
-void WriteTile8(gfx::BackgroundBuffer& bg, int tile_x, int tile_y,
-                const gfx::TileInfo& tile_info);
+inline void WriteTile8(gfx::BackgroundBuffer& bg, int tile_x, int tile_y,
+                       const gfx::TileInfo& tile_info) {
+  if (!IsValidTilePosition(tile_x, tile_y)) {
+    return;
+  }
+  const auto& trace = internal::g_trace_state;
+  if (trace.hook) {
+    trace.hook(&bg, tile_x, tile_y, tile_info, trace.user_data);
+    if (trace.trace_only) {
+      return;
+    }
+  }
+  bg.SetTileAt(tile_x, tile_y, gfx::TileInfoToWord(tile_info));
+}
+
+/**
+ * @brief Draw a kCols x kRows block @p count times, @p step tiles apart
+ *
+ * Shared inner loop of the RoomDraw_*_1to16 family. Block shape, direction
+ * and tile order are template parameters so the per-tile loop fully unrolls
+ * around WriteTile8. Tiles are written in the same order the hand-written
+ * routines used (column by column for kColumnMajor, row by row otherwise).
+ * Draws nothing when @p tiles holds fewer than kCols * kRows entries.
+ */
+template <RepeatDirection kDirection, int kCols, int kRows,
+          TileOrder kOrder = TileOrder::kColumnMajor>
+inline void DrawRepeatedBlock(gfx::BackgroundBuffer& bg, int tile_x,
+                              int tile_y, std::span<const gfx::TileInfo> tiles,
+                              int count, int step) {
+  if (tiles.size() < static_cast<size_t>(kCols * kRows)) {
+    return;
+  }
+  for (int s = 0; s < count; ++s) {
+    const int x =
+        tile_x + (kDirection == RepeatDirection::kRightwards ? s * step : 0);
+    const int y =
+        tile_y + (kDirection == RepeatDirection::kDownwards ? s * step : 0);
+    if constexpr (kOrder == TileOrder::kColumnMajor) {
+      for (int col = 0; col < kCols; ++col) {
+        for (int row = 0; row < kRows; ++row) {
+          WriteTile8(bg, x + col, y + row, tiles[col * kRows + row]);
+        }
+      }
+    } else {
+      for (int row = 0; row < kRows; ++row) {
+        for (int col = 0; col < kCols; ++col) {
+          WriteTile8(bg, x + col, y + row, tiles[row * kCols + col]);
+        }
+      }
+    }
+  }
+}
 
 /**
  * @brief Draw a 2x2 block of tiles (16x16 pixels)
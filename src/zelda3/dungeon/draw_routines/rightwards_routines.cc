@@ -11,31 +11,16 @@ void DrawRightwards2x2_1to15or32(const DrawContext& ctx) {
   // Pattern: Draws 2x2 tiles rightward (object 0x00)
   // Size byte determines how many times to repeat (1-15 or 32)
   // ROM tile order is COLUMN-MAJOR: [col0_row0, col0_row1, col1_row0, col1_row1]
+  // tiles[0] → $BF → (col 0, row 0) = top-left
+  // tiles[1] → $CB → (col 0, row 1) = bottom-left
+  // tiles[2] → $C2 → (col 1, row 0) = top-right
+  // tiles[3] → $CE → (col 1, row 1) = bottom-right
   int size = ctx.object.size_;
   if (size == 0)
     size = 32;  // Special case for object 0x00
 
-  for (int s = 0; s < size; s++) {
-    if (ctx.tiles.size() >= 4) {
-      // Draw 2x2 pattern in COLUMN-MAJOR order (matching assembly)
-      // tiles[0] → $BF → (col 0, row 0) = top-left
-      // tiles[1] → $CB → (col 0, row 1) = bottom-left
-      // tiles[2] → $C2 → (col 1, row 0) = top-right
-      // tiles[3] → $CE → (col 1, row 1) = bottom-right
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_,
-                                   ctx.tiles[0]);  // col 0, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 1,
-                                   ctx.tiles[1]);  // col 0, row 1
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2) + 1,
-                                   ctx.object.y_,
-                                   ctx.tiles[2]);  // col 1, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2) + 1,
-                                   ctx.object.y_ + 1,
-                                   ctx.tiles[3]);  // col 1, row 1
-    }
-  }
+  DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kRightwards, 2, 2>(
+      ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, size, 2);
 }
 
 void DrawRightwards2x4_1to15or26(const DrawContext& ctx) {
@@ -46,46 +31,13 @@ void DrawRightwards2x4_1to15or26(const DrawContext& ctx) {
   if (size == 0)
     size = 26;  // Special case
 
-  for (int s = 0; s < size; s++) {
-    if (ctx.tiles.size() >= 8) {
-      // Draw 2x4 pattern in COLUMN-MAJOR order (matching RoomDraw_Nx4)
-      // Column 0 (tiles 0-3)
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_,
-                                   ctx.tiles[0]);  // col 0, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 1,
-                                   ctx.tiles[1]);  // col 0, row 1
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 2,
-                                   ctx.tiles[2]);  // col 0, row 2
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 3,
-                                   ctx.tiles[3]);  // col 0, row 3
-      // Column 1 (tiles 4-7)
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2) + 1,
-                                   ctx.object.y_,
-                                   ctx.tiles[4]);  // col 1, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2) + 1,
-                                   ctx.object.y_ + 1,
-                                   ctx.tiles[5]);  // col 1, row 1
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2) + 1,
-                                   ctx.object.y_ + 2,
-                                   ctx.tiles[6]);  // col 1, row 2
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2) + 1,
-                                   ctx.object.y_ + 3,
-                                   ctx.tiles[7]);  // col 1, row 3
-    } else if (ctx.tiles.size() >= 4) {
-      // Fallback: with 4 tiles we can only draw 1 column (1x4 pattern)
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_, ctx.tiles[0]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 1, ctx.tiles[1]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 2, ctx.tiles[2]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 3, ctx.tiles[3]);
-    }
+  if (ctx.tiles.size() >= 8) {
+    DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kRightwards, 2, 4>(
+        ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, size, 2);
+  } else {
+    // Fallback: with 4 tiles we can only draw 1 column (1x4 pattern)
+    DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kRightwards, 1, 4>(
+        ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, size, 2);
   }
 }
 
@@ -96,46 +48,13 @@ void DrawRightwards2x4_1to16(const DrawContext& ctx) {
   int size = ctx.object.size_ & 0x0F;
   int count = size + 1;
 
-  for (int s = 0; s < count; s++) {
-    if (ctx.tiles.size() >= 8) {
-      // Draw 2x4 pattern in COLUMN-MAJOR order with adjacent spacing (s * 2)
-      // Column 0 (tiles 0-3)
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_,
-                                   ctx.tiles[0]);  // col 0, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 1,
-                                   ctx.tiles[1]);  // col 0, row 1
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 2,
-                                   ctx.tiles[2]);  // col 0, row 2
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 3,
-                                   ctx.tiles[3]);  // col 0, row 3
-      // Column 1 (tiles 4-7)
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2) + 1,
-                                   ctx.object.y_,
-                                   ctx.tiles[4]);  // col 1, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2) + 1,
-                                   ctx.object.y_ + 1,
-                                   ctx.tiles[5]);  // col 1, row 1
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2) + 1,
-                                   ctx.object.y_ + 2,
-                                   ctx.tiles[6]);  // col 1, row 2
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2) + 1,
-                                   ctx.object.y_ + 3,
-                                   ctx.tiles[7]);  // col 1, row 3
-    } else if (ctx.tiles.size() >= 4) {
-      // Fallback: with 4 tiles we can only draw 1 column (1x4 pattern)
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_, ctx.tiles[0]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 1, ctx.tiles[1]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 2, ctx.tiles[2]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 3, ctx.tiles[3]);
-    }
+  if (ctx.tiles.size() >= 8) {
+    DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kRightwards, 2, 4>(
+        ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, count, 2);
+  } else {
+    // Fallback: with 4 tiles we can only draw 1 column (1x4 pattern)
+    DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kRightwards, 1, 4>(
+        ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, count, 2);
   }
 }
 
@@ -153,40 +72,15 @@ void DrawRightwards2x4_1to16_BothBG(const DrawContext& ctx) {
 
   constexpr int kStepTiles = 6;
 
-  for (int s = 0; s < count; s++) {
-    const int base_x = ctx.object.x_ + (s * kStepTiles);
-
-    if (ctx.tiles.size() >= 8) {
-      // Column 0 (tiles 0-3)
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 0, ctx.object.y_,
-                                   ctx.tiles[0]);  // col 0, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 0, ctx.object.y_ + 1,
-                                   ctx.tiles[1]);  // col 0, row 1
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 0, ctx.object.y_ + 2,
-                                   ctx.tiles[2]);  // col 0, row 2
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 0, ctx.object.y_ + 3,
-                                   ctx.tiles[3]);  // col 0, row 3
-
-      // Column 1 (tiles 4-7)
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 1, ctx.object.y_,
-                                   ctx.tiles[4]);  // col 1, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 1, ctx.object.y_ + 1,
-                                   ctx.tiles[5]);  // col 1, row 1
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 1, ctx.object.y_ + 2,
-                                   ctx.tiles[6]);  // col 1, row 2
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 1, ctx.object.y_ + 3,
-                                   ctx.tiles[7]);  // col 1, row 3
-    } else if (ctx.tiles.size() >= 4) {
-      // Fallback: with 4 tiles we can only draw 1 column (1x4 pattern)
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 0, ctx.object.y_,
-                                   ctx.tiles[0]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 0, ctx.object.y_ + 1,
-                                   ctx.tiles[1]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 0, ctx.object.y_ + 2,
-                                   ctx.tiles[2]);
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 0, ctx.object.y_ + 3,
-                                   ctx.tiles[3]);
-    }
+  if (ctx.tiles.size() >= 8) {
+    DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kRightwards, 2, 4>(
+        ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, count,
+        kStepTiles);
+  } else {
+    // Fallback: with 4 tiles we can only draw 1 column (1x4 pattern)
+    DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kRightwards, 1, 4>(
+        ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, count,
+        kStepTiles);
   }
 }
 
@@ -199,23 +93,8 @@ void DrawRightwards2x2_1to16(const DrawContext& ctx) {
   // GetSize_1to16: count = size + 1
   int count = size + 1;
 
-  for (int s = 0; s < count; s++) {
-    if (ctx.tiles.size() >= 4) {
-      // Draw 2x2 pattern in COLUMN-MAJOR order (matching assembly)
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_,
-                                   ctx.tiles[0]);  // col 0, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2),
-                                   ctx.object.y_ + 1,
-                                   ctx.tiles[1]);  // col 0, row 1
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2) + 1,
-                                   ctx.object.y_,
-                                   ctx.tiles[2]);  // col 1, row 0
-      DrawRoutineUtils::WriteTile8(ctx.target_bg, ctx.object.x_ + (s * 2) + 1,
-                                   ctx.object.y_ + 1,
-                                   ctx.tiles[3]);  // col 1, row 1
-    }
-  }
+  DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kRightwards, 2, 2>(
+      ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, count, 2);
 }
 
 void DrawRightwards1x2_1to16_plus2(const DrawContext& ctx) {
@@ -383,24 +262,14 @@ void DrawRightwardsBottomCorners1x2_1to16_plus13(const DrawContext& ctx) {
 
 void DrawRightwards4x4_1to16(const DrawContext& ctx) {
   // Pattern: 4x4 block rightward (object 0x33)
+  // Tiles are COLUMN-MAJOR, matching the assembly.
   int size = ctx.object.size_ & 0x0F;
 
   // Assembly: GetSize_1to16, so count = size + 1
   int count = size + 1;
 
-  for (int s = 0; s < count; s++) {
-    if (ctx.tiles.size() >= 16) {
-      // Draw 4x4 pattern in COLUMN-MAJOR order (matching assembly)
-      // Iterate columns (x) first, then rows (y) within each column
-      for (int x = 0; x < 4; ++x) {
-        for (int y = 0; y < 4; ++y) {
-          DrawRoutineUtils::WriteTile8(ctx.target_bg,
-                                       ctx.object.x_ + (s * 4) + x,
-                                       ctx.object.y_ + y, ctx.tiles[x * 4 + y]);
-        }
-      }
-    }
-  }
+  DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kRightwards, 4, 4>(
+      ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, count, 4);
 }
 
 void DrawRightwards1x1Solid_1to16_plus3(const DrawContext& ctx) {
@@ -569,31 +438,9 @@ void DrawRightwards4x2_1to16(const DrawContext& ctx) {
   const int size = ctx.object.size_ & 0x0F;
   const int count = size + 1;  // GetSize_1to16
 
-  if (ctx.tiles.size() < 8) {
-    return;
-  }
-
-  for (int s = 0; s < count; ++s) {
-    const int base_x = ctx.object.x_ + (s * 4);
-
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 0, ctx.object.y_,
-                                 ctx.tiles[0]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 1, ctx.object.y_,
-                                 ctx.tiles[1]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 2, ctx.object.y_,
-                                 ctx.tiles[2]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 3, ctx.object.y_,
-                                 ctx.tiles[3]);
-
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 0, ctx.object.y_ + 1,
-                                 ctx.tiles[4]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 1, ctx.object.y_ + 1,
-                                 ctx.tiles[5]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 2, ctx.object.y_ + 1,
-                                 ctx.tiles[6]);
-    DrawRoutineUtils::WriteTile8(ctx.target_bg, base_x + 3, ctx.object.y_ + 1,
-                                 ctx.tiles[7]);
-  }
+  DrawRoutineUtils::DrawRepeatedBlock<RepeatDirection::kRightwards, 4, 2,
+                                      TileOrder::kRowMajor>(
+      ctx.target_bg, ctx.object.x_, ctx.object.y_, ctx.tiles, count, 4);
 }
 
 void DrawRightwardsDecor4x2spaced8_1to16(const DrawContext& ctx) {
@@ -0,0 +1,66 @@
+#include "zelda3/dungeon/dungeon_room_index.h"
+
+#include <cstdint>
+
+#include "absl/status/status.h"
+#include "util/macro.h"
+#include "zelda3/dungeon/dungeon_rom_addresses.h"
+#include "zelda3/dungeon/dungeon_spawn_point.h"
+#include "zelda3/dungeon/room_entrance.h"
+
+namespace yaze {
+namespace zelda3 {
+
+std::vector<int> DungeonRoomIndex::RoomsOf(int dungeon_id) const {
+  auto it = rooms_by_dungeon.find(dungeon_id);
+  if (it == rooms_by_dungeon.end()) {
+    return {};
+  }
+  return std::vector<int>(it->second.begin(), it->second.end());
+}
+
+absl::StatusOr<DungeonRoomIndex> BuildDungeonRoomIndex(const Rom& rom) {
+  if (!rom.is_loaded()) {
+    return absl::FailedPreconditionError("ROM not loaded");
+  }
+  if (rom.size() < kEntranceDungeon + kNumRegularDungeonEntrances) {
+    return absl::OutOfRangeError("ROM too small for the entrance tables");
+  }
+
+  DungeonRoomIndex index;
+  for (int dungeon_id = 0; dungeon_id < kNumVanillaDungeons; ++dungeon_id) {
+    index.rooms_by_dungeon[dungeon_id];
+  }
+
+  // Only the room and dungeon columns matter here, so read them directly
+  // rather than decoding whole RoomEntrance records.
+  const uint8_t* data = rom.data();
+  for (int entrance_id = 0; entrance_id < kNumRegularDungeonEntrances;
+       ++entrance_id) {
+    const int room_id = data[kEntranceRoom + (entrance_id * 2)] |
+                        (data[kEntranceRoom + (entrance_id * 2) + 1] << 8);
+    const int dungeon_id = data[kEntranceDungeon + entrance_id];
+    if (room_id >= kNumberOfRooms) {
+      continue;
+    }
+    index.dungeon_by_room[room_id] = dungeon_id;
+    index.rooms_by_dungeon[dungeon_id].insert(room_id);
+  }
+
+  for (int spawn_id = 0; spawn_id < kNumDungeonSpawnPoints; ++spawn_id) {
+    ASSIGN_OR_RETURN(const auto spawn, DungeonSpawnPoint::Load(rom, spawn_id));
+    const int room_id = spawn.room_id;
+    if (room_id >= kNumberOfRooms) {
+      continue;
+    }
+    index.dungeon_by_room[room_id] = spawn.dungeon_id;
+    if (auto it = index.rooms_by_dungeon.find(spawn.dungeon_id);
+        it != index.rooms_by_dungeon.end()) {
+      it->second.insert(room_id);
+    }
+  }
+  return index;
+}
+
+}  // namespace zelda3
+}  // namespace yaze
@@ -0,0 +1,38 @@
+#ifndef YAZE_ZELDA3_DUNGEON_DUNGEON_ROOM_INDEX_H_
+#define YAZE_ZELDA3_DUNGEON_DUNGEON_ROOM_INDEX_H_
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "rom/rom.h"
+
+namespace yaze {
+namespace zelda3 {
+
+// Dungeons with start/boss room tables in a vanilla ROM (0x00..0x0D).
+constexpr int kNumVanillaDungeons = 14;
+
+// Which rooms belong to which dungeon, as far as the ROM can tell.
+//
+// A room belongs to the dungeon named by any regular entrance or spawn point
+// that leads into it. Rooms only reachable through doors, stairs or pits are
+// not listed. Spawn points add rooms only to vanilla dungeons or dungeons an
+// entrance already names, so a stray spawn record cannot invent a dungeon.
+struct DungeonRoomIndex {
+  // Every vanilla dungeon plus any dungeon an entrance names, possibly empty.
+  std::map<int, std::set<int>> rooms_by_dungeon;
+  // Last entrance or spawn point wins when two disagree.
+  std::map<int, int> dungeon_by_room;
+
+  // Sorted room IDs of a dungeon; empty if the dungeon is unknown.
+  std::vector<int> RoomsOf(int dungeon_id) const;
+};
+
+absl::StatusOr<DungeonRoomIndex> BuildDungeonRoomIndex(const Rom& rom);
+
+}  // namespace zelda3
+}  // namespace yaze
+
+#endif  // YAZE_ZELDA3_DUNGEON_DUNGEON_ROOM_INDEX_H_
@@ -16,6 +16,7 @@
 #include "absl/strings/str_format.h"
 #include "rom/rom.h"
 #include "rom/snes.h"
+#include "rom/write_batch.h"
 #include "rom/write_fence.h"
 #include "util/macro.h"
 #include "util/rom_hash.h"
@@ -646,6 +647,164 @@ void ConsumeInterval(std::vector<DungeonStreamPcRange>* free_intervals,
   *free_intervals = std::move(next);
 }
 
+constexpr uint32_t kNoRepackAnchor = std::numeric_limits<uint32_t>::max();
+
+struct RepackGroup {
+  uint32_t owner_room = 0;
+  std::vector<uint8_t> bytes;
+  std::vector<uint32_t> room_ids;
+  // Source address of an identical stream inside the repack range, and how
+  // many of this group's rooms already point at it.
+  uint32_t anchor = kNoRepackAnchor;
+  uint32_t anchor_rooms = 0;
+  bool keep = false;
+  uint32_t address = 0;
+
+  uint32_t size() const { return static_cast<uint32_t>(bytes.size()); }
+  DungeonStreamPcRange anchor_range() const {
+    return {anchor, anchor + size()};
+  }
+};
+
+// Keeps non-overlapping anchors, preferring the ones that save the most
+// pointer updates. Suffix-shared source streams can keep only one owner.
+void SelectRepackAnchors(std::vector<RepackGroup>& groups) {
+  std::vector<size_t> candidates;
+  for (size_t i = 0; i < groups.size(); ++i) {
+    if (groups[i].anchor != kNoRepackAnchor) {
+      candidates.push_back(i);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(), [&](size_t a, size_t b) {
+    const RepackGroup& ga = groups[a];
+    const RepackGroup& gb = groups[b];
+    return std::make_tuple(gb.anchor_rooms, gb.size(), ga.anchor) <
+           std::make_tuple(ga.anchor_rooms, ga.size(), gb.anchor);
+  });
+  std::vector<DungeonStreamPcRange> kept;
+  for (size_t index : candidates) {
+    const DungeonStreamPcRange range = groups[index].anchor_range();
+    const bool overlaps = std::any_of(
+        kept.begin(), kept.end(),
+        [&](const auto& other) { return Intersects(other, range); });
+    if (!overlaps) {
+      groups[index].keep = true;
+      kept.push_back(range);
+    }
+  }
+}
+
+std::vector<DungeonStreamPcRange> RepackFreeFragments(
+    const std::vector<RepackGroup>& groups, const DungeonStreamPcRange& range) {
+  std::vector<DungeonStreamPcRange> kept;
+  for (const RepackGroup& group : groups) {
+    if (group.keep) {
+      kept.push_back(group.anchor_range());
+    }
+  }
+  return ComplementIntervals({range}, UnionIntervals(std::move(kept)));
+}
+
+// Best-fit-decreasing: each moving payload, largest first, takes the fragment
+// it leaves the smallest gap in. Payloads sharing a fragment are then laid out
+// in owner-room order so plans stay stable across runs. Returns false and
+// fills @p unplaced when some payload has no fragment.
+bool PlaceBestFitDecreasing(std::vector<RepackGroup>& groups,
+                            const std::vector<DungeonStreamPcRange>& fragments,
+                            std::vector<size_t>* unplaced) {
+  std::vector<size_t> moving;
+  for (size_t i = 0; i < groups.size(); ++i) {
+    if (!groups[i].keep) {
+      moving.push_back(i);
+    }
+  }
+  std::sort(moving.begin(), moving.end(), [&](size_t a, size_t b) {
+    return std::make_tuple(groups[b].size(), groups[a].owner_room) <
+           std::make_tuple(groups[a].size(), groups[b].owner_room);
+  });
+
+  std::vector<uint32_t> remaining;
+  remaining.reserve(fragments.size());
+  for (const auto& fragment : fragments) {
+    remaining.push_back(fragment.end - fragment.begin);
+  }
+  std::vector<std::vector<size_t>> assigned(fragments.size());
+  for (size_t index : moving) {
+    const uint32_t size = groups[index].size();
+    size_t best = fragments.size();
+    for (size_t f = 0; f < fragments.size(); ++f) {
+      if (remaining[f] >= size &&
+          (best == fragments.size() || remaining[f] < remaining[best])) {
+        best = f;
+      }
+    }
+    if (best == fragments.size()) {
+      unplaced->push_back(index);
+      continue;
+    }
+    remaining[best] -= size;
+    assigned[best].push_back(index);
+  }
+  if (!unplaced->empty()) {
+    return false;
+  }
+
+  for (size_t f = 0; f < fragments.size(); ++f) {
+    std::sort(assigned[f].begin(), assigned[f].end(), [&](size_t a, size_t b) {
+      return groups[a].owner_room < groups[b].owner_room;
+    });
+    uint32_t cursor = fragments[f].begin;
+    for (size_t index : assigned[f]) {
+      groups[index].address = cursor;
+      cursor += groups[index].size();
+    }
+  }
+  return true;
+}
+
+// Local-search step for a failed placement. Prefers the kept payload whose
+// eviction lets every moving payload fit while repointing the fewest rooms
+// and moving the fewest bytes. If no single eviction is enough, frees the
+// largest contiguous run per repointed room so the next round gets closer.
+size_t PickRepackEviction(const std::vector<RepackGroup>& groups,
+                          const DungeonStreamPcRange& range) {
+  size_t best_fit = groups.size();
+  size_t best_run = groups.size();
+  uint64_t best_run_score = 0;
+  for (size_t i = 0; i < groups.size(); ++i) {
+    if (!groups[i].keep) {
+      continue;
+    }
+    std::vector<RepackGroup> trial = groups;
+    trial[i].keep = false;
+    const auto fragments = RepackFreeFragments(trial, range);
+    std::vector<size_t> unplaced;
+    if (PlaceBestFitDecreasing(trial, fragments, &unplaced)) {
+      if (best_fit == groups.size() ||
+          std::make_tuple(groups[i].anchor_rooms, groups[i].size(),
+                          groups[i].anchor) <
+              std::make_tuple(groups[best_fit].anchor_rooms,
+                              groups[best_fit].size(),
+                              groups[best_fit].anchor)) {
+        best_fit = i;
+      }
+      continue;
+    }
+
+    uint32_t largest_run = 0;
+    for (const auto& fragment : fragments) {
+      largest_run = std::max(largest_run, fragment.end - fragment.begin);
+    }
+    const uint64_t score = static_cast<uint64_t>(largest_run) * kNumberOfRooms /
+                           std::max<uint32_t>(groups[i].anchor_rooms, 1);
+    if (best_run == groups.size() || score > best_run_score) {
+      best_run = i;
+      best_run_score = score;
+    }
+  }
+  return best_fit != groups.size() ? best_fit : best_run;
+}
+
 bool IsSortedUniqueByRoom(const std::vector<DungeonStreamWrite>& writes) {
   for (size_t i = 1; i < writes.size(); ++i) {
     if (writes[i - 1].room_id >= writes[i].room_id) {
@@ -933,42 +1092,50 @@ absl::StatusOr<DungeonStreamInventory> InventoryDungeonStreams(
     occupied.push_back({record.data_pc, record.logical_end_pc});
   }
 
-  struct UniqueStream {
-    uint32_t begin = 0;
-    uint32_t end = 0;
-    std::vector<uint32_t> room_ids;
-  };
-  std::vector<UniqueStream> unique;
-  unique.reserve(valid_by_start.size());
+  // Starts are visited in address order, so each stream's physical end is
+  // the next start and overlaps only need to look ahead until the first start
+  // past the current logical end.
+  auto& extents = inventory.extents;
+  extents.reserve(valid_by_start.size());
   for (const auto& [start, indices] : valid_by_start) {
-    UniqueStream stream;
-    stream.begin = start;
-    stream.end = inventory.streams[indices.front()].logical_end_pc;
+    DungeonStreamExtent extent;
+    extent.data_pc = start;
+    extent.logical_end_pc = inventory.streams[indices.front()].logical_end_pc;
+    const uint32_t bank_end = ((start / kLoRomBankSize) + 1) * kLoRomBankSize;
+    extent.physical_end_pc = std::min(
+        FindContainingRange(inventory.layout.data_ranges, start)->end,
+        bank_end);
     for (size_t index : indices) {
-      stream.room_ids.push_back(inventory.streams[index].room_id);
+      extent.room_ids.push_back(inventory.streams[index].room_id);
     }
-    if (stream.room_ids.size() > 1) {
-      inventory.aliases.push_back({start, stream.room_ids});
+    if (extent.room_ids.size() > 1) {
+      inventory.aliases.push_back({start, extent.room_ids});
     }
-    unique.push_back(std::move(stream));
+    if (!extents.empty()) {
+      auto& previous = extents.back();
+      previous.physical_end_pc = std::min(previous.physical_end_pc, start);
+    }
+    extents.push_back(std::move(extent));
   }
 
-  for (size_t i = 0; i < unique.size(); ++i) {
-    for (size_t j = i + 1; j < unique.size(); ++j) {
-      if (unique[j].begin >= unique[i].end) {
+  for (size_t i = 0; i < extents.size(); ++i) {
+    for (size_t j = i + 1; j < extents.size(); ++j) {
+      if (extents[j].data_pc >= extents[i].logical_end_pc) {
         break;
       }
-      const uint32_t intersection_end = std::min(unique[i].end, unique[j].end);
-      if (unique[j].begin >= intersection_end) {
+      const uint32_t intersection_end =
+          std::min(extents[i].logical_end_pc, extents[j].logical_end_pc);
+      if (extents[j].data_pc >= intersection_end) {
         continue;
       }
-      const auto kind = unique[j].end == unique[i].end
-                            ? DungeonStreamOverlapKind::kSuffix
-                            : DungeonStreamOverlapKind::kInterior;
+      const auto kind =
+          extents[j].logical_end_pc == extents[i].logical_end_pc
+              ? DungeonStreamOverlapKind::kSuffix
+              : DungeonStreamOverlapKind::kInterior;
       inventory.overlaps.push_back({kind,
-                                    unique[i].room_ids,
-                                    unique[j].room_ids,
-                                    {unique[j].begin, intersection_end}});
+                                    extents[i].room_ids,
+                                    extents[j].room_ids,
+                                    {extents[j].data_pc, intersection_end}});
     }
   }
 
@@ -1088,6 +1255,8 @@ absl::StatusOr<DungeonStreamWritePlan> PlanDungeonStreamRepack(
 
   std::vector<std::vector<uint8_t>> logical_streams(
       inventory.layout.pointer_count);
+  std::vector<const DungeonStreamRecord*> source_by_room(
+      inventory.layout.pointer_count, nullptr);
   std::vector<bool> seen_rooms(inventory.layout.pointer_count, false);
   for (const DungeonStreamRecord& record : inventory.streams) {
     if (!record.valid || record.room_id >= inventory.layout.pointer_count ||
@@ -1097,6 +1266,7 @@ absl::StatusOr<DungeonStreamWritePlan> PlanDungeonStreamRepack(
           "Pot-item inventory contains an incomplete logical stream snapshot");
     }
     seen_rooms[record.room_id] = true;
+    source_by_room[record.room_id] = &record;
     logical_streams[record.room_id] = record.encoded_stream;
   }
   if (std::find(seen_rooms.begin(), seen_rooms.end(), false) !=
@@ -1140,22 +1310,40 @@ absl::StatusOr<DungeonStreamWritePlan> PlanDungeonStreamRepack(
     available_bytes += static_cast<uint64_t>(range.end) - range.begin;
   }
 
-  struct RepackGroup {
-    uint32_t owner_room = 0;
-    std::vector<uint8_t> bytes;
-    std::vector<uint32_t> room_ids;
-  };
   std::map<std::vector<uint8_t>, std::vector<uint32_t>> rooms_by_payload;
   for (uint32_t room_id = 0; room_id < inventory.layout.pointer_count;
        ++room_id) {
     rooms_by_payload[logical_streams[room_id]].push_back(room_id);
   }
+  const DungeonStreamPcRange repack_range =
+      inventory.layout.allocation_ranges.front();
   std::vector<RepackGroup> groups;
   groups.reserve(rooms_by_payload.size());
   uint64_t required_bytes = 0;
   for (auto& [bytes, room_ids] : rooms_by_payload) {
     required_bytes += bytes.size();
-    groups.push_back({room_ids.front(), std::move(bytes), std::move(room_ids)});
+    RepackGroup group;
+    group.owner_room = room_ids.front();
+    group.bytes = bytes;
+    group.room_ids = std::move(room_ids);
+
+    // Rooms whose source stream is unchanged already point at a copy of
+    // these bytes; the copy serving the most of them can stay.
+    std::map<uint32_t, uint32_t> rooms_by_source;
+    for (const uint32_t room_id : group.room_ids) {
+      const DungeonStreamRecord& source = *source_by_room[room_id];
+      if (source.encoded_stream == group.bytes) {
+        ++rooms_by_source[source.data_pc];
+      }
+    }
+    for (const auto& [source_pc, count] : rooms_by_source) {
+      if (count > group.anchor_rooms &&
+          Contains(repack_range, {source_pc, source_pc + group.size()})) {
+        group.anchor = source_pc;
+        group.anchor_rooms = count;
+      }
+    }
+    groups.push_back(std::move(group));
   }
   if (required_bytes > available_bytes) {
     return absl::ResourceExhaustedError(
@@ -1166,6 +1354,25 @@ absl::StatusOr<DungeonStreamWritePlan> PlanDungeonStreamRepack(
     return a.owner_room < b.owner_room;
   });
 
+  DungeonStreamRepackCost cost;
+  SelectRepackAnchors(groups);
+  while (true) {
+    const auto fragments = RepackFreeFragments(groups, repack_range);
+    std::vector<size_t> unplaced;
+    if (PlaceBestFitDecreasing(groups, fragments, &unplaced)) {
+      break;
+    }
+    // With nothing kept the range is one fragment at least required_bytes
+    // long, so this only trips if the size check above is wrong.
+    const size_t victim = PickRepackEviction(groups, repack_range);
+    if (victim == groups.size()) {
+      return absl::ResourceExhaustedError(
+          "Pot-item repack could not place every payload");
+    }
+    groups[victim].keep = false;
+    ++cost.evicted_payloads;
+  }
+
   DungeonStreamWritePlan plan;
   plan.layout = inventory.layout;
   plan.source_size = inventory.source_size;
@@ -1175,15 +1382,39 @@ absl::StatusOr<DungeonStreamWritePlan> PlanDungeonStreamRepack(
   plan.pointer_writes.reserve(inventory.layout.pointer_count);
 
   std::vector<uint32_t> target_by_room(inventory.layout.pointer_count, 0);
-  uint32_t next_address = inventory.layout.allocation_ranges.front().begin;
-  for (const RepackGroup& group : groups) {
-    const uint32_t address = next_address;
-    plan.payload_writes.push_back({group.owner_room, address, group.bytes});
+  std::vector<DungeonStreamPcRange> placed;
+  placed.reserve(groups.size());
+  for (RepackGroup& group : groups) {
+    if (group.keep) {
+      group.address = group.anchor;
+      ++cost.kept_payloads;
+    } else {
+      ++cost.moved_payloads;
+      cost.moved_bytes += group.size();
+    }
+    plan.payload_writes.push_back(
+        {group.owner_room, group.address, group.bytes});
     for (const uint32_t room_id : group.room_ids) {
-      target_by_room[room_id] = address;
+      target_by_room[room_id] = group.address;
+      if (source_by_room[room_id]->data_pc != group.address) {
+        ++cost.repointed_rooms;
+      }
     }
-    next_address += static_cast<uint32_t>(group.bytes.size());
+    placed.push_back({group.address, group.address + group.size()});
   }
+  for (const auto& fragment :
+       ComplementIntervals({repack_range}, UnionIntervals(std::move(placed)))) {
+    const uint32_t fragment_size = fragment.end - fragment.begin;
+    cost.free_bytes += fragment_size;
+    ++cost.free_fragments;
+    cost.largest_free_fragment =
+        std::max(cost.largest_free_fragment, fragment_size);
+  }
+  cost.unique_payloads = static_cast<uint32_t>(groups.size());
+  cost.deduplicated_rooms =
+      inventory.layout.pointer_count - cost.unique_payloads;
+  cost.payload_bytes = static_cast<uint32_t>(required_bytes);
+  plan.repack_cost = cost;
 
   const uint32_t pointer_width =
       PointerWidth(inventory.layout.pointer_encoding);
@@ -1243,36 +1474,18 @@ absl::Status ApplyDungeonStreamWritePlan(Rom* rom,
                                "DungeonStreamAuxiliaryPointer"));
   yaze::rom::ScopedWriteFence write_scope(rom, &write_fence);
 
-  const std::vector<uint8_t> snapshot = rom->vector();
-  const bool was_dirty = rom->dirty();
-  auto rollback = [&]() {
-    rom->mutable_vector() = snapshot;
-    rom->set_dirty(was_dirty);
-  };
-
-  for (const auto& write : plan.payload_writes) {
-    auto status =
-        rom->WriteVector(static_cast<int>(write.address), write.bytes);
-    if (!status.ok()) {
-      rollback();
-      return status;
+  // One batch: every range is fence-checked before any byte changes, so a
+  // rejected plan leaves the ROM as it was without a full snapshot.
+  yaze::rom::WriteBatch batch;
+  for (const auto* writes : {&plan.payload_writes, &plan.pointer_writes,
+                             &plan.auxiliary_pointer_writes}) {
+    for (const auto& write : *writes) {
+      batch.WriteVector(write.address, write.bytes);
     }
   }
-  for (const auto& write : plan.pointer_writes) {
-    auto status =
-        rom->WriteVector(static_cast<int>(write.address), write.bytes);
-    if (!status.ok()) {
-      rollback();
-      return status;
-    }
-  }
-  for (const auto& write : plan.auxiliary_pointer_writes) {
-    auto status =
-        rom->WriteVector(static_cast<int>(write.address), write.bytes);
-    if (!status.ok()) {
-      rollback();
-      return status;
-    }
+  auto journal = batch.Commit(*rom);
+  if (!journal.ok()) {
+    return journal.status();
   }
   return absl::OkStatus();
 }
@@ -77,6 +77,20 @@ struct DungeonStreamRecord {
   }
 };
 
+// One distinct parsed stream start and the rooms that point at it, in address
+// order. physical_end_pc is the next parsed stream start, the end of the
+// containing data range, or the LoROM bank end, whichever comes first, so
+// capacity() bounds an in-place rewrite that leaves every other stream intact.
+struct DungeonStreamExtent {
+  uint32_t data_pc = 0;
+  uint32_t logical_end_pc = 0;
+  uint32_t physical_end_pc = 0;
+  std::vector<uint32_t> room_ids;
+
+  uint32_t size() const { return logical_end_pc - data_pc; }
+  uint32_t capacity() const { return physical_end_pc - data_pc; }
+};
+
 struct DungeonStreamAliasGroup {
   uint32_t data_pc = 0;
   std::vector<uint32_t> room_ids;
@@ -106,6 +120,7 @@ struct DungeonStreamInventory {
   uint32_t source_size = 0;
   uint32_t source_crc32 = 0;
   std::vector<DungeonStreamRecord> streams;
+  std::vector<DungeonStreamExtent> extents;
   std::vector<DungeonStreamAliasGroup> aliases;
   std::vector<DungeonStreamOverlap> overlaps;
   std::vector<DungeonStreamIssue> issues;
@@ -135,6 +150,26 @@ enum class DungeonStreamWriteMode {
   kRepackAll,
 };
 
+// How much a repack plan disturbs the source layout. A room is repointed when
+// its planned pointer differs from the inventory snapshot. A payload is kept
+// when an identical stream already sits at its planned address, so its bytes
+// are rewritten unchanged.
+struct DungeonStreamRepackCost {
+  uint32_t unique_payloads = 0;
+  // Rooms that share another room's payload instead of getting their own.
+  uint32_t deduplicated_rooms = 0;
+  uint32_t payload_bytes = 0;
+  uint32_t kept_payloads = 0;
+  uint32_t moved_payloads = 0;
+  uint32_t moved_bytes = 0;
+  // Kept payloads that had to move to open a large enough free fragment.
+  uint32_t evicted_payloads = 0;
+  uint32_t repointed_rooms = 0;
+  uint32_t free_bytes = 0;
+  uint32_t free_fragments = 0;
+  uint32_t largest_free_fragment = 0;
+};
+
 struct DungeonStreamWritePlan {
   DungeonStreamLayout layout;
   uint32_t source_size = 0;
@@ -147,6 +182,8 @@ struct DungeonStreamWritePlan {
   // Object relocation also needs the runtime door pointer updated to the
   // first door byte (or the final terminator for a doorless stream).
   std::vector<DungeonStreamWrite> auxiliary_pointer_writes;
+  // Filled by PlanDungeonStreamRepack only.
+  DungeonStreamRepackCost repack_cost;
 };
 
 // Reads and strictly parses every pointer-table entry without modifying rom.
@@ -165,7 +202,13 @@ absl::StatusOr<DungeonStreamWritePlan> PlanDungeonStreamWrites(
 // Deterministically repacks every pot-item stream into one normalized declared
 // allocation range. Exact byte-identical payloads share one placement owned by
 // their lowest room ID, while every pointer-table entry receives an update.
-// Untouched rooms come from the immutable inventory snapshot. No ROM bytes are
+// Untouched rooms come from the immutable inventory snapshot.
+//
+// Payloads already inside the range stay where they are whenever possible, so
+// growing a few rooms repoints only those rooms. The remaining payloads are
+// placed into the free fragments best-fit-decreasing; when one does not fit,
+// the kept payload whose eviction repoints the fewest rooms is moved as well.
+// The resulting plan carries a DungeonStreamRepackCost. No ROM bytes are
 // changed during planning, and the operation fails before producing a plan if
 // all unique payloads cannot fit without crossing the fixed pointer bank.
 absl::StatusOr<DungeonStreamWritePlan> PlanDungeonStreamRepack(
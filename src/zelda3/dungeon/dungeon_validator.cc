@@ -1,6 +1,11 @@
 #include "dungeon_validator.h"
 
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+
 #include "absl/strings/str_format.h"
+#include "rom/rom.h"
 #include "zelda3/dungeon/object_layer_semantics.h"
 
 namespace yaze {
@@ -10,32 +15,42 @@ namespace {
 constexpr int16_t kBigKeyLockObjectId = 0xF98;
 constexpr size_t kMaxStatefulRoomEventSlots = 6;
 
-}  // namespace
-
-ValidationResult DungeonValidator::ValidateRoom(const Room& room) {
-  ValidationResult result;
-
-  // Check object count
-  size_t object_count = room.GetTileObjects().size();
+void CheckObjectCount(const RoomValidationSnapshot& room,
+                      ValidationResult* result) {
+  const size_t object_count = room.objects.size();
   if (object_count > kMaxTileObjects) {
-    result.warnings.push_back(absl::StrFormat(
+    result->warnings.push_back(absl::StrFormat(
         "High object count (%zu > %d). May cause lag or memory issues.",
         object_count, kMaxTileObjects));
   }
+}
 
-  // Check sprite count
-  size_t sprite_count = room.GetSprites().size();
+void CheckSpriteCount(const RoomValidationSnapshot& room,
+                      ValidationResult* result) {
+  const size_t sprite_count = room.sprites.size();
   if (sprite_count > kMaxTotalSprites) {
-    result.warnings.push_back(
+    result->warnings.push_back(
         absl::StrFormat("Too many sprites (%zu > %d). Game limit is strict.",
                         sprite_count, kMaxTotalSprites));
   }
+}
+
+void CheckDoorCount(const RoomValidationSnapshot& room,
+                    ValidationResult* result) {
+  const size_t door_count = room.doors.size();
+  if (door_count > kMaxDoors) {
+    result->warnings.push_back(absl::StrFormat(
+        "Too many doors (%zu > %d).", door_count, kMaxDoors));
+  }
+}
 
-  // Stateful chests and big-key locks share a six-entry room-event table in
-  // the game engine. Chests use a chest-only index and then synchronize the
-  // shared index, so a chest after a lock reuses an earlier event slot.
-  // Validate the encoded stream order (primary, BG2 overlay, BG1 overlay), not
-  // the editor vector order, which may interleave objects from those lists.
+// Stateful chests and big-key locks share a six-entry room-event table in
+// the game engine. Chests use a chest-only index and then synchronize the
+// shared index, so a chest after a lock reuses an earlier event slot.
+// Validate the encoded stream order (primary, BG2 overlay, BG1 overlay), not
+// the editor vector order, which may interleave objects from those lists.
+void CheckRoomEventSlots(const RoomValidationSnapshot& room,
+                         ValidationResult* result) {
   size_t chest_slot_index = 0;
   size_t shared_event_slot_index = 0;
   bool saw_big_key_lock = false;
@@ -43,7 +58,7 @@ ValidationResult DungeonValidator::ValidateRoom(const Room& room) {
   int first_out_of_range_object = -1;
   size_t first_out_of_range_slot = 0;
   for (uint8_t list_index = 0; list_index < 3; ++list_index) {
-    for (const auto& obj : room.GetTileObjects()) {
+    for (const auto& obj : room.objects) {
       if (!UsesRoomObjectStream(obj) || obj.GetLayerValue() != list_index) {
         continue;
       }
@@ -74,47 +89,195 @@ ValidationResult DungeonValidator::ValidateRoom(const Room& room) {
   }
 
   if (first_chest_after_lock >= 0) {
-    result.warnings.push_back(absl::StrFormat(
+    result->warnings.push_back(absl::StrFormat(
         "Stateful chest 0x%03X appears after big-key lock 0xF98 in "
         "room-object stream order; move stateful chests before locks to avoid "
         "room-state slot conflicts.",
         first_chest_after_lock));
   }
   if (first_out_of_range_object >= 0) {
-    result.warnings.push_back(absl::StrFormat(
+    result->warnings.push_back(absl::StrFormat(
         "Stateful object 0x%03X accesses room-event slot %zu; RoomFlagMask "
         "only defines slots 0-%zu.",
         first_out_of_range_object, first_out_of_range_slot,
         kMaxStatefulRoomEventSlots - 1));
   }
+}
 
-  // Check bounds
-  for (const auto& obj : room.GetTileObjects()) {
+void CheckObjectEncoding(const RoomValidationSnapshot& room,
+                         ValidationResult* result) {
+  for (const auto& obj : room.objects) {
     if (UsesRoomObjectStream(obj)) {
       const absl::Status status = ValidateRoomObjectStreamEntryForSave(obj);
       if (!status.ok()) {
-        result.errors.emplace_back(std::string(status.message()));
-        result.is_valid = false;
+        result->errors.emplace_back(std::string(status.message()));
       }
       continue;
     }
 
     const int layer = static_cast<int>(obj.GetLayerValue());
     if (layer > 1) {
-      result.errors.push_back(absl::StrFormat(
+      result->errors.push_back(absl::StrFormat(
           "Special-table object 0x%02X has invalid layer selector %d; "
           "expected upper/BG1 (0) or lower/BG2 (1)",
           obj.id_, layer));
-      result.is_valid = false;
     }
 
     if (obj.x_ < 0 || obj.x_ >= 64 || obj.y_ < 0 || obj.y_ >= 64) {
-      result.errors.push_back(absl::StrFormat(
+      result->errors.push_back(absl::StrFormat(
           "Object 0x%02X out of bounds at (%d, %d)", obj.id_, obj.x_, obj.y_));
-      result.is_valid = false;
     }
   }
+}
+
+// Stacked copies of the same object draw identically and only cost stream
+// space. Reports the earliest object that has a later identical copy.
+void CheckDuplicateObjects(const RoomValidationSnapshot& room,
+                           ValidationResult* result) {
+  std::unordered_map<uint64_t, size_t> first_index;
+  first_index.reserve(room.objects.size());
+  size_t duplicate_count = 0;
+  size_t first_duplicate = room.objects.size();
+  for (size_t i = 0; i < room.objects.size(); ++i) {
+    const auto& obj = room.objects[i];
+    const uint64_t key =
+        static_cast<uint64_t>(static_cast<uint16_t>(obj.id_)) |
+        (static_cast<uint64_t>(obj.x_) << 16) |
+        (static_cast<uint64_t>(obj.y_) << 24) |
+        (static_cast<uint64_t>(obj.size_) << 32) |
+        (static_cast<uint64_t>(obj.GetLayerValue()) << 40) |
+        (static_cast<uint64_t>(obj.options()) << 48);
+    const auto [it, inserted] = first_index.try_emplace(key, i);
+    if (!inserted) {
+      ++duplicate_count;
+      first_duplicate = std::min(first_duplicate, it->second);
+    }
+  }
+  if (duplicate_count > 0) {
+    const auto& first = room.objects[first_duplicate];
+    result->warnings.push_back(absl::StrFormat(
+        "%zu duplicate object(s) stacked on an identical object (first: "
+        "0x%03X at (%d, %d)).",
+        duplicate_count, first.id_, first.x_, first.y_));
+  }
+}
+
+// Two identical sprites on one spot spawn together and read as one.
+void CheckDuplicateSprites(const RoomValidationSnapshot& room,
+                           ValidationResult* result) {
+  std::unordered_map<uint64_t, size_t> first_index;
+  first_index.reserve(room.sprites.size());
+  size_t duplicate_count = 0;
+  size_t first_duplicate = room.sprites.size();
+  for (size_t i = 0; i < room.sprites.size(); ++i) {
+    const auto& sprite = room.sprites[i];
+    const uint64_t key =
+        static_cast<uint64_t>(sprite.id) |
+        (static_cast<uint64_t>(sprite.overlord) << 8) |
+        (static_cast<uint64_t>(static_cast<uint16_t>(sprite.x)) << 16) |
+        (static_cast<uint64_t>(static_cast<uint16_t>(sprite.y)) << 32) |
+        (static_cast<uint64_t>(sprite.layer & 0xFF) << 48) |
+        (static_cast<uint64_t>(sprite.subtype & 0xFF) << 56);
+    const auto [it, inserted] = first_index.try_emplace(key, i);
+    if (!inserted) {
+      ++duplicate_count;
+      first_duplicate = std::min(first_duplicate, it->second);
+    }
+  }
+  if (duplicate_count > 0) {
+    const auto& first = room.sprites[first_duplicate];
+    result->warnings.push_back(absl::StrFormat(
+        "%zu duplicate sprite(s) stacked on an identical sprite (first: "
+        "0x%02X at (%d, %d)).",
+        duplicate_count, first.id, first.x, first.y));
+  }
+}
+
+// Byte size of Room::EncodeObjects() plus the two-byte floor/layout header:
+// three bytes per stream object, two per door, and the three list
+// terminators and door marker.
+size_t EncodedObjectStreamSize(const RoomValidationSnapshot& room) {
+  size_t stream_objects = 0;
+  for (const auto& obj : room.objects) {
+    if (UsesRoomObjectStream(obj) && obj.GetLayerValue() <= 2) {
+      ++stream_objects;
+    }
+  }
+  return 2 + stream_objects * 3 + room.doors.size() * 2 + 8;
+}
+
+// An object stream that outgrows its slot cannot be saved in place; the
+// save then needs a relocation layout. Shared slots are always relocated.
+void CheckObjectStreamCapacity(const RoomValidationSnapshot& room,
+                               ValidationResult* result) {
+  const RoomStreamExtent& extent = room.object_stream;
+  if (extent.address < 0 || extent.shared || extent.capacity() <= 0) {
+    return;
+  }
+  const size_t stream_size = EncodedObjectStreamSize(room);
+  if (stream_size > static_cast<size_t>(extent.capacity())) {
+    result->warnings.push_back(absl::StrFormat(
+        "Object stream needs %zu bytes but only %d fit in place at PC "
+        "0x%06X; saving requires relocation.",
+        stream_size, extent.capacity(), extent.address));
+  }
+}
+
+constexpr std::array<RoomValidationRule, 8> kRoomValidationRules = {{
+    {"object-count", kRoomInputObjects, CheckObjectCount},
+    {"sprite-count", kRoomInputSprites, CheckSpriteCount},
+    {"door-count", kRoomInputDoors, CheckDoorCount},
+    {"room-event-slots", kRoomInputObjects, CheckRoomEventSlots},
+    {"object-encoding", kRoomInputObjects, CheckObjectEncoding},
+    {"duplicate-objects", kRoomInputObjects, CheckDuplicateObjects},
+    {"duplicate-sprites", kRoomInputSprites, CheckDuplicateSprites},
+    {"object-stream-capacity",
+     kRoomInputObjects | kRoomInputDoors | kRoomInputStreamTable,
+     CheckObjectStreamCapacity},
+}};
 
+}  // namespace
+
+RoomValidationSnapshot CaptureRoomValidationSnapshot(const Room& room,
+                                                     uint8_t inputs) {
+  RoomValidationSnapshot snapshot;
+  snapshot.room_id = room.id();
+  snapshot.inputs = inputs;
+  if (inputs & kRoomInputObjects) {
+    snapshot.objects = room.GetTileObjects();
+  }
+  if (inputs & kRoomInputDoors) {
+    snapshot.doors = room.GetDoors();
+  }
+  if (inputs & kRoomInputSprites) {
+    snapshot.sprites.reserve(room.GetSprites().size());
+    for (const auto& sprite : room.GetSprites()) {
+      snapshot.sprites.push_back({sprite.id(), sprite.IsOverlord(), sprite.x(),
+                                  sprite.y(), sprite.layer(),
+                                  sprite.subtype()});
+    }
+  }
+  const Rom* rom = room.rom();
+  if ((inputs & kRoomInputStreamTable) && rom != nullptr &&
+      rom->is_loaded() && room.id() >= 0 && room.id() < kNumberOfRooms) {
+    snapshot.object_stream =
+        GetRoomStreamTables(*rom)->objects.rooms[room.id()];
+  }
+  return snapshot;
+}
+
+std::span<const RoomValidationRule> GetRoomValidationRules() {
+  return kRoomValidationRules;
+}
+
+ValidationResult DungeonValidator::ValidateRoom(const Room& room) {
+  const RoomValidationSnapshot snapshot =
+      CaptureRoomValidationSnapshot(room, kAllRoomInputs);
+  ValidationResult result;
+  for (const RoomValidationRule& rule : GetRoomValidationRules()) {
+    rule.run(snapshot, &result);
+  }
+  result.is_valid = result.errors.empty();
   return result;
 }
 
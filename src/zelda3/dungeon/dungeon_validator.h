@@ -1,11 +1,14 @@
 #ifndef YAZE_APP_ZELDA3_DUNGEON_DUNGEON_VALIDATOR_H
 #define YAZE_APP_ZELDA3_DUNGEON_DUNGEON_VALIDATOR_H
 
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
 #include "zelda3/dungeon/dungeon_limits.h"
 #include "zelda3/dungeon/room.h"
+#include "zelda3/dungeon/room_stream_table.h"
 
 namespace yaze {
 namespace zelda3 {
@@ -16,6 +19,53 @@ struct ValidationResult {
   std::vector<std::string> errors;
 };
 
+// Room data a validation rule reads. An edit only re-runs the rules whose
+// inputs it touched.
+inline constexpr uint8_t kRoomInputObjects = 1u << 0;
+inline constexpr uint8_t kRoomInputDoors = 1u << 1;
+inline constexpr uint8_t kRoomInputSprites = 1u << 2;
+// The ROM's object pointer table, which bounds each stream in place.
+inline constexpr uint8_t kRoomInputStreamTable = 1u << 3;
+inline constexpr uint8_t kAllRoomInputs = kRoomInputObjects | kRoomInputDoors |
+                                          kRoomInputSprites |
+                                          kRoomInputStreamTable;
+
+// The sprite fields the rules read; Sprite itself carries preview graphics.
+struct RoomSpriteSnapshot {
+  uint8_t id = 0;
+  bool overlord = false;
+  int x = 0;
+  int y = 0;
+  int layer = 0;
+  int subtype = 0;
+};
+
+// Copy of the room data the rules read, so they can run on a worker while
+// the editor keeps changing the room. Only the captured inputs are filled.
+struct RoomValidationSnapshot {
+  int room_id = -1;
+  uint8_t inputs = 0;
+  std::vector<RoomObject> objects;
+  std::vector<Room::Door> doors;
+  std::vector<RoomSpriteSnapshot> sprites;
+  // In-place slot of the room's object stream. address < 0 when the room is
+  // not backed by a loaded ROM.
+  RoomStreamExtent object_stream;
+};
+
+RoomValidationSnapshot CaptureRoomValidationSnapshot(const Room& room,
+                                                     uint8_t inputs);
+
+struct RoomValidationRule {
+  const char* name;
+  uint8_t inputs;
+  void (*run)(const RoomValidationSnapshot& room, ValidationResult* result);
+};
+
+// Every rule, in report order. Rules only read the snapshot fields named by
+// their inputs and append to result without setting is_valid.
+std::span<const RoomValidationRule> GetRoomValidationRules();
+
 class DungeonValidator {
  public:
   ValidationResult ValidateRoom(const Room& room);
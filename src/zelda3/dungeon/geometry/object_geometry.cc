@@ -273,14 +273,19 @@ absl::StatusOr<GeometryBounds> ObjectGeometry::MeasureByObjectId(
 
   // Check cache
   CacheKey key{routine_id, object.id_, object.size_};
-  auto cache_it = cache_.find(key);
-  if (cache_it != cache_.end()) {
-    return cache_it->second;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    auto cache_it = cache_.find(key);
+    if (cache_it != cache_.end()) {
+      return cache_it->second;
+    }
   }
 
-  // Measure and cache
+  // Measure outside the lock; two threads measuring the same key store the
+  // same bounds.
   auto result = MeasureByRoutineId(routine_id, object);
   if (result.ok()) {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
     cache_[key] = *result;
   }
   return result;
@@ -309,6 +314,7 @@ absl::StatusOr<GeometryBounds> ObjectGeometry::MeasureByObjectIdForState(
 }
 
 void ObjectGeometry::ClearCache() {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
   cache_.clear();
 }
 
@@ -2,6 +2,7 @@
 #define YAZE_ZELDA3_DUNGEON_GEOMETRY_OBJECT_GEOMETRY_H
 
 #include <cstdint>
+#include <mutex>
 #include <optional>
 #include <tuple>
 #include <unordered_map>
@@ -239,6 +240,9 @@ class ObjectGeometry {
 
   std::vector<DrawRoutineInfo> routines_;
   std::unordered_map<int, DrawRoutineInfo> routine_map_;
+  // Guards cache_: editor panels and off-screen room renders on worker
+  // threads measure through the same instance.
+  mutable std::mutex cache_mutex_;
   mutable std::unordered_map<CacheKey, GeometryBounds, CacheKeyHash> cache_;
 };
 
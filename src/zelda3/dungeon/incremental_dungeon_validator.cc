@@ -0,0 +1,153 @@
+#include "zelda3/dungeon/incremental_dungeon_validator.h"
+
+#include <utility>
+
+#include "rom/rom.h"
+
+namespace yaze {
+namespace zelda3 {
+
+IncrementalDungeonValidator::IncrementalDungeonValidator()
+    : IncrementalDungeonValidator(util::TaskScheduler::Get()) {}
+
+IncrementalDungeonValidator::IncrementalDungeonValidator(
+    util::TaskScheduler& scheduler)
+    : scheduler_(scheduler) {}
+
+// group_ is destroyed before run_ and waits for the task that writes it.
+IncrementalDungeonValidator::~IncrementalDungeonValidator() = default;
+
+void IncrementalDungeonValidator::NotifyChanged(int room_id, uint8_t inputs) {
+  // Rooms not seen yet start with every input dirty.
+  auto it = rooms_.find(room_id);
+  if (it != rooms_.end()) {
+    it->second.dirty |= inputs;
+  }
+}
+
+void IncrementalDungeonValidator::Reset() {
+  Wait();
+  rooms_.clear();
+}
+
+const ValidationResult& IncrementalDungeonValidator::Update(const Room& room) {
+  if (run_ && run_->done.load(std::memory_order_acquire)) {
+    Collect();
+  }
+
+  RoomState& state = rooms_[room.id()];
+  if (state.rule_results.empty()) {
+    state.rule_results.resize(GetRoomValidationRules().size());
+  }
+  DetectUnreportedChanges(room, state);
+  if (state.dirty != 0 && !run_) {
+    Start(room, state);
+  }
+  return state.merged;
+}
+
+const ValidationResult& IncrementalDungeonValidator::GetResult(
+    int room_id) const {
+  static const ValidationResult kEmpty;
+  auto it = rooms_.find(room_id);
+  return it != rooms_.end() ? it->second.merged : kEmpty;
+}
+
+bool IncrementalDungeonValidator::IsCurrent(int room_id) const {
+  auto it = rooms_.find(room_id);
+  return it != rooms_.end() && it->second.dirty == 0 &&
+         !(run_ && run_->snapshot.room_id == room_id);
+}
+
+void IncrementalDungeonValidator::Wait() {
+  if (run_) {
+    Collect();
+  }
+}
+
+void IncrementalDungeonValidator::DetectUnreportedChanges(const Room& room,
+                                                          RoomState& state) {
+  const size_t object_count = room.GetTileObjects().size();
+  const size_t door_count = room.GetDoors().size();
+  const size_t sprite_count = room.GetSprites().size();
+  if (object_count != state.object_count) {
+    state.dirty |= kRoomInputObjects;
+    state.object_count = object_count;
+  }
+  if (door_count != state.door_count) {
+    state.dirty |= kRoomInputDoors;
+    state.door_count = door_count;
+  }
+  if (sprite_count != state.sprite_count) {
+    state.dirty |= kRoomInputSprites;
+    state.sprite_count = sprite_count;
+  }
+
+  // Saving can relocate streams without touching the room itself. The tables
+  // are cached per ROM revision, so this is a key compare per frame.
+  const Rom* rom = room.rom();
+  if (rom != nullptr && rom->is_loaded()) {
+    auto tables = GetRoomStreamTables(*rom);
+    if (tables != state.stream_tables) {
+      state.dirty |= kRoomInputStreamTable;
+      state.stream_tables = std::move(tables);
+    }
+  }
+}
+
+void IncrementalDungeonValidator::Start(const Room& room, RoomState& state) {
+  const auto rules = GetRoomValidationRules();
+  run_ = std::make_unique<Run>();
+  uint8_t capture = 0;
+  for (size_t i = 0; i < rules.size(); ++i) {
+    if (rules[i].inputs & state.dirty) {
+      run_->rule_indices.push_back(i);
+      // A rule that re-runs needs all of its inputs, not just the dirty ones.
+      capture |= rules[i].inputs;
+    }
+  }
+  state.dirty = 0;
+  run_->snapshot = CaptureRoomValidationSnapshot(room, capture);
+  run_->results.resize(run_->rule_indices.size());
+
+  group_ = std::make_unique<util::TaskGroup>(scheduler_,
+                                             util::TaskPriority::kLow);
+  group_->Run([run = run_.get(), rules] {
+    for (size_t i = 0; i < run->rule_indices.size(); ++i) {
+      rules[run->rule_indices[i]].run(run->snapshot, &run->results[i]);
+    }
+    run->done.store(true, std::memory_order_release);
+    return absl::OkStatus();
+  });
+  if (scheduler_.worker_count() == 0) {
+    Collect();
+  }
+}
+
+void IncrementalDungeonValidator::Collect() {
+  group_->Wait().IgnoreError();
+  std::unique_ptr<Run> run = std::move(run_);
+  group_.reset();
+  rules_run_ += static_cast<int>(run->rule_indices.size());
+
+  auto it = rooms_.find(run->snapshot.room_id);
+  if (it == rooms_.end()) {
+    return;
+  }
+  RoomState& state = it->second;
+  for (size_t i = 0; i < run->rule_indices.size(); ++i) {
+    state.rule_results[run->rule_indices[i]] = std::move(run->results[i]);
+  }
+
+  state.merged = ValidationResult{};
+  for (const ValidationResult& part : state.rule_results) {
+    state.merged.warnings.insert(state.merged.warnings.end(),
+                                 part.warnings.begin(), part.warnings.end());
+    state.merged.errors.insert(state.merged.errors.end(), part.errors.begin(),
+                               part.errors.end());
+  }
+  state.merged.is_valid = state.merged.errors.empty();
+}
+
+}  // namespace zelda3
+}  // namespace yaze
@@ -0,0 +1,96 @@
+#ifndef YAZE_ZELDA3_DUNGEON_INCREMENTAL_DUNGEON_VALIDATOR_H_
+#define YAZE_ZELDA3_DUNGEON_INCREMENTAL_DUNGEON_VALIDATOR_H_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "util/task_scheduler.h"
+#include "zelda3/dungeon/dungeon_validator.h"
+#include "zelda3/dungeon/room_stream_table.h"
+
+namespace yaze {
+namespace zelda3 {
+
+/**
+ * @class IncrementalDungeonValidator
+ * @brief Keeps per-room validation results current as the room is edited
+ *
+ * Edits report which room inputs they touched through NotifyChanged(). Once
+ * per frame, Update() snapshots only the inputs the affected rules read and
+ * re-runs those rules on a low-priority task; results of the other rules are
+ * reused. Edits made while a run is in flight are coalesced into the next
+ * run, so a result is at most one run behind the room.
+ *
+ * Update() also marks inputs dirty when an object, door or sprite count or
+ * the ROM's object pointer tables changed, so an edit path that forgets to
+ * notify still refreshes limit warnings.
+ *
+ * With a scheduler that has no workers, as on Emscripten, Update() runs the
+ * rules inline.
+ */
+class IncrementalDungeonValidator {
+ public:
+  IncrementalDungeonValidator();
+  explicit IncrementalDungeonValidator(util::TaskScheduler& scheduler);
+  ~IncrementalDungeonValidator();
+  IncrementalDungeonValidator(const IncrementalDungeonValidator&) = delete;
+  IncrementalDungeonValidator& operator=(const IncrementalDungeonValidator&) =
+      delete;
+
+  // inputs is a mask of kRoomInput* flags.
+  void NotifyChanged(int room_id, uint8_t inputs);
+  // Forgets every room, e.g. after a different ROM is loaded.
+  void Reset();
+
+  // Collects a finished run, starts the next one for room if it has pending
+  // changes, and returns the latest result for room. Call from the thread
+  // that edits rooms.
+  const ValidationResult& Update(const Room& room);
+  // Latest result for room_id, or an empty result if it was never updated.
+  const ValidationResult& GetResult(int room_id) const;
+
+  // True when room_id has no pending changes and no run in flight.
+  bool IsCurrent(int room_id) const;
+  // Blocks until the run in flight, if any, finishes and collects it.
+  void Wait();
+
+  // Rule executions so far, for tests and diagnostics.
+  int rules_run() const { return rules_run_; }
+
+ private:
+  struct RoomState {
+    uint8_t dirty = kAllRoomInputs;
+    size_t object_count = 0;
+    size_t door_count = 0;
+    size_t sprite_count = 0;
+    std::shared_ptr<const RoomStreamTables> stream_tables;
+    // One result per rule in GetRoomValidationRules() order.
+    std::vector<ValidationResult> rule_results;
+    ValidationResult merged;
+  };
+
+  struct Run {
+    RoomValidationSnapshot snapshot;
+    std::vector<size_t> rule_indices;
+    std::vector<ValidationResult> results;
+    std::atomic<bool> done{false};
+  };
+
+  void DetectUnreportedChanges(const Room& room, RoomState& state);
+  void Start(const Room& room, RoomState& state);
+  void Collect();
+
+  util::TaskScheduler& scheduler_;
+  std::map<int, RoomState> rooms_;
+  std::unique_ptr<Run> run_;
+  std::unique_ptr<util::TaskGroup> group_;
+  int rules_run_ = 0;
+};
+
+}  // namespace zelda3
+}  // namespace yaze
+
+#endif  // YAZE_ZELDA3_DUNGEON_INCREMENTAL_DUNGEON_VALIDATOR_H_
@@ -1,5 +1,6 @@
 #include "object_drawer.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <filesystem>
@@ -15,7 +16,6 @@
 #include "zelda3/dungeon/draw_routines/draw_routine_types.h"
 #include "zelda3/dungeon/draw_routines/special_routines.h"
 #include "zelda3/dungeon/dungeon_rom_addresses.h"
-#include "zelda3/dungeon/object_dimensions.h"
 
 namespace yaze {
 namespace zelda3 {
@@ -29,7 +29,8 @@ bool LockSurface(SDL_Surface* surface) {
 #endif
 }
 
-void SyncModifiedBitmapToSurface(gfx::Bitmap& bitmap, const char* layer_name) {
+void SyncModifiedBitmapToSurface(gfx::Bitmap& bitmap, const char* layer_name,
+                                 int y_begin = 0, int y_end = -1) {
   SDL_Surface* surface = bitmap.surface();
   if (!bitmap.modified() || surface == nullptr || bitmap.size() == 0) {
     return;
@@ -66,9 +67,12 @@ void SyncModifiedBitmapToSurface(gfx::Bitmap& bitmap, const char* layer_name) {
               SDL_GetError());
     return;
   }
+  if (y_end < 0 || y_end > height) {
+    y_end = height;
+  }
   auto* destination = static_cast<uint8_t*>(surface->pixels);
   const uint8_t* source = bitmap.data();
-  for (int y = 0; y < height; ++y) {
+  for (int y = std::max(y_begin, 0); y < y_end; ++y) {
     std::memcpy(destination + static_cast<size_t>(y) *
                                   static_cast<size_t>(surface->pitch),
                 source + static_cast<size_t>(y) * row_bytes, row_bytes);
@@ -140,33 +144,32 @@ void ObjectDrawer::TraceHookThunk(gfx::BackgroundBuffer* /*bg*/, int tile_x,
 void ObjectDrawer::DrawUsingRegistryRoutine(
     int routine_id, const RoomObject& obj, gfx::BackgroundBuffer& bg,
     std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-  // Many DrawRoutineRegistry routines are implemented as pure functions that
-  // call DrawRoutineUtils::WriteTile8(), which only writes to BackgroundBuffer's
-  // tile buffer (not the bitmap). Runtime rendering/compositing uses the
-  // bitmap-backed buffers, so we capture tile writes from the pure routine and
-  // replay them via ObjectDrawer::WriteTile8().
   const auto* info = DrawRoutineRegistry::Get().GetRoutineInfo(routine_id);
   if (info == nullptr) {
     LOG_DEBUG("ObjectDrawer", "DrawUsingRegistryRoutine: unknown routine %d",
               routine_id);
     return;
   }
+  DrawUsingRegistryRoutine(*info, obj, bg, tiles, state);
+}
 
-  struct CapturedWrite {
-    int x = 0;
-    int y = 0;
-    gfx::TileInfo tile{};
-    bool secondary = false;
-  };
-
+void ObjectDrawer::DrawUsingRegistryRoutine(
+    const DrawRoutineInfo& info, const RoomObject& obj,
+    gfx::BackgroundBuffer& bg, std::span<const gfx::TileInfo> tiles,
+    const DungeonState* state) {
+  // Many DrawRoutineRegistry routines are implemented as pure functions that
+  // call DrawRoutineUtils::WriteTile8(), which only writes to BackgroundBuffer's
+  // tile buffer (not the bitmap). Runtime rendering/compositing uses the
+  // bitmap-backed buffers, so we capture tile writes from the pure routine and
+  // replay them via ObjectDrawer::WriteTile8().
   struct CaptureState {
     std::vector<CapturedWrite>* writes = nullptr;
     gfx::BackgroundBuffer* secondary_bg = nullptr;
   };
 
-  std::vector<CapturedWrite> writes;
-  writes.reserve(256);
-  CaptureState capture_state{.writes = &writes,
+  // Reused across objects; a room draw would otherwise allocate per object.
+  registry_writes_.clear();
+  CaptureState capture_state{.writes = &registry_writes_,
                              .secondary_bg = registry_secondary_bg_};
 
   DrawRoutineUtils::SetTraceHook(
@@ -197,11 +200,11 @@ void ObjectDrawer::DrawUsingRegistryRoutine(
       .room_gfx_buffer = room_gfx_buffer_,
       .secondary_bg = registry_secondary_bg_,
   };
-  info->function(ctx);
+  info.function(ctx);
 
   DrawRoutineUtils::ClearTraceHook();
 
-  for (const auto& w : writes) {
+  for (const auto& w : registry_writes_) {
     if (w.secondary && registry_secondary_bg_ != nullptr) {
       SetTraceContext(obj, registry_secondary_layer_);
       WriteTile8(*registry_secondary_bg_, w.x, w.y, w.tile);
@@ -287,10 +290,10 @@ absl::Status ObjectDrawer::DrawObject(
             object.id_, object.x_, object.y_, object.size_, routine_id,
             mutable_obj.tiles().size());
 
-  if (routine_id < 0 || routine_id >= static_cast<int>(draw_routines_.size())) {
+  if (routine_id < 0 || routine_id >= DrawRoutineIds::kRoutineCount) {
     LOG_DEBUG("ObjectDrawer",
-              "Object 0x%03X: NO ROUTINE (id=%d, max=%zu) - using fallback 1x1",
-              object.id_, routine_id, draw_routines_.size());
+              "Object 0x%03X: NO ROUTINE (id=%d, max=%d) - using fallback 1x1",
+              object.id_, routine_id, DrawRoutineIds::kRoutineCount);
     // Fallback to simple 1x1 drawing using first 8x8 tile
     if (!mutable_obj.tiles().empty()) {
       const auto& tile_info = mutable_obj.tiles()[0];
@@ -333,7 +336,8 @@ absl::Status ObjectDrawer::DrawObject(
   // Check if this should draw to both BG layers.
   // In the original engine, BothBG routines explicitly write to both tilemaps
   // regardless of which object list or pass they are executed from.
-  bool is_both_bg = (object.all_bgs_ || RoutineDrawsToBothBGs(routine_id));
+  bool is_both_bg =
+      object.all_bgs_ || (routine_info && routine_info->draws_to_both_bgs);
   const bool use_rectangular_bg1_mask =
       !trace_only_ && object.layer_ == RoomObject::LayerType::BG2 &&
       !is_both_bg && RequiresRectangularBg1Mask(object);
@@ -376,20 +380,32 @@ absl::Status ObjectDrawer::DrawObject(
     active_mask_source_bg_ = &bg2;
   }
 
+  const DrawRoutine drawer_routine = kDrawRoutineTable[routine_id];
+  auto run_routine = [&](gfx::BackgroundBuffer& bg) {
+    if (drawer_routine != nullptr) {
+      (this->*drawer_routine)(object, bg, mutable_obj.tiles(), state);
+    } else if (routine_info != nullptr) {
+      DrawUsingRegistryRoutine(*routine_info, object, bg, mutable_obj.tiles(),
+                               state);
+    } else {
+      LOG_DEBUG("ObjectDrawer", "Object 0x%03X: routine %d not registered",
+                object.id_, routine_id);
+    }
+  };
+
   if (is_both_bg) {
     // Draw to both background layers
     registry_secondary_bg_ = nullptr;
     registry_primary_layer_ = RoomObject::LayerType::BG1;
     SetTraceContext(object, RoomObject::LayerType::BG1);
-    draw_routines_[routine_id](this, object, bg1, mutable_obj.tiles(), state);
+    run_routine(bg1);
     registry_primary_layer_ = RoomObject::LayerType::BG2;
     SetTraceContext(object, RoomObject::LayerType::BG2);
-    draw_routines_[routine_id](this, object, bg2, mutable_obj.tiles(), state);
+    run_routine(bg2);
   } else {
     // Execute the appropriate draw routine on target buffer only
     SetTraceContext(object, registry_primary_layer_);
-    draw_routines_[routine_id](this, object, *dispatch_bg, mutable_obj.tiles(),
-                               state);
+    run_routine(*dispatch_bg);
   }
 
   if (trace_hook_active) {
@@ -412,7 +428,7 @@ absl::Status ObjectDrawer::DrawObject(
     // source as selection bounds (ObjectGeometry if available, then
     // ObjectDimensionTable, then the size-nibble fallback). Keeps the
     // transparent cutout aligned with what the user sees in the editor.
-    ObjectDimensionTable::Get().LoadFromRom(rom_).IgnoreError();
+    // LoadGameData() loads the dimension table when the ROM is opened.
     const auto [mask_px_x, mask_px_y, pixel_width, pixel_height] =
         DimensionService::Get().GetSelectionBoundsPixels(object);
 
@@ -451,7 +467,8 @@ absl::Status ObjectDrawer::DrawObjectList(
     const std::vector<RoomObject>& objects, gfx::BackgroundBuffer& bg1,
     gfx::BackgroundBuffer& bg2, const gfx::PaletteGroup& palette_group,
     [[maybe_unused]] const DungeonState* state,
-    gfx::BackgroundBuffer* layout_bg1, bool reset_room_event_indices) {
+    gfx::BackgroundBuffer* layout_bg1, bool reset_room_event_indices,
+    std::vector<ObjectDrawRecord>* records) {
   if (reset_room_event_indices) {
     ResetChestIndex();
   }
@@ -474,10 +491,18 @@ absl::Status ObjectDrawer::DrawObjectList(
       to_bg1++;
     }
 
+    ObjectDrawRecord record;
+    record.trace_begin = trace_collector_ ? trace_collector_->size() : 0;
+    record.cursor_before = room_event_cursor();
     auto s = DrawObject(object, bg1, bg2, palette_group, state, layout_bg1);
     if (!s.ok() && status.ok()) {
       status = s;
     }
+    if (records) {
+      record.trace_end = trace_collector_ ? trace_collector_->size() : 0;
+      record.cursor_after = room_event_cursor();
+      records->push_back(record);
+    }
   }
 
   LOG_DEBUG("ObjectDrawer", "Buffer routing: to_BG1=%d, to_BG2=%d, BothBGs=%d",
@@ -491,6 +516,11 @@ absl::Status ObjectDrawer::DrawObjectList(
   return status;
 }
 
+void ObjectDrawer::SyncBitmapRowsToSurface(gfx::Bitmap& bitmap, int y_begin,
+                                           int y_end) {
+  SyncModifiedBitmapToSurface(bitmap, "partial", y_begin, y_end);
+}
+
 // ============================================================================
 // Metadata-based BothBG Detection
 // ============================================================================
@@ -501,1002 +531,45 @@ bool ObjectDrawer::RoutineDrawsToBothBGs(int routine_id) {
 }
 
 // ============================================================================
-// Draw Routine Registry Initialization
+// Draw Routine Dispatch Table
 // ============================================================================
 
-void ObjectDrawer::InitializeDrawRoutines() {
-  // This function maps object IDs to their corresponding draw routines.
-  // The mapping is based on ZScream's DungeonObjectData.cs and the game's
-  // assembly code. The order of functions in draw_routines_ MUST match the
-  // indices used here.
-  //
-  // ASM Reference (Bank 01):
-  // Subtype 1 Data Offset: $018000 (DrawObjects.type1_subtype_1_data_offset)
+constexpr ObjectDrawer::DrawRoutineTable ObjectDrawer::BuildDrawRoutineTable() {
+  // Routine IDs come from DrawRoutineRegistry::BuildObjectMapping(), which
+  // mirrors the bank 01 routine pointer tables:
   // Subtype 1 Routine Ptr: $018200 (DrawObjects.type1_subtype_1_routine)
-  // Subtype 2 Data Offset: $0183F0 (DrawObjects.type1_subtype_2_data_offset)
   // Subtype 2 Routine Ptr: $018470 (DrawObjects.type1_subtype_2_routine)
-  // Subtype 3 Data Offset: $0184F0 (DrawObjects.type1_subtype_3_data_offset)
   // Subtype 3 Routine Ptr: $0185F0 (DrawObjects.type1_subtype_3_routine)
+  //
+  // Empty entries run the registry's pure DrawContext routine through
+  // DrawUsingRegistryRoutine(). Only routines that need drawer state (chest
+  // and lock event counters, custom object files) are overridden here.
+  DrawRoutineTable table{};
 
-  draw_routines_.clear();
-
-  // Object-to-routine mapping now lives in DrawRoutineRegistry::BuildObjectMapping().
-  // ObjectDrawer::GetDrawRoutineId() delegates to the registry singleton.
-  // Initialize draw routine function array in the correct order
-  // Routines 0-82 (existing), 80-98 (new special routines for stairs, locks, etc.)
-  draw_routines_.reserve(100);
-
-  // Routine 0
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(0, obj, bg, tiles, state);
-      });
-  // Routine 1
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(1, obj, bg, tiles, state);
-      });
-  // Routine 2 - 2x4 tiles with adjacent spacing (s * 2), count = size + 1
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(2, obj, bg, tiles, state);
-      });
-  // Routine 3 - Same as routine 2 but draws to both BG1 and BG2
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(3, obj, bg, tiles, state);
-      });
-  // Routine 4
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(4, obj, bg, tiles, state);
-      });
-  // Routine 5
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(5, obj, bg, tiles, state);
-      });
-  // Routine 6
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(6, obj, bg, tiles, state);
-      });
-  // Routine 7
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(7, obj, bg, tiles, state);
-      });
-  // Routine 8
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(8, obj, bg, tiles, state);
-      });
-  // Routine 9
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(9, obj, bg, tiles, state);
-      });
-  // Routine 10
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(10, obj, bg, tiles, state);
-      });
-  // Routine 11
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(11, obj, bg, tiles, state);
-      });
-  // Routine 12
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(12, obj, bg, tiles, state);
-      });
-  // Routine 13
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(13, obj, bg, tiles, state);
-      });
-  // Routine 14
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(14, obj, bg, tiles, state);
-      });
-  // Routine 15
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(15, obj, bg, tiles, state);
-      });
-  // Routine 16
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(16, obj, bg, tiles, state);
-      });
-  // Routine 17 - Diagonal Acute BothBG
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(17, obj, bg, tiles, state);
-      });
-  // Routine 18 - Diagonal Grave BothBG
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(18, obj, bg, tiles, state);
-      });
-  // Routine 19 - 4x4 Corner (Type 2 corners)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(19, obj, bg, tiles, state);
-      });
-
-  // Routine 20 - Edge objects 1x2 +2
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(20, obj, bg, tiles, state);
-      });
-  // Routine 21 - Edge with perimeter 1x1 +3
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(21, obj, bg, tiles, state);
-      });
-  // Routine 22 - Edge variant 1x1 +2
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(22, obj, bg, tiles, state);
-      });
-  // Routine 23 - Top corners 1x2 +13
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(23, obj, bg, tiles, state);
-      });
-  // Routine 24 - Bottom corners 1x2 +13
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(24, obj, bg, tiles, state);
-      });
-  // Routine 25 - Solid fill 1x1 +3 (floor patterns)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(25, obj, bg, tiles, state);
-      });
-  // Routine 26 - Door switcherer
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(26, obj, bg, tiles, state);
-      });
-  // Routine 27 - Decorations 4x4 spaced 2
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(27, obj, bg, tiles, state);
-      });
-  // Routine 28 - Statues 2x3 spaced 2
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(28, obj, bg, tiles, state);
-      });
-  // Routine 29 - Pillars 2x4 spaced 4
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(29, obj, bg, tiles, state);
-      });
-  // Routine 30 - Decorations 4x3 spaced 4
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(30, obj, bg, tiles, state);
-      });
-  // Routine 31 - Doubled 2x2 spaced 2
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(31, obj, bg, tiles, state);
-      });
-  // Routine 32 - Decorations 2x2 spaced 12
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(32, obj, bg, tiles, state);
-      });
-  // Routine 33 - Somaria Line
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(33, obj, bg, tiles, state);
-      });
-  // Routine 34 - Water Face
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(34, obj, bg, tiles, state);
-      });
-  // Routine 35 - 4x4 Corner BothBG
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(35, obj, bg, tiles, state);
-      });
-  // Routine 36 - Weird Corner Bottom BothBG
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(36, obj, bg, tiles, state);
-      });
-  // Routine 37 - Weird Corner Top BothBG
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(37, obj, bg, tiles, state);
-      });
-  // Routine 38 - Nothing
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(38, obj, bg, tiles, state);
-      });
-  // Routine 39 - Small chest rendering (stateful F99 / fixed-open F9A)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawChest(obj, bg, tiles, state);
-      });
-  // Routine 40 - Rightwards 4x2 (Floor Tile)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(40, obj, bg, tiles, state);
-      });
-  // Routine 41 - Rightwards Decor 4x2 spaced 8 (12-column spacing)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(41, obj, bg, tiles, state);
-      });
-  // Routine 42 - Rightwards Cannon Hole 4x3
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(42, obj, bg, tiles, state);
-      });
-  // Routine 43 - Downwards Floor 4x4 (object 0x70)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(43, obj, bg, tiles, state);
-      });
-  // Routine 44 - Downwards 1x1 Solid +3 (object 0x71)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(44, obj, bg, tiles, state);
-      });
-  // Routine 45 - Downwards Decor 4x4 spaced 2 (objects 0x73-0x74)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(45, obj, bg, tiles, state);
-      });
-  // Routine 46 - Downwards Pillar 2x4 spaced 2 (objects 0x75, 0x87)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(46, obj, bg, tiles, state);
-      });
-  // Routine 47 - Downwards Decor 3x4 spaced 4 (objects 0x76-0x77)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(47, obj, bg, tiles, state);
-      });
-  // Routine 48 - Downwards Decor 2x2 spaced 12 (objects 0x78, 0x7B)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(48, obj, bg, tiles, state);
-      });
-  // Routine 49 - Downwards Line 1x1 +1 (object 0x7C)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(49, obj, bg, tiles, state);
-      });
-  // Routine 50 - Downwards Decor 2x4 spaced 8 (objects 0x7F, 0x80)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(50, obj, bg, tiles, state);
-      });
-  // Routine 51 - Rightwards Line 1x1 +1 (object 0x50)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(51, obj, bg, tiles, state);
-      });
-  // Routine 52 - Rightwards Bar 4x3 (object 0x4C)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(52, obj, bg, tiles, state);
-      });
-  // Routine 53 - Rightwards Shelf 4x4 (objects 0x4D-0x4F)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(53, obj, bg, tiles, state);
-      });
-  // Routine 54 - Rightwards Big Rail 1x3 +5 (object 0x5D)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(54, obj, bg, tiles, state);
-      });
-  // Routine 55 - Rightwards Block 2x2 spaced 2 (object 0x5E)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(55, obj, bg, tiles, state);
-      });
-
-  // ============================================================================
-  // Phase 4: SuperSquare Routines (routines 56-64)
-  // ============================================================================
-
-  // Routine 56 - 4x4 Blocks in 4x4 SuperSquare (objects 0xC0, 0xC2)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(56, obj, bg, tiles, state);
-      });
-
-  // Routine 57 - 3x3 Floor in 4x4 SuperSquare (objects 0xC3, 0xD7)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(57, obj, bg, tiles, state);
-      });
-
-  // Routine 58 - 4x4 Floor in 4x4 SuperSquare (objects 0xC5-0xCA, 0xD1-0xD2,
-  // 0xD9, 0xDF-0xE8)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(58, obj, bg, tiles, state);
-      });
-
-  // Routine 59 - 4x4 Floor One in 4x4 SuperSquare (object 0xC4)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(59, obj, bg, tiles, state);
-      });
-
-  // Routine 60 - 4x4 Floor Two in 4x4 SuperSquare (object 0xDB)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(60, obj, bg, tiles, state);
-      });
-
-  // Routine 61 - Big Hole 4x4 (object 0xA4)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(61, obj, bg, tiles, state);
-      });
-
-  // Routine 62 - Spike 2x2 in 4x4 SuperSquare (object 0xDE)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(62, obj, bg, tiles, state);
-      });
-
-  // Routine 63 - Table Rock 4x4 (object 0xDD)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(63, obj, bg, tiles, state);
-      });
-
-  // Routine 64 - Water Overlay 8x8 (objects 0xD8, 0xDA)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(64, obj, bg, tiles, state);
-      });
-
-  // ============================================================================
-  // Phase 4 Step 2: Simple Variant Routines (routines 65-74)
-  // ============================================================================
-
-  // Routine 65 - Downwards Decor 3x4 spaced 2 (objects 0x81-0x84)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(65, obj, bg, tiles, state);
-      });
-
-  // Routine 66 - Downwards Big Rail 3x1 plus 5 (object 0x88)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(66, obj, bg, tiles, state);
-      });
-
-  // Routine 67 - Downwards Block 2x2 spaced 2 (object 0x89)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(67, obj, bg, tiles, state);
-      });
-
-  // Routine 68 - Downwards Cannon Hole 3x6 (objects 0x85-0x86)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(68, obj, bg, tiles, state);
-      });
-
-  // Routine 69 - Downwards Bar 2x3 (object 0x8F)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(69, obj, bg, tiles, state);
-      });
-
-  // Routine 70 - Downwards Pots 2x2 (object 0x95)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(70, obj, bg, tiles, state);
-      });
-
-  // Routine 71 - Downwards Hammer Pegs 2x2 (object 0x96)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(71, obj, bg, tiles, state);
-      });
-
-  // Routine 72 - Rightwards Edge 1x1 plus 7 (objects 0xB0-0xB1)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(72, obj, bg, tiles, state);
-      });
-
-  // Routine 73 - Rightwards Pots 2x2 (object 0xBC)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(73, obj, bg, tiles, state);
-      });
-
-  // Routine 74 - Rightwards Hammer Pegs 2x2 (object 0xBD)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(74, obj, bg, tiles, state);
-      });
-
-  // ============================================================================
-  // Phase 4 Step 3: Diagonal Ceiling Routines (routines 75-78)
-  // ============================================================================
-
-  // Routine 75 - Diagonal Ceiling Top Left (objects 0xA0, 0xA5, 0xA9)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(75, obj, bg, tiles, state);
-      });
-
-  // Routine 76 - Diagonal Ceiling Bottom Left (objects 0xA1, 0xA6, 0xAA)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(76, obj, bg, tiles, state);
-      });
-
-  // Routine 77 - Diagonal Ceiling Top Right (objects 0xA2, 0xA7, 0xAB)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(77, obj, bg, tiles, state);
-      });
-
-  // Routine 78 - Diagonal Ceiling Bottom Right (objects 0xA3, 0xA8, 0xAC)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(78, obj, bg, tiles, state);
-      });
-
-  // ============================================================================
-  // Phase 4 Step 5: Special Routines (routines 79-82)
-  // ============================================================================
-
-  // Routine 79 - Closed Chest Platform (object 0xC1, 68 tiles)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(79, obj, bg, tiles, state);
-      });
-
-  // Routine 80 - Moving Wall West (object 0xCD, 24 tiles)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(80, obj, bg, tiles, state);
-      });
-
-  // Routine 81 - Moving Wall East (object 0xCE, 24 tiles)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(81, obj, bg, tiles, state);
-      });
-
-  // Routine 82 - Open Chest Platform (object 0xDC, 21 tiles)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(82, obj, bg, tiles, state);
-      });
-
-  // ============================================================================
-  // New Special Routines (Phase 5) - Stairs, Locks, Interactive Objects
-  // ============================================================================
-
-  // Routine 83 - InterRoom Fat Stairs Up (object 0x12D)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(83, obj, bg, tiles, state);
-      });
-
-  // Routine 84 - InterRoom Fat Stairs Down A (object 0x12E)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(84, obj, bg, tiles, state);
-      });
-
-  // Routine 85 - InterRoom Fat Stairs Down B (object 0x12F)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(85, obj, bg, tiles, state);
-      });
-
-  // Routine 86 - Auto Stairs (objects 0x130-0x133)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(86, obj, bg, tiles, state);
-      });
-
-  // Routine 87 - Straight InterRoom Stairs (Type 3 objects 0x21E-0x229)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(87, obj, bg, tiles, state);
-      });
-
-  // Routine 88 - Spiral Stairs Going Up Upper (object 0x138)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(88, obj, bg, tiles, state);
-      });
-
-  // Routine 89 - Spiral Stairs Going Down Upper (object 0x139)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(89, obj, bg, tiles, state);
-      });
-
-  // Routine 90 - Spiral Stairs Going Up Lower (object 0x13A)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(90, obj, bg, tiles, state);
-      });
-
-  // Routine 91 - Spiral Stairs Going Down Lower (object 0x13B)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(91, obj, bg, tiles, state);
-      });
-
-  // Routine 92 - Big Key Lock (Yaze 0xF98 / ASM object 0x218)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawBigKeyLock(obj, bg, tiles, state);
-      });
-
-  // Routine 93 - Bombable Floor (Type 3 object 0x247)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(93, obj, bg, tiles, state);
-      });
-
-  // Routine 94 - Empty Water Face (Type 3 object 0x200)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(94, obj, bg, tiles, state);
-      });
-
-  // Routine 95 - Spitting Water Face (Type 3 object 0x201)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(95, obj, bg, tiles, state);
-      });
-
-  // Routine 96 - Drenching Water Face (Type 3 object 0x202)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(96, obj, bg, tiles, state);
-      });
-
-  // Routine 97 - Prison Cell (Type 3 objects 0x20D, 0x217)
-  // USDASM selects one tilemap through $BF and draws a sparse 16x4 pattern.
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(97, obj, bg, tiles, state);
-      });
-
-  // Routine 98 - Bed 4x5 (Type 2 objects 0x122, 0x128)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kBed4x5, obj, bg, tiles,
-                                       state);
-      });
-
-  // Routine 99 - Rightwards 3x6 (Type 2 object 0x12C, Type 3 0x236-0x237)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kRightwards3x6, obj, bg,
-                                       tiles, state);
-      });
-
-  // Routine 100 - Utility 6x3 (Type 2 object 0x13E, Type 3 0x24D, 0x25D)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kUtility6x3, obj, bg,
-                                       tiles, state);
-      });
-
-  // Routine 101 - Utility 3x5 (Type 3 objects 0x255, 0x25B)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kUtility3x5, obj, bg,
-                                       tiles, state);
-      });
-
-  // Routine 102 - Vertical Turtle Rock Pipe (Type 3 objects 0x23A, 0x23B)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kVerticalTurtleRockPipe,
-                                       obj, bg, tiles, state);
-      });
-
-  // Routine 103 - Horizontal Turtle Rock Pipe (Type 3 objects 0x23C, 0x23D,
-  // 0x25C)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(
-            DrawRoutineIds::kHorizontalTurtleRockPipe, obj, bg, tiles, state);
-      });
-
-  // Routine 104 - Light Beam on Floor (Type 3 object 0x270)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kLightBeam, obj, bg,
-                                       tiles, state);
-      });
-
-  // Routine 105 - Big Light Beam on Floor (Type 3 object 0x271)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kBigLightBeam, obj, bg,
-                                       tiles, state);
-      });
-
-  // Routine 106 - Boss Shell 4x4 (Yaze 0xF95/0xFF2; ASM 0x215/0x272)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kBossShell4x4, obj, bg,
-                                       tiles, state);
-      });
-
-  // Routine 107 - Solid Wall Decor 3x4 (Type 3 objects 0x269-0x26A, 0x26E-0x26F)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kSolidWallDecor3x4, obj,
-                                       bg, tiles, state);
-      });
-
-  // Routine 108 - Archery Game Target Door (Type 3 objects 0x260-0x261)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kArcheryGameTargetDoor,
-                                       obj, bg, tiles, state);
-      });
-
-  // Routine 109 - Ganon Triforce Floor Decor (Type 3 object 0x278)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kGanonTriforceFloorDecor,
-                                       obj, bg, tiles, state);
-      });
-
-  // Routine 110 - Single 2x2 (pots, statues, single-instance 2x2 objects)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kSingle2x2, obj, bg,
-                                       tiles, state);
-      });
-
-  // Routine 111 - Waterfall47 (object 0x47)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kWaterfall47, obj, bg,
-                                       tiles, state);
-      });
-
-  // Routine 112 - Waterfall48 (object 0x48)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kWaterfall48, obj, bg,
-                                       tiles, state);
-      });
-
-  // Routine 113 - Single 4x4 (NO repetition)
-  // ASM: RoomDraw_4x4 - draws a single 4x4 pattern (16 tiles)
-  // Used for: 0xFEB (large decor), and other single 4x4 objects
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kSingle4x4, obj, bg,
-                                       tiles, state);
-      });
-
-  // Routine 114 - Single 4x3 (NO repetition)
-  // ASM: RoomDraw_TableRock4x3 - draws a single 4x3 pattern (12 tiles)
-  // Used for: 0xFED (water grate), 0xFB1 (big chest), etc.
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        if (obj.id_ == 0xFB1) {
-          self->DrawBigChest(obj, bg, tiles, state);
-          return;
-        }
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kSingle4x3, obj, bg,
-                                       tiles, state);
-      });
-
-  // Routine 115 - RupeeFloor (special pattern for 0xF92)
-  // ASM: RoomDraw_RupeeFloor - draws 3 one-tile columns two tiles apart.
-  // Pattern: 5 tiles wide, 8 rows tall with gaps (rows 2 and 5 are empty).
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kRupeeFloor, obj, bg,
-                                       tiles, state);
-      });
-
-  // Routine 116 - Actual 4x4 tile8 pattern (32x32 pixels, NO repetition)
-  // ASM: RoomDraw_4x4 - draws exactly 4 columns x 4 rows = 16 tiles
-  // Used for: 0xFE6 (pit)
-  draw_routines_.push_back(
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kActual4x4, obj, bg,
-                                       tiles, state);
-      });
-
-  auto ensure_index = [this](size_t index) {
-    while (draw_routines_.size() <= index) {
-      draw_routines_.push_back([](ObjectDrawer* self, const RoomObject& obj,
-                                  gfx::BackgroundBuffer& bg,
-                                  std::span<const gfx::TileInfo> tiles,
-                                  [[maybe_unused]] const DungeonState* state) {
-        self->DrawNothing(obj, bg, tiles, state);
-      });
-    }
-  };
+  // Routine 39 - Chest (F99 stateful, F9A fixed open graphic)
+  table[DrawRoutineIds::kChest] = &ObjectDrawer::DrawChest;
 
-  // Routine 117 - Long vertical rail with CORNER+MIDDLE+END pattern (0x8A)
-  // ASM: RoomDraw_DownwardsHasEdge1x1_1to16_plus23 - matches horizontal 0x22
-  ensure_index(117);
-  draw_routines_[117] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(117, obj, bg, tiles, state);
-      };
-
-  // Routine 118 - Horizontal long rails with CORNER+MIDDLE+END pattern (0x5F)
-  ensure_index(118);
-  draw_routines_[118] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(118, obj, bg, tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kWaterHopStairsA);
-  draw_routines_[DrawRoutineIds::kWaterHopStairsA] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kWaterHopStairsA, obj,
-                                       bg, tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kWaterHopStairsB);
-  draw_routines_[DrawRoutineIds::kWaterHopStairsB] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kWaterHopStairsB, obj,
-                                       bg, tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kDamFloodGate);
-  draw_routines_[DrawRoutineIds::kDamFloodGate] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kDamFloodGate, obj, bg,
-                                       tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kDownwardsEdge1x1_1to16plus7);
-  draw_routines_[DrawRoutineIds::kDownwardsEdge1x1_1to16plus7] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(
-            DrawRoutineIds::kDownwardsEdge1x1_1to16plus7, obj, bg, tiles,
-            state);
-      };
-
-  ensure_index(DrawRoutineIds::kFloorLight);
-  draw_routines_[DrawRoutineIds::kFloorLight] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kFloorLight, obj, bg,
-                                       tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kWeird2x4_1to16);
-  draw_routines_[DrawRoutineIds::kWeird2x4_1to16] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kWeird2x4_1to16, obj, bg,
-                                       tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kBigWallDecor);
-  draw_routines_[DrawRoutineIds::kBigWallDecor] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kBigWallDecor, obj, bg,
-                                       tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kTableBowl);
-  draw_routines_[DrawRoutineIds::kTableBowl] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kTableBowl, obj, bg,
-                                       tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kSmithyFurnace);
-  draw_routines_[DrawRoutineIds::kSmithyFurnace] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kSmithyFurnace, obj, bg,
-                                       tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kBigGrayRock);
-  draw_routines_[DrawRoutineIds::kBigGrayRock] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kBigGrayRock, obj, bg,
-                                       tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kAgahnimsAltar);
-  draw_routines_[DrawRoutineIds::kAgahnimsAltar] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kAgahnimsAltar, obj, bg,
-                                       tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kFortuneTellerRoom);
-  draw_routines_[DrawRoutineIds::kFortuneTellerRoom] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kFortuneTellerRoom, obj,
-                                       bg, tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kMagicBatAltar);
-  draw_routines_[DrawRoutineIds::kMagicBatAltar] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kMagicBatAltar, obj, bg,
-                                       tiles, state);
-      };
-
-  ensure_index(DrawRoutineIds::kVitreousGooDamage);
-  draw_routines_[DrawRoutineIds::kVitreousGooDamage] =
-      [](ObjectDrawer* self, const RoomObject& obj, gfx::BackgroundBuffer& bg,
-         std::span<const gfx::TileInfo> tiles, const DungeonState* state) {
-        self->DrawUsingRegistryRoutine(DrawRoutineIds::kVitreousGooDamage, obj,
-                                       bg, tiles, state);
-      };
+  // Routine 92 - Big key lock (skipped once opened)
+  table[DrawRoutineIds::kBigKeyLock] = &ObjectDrawer::DrawBigKeyLock;
+
+  // Routine 114 - Single 4x3; 0xFB1 (big chest) shares it but is stateful
+  table[DrawRoutineIds::kSingle4x3] = &ObjectDrawer::DrawSingle4x3;
 
   // Routine 130 - Custom Object (Oracle of Secrets 0x31, 0x32)
   // Uses external binary files instead of ROM tile data.
   // Requires CustomObjectManager initialization and enable_custom_objects flag.
-  ensure_index(130);
-  draw_routines_[130] = [](ObjectDrawer* self, const RoomObject& obj,
-                           gfx::BackgroundBuffer& bg,
-                           std::span<const gfx::TileInfo> tiles,
-                           [[maybe_unused]] const DungeonState* state) {
-    self->DrawCustomObject(obj, bg, tiles, state);
-  };
+  table[DrawRoutineIds::kCustomObject] = &ObjectDrawer::DrawCustomObject;
+
+  return table;
+}
+
+constinit const ObjectDrawer::DrawRoutineTable ObjectDrawer::kDrawRoutineTable =
+    ObjectDrawer::BuildDrawRoutineTable();
 
+void ObjectDrawer::InitializeDrawRoutines() {
+  // The dispatch table is static; only the registry it indexes into needs to
+  // exist before the first draw.
+  DrawRoutineRegistry::Get();
   routines_initialized_ = true;
 }
 
@@ -2074,6 +1147,17 @@ void ObjectDrawer::DrawBigKeyLock(const RoomObject& obj,
   DrawUsingRegistryRoutine(DrawRoutineIds::kBigKeyLock, obj, bg, tiles, state);
 }
 
+void ObjectDrawer::DrawSingle4x3(const RoomObject& obj,
+                                 gfx::BackgroundBuffer& bg,
+                                 std::span<const gfx::TileInfo> tiles,
+                                 const DungeonState* state) {
+  if (obj.id_ == 0xFB1) {
+    DrawBigChest(obj, bg, tiles, state);
+    return;
+  }
+  DrawUsingRegistryRoutine(DrawRoutineIds::kSingle4x3, obj, bg, tiles, state);
+}
+
 void ObjectDrawer::DrawNothing(const RoomObject& obj, gfx::BackgroundBuffer& bg,
                                std::span<const gfx::TileInfo> tiles,
                                [[maybe_unused]] const DungeonState* state) {
@@ -2229,7 +1313,7 @@ void ObjectDrawer::WriteTile8(gfx::BackgroundBuffer& bg, int tile_x, int tile_y,
     return;  // Bitmap not ready
   }
 
-  // The room-specific graphics buffer (current_gfx16_) contains the assembled
+  // The room-specific graphics buffer (Room::get_gfx_buffer) holds the assembled
   // tile graphics for the current room. Object tile IDs are relative to this
   // buffer.
   const uint8_t* gfx_data = room_gfx_buffer_;
@@ -2374,6 +1458,39 @@ void ObjectDrawer::DrawTileToBitmap(gfx::Bitmap& bitmap,
   // (transparent key) for zero pixels.
   bool any_pixels_changed = false;
 
+  // Fast path: whole-row blits from the pre-flipped tile cache when the tile
+  // lies entirely inside the bitmap.
+  if (tile_pixel_cache_ && tiledata == room_gfx_buffer_ && pixel_x >= 0 &&
+      pixel_y >= 0 && pixel_x + 8 <= bitmap.width() &&
+      pixel_y + 8 <= bitmap.height() &&
+      static_cast<size_t>(bitmap.width()) * bitmap.height() <=
+          bitmap.mutable_data().size()) {
+    const uint8_t* pixels = tile_pixel_cache_->GetTileById(
+        tiledata, kGfxBufferSize, tile_info.id_,
+        gfx::TilePixelCache::FlipIndex(tile_info.horizontal_mirror_,
+                                       tile_info.vertical_mirror_));
+    if (pixels) {
+      constexpr uint64_t kTransparentRow = ~0ULL;
+      uint8_t* dst_base = bitmap.mutable_data().data();
+      for (int py = 0; py < 8; py++) {
+        const uint64_t src = gfx::TilePixelCache::LoadRow(pixels, py);
+        const uint64_t mask = gfx::TilePixelCache::OpaqueMask(src);
+        const uint64_t out =
+            (gfx::TilePixelCache::AddToLanes(src, palette_offset) & mask) |
+            (kTransparentRow & ~mask);
+        uint8_t* dst = dst_base + (pixel_y + py) * bitmap.width() + pixel_x;
+        if (gfx::TilePixelCache::LoadRow(dst, 0) != out) {
+          gfx::TilePixelCache::StoreRow(dst, out);
+          any_pixels_changed = true;
+        }
+      }
+      if (any_pixels_changed) {
+        bitmap.set_modified(true);
+      }
+      return;
+    }
+  }
+
   for (int py = 0; py < 8; py++) {
     // Source row with vertical mirroring
     int src_row = tile_info.vertical_mirror_ ? (7 - py) : py;
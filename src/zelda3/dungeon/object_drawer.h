@@ -1,18 +1,21 @@
 #ifndef YAZE_APP_ZELDA3_DUNGEON_OBJECT_DRAWER_H
 #define YAZE_APP_ZELDA3_DUNGEON_OBJECT_DRAWER_H
 
-#include <functional>
+#include <array>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
 #include "absl/status/status.h"
 #include "app/gfx/render/background_buffer.h"
+#include "app/gfx/render/tile_pixel_cache.h"
 #include "app/gfx/types/snes_palette.h"
 #include "app/gfx/types/snes_tile.h"
 #include "rom/rom.h"
 #include "zelda3/dungeon/custom_object.h"
 #include "zelda3/dungeon/door_position.h"
 #include "zelda3/dungeon/door_types.h"
+#include "zelda3/dungeon/draw_routines/draw_routine_registry.h"
 #include "zelda3/dungeon/dungeon_state.h"
 #include "zelda3/dungeon/room_object.h"
 
@@ -75,12 +78,41 @@ class ObjectDrawer {
     current_chest_index_ = 0;
     current_room_event_index_ = 0;
   }
+
+  // Chest and room-event indexes at one point of a room's object stream.
+  // Saved per object so a partial redraw can resume mid-stream.
+  struct RoomEventCursor {
+    int chest_index = 0;
+    int room_event_index = 0;
+    bool operator==(const RoomEventCursor&) const = default;
+  };
+  RoomEventCursor room_event_cursor() const {
+    return {current_chest_index_, current_room_event_index_};
+  }
+  void set_room_event_cursor(const RoomEventCursor& cursor) {
+    current_chest_index_ = cursor.chest_index;
+    current_room_event_index_ = cursor.room_event_index;
+  }
+
+  // What DrawObjectList did for one object: its slice of the trace collector
+  // and the room-event indexes around it.
+  struct ObjectDrawRecord {
+    size_t trace_begin = 0;
+    size_t trace_end = 0;
+    RoomEventCursor cursor_before;
+    RoomEventCursor cursor_after;
+  };
   void SetAllowTrackCornerAliases(bool allow) {
     allow_track_corner_aliases_ = allow;
   }
   void SetBG1RevealMaskSource(gfx::BG1RevealMaskSource source) {
     bg1_reveal_mask_source_ = source;
   }
+  // Optional pre-flipped tile cache over room_gfx_buffer_. When set,
+  // DrawTileToBitmap blits 8-pixel rows instead of mirroring per pixel.
+  void SetTilePixelCache(gfx::TilePixelCache* cache) {
+    tile_pixel_cache_ = cache;
+  }
 
   /**
    * @brief Draw a door to background buffers
@@ -111,6 +143,8 @@ class ObjectDrawer {
    * @param reset_room_event_indices If true, reset the chest-only and shared
    *        chest/lock counters before drawing (set false on subsequent USDASM
    *        list passes; see Room::RenderObjectsToBackground)
+   * @param records Optional; receives one ObjectDrawRecord per object. Trace
+   *        offsets are only meaningful while a trace collector is set.
    * @return Status of the drawing operation
    */
   absl::Status DrawObjectList(const std::vector<RoomObject>& objects,
@@ -119,7 +153,17 @@ class ObjectDrawer {
                               const gfx::PaletteGroup& palette_group,
                               const DungeonState* state = nullptr,
                               gfx::BackgroundBuffer* layout_bg1 = nullptr,
-                              bool reset_room_event_indices = true);
+                              bool reset_room_event_indices = true,
+                              std::vector<ObjectDrawRecord>* records = nullptr);
+
+  /**
+   * @brief Copy rows [y_begin, y_end) of a modified bitmap to its SDL surface
+   *
+   * DrawObjectList syncs whole bitmaps; partial redraws sync only the rows
+   * they touched.
+   */
+  static void SyncBitmapRowsToSurface(gfx::Bitmap& bitmap, int y_begin,
+                                      int y_end);
 
   /**
    * @brief Get draw routine ID for an object
@@ -131,9 +175,7 @@ class ObjectDrawer {
   /**
    * @brief Get the total number of registered draw routines
    */
-  int GetDrawRoutineCount() const {
-    return static_cast<int>(draw_routines_.size());
-  }
+  int GetDrawRoutineCount() const { return DrawRoutineIds::kRoutineCount; }
 
   /**
    * @brief Initialize draw routine registry
@@ -196,10 +238,13 @@ class ObjectDrawer {
   bool TraceOnly() const { return trace_only_; }
 
  protected:
-  // Draw routine function type
-  using DrawRoutine = std::function<void(
-      ObjectDrawer*, const RoomObject&, gfx::BackgroundBuffer&,
-      std::span<const gfx::TileInfo>, const DungeonState*)>;
+  // Drawer-side override for a registry routine that needs ObjectDrawer state.
+  using DrawRoutine = void (ObjectDrawer::*)(const RoomObject&,
+                                             gfx::BackgroundBuffer&,
+                                             std::span<const gfx::TileInfo>,
+                                             const DungeonState*);
+  using DrawRoutineTable =
+      std::array<DrawRoutine, DrawRoutineIds::kRoutineCount>;
 
   // Core draw routines (based on ZScream's subtype1_routines table)
   void DrawChest(const RoomObject& obj, gfx::BackgroundBuffer& bg,
@@ -211,6 +256,9 @@ class ObjectDrawer {
   void DrawBigKeyLock(const RoomObject& obj, gfx::BackgroundBuffer& bg,
                       std::span<const gfx::TileInfo> tiles,
                       const DungeonState* state = nullptr);
+  void DrawSingle4x3(const RoomObject& obj, gfx::BackgroundBuffer& bg,
+                     std::span<const gfx::TileInfo> tiles,
+                     const DungeonState* state = nullptr);
 
   void DrawNothing(const RoomObject& obj, gfx::BackgroundBuffer& bg,
                    std::span<const gfx::TileInfo> tiles,
@@ -246,6 +294,11 @@ class ObjectDrawer {
                                 gfx::BackgroundBuffer& bg,
                                 std::span<const gfx::TileInfo> tiles,
                                 const DungeonState* state);
+  void DrawUsingRegistryRoutine(const DrawRoutineInfo& info,
+                                const RoomObject& obj,
+                                gfx::BackgroundBuffer& bg,
+                                std::span<const gfx::TileInfo> tiles,
+                                const DungeonState* state);
   void WriteTile8(gfx::BackgroundBuffer& bg, int tile_x, int tile_y,
                   const gfx::TileInfo& tile_info);
   bool IsValidTilePosition(int tile_x, int tile_y) const;
@@ -268,10 +321,22 @@ class ObjectDrawer {
                          int width, int height, DoorType type,
                          DoorDirection direction);
 
-  // Draw routine function array (indexed by routine ID from DrawRoutineRegistry)
-  std::vector<DrawRoutine> draw_routines_;
+  // Indexed by routine ID from DrawRoutineRegistry. Null entries run the
+  // registry routine directly; built at compile time, shared by all drawers.
+  static constexpr DrawRoutineTable BuildDrawRoutineTable();
+  static const DrawRoutineTable kDrawRoutineTable;
   bool routines_initialized_ = false;
 
+  // Tile writes captured from a registry routine, replayed through
+  // WriteTile8(). Kept as a member so its capacity survives across objects.
+  struct CapturedWrite {
+    int x = 0;
+    int y = 0;
+    gfx::TileInfo tile{};
+    bool secondary = false;
+  };
+  std::vector<CapturedWrite> registry_writes_;
+
   struct TraceContext {
     uint16_t object_id = 0;
     uint8_t size = 0;
@@ -301,7 +366,8 @@ class ObjectDrawer {
   gfx::BG1RevealMaskSource bg1_reveal_mask_source_ =
       gfx::BG1RevealMaskSource::kBG2Objects;
   const uint8_t*
-      room_gfx_buffer_;  // Room-specific graphics buffer (current_gfx16_)
+      room_gfx_buffer_;  // Room-specific graphics buffer (Room::get_gfx_buffer)
+  gfx::TilePixelCache* tile_pixel_cache_ = nullptr;
 
   // Canvas dimensions in tiles (64x64 = 512x512 pixels)
   static constexpr int kMaxTilesX = 64;
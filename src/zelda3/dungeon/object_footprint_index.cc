@@ -0,0 +1,119 @@
+#include "zelda3/dungeon/object_footprint_index.h"
+
+#include <algorithm>
+
+#include "zelda3/dungeon/dimension_service.h"
+
+namespace yaze {
+namespace zelda3 {
+
+void ObjectFootprintIndex::Clear() {
+  entries_.clear();
+  object_tile_revision_ = 0;
+  valid_ = false;
+}
+
+void ObjectFootprintIndex::Reset(std::vector<Entry> entries,
+                                 uint64_t object_tile_revision) {
+  entries_ = std::move(entries);
+  object_tile_revision_ = object_tile_revision;
+  valid_ = true;
+}
+
+void ObjectFootprintIndex::SetCells(size_t index, std::vector<uint16_t> cells) {
+  if (index < entries_.size()) {
+    Normalize(cells);
+    entries_[index].cells = std::move(cells);
+  }
+}
+
+bool ObjectFootprintIndex::FindChanged(const std::vector<RoomObject>& objects,
+                                       std::vector<size_t>* changed) const {
+  if (objects.size() != entries_.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < objects.size(); ++i) {
+    if (!SameObjectState(entries_[i].object, objects[i])) {
+      changed->push_back(i);
+    }
+  }
+  return true;
+}
+
+std::vector<size_t> ObjectFootprintIndex::CloseOver(TileMask& region) const {
+  std::vector<bool> taken(entries_.size(), false);
+  bool grew = true;
+  while (grew) {
+    grew = false;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+      if (taken[i]) {
+        continue;
+      }
+      const auto& cells = entries_[i].cells;
+      const bool hit = std::any_of(cells.begin(), cells.end(),
+                                   [&](uint16_t cell) { return region[cell]; });
+      if (hit) {
+        taken[i] = true;
+        MarkCells(i, region);
+        grew = true;
+      }
+    }
+  }
+
+  std::vector<size_t> result;
+  for (size_t i = 0; i < taken.size(); ++i) {
+    if (taken[i]) {
+      result.push_back(i);
+    }
+  }
+  return result;
+}
+
+void ObjectFootprintIndex::MarkCells(size_t index, TileMask& region) const {
+  for (uint16_t cell : entries_[index].cells) {
+    region.set(cell);
+  }
+}
+
+void ObjectFootprintIndex::AddTraceCells(
+    std::span<const ObjectDrawer::TileTrace> traces,
+    std::vector<uint16_t>& cells) {
+  for (const auto& trace : traces) {
+    AddRectCells(trace.x_tile, trace.y_tile, 1, 1, cells);
+  }
+}
+
+void ObjectFootprintIndex::AddConservativeCells(const RoomObject& object,
+                                                std::vector<uint16_t>& cells) {
+  AddRectCells(object.x_, object.y_, 2, 2, cells);
+  if (object.layer_ == RoomObject::LayerType::BG2) {
+    const auto [x_px, y_px, width_px, height_px] =
+        DimensionService::Get().GetSelectionBoundsPixels(object);
+    const int x0 = x_px / 8;
+    const int y0 = y_px / 8;
+    AddRectCells(x0, y0, (x_px + width_px + 7) / 8 - x0,
+                 (y_px + height_px + 7) / 8 - y0, cells);
+  }
+}
+
+void ObjectFootprintIndex::AddRectCells(int tile_x, int tile_y, int tiles_w,
+                                        int tiles_h,
+                                        std::vector<uint16_t>& cells) {
+  const int x0 = std::max(tile_x, 0);
+  const int y0 = std::max(tile_y, 0);
+  const int x1 = std::min(tile_x + tiles_w, kGridSize);
+  const int y1 = std::min(tile_y + tiles_h, kGridSize);
+  for (int y = y0; y < y1; ++y) {
+    for (int x = x0; x < x1; ++x) {
+      cells.push_back(static_cast<uint16_t>(y * kGridSize + x));
+    }
+  }
+}
+
+void ObjectFootprintIndex::Normalize(std::vector<uint16_t>& cells) {
+  std::sort(cells.begin(), cells.end());
+  cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+}
+
+}  // namespace zelda3
+}  // namespace yaze
@@ -0,0 +1,90 @@
+#ifndef YAZE_ZELDA3_DUNGEON_OBJECT_FOOTPRINT_INDEX_H
+#define YAZE_ZELDA3_DUNGEON_OBJECT_FOOTPRINT_INDEX_H
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "zelda3/dungeon/object_drawer.h"
+#include "zelda3/dungeon/room_object.h"
+
+namespace yaze {
+namespace zelda3 {
+
+/**
+ * @brief Tile footprints of a room's last full object render
+ *
+ * Entry i describes tile_objects_[i] as it was drawn: its state, the 8x8
+ * cells it wrote on either object layer (from ObjectDrawer::TileTrace, plus
+ * the untraced areas noted in AddConservativeCells), and the room-event
+ * cursor it was drawn with.
+ *
+ * Room::RenderObjectsToBackground uses the index to redraw only what an edit
+ * touched: the cells of changed entries are invalidated, every entry
+ * intersecting them is pulled in (growing the region by its own footprint
+ * until nothing new intersects), and that closed set is cleared and redrawn
+ * in stream order. Everything outside the region is bit-identical to a full
+ * render because no entry outside the set ever wrote into it.
+ */
+class ObjectFootprintIndex {
+ public:
+  static constexpr int kGridSize = 64;
+  using TileMask = std::bitset<kGridSize * kGridSize>;
+
+  struct Entry {
+    RoomObject object{0, 0, 0, 0};  // State as drawn (list index layer)
+    std::vector<uint16_t> cells;    // Sorted, unique y * kGridSize + x
+    ObjectDrawer::RoomEventCursor cursor_before;
+    ObjectDrawer::RoomEventCursor cursor_after;
+    bool special_table = false;     // Torch/block pass, not the object stream
+  };
+
+  void Clear();
+  bool valid() const { return valid_; }
+
+  // Replace the index with the entries of a full render.
+  void Reset(std::vector<Entry> entries, uint64_t object_tile_revision);
+
+  const std::vector<Entry>& entries() const { return entries_; }
+  std::vector<Entry>& mutable_entries() { return entries_; }
+  uint64_t object_tile_revision() const { return object_tile_revision_; }
+
+  // Rebuild one entry's cells after it was redrawn.
+  void SetCells(size_t index, std::vector<uint16_t> cells);
+
+  // Collects the indices of entries whose drawn state differs from
+  // `objects`. Returns false when the lists differ in length, since entries
+  // can then no longer be matched to objects by index.
+  bool FindChanged(const std::vector<RoomObject>& objects,
+                   std::vector<size_t>* changed) const;
+
+  // Grow `region` by the footprints of intersecting entries until it is
+  // closed; returns those entries in index order.
+  std::vector<size_t> CloseOver(TileMask& region) const;
+
+  void MarkCells(size_t index, TileMask& region) const;
+
+  // Cells written through traced tile writes.
+  static void AddTraceCells(std::span<const ObjectDrawer::TileTrace> traces,
+                            std::vector<uint16_t>& cells);
+  // Areas some draw paths write without tile traces: the 16x16 missing-custom-
+  // object placeholder at the origin, and for BG2 objects the selection bounds
+  // that rectangular BG1 reveal masks use.
+  static void AddConservativeCells(const RoomObject& object,
+                                   std::vector<uint16_t>& cells);
+  static void AddRectCells(int tile_x, int tile_y, int tiles_w, int tiles_h,
+                           std::vector<uint16_t>& cells);
+  static void Normalize(std::vector<uint16_t>& cells);
+
+ private:
+  std::vector<Entry> entries_;
+  uint64_t object_tile_revision_ = 0;
+  bool valid_ = false;
+};
+
+}  // namespace zelda3
+}  // namespace yaze
+
+#endif  // YAZE_ZELDA3_DUNGEON_OBJECT_FOOTPRINT_INDEX_H
@@ -0,0 +1,246 @@
+#include "zelda3/dungeon/object_spatial_index.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+#include "zelda3/dungeon/dimension_service.h"
+
+namespace yaze {
+namespace zelda3 {
+
+namespace {
+
+int ClampTile(int tile) {
+  return std::clamp(tile, 0, ObjectSpatialIndex::kGridSize - 1);
+}
+
+}  // namespace
+
+ObjectSpatialIndex::ObjectSpatialIndex(BoundsFn bounds_fn)
+    : bounds_fn_(std::move(bounds_fn)) {
+  if (!bounds_fn_) {
+    bounds_fn_ = [](const RoomObject& object) {
+      const auto [x, y, width, height] =
+          DimensionService::Get().GetHitTestBounds(object);
+      return Bounds{x, y, width, height};
+    };
+  }
+}
+
+void ObjectSpatialIndex::Build(const std::vector<RoomObject>& objects) {
+  Clear();
+  EnsureCells();
+  entries_.reserve(objects.size());
+  for (size_t i = 0; i < objects.size(); ++i) {
+    entries_.push_back(MakeEntry(objects[i]));
+    Link(entries_.back(), static_cast<uint32_t>(i));
+  }
+}
+
+void ObjectSpatialIndex::Clear() {
+  entries_.clear();
+  for (auto& cell : cells_) {
+    cell.clear();
+  }
+}
+
+size_t ObjectSpatialIndex::Sync(const std::vector<RoomObject>& objects) {
+  if (objects.size() != entries_.size()) {
+    Build(objects);
+    return objects.size();
+  }
+  size_t reindexed = 0;
+  for (size_t i = 0; i < objects.size(); ++i) {
+    if (!SameIndexedState(entries_[i], objects[i])) {
+      Update(i, objects[i]);
+      ++reindexed;
+    }
+  }
+  return reindexed;
+}
+
+void ObjectSpatialIndex::Insert(size_t index, const RoomObject& object) {
+  index = std::min(index, entries_.size());
+  EnsureCells();
+  // Walk down so a relabeled index never collides with one not yet moved.
+  for (size_t j = entries_.size(); j > index; --j) {
+    Relabel(entries_[j - 1], static_cast<uint32_t>(j - 1),
+            static_cast<uint32_t>(j));
+  }
+  entries_.insert(entries_.begin() + index, MakeEntry(object));
+  Link(entries_[index], static_cast<uint32_t>(index));
+}
+
+void ObjectSpatialIndex::Remove(size_t index) {
+  if (index >= entries_.size()) {
+    return;
+  }
+  Unlink(entries_[index], static_cast<uint32_t>(index));
+  for (size_t j = index + 1; j < entries_.size(); ++j) {
+    Relabel(entries_[j], static_cast<uint32_t>(j),
+            static_cast<uint32_t>(j - 1));
+  }
+  entries_.erase(entries_.begin() + index);
+}
+
+void ObjectSpatialIndex::Update(size_t index, const RoomObject& object) {
+  if (index >= entries_.size()) {
+    return;
+  }
+  Unlink(entries_[index], static_cast<uint32_t>(index));
+  entries_[index] = MakeEntry(object);
+  Link(entries_[index], static_cast<uint32_t>(index));
+}
+
+std::vector<size_t> ObjectSpatialIndex::QueryPoint(int tile_x, int tile_y,
+                                                   int layer) const {
+  if (tile_x < 0 || tile_x >= kGridSize || tile_y < 0 || tile_y >= kGridSize) {
+    return {};
+  }
+  return Collect(tile_x, tile_y, tile_x, tile_y, layer,
+                 [&](const Entry& entry) {
+                   return entry.bounds.Contains(tile_x, tile_y);
+                 });
+}
+
+std::vector<size_t> ObjectSpatialIndex::QueryRect(int min_x, int min_y,
+                                                  int max_x, int max_y,
+                                                  int layer) const {
+  const Bounds rect{std::min(min_x, max_x), std::min(min_y, max_y),
+                    std::abs(max_x - min_x) + 1, std::abs(max_y - min_y) + 1};
+  return Collect(rect.x, rect.y, rect.x + rect.width - 1,
+                 rect.y + rect.height - 1, layer, [&](const Entry& entry) {
+                   return entry.bounds.Intersects(rect);
+                 });
+}
+
+std::vector<size_t> ObjectSpatialIndex::QueryOrigin(int tile_x, int tile_y,
+                                                    int layer) const {
+  if (tile_x < 0 || tile_x >= kGridSize || tile_y < 0 || tile_y >= kGridSize) {
+    return {};
+  }
+  return Collect(tile_x, tile_y, tile_x, tile_y, layer,
+                 [&](const Entry& entry) {
+                   return entry.x == tile_x && entry.y == tile_y;
+                 });
+}
+
+std::vector<size_t> ObjectSpatialIndex::QueryOverlapping(size_t index) const {
+  if (index >= entries_.size()) {
+    return {};
+  }
+  const Entry& self = entries_[index];
+  const Bounds& b = self.bounds;
+  return Collect(b.x, b.y, b.x + b.width - 1, b.y + b.height - 1, self.layer,
+                 [&](const Entry& entry) {
+                   return &entry != &self && entry.bounds.Intersects(b);
+                 });
+}
+
+ObjectSpatialIndex::Entry ObjectSpatialIndex::MakeEntry(
+    const RoomObject& object) const {
+  Entry entry;
+  entry.id = object.id_;
+  entry.x = object.x_;
+  entry.y = object.y_;
+  entry.size = object.size_;
+  entry.layer = std::min<uint8_t>(object.GetLayerValue(), kLayerCount - 1);
+  entry.bounds = bounds_fn_(object);
+  return entry;
+}
+
+bool ObjectSpatialIndex::SameIndexedState(const Entry& entry,
+                                          const RoomObject& object) const {
+  return entry.id == object.id_ && entry.x == object.x_ &&
+         entry.y == object.y_ && entry.size == object.size_ &&
+         entry.layer ==
+             std::min<uint8_t>(object.GetLayerValue(), kLayerCount - 1);
+}
+
+void ObjectSpatialIndex::EnsureCells() {
+  if (cells_.empty()) {
+    cells_.resize(static_cast<size_t>(kLayerCount) * kGridSize * kGridSize);
+  }
+}
+
+template <typename Fn>
+void ObjectSpatialIndex::ForEachCell(const Entry& entry, Fn&& fn) const {
+  // The origin tile is always filed so QueryOrigin works for objects whose
+  // hit-test bounds are offset away from it.
+  const Bounds& b = entry.bounds;
+  const bool origin_inside = b.Contains(entry.x, entry.y);
+  if (!origin_inside && entry.x < kGridSize && entry.y < kGridSize) {
+    fn(entry.x, entry.y);
+  }
+  if (b.width <= 0 || b.height <= 0) {
+    return;
+  }
+  const int x0 = std::max(b.x, 0);
+  const int y0 = std::max(b.y, 0);
+  const int x1 = std::min(b.x + b.width, kGridSize);
+  const int y1 = std::min(b.y + b.height, kGridSize);
+  for (int y = y0; y < y1; ++y) {
+    for (int x = x0; x < x1; ++x) {
+      fn(x, y);
+    }
+  }
+}
+
+void ObjectSpatialIndex::Link(const Entry& entry, uint32_t index) {
+  ForEachCell(entry, [&](int x, int y) {
+    Cell(entry.layer, x, y).push_back(index);
+  });
+}
+
+void ObjectSpatialIndex::Unlink(const Entry& entry, uint32_t index) {
+  ForEachCell(entry, [&](int x, int y) {
+    auto& cell = Cell(entry.layer, x, y);
+    cell.erase(std::remove(cell.begin(), cell.end(), index), cell.end());
+  });
+}
+
+void ObjectSpatialIndex::Relabel(const Entry& entry, uint32_t from,
+                                 uint32_t to) {
+  ForEachCell(entry, [&](int x, int y) {
+    auto& cell = Cell(entry.layer, x, y);
+    std::replace(cell.begin(), cell.end(), from, to);
+  });
+}
+
+template <typename Pred>
+std::vector<size_t> ObjectSpatialIndex::Collect(int min_x, int min_y,
+                                                int max_x, int max_y,
+                                                int layer, Pred&& pred) const {
+  std::vector<size_t> result;
+  if (cells_.empty() || max_x < 0 || max_y < 0 || min_x >= kGridSize ||
+      min_y >= kGridSize) {
+    return result;
+  }
+  min_x = ClampTile(min_x);
+  min_y = ClampTile(min_y);
+  max_x = ClampTile(max_x);
+  max_y = ClampTile(max_y);
+  const int first_layer = layer == kAnyLayer ? 0 : layer;
+  const int last_layer = layer == kAnyLayer ? kLayerCount - 1 : layer;
+  if (first_layer < 0 || last_layer >= kLayerCount) {
+    return result;
+  }
+
+  for (int l = first_layer; l <= last_layer; ++l) {
+    for (int y = min_y; y <= max_y; ++y) {
+      for (int x = min_x; x <= max_x; ++x) {
+        for (uint32_t index : Cell(l, x, y)) {
+          result.push_back(index);
+        }
+      }
+    }
+  }
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  std::erase_if(result, [&](size_t index) { return !pred(entries_[index]); });
+  return result;
+}
+
+}  // namespace zelda3
+}  // namespace yaze
@@ -0,0 +1,121 @@
+#ifndef YAZE_ZELDA3_DUNGEON_OBJECT_SPATIAL_INDEX_H
+#define YAZE_ZELDA3_DUNGEON_OBJECT_SPATIAL_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "zelda3/dungeon/room_object.h"
+
+namespace yaze {
+namespace zelda3 {
+
+/**
+ * @brief Uniform tile grid over a room's objects for hit-testing
+ *
+ * Each of the three object lists gets a 64x64 grid of 8x8 tiles. Every cell
+ * keeps the indices of the objects whose hit-test bounds (or origin tile)
+ * cover it, so point, rectangle and overlap queries only look at the objects
+ * in the touched cells instead of measuring every object in the room.
+ *
+ * Indices match the room's object vector. Insert/Remove shift the indices of
+ * later objects the same way vector insert/erase does; Sync() brings the
+ * index up to date after edits made directly through the vector.
+ */
+class ObjectSpatialIndex {
+ public:
+  static constexpr int kGridSize = 64;
+  static constexpr int kLayerCount = 3;
+  // Pass as `layer` to query every object list.
+  static constexpr int kAnyLayer = -1;
+
+  // Tile rectangle in DimensionService::GetHitTestBounds form.
+  struct Bounds {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+
+    bool Contains(int tile_x, int tile_y) const {
+      return tile_x >= x && tile_x < x + width && tile_y >= y &&
+             tile_y < y + height;
+    }
+    bool Intersects(const Bounds& other) const {
+      return x < other.x + other.width && other.x < x + width &&
+             y < other.y + other.height && other.y < y + height;
+    }
+    bool operator==(const Bounds& other) const = default;
+  };
+
+  using BoundsFn = std::function<Bounds(const RoomObject&)>;
+
+  // `bounds_fn` defaults to DimensionService hit-test bounds.
+  explicit ObjectSpatialIndex(BoundsFn bounds_fn = {});
+
+  void Build(const std::vector<RoomObject>& objects);
+  void Clear();
+
+  // Re-index the objects whose position, size, id or list changed since they
+  // were indexed; rebuilds when the object count differs. Returns the number
+  // of objects re-indexed.
+  size_t Sync(const std::vector<RoomObject>& objects);
+
+  void Insert(size_t index, const RoomObject& object);
+  void Remove(size_t index);
+  void Update(size_t index, const RoomObject& object);
+
+  size_t size() const { return entries_.size(); }
+  const Bounds& bounds(size_t index) const { return entries_[index].bounds; }
+
+  // Objects whose bounds contain the tile, in ascending index order.
+  std::vector<size_t> QueryPoint(int tile_x, int tile_y,
+                                 int layer = kAnyLayer) const;
+  // Objects whose bounds intersect the inclusive tile rectangle.
+  std::vector<size_t> QueryRect(int min_x, int min_y, int max_x, int max_y,
+                                int layer = kAnyLayer) const;
+  // Objects whose origin tile is exactly (tile_x, tile_y).
+  std::vector<size_t> QueryOrigin(int tile_x, int tile_y,
+                                  int layer = kAnyLayer) const;
+  // Other objects on the same list whose bounds intersect object `index`.
+  std::vector<size_t> QueryOverlapping(size_t index) const;
+
+ private:
+  struct Entry {
+    int16_t id = 0;
+    uint8_t x = 0;
+    uint8_t y = 0;
+    uint8_t size = 0;
+    uint8_t layer = 0;
+    Bounds bounds;
+  };
+
+  Entry MakeEntry(const RoomObject& object) const;
+  bool SameIndexedState(const Entry& entry, const RoomObject& object) const;
+  void EnsureCells();
+  // Visit every cell an entry is filed under.
+  template <typename Fn>
+  void ForEachCell(const Entry& entry, Fn&& fn) const;
+  void Link(const Entry& entry, uint32_t index);
+  void Unlink(const Entry& entry, uint32_t index);
+  void Relabel(const Entry& entry, uint32_t from, uint32_t to);
+  template <typename Pred>
+  std::vector<size_t> Collect(int min_x, int min_y, int max_x, int max_y,
+                              int layer, Pred&& pred) const;
+
+  std::vector<uint32_t>& Cell(int layer, int tile_x, int tile_y) {
+    return cells_[(layer * kGridSize + tile_y) * kGridSize + tile_x];
+  }
+  const std::vector<uint32_t>& Cell(int layer, int tile_x, int tile_y) const {
+    return cells_[(layer * kGridSize + tile_y) * kGridSize + tile_x];
+  }
+
+  BoundsFn bounds_fn_;
+  std::vector<Entry> entries_;
+  std::vector<std::vector<uint32_t>> cells_;
+};
+
+}  // namespace zelda3
+}  // namespace yaze
+
+#endif  // YAZE_ZELDA3_DUNGEON_OBJECT_SPATIAL_INDEX_H
@@ -160,8 +160,13 @@ OracleRomSafetyPreflightResult RunOracleRomSafetyPreflight(
       HasCustomCollisionWriteSupport(rom_size)) {
     const int max_errors = std::max(1, options.max_collision_errors);
     int collision_errors = 0;
+    std::vector<int> room_ids(kNumberOfRooms);
     for (int room_id = 0; room_id < kNumberOfRooms; ++room_id) {
-      auto map_or = LoadCustomCollisionMap(rom, room_id);
+      room_ids[room_id] = room_id;
+    }
+    const auto maps = LoadCustomCollisionMaps(rom, room_ids);
+    for (int room_id = 0; room_id < kNumberOfRooms; ++room_id) {
+      const auto& map_or = maps[room_id];
       if (map_or.ok()) {
         continue;
       }
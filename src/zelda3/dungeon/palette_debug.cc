@@ -26,6 +26,12 @@ bool ShouldLogPaletteInfo() {
 #endif
 }
 
+thread_local int palette_debug_mute_depth = 0;
+
+bool PaletteDebugMuted() {
+  return palette_debug_mute_depth > 0;
+}
+
 void LogPaletteDebugEvent(const yaze::zelda3::PaletteDebugEvent& event) {
   if (event.level == yaze::zelda3::PaletteDebugLevel::ERROR) {
     LOG_ERROR("PaletteDebug", "%s: %s", event.location.c_str(),
@@ -51,9 +57,20 @@ PaletteDebugger& PaletteDebugger::Get() {
   return instance;
 }
 
+PaletteDebugger::ScopedMute::ScopedMute() {
+  ++palette_debug_mute_depth;
+}
+
+PaletteDebugger::ScopedMute::~ScopedMute() {
+  --palette_debug_mute_depth;
+}
+
 void PaletteDebugger::LogPaletteLoad(const std::string& location,
                                      int palette_id,
                                      const gfx::SnesPalette& palette) {
+  if (PaletteDebugMuted()) {
+    return;
+  }
   PaletteDebugEvent event;
   event.location = location;
   event.palette_id = palette_id;
@@ -87,6 +104,9 @@ void PaletteDebugger::LogPaletteLoad(const std::string& location,
 void PaletteDebugger::LogPaletteApplication(const std::string& location,
                                             int palette_id, bool success,
                                             const std::string& reason) {
+  if (PaletteDebugMuted()) {
+    return;
+  }
   PaletteDebugEvent event;
   event.location = location;
   event.palette_id = palette_id;
@@ -107,6 +127,9 @@ void PaletteDebugger::LogPaletteApplication(const std::string& location,
 
 void PaletteDebugger::LogTextureCreation(const std::string& location,
                                          bool has_palette, int color_count) {
+  if (PaletteDebugMuted()) {
+    return;
+  }
   PaletteDebugEvent event;
   event.location = location;
   event.color_count = color_count;
@@ -127,6 +150,9 @@ void PaletteDebugger::LogTextureCreation(const std::string& location,
 
 void PaletteDebugger::LogSurfaceState(const std::string& location,
                                       SDL_Surface* surface) {
+  if (PaletteDebugMuted()) {
+    return;
+  }
   PaletteDebugEvent event;
   event.location = location;
   event.timestamp_ms = GetCurrentTimeMs();
@@ -187,15 +213,24 @@ void PaletteDebugger::LogSurfaceState(const std::string& location,
 }
 
 void PaletteDebugger::SetCurrentPalette(const gfx::SnesPalette& palette) {
+  if (PaletteDebugMuted()) {
+    return;
+  }
   current_palette_ = palette;
 }
 
 void PaletteDebugger::SetCurrentRenderPalette(
     const std::vector<SDL_Color>& palette) {
+  if (PaletteDebugMuted()) {
+    return;
+  }
   current_render_palette_ = palette;
 }
 
 void PaletteDebugger::SetCurrentBitmap(gfx::Bitmap* bitmap) {
+  if (PaletteDebugMuted()) {
+    return;
+  }
   current_bitmap_ = bitmap;
 }
 
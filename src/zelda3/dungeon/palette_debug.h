@@ -40,6 +40,20 @@ class PaletteDebugger {
 
   static PaletteDebugger& Get();
 
+  /**
+   * @brief Ignore reports from the current thread while alive
+   *
+   * Off-screen renders (room thumbnails on worker threads) must not replace
+   * the palette and bitmap of the room being inspected.
+   */
+  class ScopedMute {
+   public:
+    ScopedMute();
+    ~ScopedMute();
+    ScopedMute(const ScopedMute&) = delete;
+    ScopedMute& operator=(const ScopedMute&) = delete;
+  };
+
   void LogPaletteLoad(const std::string& location, int palette_id,
                       const gfx::SnesPalette& palette);
   void LogPaletteApplication(const std::string& location, int palette_id,
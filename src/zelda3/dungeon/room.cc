@@ -6,7 +6,6 @@
 #include <array>
 #include <cstdint>
 #include <functional>
-#include <limits>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -34,6 +33,7 @@
 #include "zelda3/dungeon/pit_damage_table.h"
 #include "zelda3/dungeon/room_layer_manager.h"
 #include "zelda3/dungeon/room_object.h"
+#include "zelda3/dungeon/room_stream_table.h"
 #include "zelda3/dungeon/track_collision_generator.h"
 #include "zelda3/sprite/sprite.h"
 
@@ -209,189 +209,32 @@ const std::string RoomTag[65] = {"Nothing",
 
 namespace {
 
-struct PhysicalStreamInfo {
-  int address = -1;
-  int physical_end = -1;
-  bool shared = false;
-
-  int capacity() const {
-    return physical_end > address ? physical_end - address : 0;
-  }
-};
-
-PhysicalStreamInfo AnalyzePhysicalStream(const std::vector<int>& room_addresses,
-                                         int room_id,
-                                         int known_region_end = -1) {
-  PhysicalStreamInfo info;
-  if (room_id < 0 || room_id >= static_cast<int>(room_addresses.size())) {
-    return info;
-  }
-
-  info.address = room_addresses[room_id];
-  if (info.address < 0) {
-    return info;
-  }
-
-  int next_address = std::numeric_limits<int>::max();
-  for (int other_room_id = 0;
-       other_room_id < static_cast<int>(room_addresses.size());
-       ++other_room_id) {
-    if (other_room_id == room_id || room_addresses[other_room_id] < 0) {
-      continue;
-    }
-    const int other_address = room_addresses[other_room_id];
-    if (other_address == info.address) {
-      info.shared = true;
-    } else if (other_address > info.address) {
-      next_address = std::min(next_address, other_address);
-    }
-  }
-
-  if (known_region_end > info.address) {
-    next_address = std::min(next_address, known_region_end);
-  }
-  if (next_address == std::numeric_limits<int>::max()) {
-    return info;
-  }
-
-  // A stream cannot safely grow across a LoROM bank boundary even when the
-  // next pointer happens to live in the following physical bank. The bank end
-  // alone is not a physical data boundary, so fail closed unless an actual
-  // pointer or a supplied region end bounds this bank.
-  constexpr int kLoRomBankSize = 0x8000;
-  const int bank_end = ((info.address / kLoRomBankSize) + 1) * kLoRomBankSize;
-  if (next_address > bank_end) {
-    return info;
-  }
-  info.physical_end = next_address;
-  return info;
-}
-
-absl::Status GetObjectPointerTablePc(const std::vector<uint8_t>& rom_data,
-                                     int* table_pc) {
-  if (table_pc == nullptr) {
-    return absl::InvalidArgumentError("table_pc pointer is null");
-  }
-  if (kRoomObjectPointer + 2 >= static_cast<int>(rom_data.size())) {
-    return absl::OutOfRangeError(
-        "Object pointer table address is out of range");
-  }
-
-  const uint32_t table_snes =
-      (static_cast<uint32_t>(rom_data[kRoomObjectPointer + 2]) << 16) |
-      (static_cast<uint32_t>(rom_data[kRoomObjectPointer + 1]) << 8) |
-      rom_data[kRoomObjectPointer];
-  const int pc = static_cast<int>(SnesToPc(table_snes));
-  if (pc < 0 || pc + (kNumberOfRooms * 3) > static_cast<int>(rom_data.size())) {
-    return absl::OutOfRangeError("Object pointer table is out of range");
-  }
-
-  *table_pc = pc;
-  return absl::OkStatus();
-}
-
-uint32_t ReadRoomObjectAddressSnes(const std::vector<uint8_t>& rom_data,
-                                   int table_pc, int room_id) {
-  if (room_id < 0 || room_id >= kNumberOfRooms) {
-    return 0;
-  }
-  const int ptr_off = table_pc + (room_id * 3);
-  if (ptr_off < 0 || ptr_off + 2 >= static_cast<int>(rom_data.size())) {
-    return 0;
-  }
-  return (static_cast<uint32_t>(rom_data[ptr_off + 2]) << 16) |
-         (static_cast<uint32_t>(rom_data[ptr_off + 1]) << 8) |
-         rom_data[ptr_off];
-}
-
-int ReadRoomObjectAddressPc(const std::vector<uint8_t>& rom_data, int table_pc,
-                            int room_id) {
-  const uint32_t snes = ReadRoomObjectAddressSnes(rom_data, table_pc, room_id);
-  if ((snes & 0xFFFF) < 0x8000) {
-    return -1;
-  }
-  const int pc = static_cast<int>(SnesToPc(snes));
-  return pc >= 0 && pc < static_cast<int>(rom_data.size()) ? pc : -1;
-}
-
-absl::StatusOr<PhysicalStreamInfo> GetObjectStreamInfo(
+// Stream extents come from the shared per-revision pointer-table analysis, so
+// a save or size query no longer rescans every room's pointer.
+absl::StatusOr<RoomStreamExtent> GetObjectStreamInfo(
     const std::vector<uint8_t>& rom_data, int room_id) {
   if (room_id < 0 || room_id >= kNumberOfRooms) {
     return absl::OutOfRangeError("Room ID out of range");
   }
-  int table_pc = 0;
-  RETURN_IF_ERROR(GetObjectPointerTablePc(rom_data, &table_pc));
-
-  std::vector<int> addresses(kNumberOfRooms, -1);
-  for (int id = 0; id < kNumberOfRooms; ++id) {
-    addresses[id] = ReadRoomObjectAddressPc(rom_data, table_pc, id);
-  }
-  const int hard_end = GetDungeonObjectDataRegionEnd(addresses[room_id]);
-  PhysicalStreamInfo info = AnalyzePhysicalStream(addresses, room_id, hard_end);
+  const auto tables = GetRoomStreamTables(rom_data);
+  RETURN_IF_ERROR(tables->objects.status);
+  const RoomStreamExtent info = tables->objects.rooms[room_id];
   if (info.address < 0) {
     return absl::OutOfRangeError("Object stream pointer is out of range");
   }
   return info;
 }
 
-absl::Status GetSpritePointerTablePc(const std::vector<uint8_t>& rom_data,
-                                     int* table_pc) {
-  if (table_pc == nullptr) {
-    return absl::InvalidArgumentError("table_pc pointer is null");
-  }
-  if (kRoomsSpritePointer + 1 >= static_cast<int>(rom_data.size())) {
-    return absl::OutOfRangeError(
-        "Sprite pointer table address is out of range");
-  }
-
-  int table_snes = (0x09 << 16) | (rom_data[kRoomsSpritePointer + 1] << 8) |
-                   rom_data[kRoomsSpritePointer];
-  int pc = SnesToPc(table_snes);
-  if (pc < 0 || pc + (kNumberOfRooms * 2) > static_cast<int>(rom_data.size())) {
-    return absl::OutOfRangeError("Sprite pointer table is out of range");
-  }
-
-  *table_pc = pc;
-  return absl::OkStatus();
-}
-
-int ReadRoomSpriteAddressPc(const std::vector<uint8_t>& rom_data, int table_pc,
-                            int room_id) {
-  if (room_id < 0 || room_id >= kNumberOfRooms) {
-    return -1;
-  }
-  const int ptr_off = table_pc + (room_id * 2);
-  if (ptr_off < 0 || ptr_off + 1 >= static_cast<int>(rom_data.size())) {
-    return -1;
-  }
-
-  const uint16_t pointer =
-      (static_cast<uint16_t>(rom_data[ptr_off + 1]) << 8) | rom_data[ptr_off];
-  if (pointer < 0x8000) {
-    return -1;
-  }
-  const int sprite_address = static_cast<int>(SnesToPc((0x09 << 16) | pointer));
-  return sprite_address >= 0 &&
-                 sprite_address < static_cast<int>(rom_data.size())
-             ? sprite_address
-             : -1;
-}
-
-absl::StatusOr<PhysicalStreamInfo> GetSpriteStreamInfo(
+absl::StatusOr<RoomStreamExtent> GetSpriteStreamInfo(
     const std::vector<uint8_t>& rom_data, int room_id) {
   if (room_id < 0 || room_id >= kNumberOfRooms) {
     return absl::OutOfRangeError("Room ID out of range");
   }
-  int table_pc = 0;
-  RETURN_IF_ERROR(GetSpritePointerTablePc(rom_data, &table_pc));
-
-  std::vector<int> addresses(kNumberOfRooms, -1);
-  for (int id = 0; id < kNumberOfRooms; ++id) {
-    addresses[id] = ReadRoomSpriteAddressPc(rom_data, table_pc, id);
-  }
+  const auto tables = GetRoomStreamTables(rom_data);
+  RETURN_IF_ERROR(tables->sprites.status);
   const int hard_end =
       std::min(static_cast<int>(rom_data.size()), kSpritesDataEndExclusive);
-  PhysicalStreamInfo info = AnalyzePhysicalStream(addresses, room_id, hard_end);
+  const RoomStreamExtent info = tables->sprites.rooms[room_id];
   if (info.address < 0 || info.address >= hard_end) {
     return absl::OutOfRangeError("Sprite stream pointer is out of range");
   }
@@ -893,9 +736,6 @@ void Room::CopyRoomGraphicsToBuffer() {
   LOG_DEBUG("Room", "Room %d: Copying 8BPP graphics (buffer size: %zu)",
             room_id_, gfx_buffer_data->size());
 
-  // Clear destination buffer
-  std::fill(current_gfx16_.begin(), current_gfx16_.end(), 0);
-
   // USDASM grounding (bank_00.asm LoadBackgroundGraphics):
   // The engine expands 3BPP graphics to 4BPP in two modes:
   // - Left palette: plane3 = 0 (pixel values 0-7).
@@ -925,53 +765,79 @@ void Room::CopyRoomGraphicsToBuffer() {
             runtime_slot == 7);
   };
 
-  // Process each of the 16 graphics blocks
-  for (int block = 0; block < 16; block++) {
-    int sheet_id = blocks_[block];
-
-    // Validate block index
-    if (sheet_id >= 223) {  // kNumGfxSheets
-      LOG_WARN("Room", "Invalid sheet index %d for block %d", sheet_id, block);
-      continue;
-    }
-
-    // Source offset in ROM graphics buffer (now 8BPP format)
-    // Each 8BPP sheet is 4096 bytes (128x32 pixels)
-    int src_sheet_offset = sheet_id * 4096;
+  RoomGraphicsKey key;
+  key.source = gfx_buffer_data->data();
+  key.source_size = gfx_buffer_data->size();
+  key.blocks = blocks_;
+  key.main_blockset = active_main_blockset;
+  key.animated_frame = animated_frame_;
+  key.animated_sheet = ResolveAnimatedGraphicsSheet();
+
+  // Rooms sharing sheets, main blockset and animation frame share a buffer;
+  // only the first of them assembles it.
+  auto assemble = [&](RoomGraphicsBuffer::Pixels& gfx16) {
+    // Process each of the 16 graphics blocks
+    for (int block = 0; block < 16; block++) {
+      int sheet_id = blocks_[block];
+
+      // Validate block index
+      if (sheet_id >= 223) {  // kNumGfxSheets
+        LOG_WARN("Room", "Invalid sheet index %d for block %d", sheet_id, block);
+        continue;
+      }
 
-    // Validate source bounds
-    if (src_sheet_offset + 4096 > gfx_buffer_data->size()) {
-      LOG_ERROR("Room", "Graphics offset out of bounds: %d (size: %zu)",
-                src_sheet_offset, gfx_buffer_data->size());
-      continue;
-    }
+      // Source offset in ROM graphics buffer (now 8BPP format)
+      // Each 8BPP sheet is 4096 bytes (128x32 pixels)
+      int src_sheet_offset = sheet_id * 4096;
 
-    // Copy 4096 bytes for the 8BPP sheet
-    int dest_index_base = block * 4096;
-    if (dest_index_base + 4096 <= current_gfx16_.size()) {
-      const uint8_t* src = gfx_buffer_data->data() + src_sheet_offset;
-      uint8_t* dst = current_gfx16_.data() + dest_index_base;
+      // Validate source bounds
+      if (src_sheet_offset + 4096 > gfx_buffer_data->size()) {
+        LOG_ERROR("Room", "Graphics offset out of bounds: %d (size: %zu)",
+                  src_sheet_offset, gfx_buffer_data->size());
+        continue;
+      }
 
-      // Only background blocks (0-7) participate in Left/Right palette
-      // expansion. Sprite sheets are handled separately by the game.
-      const bool right_pal = is_right_palette_background_slot(block);
-      if (!right_pal) {
-        memcpy(dst, src, 4096);
-      } else {
-        // Right palette expansion: set bit3 for non-zero pixels (1-7 -> 9-15).
-        for (int i = 0; i < 4096; ++i) {
-          uint8_t p = src[i];
-          if (p != 0 && p < 8) {
-            p |= 0x08;
+      // Copy 4096 bytes for the 8BPP sheet
+      int dest_index_base = block * 4096;
+      if (dest_index_base + 4096 <= gfx16.size()) {
+        const uint8_t* src = gfx_buffer_data->data() + src_sheet_offset;
+        uint8_t* dst = gfx16.data() + dest_index_base;
+
+        // Only background blocks (0-7) participate in Left/Right palette
+        // expansion. Sprite sheets are handled separately by the game.
+        const bool right_pal = is_right_palette_background_slot(block);
+        if (!right_pal) {
+          memcpy(dst, src, 4096);
+        } else {
+          // Right palette expansion: set bit3 for non-zero pixels (1-7 -> 9-15).
+          for (int i = 0; i < 4096; ++i) {
+            uint8_t p = src[i];
+            if (p != 0 && p < 8) {
+              p |= 0x08;
+            }
+            dst[i] = p;
           }
-          dst[i] = p;
         }
       }
     }
+
+    LOG_DEBUG("Room", "Room %d: Graphics blocks copied successfully", room_id_);
+    LoadAnimatedGraphics(gfx16, key.animated_sheet);
+  };
+
+  auto previous = gfx_buffer_;
+  gfx_buffer_ = RoomGraphicsCache::Get().Acquire(key, assemble);
+  if (gfx_buffer_ == previous) {
+    return;
   }
 
-  LOG_DEBUG("Room", "Room %d: Graphics blocks copied successfully", room_id_);
-  LoadAnimatedGraphics();
+  // The buffer changed wholesale; rebind slots so sheet edits reach us.
+  for (int block = 0; block < 16; block++) {
+    tile_pixel_cache_.BindSheet(block, blocks_[block] < 223
+                                           ? blocks_[block]
+                                           : gfx::TilePixelCache::kUnboundSheet);
+  }
+  tile_pixel_cache_.InvalidateAll();
 }
 
 gfx::Bitmap& Room::GetCompositeBitmap(RoomLayerManager& layer_mgr) {
@@ -1016,6 +882,12 @@ void Room::RenderRoomGraphics() {
     properties_changed = true;
   }
 
+  // A sheet this room's shared graphics were assembled from was edited.
+  if (gfx_buffer_ && gfx_buffer_->stale()) {
+    dirty_state_.graphics = true;
+    properties_changed = true;
+  }
+
   // If nothing changed and textures exist, skip rendering
   if (!properties_changed && !dirty_state_.graphics && !dirty_state_.objects &&
       !dirty_state_.layout && !dirty_state_.textures) {
@@ -1077,8 +949,8 @@ void Room::RenderRoomGraphics() {
   // This converts the floor tile buffer to pixels
   bool need_bg_draw = was_graphics_dirty || need_floor_draw;
   if (need_bg_draw) {
-    bg1_buffer_.DrawBackground(std::span<uint8_t>(current_gfx16_));
-    bg2_buffer_.DrawBackground(std::span<uint8_t>(current_gfx16_));
+    bg1_buffer_.DrawBackground(get_gfx_buffer(), &tile_pixel_cache_);
+    bg2_buffer_.DrawBackground(get_gfx_buffer(), &tile_pixel_cache_);
   }
 
   // STEP 3: Draw layout objects ON TOP of floor
@@ -1092,6 +964,12 @@ void Room::RenderRoomGraphics() {
     dirty_state_.layout = false;
   }
 
+  // Object footprints only stay valid over the same graphics, layout and
+  // room properties.
+  if (need_floor_draw || was_layout_dirty || properties_changed) {
+    object_footprints_.Clear();
+  }
+
   // Get and apply palette BEFORE rendering objects (so objects use correct colors)
   if (!game_data_)
     return;
@@ -1223,10 +1101,22 @@ void Room::RenderRoomGraphics() {
     }
   };
 
-  release_texture(&bg1_bmp);
-  release_texture(&bg2_bmp);
-  release_texture(&object_bg1_buffer_.bitmap());
-  release_texture(&object_bg2_buffer_.bitmap());
+  if (last_object_render_incremental_) {
+    // Only object pixels changed; refresh those textures in place.
+    auto update_texture = [](gfx::Bitmap* bitmap) {
+      if (bitmap->texture()) {
+        gfx::Arena::Get().QueueTextureCommand(
+            gfx::Arena::TextureCommandType::UPDATE, bitmap);
+      }
+    };
+    update_texture(&object_bg1_buffer_.bitmap());
+    update_texture(&object_bg2_buffer_.bitmap());
+  } else {
+    release_texture(&bg1_bmp);
+    release_texture(&bg2_bmp);
+    release_texture(&object_bg1_buffer_.bitmap());
+    release_texture(&object_bg2_buffer_.bitmap());
+  }
 
   dirty_state_.textures = false;
 
@@ -1294,8 +1184,9 @@ void Room::LoadLayoutTilesToBuffer() {
   // docs/internal/archive/completed_features/dungeon-palette-fix-plan-2025-12.md.
 
   // Draw layout objects using proper draw routines via RoomLayout
-  auto status = layout_.Draw(room_id_, current_gfx16_.data(), bg1_buffer_,
-                             bg2_buffer_, palette_group, dungeon_state_.get());
+  auto status =
+      layout_.Draw(room_id_, get_gfx_buffer().data(), bg1_buffer_, bg2_buffer_,
+                   palette_group, dungeon_state_.get(), &tile_pixel_cache_);
 
   if (!status.ok()) {
     LOG_DEBUG(
@@ -1310,6 +1201,7 @@ void Room::LoadLayoutTilesToBuffer() {
 void Room::RenderObjectsToBackground() {
   LOG_DEBUG("[RenderObjectsToBackground]",
             "Starting object rendering for room %d", room_id_);
+  last_object_render_incremental_ = false;
 
   if (!rom_ || !rom_->is_loaded()) {
     LOG_DEBUG("[RenderObjectsToBackground]", "ROM not loaded, aborting");
@@ -1350,9 +1242,9 @@ void Room::RenderObjectsToBackground() {
 
   // Use ObjectDrawer for pattern-based object rendering
   // This provides proper wall/object drawing patterns
-  // Pass the room-specific graphics buffer (current_gfx16_) so objects use
-  // correct tiles
-  ObjectDrawer drawer(rom_, room_id_, current_gfx16_.data());
+  // Pass the room-specific graphics buffer so objects use correct tiles
+  ObjectDrawer drawer(rom_, room_id_, get_gfx_buffer().data());
+  drawer.SetTilePixelCache(&tile_pixel_cache_);
   drawer.SetAllowTrackCornerAliases(RoomUsesTrackCornerAliases(tile_objects_));
   drawer.SetBG1RevealMaskSource(gfx::BG1RevealMaskSource::kBG2Objects);
   // NOTE: Routines marked draws_to_both_bgs explicitly write both tilemaps.
@@ -1360,6 +1252,15 @@ void Room::RenderObjectsToBackground() {
   // The room object stream is split here as primary -> BG2 overlay -> BG1
   // overlay, while the layout pass is rendered separately by RoomLayout::Draw.
 
+  // Editing a few objects only redraws what they overlap.
+  if (bitmaps_exist && RenderObjectsIncrementally(drawer, palette_group)) {
+    last_object_render_incremental_ = true;
+    dirty_state_.objects = false;
+    LOG_DEBUG("[RenderObjectsToBackground]",
+              "Room %d: Objects redrawn incrementally", room_id_);
+    return;
+  }
+
   // Clear object buffers before rendering
   // IMPORTANT: Fill with 255 (transparent color key) so objects overlay correctly
   // on the floor. We use index 255 as transparent since palette has 90 colors (0-89).
@@ -1421,7 +1322,9 @@ void Room::RenderObjectsToBackground() {
   // big-key-lock event index continues across passes (reset only on the first
   // non-empty pass).
   std::vector<std::vector<RoomObject>> by_list(3);
-  for (const auto& obj : tile_objects_) {
+  std::vector<std::vector<size_t>> by_list_index(3);
+  for (size_t index = 0; index < tile_objects_.size(); ++index) {
+    const auto& obj = tile_objects_[index];
     // Torches and pushable blocks are NOT part of the room object stream.
     // They come from the global tables and are drawn after the stream in
     // USDASM (LoadAndBuildRoom $01:873A). Draw them in a dedicated pass.
@@ -1439,23 +1342,89 @@ void Room::RenderObjectsToBackground() {
     RoomObject render_obj = obj;
     render_obj.layer_ = MapRoomObjectListIndexToDrawLayer(list_index);
     by_list[list_index].push_back(std::move(render_obj));
+    by_list_index[list_index].push_back(index);
   }
 
+  // Record where every object draws so later edits can redraw incrementally.
+  std::vector<ObjectDrawer::TileTrace> traces;
+  std::vector<ObjectFootprintIndex::Entry> footprints(tile_objects_.size());
+  drawer.SetTraceCollector(&traces);
+
   absl::Status status = absl::OkStatus();
   bool reset_room_events_for_next_chunk = true;
   for (int pass = 0; pass < 3; ++pass) {
     if (by_list[pass].empty()) {
       continue;
     }
+    std::vector<ObjectDrawer::ObjectDrawRecord> records;
     auto chunk_status = drawer.DrawObjectList(
         by_list[pass], object_bg1_buffer_, object_bg2_buffer_, palette_group,
-        dungeon_state_.get(), &bg1_buffer_, reset_room_events_for_next_chunk);
+        dungeon_state_.get(), &bg1_buffer_, reset_room_events_for_next_chunk,
+        &records);
     reset_room_events_for_next_chunk = false;
     if (!chunk_status.ok() && status.ok()) {
       status = chunk_status;
     }
+    for (size_t k = 0; k < records.size(); ++k) {
+      auto& entry = footprints[by_list_index[pass][k]];
+      entry.cursor_before = records[k].cursor_before;
+      entry.cursor_after = records[k].cursor_after;
+      ObjectFootprintIndex::AddTraceCells(
+          std::span(traces).subspan(
+              records[k].trace_begin,
+              records[k].trace_end - records[k].trace_begin),
+          entry.cells);
+      ObjectFootprintIndex::AddConservativeCells(by_list[pass][k],
+                                                 entry.cells);
+    }
+  }
+
+  DrawObjectOverlays(drawer);
+
+  std::vector<std::pair<size_t, size_t>> special_ends;
+  const size_t special_begin = traces.size();
+  DrawSpecialTableObjects(drawer, &special_ends, &traces);
+  size_t slice_begin = special_begin;
+  for (const auto& [index, slice_end] : special_ends) {
+    auto& entry = footprints[index];
+    entry.special_table = true;
+    ObjectFootprintIndex::AddTraceCells(
+        std::span(traces).subspan(slice_begin, slice_end - slice_begin),
+        entry.cells);
+    slice_begin = slice_end;
+  }
+  drawer.ClearTraceCollector();
+
+  for (size_t index = 0; index < footprints.size(); ++index) {
+    footprints[index].object = tile_objects_[index];
+    ObjectFootprintIndex::Normalize(footprints[index].cells);
+  }
+  if (status.ok()) {
+    object_footprints_.Reset(std::move(footprints),
+                             rom_->object_tile_revision());
+    footprint_overlay_key_ = ObjectOverlayKey();
+  } else {
+    object_footprints_.Clear();
   }
 
+  if (!status.ok()) {
+    LOG_WARN(
+        "[RenderObjectsToBackground]",
+        "Room %03X: ObjectDrawer failed: %s (objects left dirty for retry)",
+        room_id_,
+        std::string(status.message().data(), status.message().size()).c_str());
+    // Do not scribble placeholder rectangles into layout buffers; fix the
+    // underlying draw path or ROM state instead.
+    dirty_state_.objects = true;
+  } else {
+    // Mark objects as clean after successful render
+    dirty_state_.objects = false;
+    LOG_DEBUG("[RenderObjectsToBackground]",
+              "Room %d: Objects rendered successfully", room_id_);
+  }
+}
+
+void Room::DrawObjectOverlays(ObjectDrawer& drawer) {
   // Render doors using DoorDef struct with enum types
   // Doors are drawn to the OBJECT buffer for layer visibility control
   // This allows doors to remain visible when toggling BG1_Layout off
@@ -1500,7 +1469,11 @@ void Room::RenderObjectsToBackground() {
       drawer.DrawPotItem(key_item, sprite.x(), sprite.y(), object_bg1_buffer_);
     }
   }
+}
 
+void Room::DrawSpecialTableObjects(
+    ObjectDrawer& drawer, std::vector<std::pair<size_t, size_t>>* trace_ends,
+    const std::vector<ObjectDrawer::TileTrace>* traces) {
   // Special tables pass (USDASM-aligned):
   // - Pushable blocks: bank_01.asm RoomDraw_PushableBlock uses RoomDrawObjectData
   //   offset $0E52 (bank_00.asm #obj0E52).
@@ -1509,7 +1482,8 @@ void Room::RenderObjectsToBackground() {
   constexpr uint16_t kRoomDrawObj_PushableBlock = 0x0E52;
   constexpr uint16_t kRoomDrawObj_TorchUnlit = 0x0EC2;
   constexpr uint16_t kRoomDrawObj_TorchLit = 0x0ECA;
-  for (const auto& obj : tile_objects_) {
+  for (size_t index = 0; index < tile_objects_.size(); ++index) {
+    const auto& obj = tile_objects_[index];
     if ((obj.options() & ObjectOption::Block) != ObjectOption::Nothing) {
       // SpecialUnderworldObjects bit 13 chooses the draw tilemap. Bit 14 is an
       // independent behavior/pit selector retained in block metadata and must
@@ -1517,9 +1491,7 @@ void Room::RenderObjectsToBackground() {
       (void)drawer.DrawRoomDrawObjectData2x2(
           static_cast<uint16_t>(obj.id_), obj.x_, obj.y_, obj.layer_,
           kRoomDrawObj_PushableBlock, object_bg1_buffer_, object_bg2_buffer_);
-      continue;
-    }
-    if ((obj.options() & ObjectOption::Torch) != ObjectOption::Nothing) {
+    } else if ((obj.options() & ObjectOption::Torch) != ObjectOption::Nothing) {
       const uint16_t off =
           obj.lit_ ? kRoomDrawObj_TorchLit : kRoomDrawObj_TorchUnlit;
       // RoomDraw_LightableTorch retains bit 13 in its masked tilemap offset,
@@ -1528,103 +1500,242 @@ void Room::RenderObjectsToBackground() {
       (void)drawer.DrawRoomDrawObjectData2x2(
           static_cast<uint16_t>(obj.id_), obj.x_, obj.y_, obj.layer_, off,
           object_bg1_buffer_, object_bg2_buffer_);
+    } else {
       continue;
     }
+    if (trace_ends && traces) {
+      trace_ends->emplace_back(index, traces->size());
+    }
   }
+}
 
-  if (!status.ok()) {
-    LOG_WARN(
-        "[RenderObjectsToBackground]",
-        "Room %03X: ObjectDrawer failed: %s (objects left dirty for retry)",
-        room_id_,
-        std::string(status.message().data(), status.message().size()).c_str());
-    // Do not scribble placeholder rectangles into layout buffers; fix the
-    // underlying draw path or ROM state instead.
-    dirty_state_.objects = true;
-  } else {
-    // Mark objects as clean after successful render
-    dirty_state_.objects = false;
-    LOG_DEBUG("[RenderObjectsToBackground]",
-              "Room %d: Objects rendered successfully", room_id_);
+std::vector<int> Room::ObjectOverlayKey() const {
+  std::vector<int> key;
+  for (const auto& door : doors_) {
+    key.insert(key.end(), {static_cast<int>(door.type),
+                           static_cast<int>(door.direction), door.position});
+  }
+  key.push_back(-1);
+  for (const auto& pot_item : pot_items_) {
+    key.insert(key.end(), {pot_item.position, pot_item.item});
   }
+  key.push_back(-1);
+  for (const auto& sprite : sprites_) {
+    if (sprite.key_drop() > 0) {
+      key.insert(key.end(), {sprite.key_drop(), sprite.x(), sprite.y()});
+    }
+  }
+  // Room-wide drawer setting derived from the object list.
+  key.push_back(RoomUsesTrackCornerAliases(tile_objects_) ? 1 : 0);
+  return key;
 }
 
-// LoadGraphicsSheetsIntoArena() removed - using per-room graphics instead
-// Room rendering no longer depends on Arena graphics sheets
-
-void Room::LoadAnimatedGraphics() {
-  if (!rom_ || !rom_->is_loaded()) {
-    return;
+// Redraws only the objects an edit touched, using the footprints of the last
+// full render (see ObjectFootprintIndex). Returns false, leaving the caller to
+// render everything, whenever the edit cannot be localized: no index yet,
+// objects added or removed, doors or items changed, object tile data changed,
+// nothing object-level changed (e.g. a dungeon state toggle), or a changed
+// object takes part in the chest/big-key-lock event sequence.
+bool Room::RenderObjectsIncrementally(ObjectDrawer& drawer,
+                                      const gfx::PaletteGroup& palette_group) {
+  if (!object_footprints_.valid() ||
+      object_footprints_.object_tile_revision() !=
+          rom_->object_tile_revision() ||
+      footprint_overlay_key_ != ObjectOverlayKey()) {
+    return false;
   }
-
-  if (!game_data_) {
-    return;
+  std::vector<size_t> changed;
+  if (!object_footprints_.FindChanged(tile_objects_, &changed) ||
+      changed.empty()) {
+    return false;
   }
-  auto* gfx_buffer_data = &game_data_->graphics_buffer;
-  if (gfx_buffer_data->empty()) {
-    return;
+  std::vector<bool> is_changed(tile_objects_.size(), false);
+  for (size_t index : changed) {
+    const auto& entry = object_footprints_.entries()[index];
+    if (entry.cursor_before != entry.cursor_after) {
+      return false;
+    }
+    is_changed[index] = true;
   }
 
-  auto rom_data = rom()->vector();
-  if (rom_data.empty()) {
-    return;
+  using TileMask = ObjectFootprintIndex::TileMask;
+  constexpr int kGrid = ObjectFootprintIndex::kGridSize;
+  TileMask region;
+  for (size_t index : changed) {
+    object_footprints_.MarkCells(index, region);
   }
 
-  // Validate animated_frame_ bounds
-  if (animated_frame_ < 0 || animated_frame_ > 10) {
-    return;
+  // A changed object may now reach cells outside the region; those pull in
+  // more objects, so repeat until the redrawn set stays inside the region.
+  constexpr int kMaxRounds = 4;
+  for (int round = 0; round < kMaxRounds; ++round) {
+    const std::vector<size_t> redraw = object_footprints_.CloseOver(region);
+
+    for (int cell = 0; cell < kGrid * kGrid; ++cell) {
+      if (!region[cell]) {
+        continue;
+      }
+      const int px = (cell % kGrid) * 8;
+      const int py = (cell / kGrid) * 8;
+      object_bg1_buffer_.ClearRect(px, py, 8, 8, 255);
+      object_bg2_buffer_.ClearRect(px, py, 8, 8, 255);
+      object_bg1_buffer_.ClearBG1RevealMaskRect(
+          gfx::BG1RevealMaskSource::kBG2Objects, px, py, 8, 8);
+      bg1_buffer_.ClearBG1RevealMaskRect(gfx::BG1RevealMaskSource::kBG2Objects,
+                                         px, py, 8, 8);
+    }
+
+    std::vector<ObjectDrawer::TileTrace> traces;
+    drawer.SetTraceCollector(&traces);
+    std::vector<std::pair<size_t, std::vector<uint16_t>>> new_cells;
+    bool localized = true;
+    // Same USDASM list order as the full render.
+    for (uint8_t pass = 0; pass < 3 && localized; ++pass) {
+      for (size_t index : redraw) {
+        const auto& entry = object_footprints_.entries()[index];
+        const auto& obj = tile_objects_[index];
+        if (entry.special_table || std::min<uint8_t>(obj.GetLayerValue(), 2) !=
+                                       pass) {
+          continue;
+        }
+        RoomObject render_obj = obj;
+        render_obj.layer_ = MapRoomObjectListIndexToDrawLayer(pass);
+        drawer.set_room_event_cursor(entry.cursor_before);
+        const size_t trace_begin = traces.size();
+        if (!drawer
+                 .DrawObject(render_obj, object_bg1_buffer_,
+                             object_bg2_buffer_, palette_group,
+                             dungeon_state_.get(), &bg1_buffer_)
+                 .ok() ||
+            (is_changed[index] &&
+             drawer.room_event_cursor() != entry.cursor_before)) {
+          localized = false;
+          break;
+        }
+        std::vector<uint16_t> cells;
+        ObjectFootprintIndex::AddTraceCells(
+            std::span(traces).subspan(trace_begin), cells);
+        ObjectFootprintIndex::AddConservativeCells(render_obj, cells);
+        new_cells.emplace_back(index, std::move(cells));
+      }
+    }
+    if (!localized) {
+      drawer.ClearTraceCollector();
+      return false;
+    }
+
+    // Everything drawn after the object stream is redrawn whole; drawing it
+    // again over its own unchanged pixels is a no-op.
+    DrawObjectOverlays(drawer);
+    std::vector<std::pair<size_t, size_t>> special_ends;
+    const size_t special_begin = traces.size();
+    DrawSpecialTableObjects(drawer, &special_ends, &traces);
+    drawer.ClearTraceCollector();
+
+    bool escaped = false;
+    for (const auto& [index, cells] : new_cells) {
+      for (uint16_t cell : cells) {
+        if (!region[cell]) {
+          region.set(cell);
+          escaped = true;
+        }
+      }
+    }
+    if (escaped) {
+      continue;
+    }
+
+    for (auto& [index, cells] : new_cells) {
+      object_footprints_.SetCells(index, std::move(cells));
+    }
+    size_t slice_begin = special_begin;
+    for (const auto& [index, slice_end] : special_ends) {
+      std::vector<uint16_t> cells;
+      ObjectFootprintIndex::AddTraceCells(
+          std::span(traces).subspan(slice_begin, slice_end - slice_begin),
+          cells);
+      object_footprints_.SetCells(index, std::move(cells));
+      slice_begin = slice_end;
+    }
+    for (size_t index : changed) {
+      object_footprints_.mutable_entries()[index].object = tile_objects_[index];
+    }
+
+    // Push only the touched rows to the SDL surfaces. Overlays and special
+    // objects were redrawn whole but their pixels outside the region are
+    // unchanged.
+    int first_row = kGrid;
+    int last_row = -1;
+    for (int cell = 0; cell < kGrid * kGrid; ++cell) {
+      if (region[cell]) {
+        first_row = std::min(first_row, cell / kGrid);
+        last_row = std::max(last_row, cell / kGrid);
+      }
+    }
+    ObjectDrawer::SyncBitmapRowsToSurface(object_bg1_buffer_.bitmap(),
+                                          first_row * 8, (last_row + 1) * 8);
+    ObjectDrawer::SyncBitmapRowsToSurface(object_bg2_buffer_.bitmap(),
+                                          first_row * 8, (last_row + 1) * 8);
+    return true;
   }
+  return false;
+}
 
-  // Validate background_tileset_ bounds
-  if (background_tileset_ < 0 || background_tileset_ > 255) {
-    return;
+// LoadGraphicsSheetsIntoArena() removed - using per-room graphics instead
+// Room rendering no longer depends on Arena graphics sheets
+
+int Room::ResolveAnimatedGraphicsSheet() const {
+  if (!rom_ || !rom_->is_loaded() || !game_data_ ||
+      game_data_->graphics_buffer.empty()) {
+    return -1;
+  }
+  if (animated_frame_ < 0 || animated_frame_ > 10 || background_tileset_ < 0 ||
+      background_tileset_ > 255) {
+    return -1;
   }
+  const auto& rom_data = rom_->vector();
+  const int gfx_ptr = SnesToPc(version_constants().kGfxAnimatedPointer);
+  if (gfx_ptr < 0 ||
+      gfx_ptr + background_tileset_ >= static_cast<int>(rom_data.size())) {
+    return -1;
+  }
+  return rom_data[gfx_ptr + background_tileset_];
+}
 
-  int gfx_ptr = SnesToPc(version_constants().kGfxAnimatedPointer);
-  if (gfx_ptr < 0 || gfx_ptr >= static_cast<int>(rom_data.size())) {
+void Room::LoadAnimatedGraphics(RoomGraphicsBuffer::Pixels& gfx16,
+                                int animated_sheet) const {
+  if (animated_sheet < 0 || !game_data_) {
     return;
   }
+  const auto& gfx_buffer_data = game_data_->graphics_buffer;
 
-  int data = 0;
-  while (data < 1024) {
-    // Validate buffer access for first operation
+  for (int data = 0; data < 1024; data++) {
     // 92 * 4096 = 376832. 1024 * 10 = 10240. Total ~387KB.
     int first_offset = data + (92 * 4096) + (1024 * animated_frame_);
-    if (first_offset >= 0 &&
-        first_offset < static_cast<int>(gfx_buffer_data->size())) {
-      uint8_t map_byte = (*gfx_buffer_data)[first_offset];
-
-      // Validate current_gfx16_ access
-      int gfx_offset = data + (7 * 4096);
-      if (gfx_offset >= 0 &&
-          gfx_offset < static_cast<int>(current_gfx16_.size())) {
-        current_gfx16_[gfx_offset] = map_byte;
-      }
+    if (first_offset < static_cast<int>(gfx_buffer_data.size())) {
+      gfx16[data + (7 * 4096)] = gfx_buffer_data[first_offset];
     }
 
-    // Validate buffer access for second operation
-    int tileset_index = rom_data[gfx_ptr + background_tileset_];
     int second_offset =
-        data + (tileset_index * 4096) + (1024 * animated_frame_);
-    if (second_offset >= 0 &&
-        second_offset < static_cast<int>(gfx_buffer_data->size())) {
-      uint8_t map_byte = (*gfx_buffer_data)[second_offset];
-
-      // Validate current_gfx16_ access
-      int gfx_offset = data + (7 * 4096) - 1024;
-      if (gfx_offset >= 0 &&
-          gfx_offset < static_cast<int>(current_gfx16_.size())) {
-        current_gfx16_[gfx_offset] = map_byte;
-      }
+        data + (animated_sheet * 4096) + (1024 * animated_frame_);
+    if (second_offset < static_cast<int>(gfx_buffer_data.size())) {
+      gfx16[data + (7 * 4096) - 1024] = gfx_buffer_data[second_offset];
     }
-
-    data++;
   }
 }
 
+RoomGraphicsBuffer::Pixels& Room::mutable_gfx_buffer_for_testing() {
+  auto detached = std::make_shared<RoomGraphicsBuffer>();
+  detached->mutable_pixels() = get_gfx_buffer();
+  auto& pixels = detached->mutable_pixels();
+  gfx_buffer_ = std::move(detached);
+  tile_pixel_cache_.InvalidateAll();
+  return pixels;
+}
+
 void Room::LoadObjects() {
   LOG_DEBUG("[LoadObjects]", "Starting LoadObjects for room %d", room_id_);
-  auto rom_data = rom()->vector();
+  const auto& rom_data = rom()->vector();
 
   // Enhanced object loading with comprehensive validation
   int object_pointer = (rom_data[kRoomObjectPointer + 2] << 16) +
@@ -1689,7 +1800,7 @@ void Room::LoadObjects() {
 }
 
 void Room::ParseObjectsFromLocation(int objects_location) {
-  auto rom_data = rom()->vector();
+  const auto& rom_data = rom()->vector();
 
   // Clear existing objects before parsing to prevent accumulation on reload
   tile_objects_.clear();
@@ -2034,7 +2145,7 @@ absl::Status Room::SaveObjects(const DungeonStreamLayout* layout) {
   }
 
   const auto& rom_data = rom()->vector();
-  ASSIGN_OR_RETURN(const PhysicalStreamInfo stream_info,
+  ASSIGN_OR_RETURN(const RoomStreamExtent stream_info,
                    GetObjectStreamInfo(rom_data, room_id_));
   const auto encoded_bytes = EncodeObjects();
   bool requires_copy_on_write = false;
@@ -2138,7 +2249,7 @@ absl::Status Room::SaveObjectStreamHeader(const DungeonStreamLayout* layout) {
   }
 
   const auto& rom_data = rom_->vector();
-  ASSIGN_OR_RETURN(const PhysicalStreamInfo stream_info,
+  ASSIGN_OR_RETURN(const RoomStreamExtent stream_info,
                    GetObjectStreamInfo(rom_data, room_id_));
   if (stream_info.address < 0 ||
       stream_info.address + 1 >= static_cast<int>(rom_data.size())) {
@@ -2232,7 +2343,7 @@ absl::Status Room::SaveSprites(const DungeonStreamLayout* layout) {
     return absl::OutOfRangeError("Room ID out of range");
   }
 
-  ASSIGN_OR_RETURN(const PhysicalStreamInfo stream_info,
+  ASSIGN_OR_RETURN(const RoomStreamExtent stream_info,
                    GetSpriteStreamInfo(rom_data, room_id_));
   const auto encoded_bytes = EncodeSprites();
   bool requires_copy_on_write = false;
@@ -2390,9 +2501,7 @@ absl::Status Room::AddObject(const RoomObject& object) {
   }
 
   // Add to internal list
-  tile_objects_.push_back(object);
-  objects_loaded_ = true;
-  MarkSaveDirtyForTileObject(object);
+  AddTileObject(object);
 
   return absl::OkStatus();
 }
@@ -2402,10 +2511,7 @@ absl::Status Room::RemoveObject(size_t index) {
     return absl::OutOfRangeError("Object index out of range");
   }
 
-  MarkSaveDirtyForTileObject(tile_objects_[index]);
-  tile_objects_.erase(tile_objects_.begin() + index);
-  objects_loaded_ = true;
-  MarkObjectsDirty();
+  RemoveTileObject(index);
 
   return absl::OkStatus();
 }
@@ -2419,24 +2525,38 @@ absl::Status Room::UpdateObject(size_t index, const RoomObject& object) {
     return absl::InvalidArgumentError("Invalid object parameters");
   }
 
+  const bool index_in_sync = ObjectSpatialIndexInSync();
   MarkSaveDirtyForTileObject(tile_objects_[index]);
   tile_objects_[index] = object;
   objects_loaded_ = true;
   MarkSaveDirtyForTileObject(object);
+  if (index_in_sync) {
+    object_spatial_index_.Update(index, object);
+    object_spatial_index_stale_ = false;
+  }
 
   return absl::OkStatus();
 }
 
 absl::StatusOr<size_t> Room::FindObjectAt(int x, int y, int layer) const {
-  for (size_t i = 0; i < tile_objects_.size(); i++) {
-    const auto& obj = tile_objects_[i];
-    if (obj.x() == x && obj.y() == y && obj.GetLayerValue() == layer) {
+  // The grid clamps list indices above 2 into the last list; match the exact
+  // value here.
+  for (size_t i : GetObjectSpatialIndex().QueryOrigin(x, y)) {
+    if (tile_objects_[i].GetLayerValue() == layer) {
       return i;
     }
   }
   return absl::NotFoundError("No object found at position");
 }
 
+const ObjectSpatialIndex& Room::GetObjectSpatialIndex() const {
+  if (!ObjectSpatialIndexInSync()) {
+    object_spatial_index_.Sync(tile_objects_);
+    object_spatial_index_stale_ = false;
+  }
+  return object_spatial_index_;
+}
+
 bool Room::ValidateObject(const RoomObject& object) const {
   // Validate position (0-63 for both X and Y)
   if (object.x() < 0 || object.x() > 63)
@@ -3714,43 +3834,17 @@ absl::StatusOr<ChestSavePlan> BuildChestSavePlanImpl(
   return plan;
 }
 
-int ReadRoomPotItemAddressPc(const std::vector<uint8_t>& rom_data,
-                             int room_id) {
-  if (room_id < 0 || room_id >= kNumberOfRooms) {
-    return -1;
-  }
-  const int ptr_off = kRoomItemsPointers + (room_id * 2);
-  if (ptr_off < 0 || ptr_off + 1 >= static_cast<int>(rom_data.size())) {
-    return -1;
-  }
-  const uint16_t item_ptr =
-      (static_cast<uint16_t>(rom_data[ptr_off + 1]) << 8) | rom_data[ptr_off];
-  if (item_ptr < 0x8000) {
-    return -1;
-  }
-  const int item_addr = static_cast<int>(SnesToPc(0x010000 | item_ptr));
-  return item_addr >= 0 && item_addr < static_cast<int>(rom_data.size())
-             ? item_addr
-             : -1;
-}
-
-absl::StatusOr<PhysicalStreamInfo> GetPotItemStreamInfo(
+absl::StatusOr<RoomStreamExtent> GetPotItemStreamInfo(
     const std::vector<uint8_t>& rom_data, int room_id) {
-  if (kRoomItemsPointers + (kNumberOfRooms * 2) >
-      static_cast<int>(rom_data.size())) {
-    return absl::OutOfRangeError("Room items pointer table out of range");
-  }
+  const auto tables = GetRoomStreamTables(rom_data);
+  RETURN_IF_ERROR(tables->pot_items.status);
   if (room_id < 0 || room_id >= kNumberOfRooms) {
     return absl::OutOfRangeError("Room ID out of range");
   }
 
-  std::vector<int> addresses(kNumberOfRooms, -1);
-  for (int id = 0; id < kNumberOfRooms; ++id) {
-    addresses[id] = ReadRoomPotItemAddressPc(rom_data, id);
-  }
   const int hard_end =
       std::min(static_cast<int>(rom_data.size()), kRoomItemsDataEnd);
-  PhysicalStreamInfo info = AnalyzePhysicalStream(addresses, room_id, hard_end);
+  const RoomStreamExtent info = tables->pot_items.rooms[room_id];
   if (info.address < 0 || info.address >= hard_end) {
     return absl::FailedPreconditionError(
         "Room pot item pointer is null, invalid, or outside the item region");
@@ -3909,6 +4003,12 @@ absl::Status SaveAllPotItemsImpl(
                      InventoryDungeonStreams(*rom, *repack_layout));
     ASSIGN_OR_RETURN(const DungeonStreamWritePlan plan,
                      PlanDungeonStreamRepack(inventory, replacements));
+    LOG_DEBUG("Room",
+              "Pot-item repack: %u room(s) repointed, %u payload(s) moved "
+              "(%u bytes), %u free byte(s) in %u fragment(s)",
+              plan.repack_cost.repointed_rooms,
+              plan.repack_cost.moved_payloads, plan.repack_cost.moved_bytes,
+              plan.repack_cost.free_bytes, plan.repack_cost.free_fragments);
     RETURN_IF_ERROR(ApplyDungeonStreamWritePlan(rom, plan));
     for (const DungeonStreamReplacement& replacement : replacements) {
       if (const Room* room = room_lookup(replacement.room_id);
@@ -3934,7 +4034,7 @@ absl::Status SaveAllPotItemsImpl(
       continue;
     }
 
-    ASSIGN_OR_RETURN(const PhysicalStreamInfo stream_info,
+    ASSIGN_OR_RETURN(const RoomStreamExtent stream_info,
                      GetPotItemStreamInfo(rom_data, room_id));
     if (stream_info.shared) {
       return absl::FailedPreconditionError(absl::StrFormat(
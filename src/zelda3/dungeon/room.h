@@ -17,12 +17,16 @@
 #include "absl/types/span.h"
 
 #include "app/gfx/render/background_buffer.h"
+#include "app/gfx/render/tile_pixel_cache.h"
 #include "rom/rom.h"
 #include "zelda3/dungeon/custom_collision.h"
 #include "zelda3/dungeon/door_position.h"
 #include "zelda3/dungeon/door_types.h"
 #include "zelda3/dungeon/dungeon_limits.h"
 #include "zelda3/dungeon/dungeon_rom_addresses.h"
+#include "zelda3/dungeon/object_footprint_index.h"
+#include "zelda3/dungeon/object_spatial_index.h"
+#include "zelda3/dungeon/room_graphics_cache.h"
 #include "zelda3/dungeon/room_layout.h"
 #include "zelda3/dungeon/room_object.h"
 #include "zelda3/game_data.h"
@@ -233,7 +237,8 @@ class Room {
   // LoadGraphicsSheetsIntoArena() removed - per-room graphics instead
   void RenderRoomGraphics();
   void RenderObjectsToBackground();
-  void LoadAnimatedGraphics();
+  void LoadAnimatedGraphics(RoomGraphicsBuffer::Pixels& gfx16,
+                            int animated_sheet) const;
   void LoadObjects();
   void EnsureObjectsLoaded();
   void LoadSprites();
@@ -393,9 +398,14 @@ class Room {
     MarkObjectsDirty();
   }
   void AddTileObject(const RoomObject& object) {
+    const bool index_in_sync = ObjectSpatialIndexInSync();
     tile_objects_.push_back(object);
     objects_loaded_ = true;
     MarkSaveDirtyForTileObject(object);
+    if (index_in_sync) {
+      object_spatial_index_.Insert(tile_objects_.size() - 1, object);
+      object_spatial_index_stale_ = false;
+    }
   }
 
   // Enhanced object manipulation (Phase 3)
@@ -403,10 +413,16 @@ class Room {
   absl::Status RemoveObject(size_t index);
   absl::Status UpdateObject(size_t index, const RoomObject& object);
   absl::StatusOr<size_t> FindObjectAt(int x, int y, int layer) const;
+
+  // Tile grid over tile_objects_ for point/rect/overlap queries. Edits made
+  // through the methods above update it in place; anything that calls
+  // MarkObjectsDirty() gets it re-synced on the next access.
+  const ObjectSpatialIndex& GetObjectSpatialIndex() const;
   bool ValidateObject(const RoomObject& object) const;
 
   // Performance optimization: Mark objects as dirty when modified
   void MarkObjectsDirty() {
+    object_spatial_index_stale_ = true;
     dirty_state_.objects = true;
     dirty_state_.textures = true;
     dirty_state_.composite = true;
@@ -459,10 +475,15 @@ class Room {
   }
   void RemoveTileObject(size_t index) {
     if (index < tile_objects_.size()) {
+      const bool index_in_sync = ObjectSpatialIndexInSync();
       MarkSaveDirtyForTileObject(tile_objects_[index]);
       tile_objects_.erase(tile_objects_.begin() + index);
       objects_loaded_ = true;
       MarkObjectsDirty();
+      if (index_in_sync) {
+        object_spatial_index_.Remove(index);
+        object_spatial_index_stale_ = false;
+      }
     }
   }
   size_t GetTileObjectCount() const { return tile_objects_.size(); }
@@ -969,8 +990,10 @@ class Room {
                                               : zelda3_version::US);
   }
   const std::array<uint8_t, 0x10000>& get_gfx_buffer() const {
-    return current_gfx16_;
+    return gfx_buffer_ ? gfx_buffer_->pixels() : RoomGraphicsBuffer::Empty();
   }
+  // Gives the room a private copy of its graphics that tests may poke at.
+  RoomGraphicsBuffer::Pixels& mutable_gfx_buffer_for_testing();
 
   // Per-room background buffers (not shared via arena!)
   auto& bg1_buffer() { return bg1_buffer_; }
@@ -992,11 +1015,46 @@ class Room {
 
   DungeonState* GetDungeonState() { return dungeon_state_.get(); }
 
+  /// True when the last object render only redrew the objects an edit
+  /// touched instead of the whole room.
+  bool last_object_render_incremental() const {
+    return last_object_render_incremental_;
+  }
+  /// Object footprints recorded by the last object render.
+  const ObjectFootprintIndex& object_footprints() const {
+    return object_footprints_;
+  }
+
  private:
+  // Object render helpers shared by the full and incremental paths.
+  bool RenderObjectsIncrementally(ObjectDrawer& drawer,
+                                  const gfx::PaletteGroup& palette_group);
+  void DrawObjectOverlays(ObjectDrawer& drawer);
+  // Draws torches and pushable blocks; when `traces` is set, appends each
+  // one's tile_objects_ index and trace slice end to `trace_ends`.
+  void DrawSpecialTableObjects(
+      ObjectDrawer& drawer,
+      std::vector<std::pair<size_t, size_t>>* trace_ends,
+      const std::vector<ObjectDrawer::TileTrace>* traces);
+  std::vector<int> ObjectOverlayKey() const;
+
+  // Sheet LoadAnimatedGraphics reads animated background tiles from, or -1
+  // when the room has none.
+  int ResolveAnimatedGraphicsSheet() const;
+
+  bool ObjectSpatialIndexInSync() const {
+    return !object_spatial_index_stale_ &&
+           object_spatial_index_.size() == tile_objects_.size();
+  }
+
   Rom* rom_;
   GameData* game_data_ = nullptr;
 
-  std::array<uint8_t, 0x10000> current_gfx16_;
+  // Assembled room graphics, shared with every room that has the same sheets
+  // (see RoomGraphicsCache).
+  std::shared_ptr<const RoomGraphicsBuffer> gfx_buffer_;
+  // Pre-flipped 8x8 tiles decoded from gfx_buffer_ (one slot per block).
+  gfx::TilePixelCache tile_pixel_cache_{16};
 
   // Each room has its OWN background buffers and bitmaps
   // Each room has its OWN background buffers and bitmaps
@@ -1005,6 +1063,13 @@ class Room {
   gfx::BackgroundBuffer object_bg1_buffer_{512, 512};
   gfx::BackgroundBuffer object_bg2_buffer_{512, 512};
 
+  // Where each object drew during the last full object render, so an edit
+  // can redraw just the objects it overlaps.
+  ObjectFootprintIndex object_footprints_;
+  // Doors, pot items and key drops the footprints were recorded with.
+  std::vector<int> footprint_overlay_key_;
+  bool last_object_render_incremental_ = false;
+
   struct DirtyState {
     bool graphics = true;
     bool objects = true;
@@ -1085,6 +1150,8 @@ class Room {
   std::array<chest, 16> chest_list_;
 
   std::vector<RoomObject> tile_objects_;
+  mutable ObjectSpatialIndex object_spatial_index_;
+  mutable bool object_spatial_index_stale_ = true;
   // TODO: add separate door objects list when door section (F0 FF) is parsed
   std::vector<zelda3::Sprite> sprites_;
   std::vector<staircase> z3_staircases_;
@@ -0,0 +1,123 @@
+#include "zelda3/dungeon/room_graphics_cache.h"
+
+#include <algorithm>
+
+#include "app/gfx/resource/arena.h"
+
+namespace yaze {
+namespace zelda3 {
+
+namespace {
+
+// LoadAnimatedGraphics copies frames of this sheet into block 7.
+constexpr int kAnimatedTileSheet = 92;
+
+bool UsesSheet(const RoomGraphicsKey& key, int sheet) {
+  if (std::find(key.blocks.begin(), key.blocks.end(), sheet) !=
+      key.blocks.end()) {
+    return true;
+  }
+  return key.animated_sheet >= 0 &&
+         (sheet == key.animated_sheet || sheet == kAnimatedTileSheet);
+}
+
+}  // namespace
+
+const RoomGraphicsBuffer::Pixels& RoomGraphicsBuffer::Empty() {
+  static const Pixels empty{};
+  return empty;
+}
+
+size_t RoomGraphicsCache::KeyHash::operator()(
+    const RoomGraphicsKey& key) const {
+  size_t hash = std::hash<const void*>()(key.source) ^ key.source_size;
+  for (uint8_t block : key.blocks) {
+    hash = hash * 31 + block;
+  }
+  hash = hash * 31 + key.main_blockset;
+  hash = hash * 31 + static_cast<size_t>(key.animated_frame);
+  hash = hash * 31 + static_cast<size_t>(key.animated_sheet + 1);
+  return hash;
+}
+
+RoomGraphicsCache& RoomGraphicsCache::Get() {
+  static RoomGraphicsCache instance;
+  return instance;
+}
+
+std::shared_ptr<const RoomGraphicsBuffer> RoomGraphicsCache::Acquire(
+    const RoomGraphicsKey& key, const Builder& build) {
+  EnsureSheetListener();
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    if (auto buffer = it->second.lock()) {
+      ++stats_.hits;
+      return buffer;
+    }
+  }
+
+  auto buffer = std::make_shared<RoomGraphicsBuffer>();
+  build(buffer->pixels_);
+  ++stats_.builds;
+  PruneExpiredLocked();
+  entries_[key] = buffer;
+  return buffer;
+}
+
+void RoomGraphicsCache::InvalidateSheet(int sheet) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (!UsesSheet(it->first, sheet)) {
+      ++it;
+      continue;
+    }
+    if (auto buffer = it->second.lock()) {
+      buffer->stale_.store(true, std::memory_order_release);
+      ++stats_.invalidations;
+    }
+    it = entries_.erase(it);
+  }
+}
+
+void RoomGraphicsCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& [key, weak] : entries_) {
+    if (auto buffer = weak.lock()) {
+      buffer->stale_.store(true, std::memory_order_release);
+    }
+  }
+  entries_.clear();
+  stats_ = {};
+}
+
+size_t RoomGraphicsCache::LiveCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return std::count_if(entries_.begin(), entries_.end(),
+                       [](const auto& entry) { return !entry.second.expired(); });
+}
+
+RoomGraphicsCache::Stats RoomGraphicsCache::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+void RoomGraphicsCache::EnsureSheetListener() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (listening_) {
+      return;
+    }
+    listening_ = true;
+  }
+  gfx::Arena::Get().RegisterSheetListener(
+      [this](int sheet_index) { InvalidateSheet(sheet_index); });
+}
+
+void RoomGraphicsCache::PruneExpiredLocked() {
+  std::erase_if(entries_,
+                [](const auto& entry) { return entry.second.expired(); });
+}
+
+}  // namespace zelda3
+}  // namespace yaze
@@ -0,0 +1,116 @@
+#ifndef YAZE_ZELDA3_DUNGEON_ROOM_GRAPHICS_CACHE_H
+#define YAZE_ZELDA3_DUNGEON_ROOM_GRAPHICS_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace yaze {
+namespace zelda3 {
+
+/**
+ * @brief Everything an assembled room graphics buffer depends on
+ *
+ * Rooms with the same sheet assignment, main blockset (which picks the
+ * Left/Right palette expansion of the background slots) and animated tile
+ * frame build byte-identical buffers, so most of the 296 rooms share a few
+ * dozen buffers.
+ */
+struct RoomGraphicsKey {
+  const uint8_t* source = nullptr;  // GameData::graphics_buffer storage
+  size_t source_size = 0;
+  std::array<uint8_t, 16> blocks{};
+  uint8_t main_blockset = 0;
+  int animated_frame = 0;
+  int animated_sheet = -1;  // Sheet the animated tiles come from; -1 if none
+
+  bool operator==(const RoomGraphicsKey& other) const = default;
+};
+
+/**
+ * @brief A room's assembled 8BPP graphics: 16 sheets of 128x32 pixels
+ *
+ * Immutable once published by RoomGraphicsCache. stale() turns true when a
+ * source sheet is modified; holders should acquire a fresh buffer then.
+ */
+class RoomGraphicsBuffer {
+ public:
+  static constexpr size_t kSize = 0x10000;
+  using Pixels = std::array<uint8_t, kSize>;
+
+  const Pixels& pixels() const { return pixels_; }
+  // Only for buffers that were never published through RoomGraphicsCache.
+  Pixels& mutable_pixels() { return pixels_; }
+  bool stale() const { return stale_.load(std::memory_order_acquire); }
+
+  /// Shared all-zero buffer for rooms that have not assembled graphics yet.
+  static const Pixels& Empty();
+
+ private:
+  friend class RoomGraphicsCache;
+
+  Pixels pixels_{};
+  std::atomic<bool> stale_{false};
+};
+
+/**
+ * @brief Process-wide cache of assembled room graphics buffers
+ *
+ * Buffers are reference counted: the cache only holds weak references, so a
+ * buffer lives exactly as long as some Room uses it. Acquire() returns the
+ * live buffer for a key or runs the builder once to create it.
+ * Arena::NotifySheetModified marks every buffer assembled from that sheet
+ * stale and drops it from the cache.
+ *
+ * Buffers hold palette indices only; palettes are applied when rooms render,
+ * so palette edits never invalidate them.
+ */
+class RoomGraphicsCache {
+ public:
+  using Builder = std::function<void(RoomGraphicsBuffer::Pixels&)>;
+
+  struct Stats {
+    size_t hits = 0;
+    size_t builds = 0;
+    size_t invalidations = 0;
+  };
+
+  static RoomGraphicsCache& Get();
+
+  std::shared_ptr<const RoomGraphicsBuffer> Acquire(const RoomGraphicsKey& key,
+                                                    const Builder& build);
+
+  /// Mark buffers built from Arena sheet @p sheet stale and forget them.
+  void InvalidateSheet(int sheet);
+  void Clear();
+
+  /// Number of buffers still referenced by some room.
+  size_t LiveCount() const;
+  Stats stats() const;
+
+ private:
+  struct KeyHash {
+    size_t operator()(const RoomGraphicsKey& key) const;
+  };
+
+  RoomGraphicsCache() = default;
+  void EnsureSheetListener();
+  void PruneExpiredLocked();
+
+  mutable std::mutex mutex_;
+  std::unordered_map<RoomGraphicsKey, std::weak_ptr<RoomGraphicsBuffer>,
+                     KeyHash>
+      entries_;
+  Stats stats_;
+  bool listening_ = false;
+};
+
+}  // namespace zelda3
+}  // namespace yaze
+
+#endif  // YAZE_ZELDA3_DUNGEON_ROOM_GRAPHICS_CACHE_H
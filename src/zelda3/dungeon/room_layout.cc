@@ -124,7 +124,8 @@ absl::Status RoomLayout::Draw(int room_id, const uint8_t* gfx_data,
                               gfx::BackgroundBuffer& bg1,
                               gfx::BackgroundBuffer& bg2,
                               const gfx::PaletteGroup& palette_group,
-                              DungeonState* state) const {
+                              DungeonState* state,
+                              gfx::TilePixelCache* tile_cache) const {
   if (!rom_ || !rom_->is_loaded()) {
     return absl::FailedPreconditionError("ROM not loaded");
   }
@@ -134,6 +135,7 @@ absl::Status RoomLayout::Draw(int room_id, const uint8_t* gfx_data,
   }
 
   ObjectDrawer drawer(rom_, room_id, gfx_data);
+  drawer.SetTilePixelCache(tile_cache);
   drawer.SetAllowTrackCornerAliases(false);
   drawer.SetBG1RevealMaskSource(gfx::BG1RevealMaskSource::kBG2Layout);
 
@@ -22,11 +22,12 @@ class RoomLayout {
 
   absl::Status LoadLayout(int layout_id);
 
-  // Render the layout objects into the provided buffers
+  // Render the layout objects into the provided buffers. `tile_cache`, when
+  // given, must decode from `gfx_data`.
   absl::Status Draw(int room_id, const uint8_t* gfx_data,
                     gfx::BackgroundBuffer& bg1, gfx::BackgroundBuffer& bg2,
-                    const gfx::PaletteGroup& palette_group,
-                    DungeonState* state) const;
+                    const gfx::PaletteGroup& palette_group, DungeonState* state,
+                    gfx::TilePixelCache* tile_cache = nullptr) const;
 
   const std::vector<RoomObject>& GetObjects() const { return objects_; }
 
@@ -356,6 +356,24 @@ RoomObject::ObjectBytes RoomObject::EncodeObjectToBytes() const {
   return bytes;
 }
 
+bool SameObjectState(const RoomObject& a, const RoomObject& b) {
+  return a.id_ == b.id_ && a.x_ == b.x_ && a.y_ == b.y_ &&
+         a.size_ == b.size_ && a.layer_ == b.layer_ && a.nx_ == b.nx_ &&
+         a.ny_ == b.ny_ && a.ox_ == b.ox_ && a.oy_ == b.oy_ && a.z_ == b.z_ &&
+         a.previous_size_ == b.previous_size_ &&
+         a.size_x_bits_ == b.size_x_bits_ &&
+         a.size_y_bits_ == b.size_y_bits_ && a.width_ == b.width_ &&
+         a.height_ == b.height_ && a.offset_x_ == b.offset_x_ &&
+         a.offset_y_ == b.offset_y_ && a.all_bgs_ == b.all_bgs_ &&
+         a.lit_ == b.lit_ && a.options() == b.options() &&
+         a.block_load_order() == b.block_load_order() &&
+         a.block_behavior_layer() == b.block_behavior_layer() &&
+         a.torch_reserved_bit() == b.torch_reserved_bit() &&
+         a.rom_ == b.rom_ && a.name_ == b.name_ &&
+         a.preview_object_data_ == b.preview_object_data_ &&
+         a.tiles_loaded_ == b.tiles_loaded_ && a.tiles_ == b.tiles_;
+}
+
 bool IsRoomObjectSizeEditable(int object_id) {
   return object_id >= 0x000 && object_id <= 0x0F7;
 }
@@ -264,6 +264,12 @@ bool IsRoomObjectSizeEditable(int object_id);
 uint8_t CanonicalRoomObjectSize(int object_id, uint8_t requested_size);
 uint8_t DefaultRoomObjectSizeForPlacement(int object_id);
 
+// True when two objects hold the same editable state and the same loaded
+// tiles, so either can stand in for the other when redrawing or recording
+// undo history. Objects carrying injected preview tiles compare unequal to a
+// differently cached copy.
+bool SameObjectState(const RoomObject& a, const RoomObject& b);
+
 // Stateful small and big chests advance the engine's per-room chest-event
 // index. Fixed-open chest graphics (F9A/FB2) and the FF5 minigame chest do not.
 inline constexpr bool IsStatefulChestObjectId(int object_id) {
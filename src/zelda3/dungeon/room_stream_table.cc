@@ -0,0 +1,329 @@
+#include "zelda3/dungeon/room_stream_table.h"
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <unordered_set>
+
+#include "rom/rom.h"
+#include "rom/snes.h"
+#include "zelda3/dungeon/dungeon_rom_addresses.h"
+
+namespace yaze {
+namespace zelda3 {
+
+namespace {
+
+constexpr int kLoRomBankSize = 0x8000;
+
+RoomStreamTable BuildObjectTable(const std::vector<uint8_t>& rom_data) {
+  std::vector<int> addresses(kNumberOfRooms, -1);
+  int table_pc = 0;
+  absl::Status status = GetObjectPointerTablePc(rom_data, &table_pc);
+  if (status.ok()) {
+    for (int id = 0; id < kNumberOfRooms; ++id) {
+      addresses[id] = ReadRoomObjectAddressPc(rom_data, table_pc, id);
+    }
+  }
+  RoomStreamTable table =
+      BuildRoomStreamTable(addresses, [](int address) {
+        return GetDungeonObjectDataRegionEnd(address);
+      });
+  table.status = std::move(status);
+  return table;
+}
+
+RoomStreamTable BuildSpriteTable(const std::vector<uint8_t>& rom_data) {
+  std::vector<int> addresses(kNumberOfRooms, -1);
+  int table_pc = 0;
+  absl::Status status = GetSpritePointerTablePc(rom_data, &table_pc);
+  if (status.ok()) {
+    for (int id = 0; id < kNumberOfRooms; ++id) {
+      addresses[id] = ReadRoomSpriteAddressPc(rom_data, table_pc, id);
+    }
+  }
+  const int hard_end =
+      std::min(static_cast<int>(rom_data.size()), kSpritesDataEndExclusive);
+  RoomStreamTable table =
+      BuildRoomStreamTable(addresses, [hard_end](int) { return hard_end; });
+  table.status = std::move(status);
+  return table;
+}
+
+RoomStreamTable BuildPotItemTable(const std::vector<uint8_t>& rom_data) {
+  std::vector<int> addresses(kNumberOfRooms, -1);
+  absl::Status status;
+  if (kRoomItemsPointers + (kNumberOfRooms * 2) >
+      static_cast<int>(rom_data.size())) {
+    status = absl::OutOfRangeError("Room items pointer table out of range");
+  } else {
+    for (int id = 0; id < kNumberOfRooms; ++id) {
+      addresses[id] = ReadRoomPotItemAddressPc(rom_data, id);
+    }
+  }
+  const int hard_end =
+      std::min(static_cast<int>(rom_data.size()), kRoomItemsDataEnd);
+  RoomStreamTable table =
+      BuildRoomStreamTable(addresses, [hard_end](int) { return hard_end; });
+  table.status = std::move(status);
+  return table;
+}
+
+// Every byte the tables are derived from: the ROM size, the table base
+// pointers and the pointer tables themselves. Whether a table is included
+// depends only on the bytes before it, so equal keys mean equal tables.
+std::vector<uint8_t> MakeCacheKey(const std::vector<uint8_t>& rom_data) {
+  std::vector<uint8_t> key;
+  key.reserve(16 + kNumberOfRooms * 7);
+  const uint32_t size = static_cast<uint32_t>(rom_data.size());
+  for (int shift = 0; shift < 32; shift += 8) {
+    key.push_back(static_cast<uint8_t>(size >> shift));
+  }
+  const auto append = [&](int begin, int length) {
+    if (begin >= 0 && begin + length <= static_cast<int>(rom_data.size())) {
+      key.insert(key.end(), rom_data.begin() + begin,
+                 rom_data.begin() + begin + length);
+    }
+  };
+
+  int table_pc = 0;
+  append(kRoomObjectPointer, 3);
+  if (GetObjectPointerTablePc(rom_data, &table_pc).ok()) {
+    append(table_pc, kNumberOfRooms * 3);
+  }
+  append(kRoomsSpritePointer, 2);
+  if (GetSpritePointerTablePc(rom_data, &table_pc).ok()) {
+    append(table_pc, kNumberOfRooms * 2);
+  }
+  append(kRoomItemsPointers, kNumberOfRooms * 2);
+  return key;
+}
+
+struct TableCache {
+  std::mutex mutex;
+  std::vector<uint8_t> key;
+  std::shared_ptr<const RoomStreamTables> tables;
+};
+
+TableCache& GetTableCache() {
+  static TableCache instance;
+  return instance;
+}
+
+}  // namespace
+
+const RoomStreamTable& RoomStreamTables::Get(DungeonStreamKind kind) const {
+  switch (kind) {
+    case DungeonStreamKind::kSprite:
+      return sprites;
+    case DungeonStreamKind::kPotItem:
+      return pot_items;
+    case DungeonStreamKind::kObject:
+    default:
+      return objects;
+  }
+}
+
+RoomStreamTable BuildRoomStreamTable(
+    const std::vector<int>& addresses,
+    const std::function<int(int address)>& region_end) {
+  RoomStreamTable table;
+  table.rooms.resize(addresses.size());
+
+  std::vector<int> order;
+  order.reserve(addresses.size());
+  for (int id = 0; id < static_cast<int>(addresses.size()); ++id) {
+    if (addresses[id] >= 0) {
+      table.rooms[id].address = addresses[id];
+      order.push_back(id);
+    }
+  }
+  std::sort(order.begin(), order.end(), [&addresses](int a, int b) {
+    return addresses[a] != addresses[b] ? addresses[a] < addresses[b] : a < b;
+  });
+
+  for (size_t begin = 0; begin < order.size();) {
+    const int address = addresses[order[begin]];
+    size_t end = begin + 1;
+    while (end < order.size() && addresses[order[end]] == address) {
+      ++end;
+    }
+
+    int bound = end < order.size() ? addresses[order[end]]
+                                   : std::numeric_limits<int>::max();
+    const int known_end = region_end(address);
+    if (known_end > address) {
+      bound = std::min(bound, known_end);
+    }
+    // A stream cannot safely grow across a LoROM bank boundary even when the
+    // next pointer happens to live in the following physical bank. The bank
+    // end alone is not a physical data boundary, so fail closed unless an
+    // actual pointer or a region end bounds this bank.
+    const int bank_end = ((address / kLoRomBankSize) + 1) * kLoRomBankSize;
+    const int physical_end = bound <= bank_end ? bound : -1;
+
+    const bool shared = end - begin > 1;
+    for (size_t i = begin; i < end; ++i) {
+      table.rooms[order[i]].physical_end = physical_end;
+      table.rooms[order[i]].shared = shared;
+    }
+    const int rooms = static_cast<int>(end - begin);
+    ++table.stream_count;
+    table.shared_room_count += shared ? rooms : 0;
+    table.unbounded_room_count += physical_end < 0 ? rooms : 0;
+    begin = end;
+  }
+  return table;
+}
+
+std::vector<int> RoomStreamSpans(const RoomStreamTable& table) {
+  std::vector<int> spans(table.rooms.size(), 0);
+  std::unordered_set<int> counted;
+  for (size_t id = 0; id < table.rooms.size(); ++id) {
+    const RoomStreamExtent& room = table.rooms[id];
+    if (room.address < 0 ||
+        (room.shared && !counted.insert(room.address).second)) {
+      continue;
+    }
+    const int bank_end =
+        ((room.address / kLoRomBankSize) + 1) * kLoRomBankSize;
+    spans[id] = room.physical_end >= 0 ? room.capacity()
+                                       : bank_end - room.address;
+  }
+  return spans;
+}
+
+std::shared_ptr<const RoomStreamTables> GetRoomStreamTables(
+    const std::vector<uint8_t>& rom_data) {
+  std::vector<uint8_t> key = MakeCacheKey(rom_data);
+  TableCache& cache = GetTableCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  if (cache.tables && cache.key == key) {
+    return cache.tables;
+  }
+
+  auto tables = std::make_shared<RoomStreamTables>();
+  tables->objects = BuildObjectTable(rom_data);
+  tables->sprites = BuildSpriteTable(rom_data);
+  tables->pot_items = BuildPotItemTable(rom_data);
+  cache.key = std::move(key);
+  cache.tables = std::move(tables);
+  return cache.tables;
+}
+
+std::shared_ptr<const RoomStreamTables> GetRoomStreamTables(const Rom& rom) {
+  return GetRoomStreamTables(rom.vector());
+}
+
+absl::Status GetObjectPointerTablePc(const std::vector<uint8_t>& rom_data,
+                                     int* table_pc) {
+  if (table_pc == nullptr) {
+    return absl::InvalidArgumentError("table_pc pointer is null");
+  }
+  if (kRoomObjectPointer + 2 >= static_cast<int>(rom_data.size())) {
+    return absl::OutOfRangeError(
+        "Object pointer table address is out of range");
+  }
+
+  const uint32_t table_snes =
+      (static_cast<uint32_t>(rom_data[kRoomObjectPointer + 2]) << 16) |
+      (static_cast<uint32_t>(rom_data[kRoomObjectPointer + 1]) << 8) |
+      rom_data[kRoomObjectPointer];
+  const int pc = static_cast<int>(SnesToPc(table_snes));
+  if (pc < 0 || pc + (kNumberOfRooms * 3) > static_cast<int>(rom_data.size())) {
+    return absl::OutOfRangeError("Object pointer table is out of range");
+  }
+
+  *table_pc = pc;
+  return absl::OkStatus();
+}
+
+uint32_t ReadRoomObjectAddressSnes(const std::vector<uint8_t>& rom_data,
+                                   int table_pc, int room_id) {
+  if (room_id < 0 || room_id >= kNumberOfRooms) {
+    return 0;
+  }
+  const int ptr_off = table_pc + (room_id * 3);
+  if (ptr_off < 0 || ptr_off + 2 >= static_cast<int>(rom_data.size())) {
+    return 0;
+  }
+  return (static_cast<uint32_t>(rom_data[ptr_off + 2]) << 16) |
+         (static_cast<uint32_t>(rom_data[ptr_off + 1]) << 8) |
+         rom_data[ptr_off];
+}
+
+int ReadRoomObjectAddressPc(const std::vector<uint8_t>& rom_data, int table_pc,
+                            int room_id) {
+  const uint32_t snes = ReadRoomObjectAddressSnes(rom_data, table_pc, room_id);
+  if ((snes & 0xFFFF) < 0x8000) {
+    return -1;
+  }
+  const int pc = static_cast<int>(SnesToPc(snes));
+  return pc >= 0 && pc < static_cast<int>(rom_data.size()) ? pc : -1;
+}
+
+absl::Status GetSpritePointerTablePc(const std::vector<uint8_t>& rom_data,
+                                     int* table_pc) {
+  if (table_pc == nullptr) {
+    return absl::InvalidArgumentError("table_pc pointer is null");
+  }
+  if (kRoomsSpritePointer + 1 >= static_cast<int>(rom_data.size())) {
+    return absl::OutOfRangeError(
+        "Sprite pointer table address is out of range");
+  }
+
+  int table_snes = (0x09 << 16) | (rom_data[kRoomsSpritePointer + 1] << 8) |
+                   rom_data[kRoomsSpritePointer];
+  int pc = SnesToPc(table_snes);
+  if (pc < 0 || pc + (kNumberOfRooms * 2) > static_cast<int>(rom_data.size())) {
+    return absl::OutOfRangeError("Sprite pointer table is out of range");
+  }
+
+  *table_pc = pc;
+  return absl::OkStatus();
+}
+
+int ReadRoomSpriteAddressPc(const std::vector<uint8_t>& rom_data, int table_pc,
+                            int room_id) {
+  if (room_id < 0 || room_id >= kNumberOfRooms) {
+    return -1;
+  }
+  const int ptr_off = table_pc + (room_id * 2);
+  if (ptr_off < 0 || ptr_off + 1 >= static_cast<int>(rom_data.size())) {
+    return -1;
+  }
+
+  const uint16_t pointer =
+      (static_cast<uint16_t>(rom_data[ptr_off + 1]) << 8) | rom_data[ptr_off];
+  if (pointer < 0x8000) {
+    return -1;
+  }
+  const int sprite_address = static_cast<int>(SnesToPc((0x09 << 16) | pointer));
+  return sprite_address >= 0 &&
+                 sprite_address < static_cast<int>(rom_data.size())
+             ? sprite_address
+             : -1;
+}
+
+int ReadRoomPotItemAddressPc(const std::vector<uint8_t>& rom_data,
+                             int room_id) {
+  if (room_id < 0 || room_id >= kNumberOfRooms) {
+    return -1;
+  }
+  const int ptr_off = kRoomItemsPointers + (room_id * 2);
+  if (ptr_off < 0 || ptr_off + 1 >= static_cast<int>(rom_data.size())) {
+    return -1;
+  }
+  const uint16_t item_ptr =
+      (static_cast<uint16_t>(rom_data[ptr_off + 1]) << 8) | rom_data[ptr_off];
+  if (item_ptr < 0x8000) {
+    return -1;
+  }
+  const int item_addr = static_cast<int>(SnesToPc(0x010000 | item_ptr));
+  return item_addr >= 0 && item_addr < static_cast<int>(rom_data.size())
+             ? item_addr
+             : -1;
+}
+
+}  // namespace zelda3
+}  // namespace yaze
@@ -0,0 +1,92 @@
+#ifndef YAZE_ZELDA3_DUNGEON_ROOM_STREAM_TABLE_H_
+#define YAZE_ZELDA3_DUNGEON_ROOM_STREAM_TABLE_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "zelda3/dungeon/dungeon_stream_allocator.h"
+
+namespace yaze {
+
+class Rom;
+
+namespace zelda3 {
+
+// Where one room's stream starts and how far it may grow in place. All
+// addresses are headerless PC offsets.
+struct RoomStreamExtent {
+  int address = -1;  // -1 when the room pointer is null or out of range.
+  // Start of the next stream, or the region end, whichever is closer. -1
+  // when nothing bounds the stream inside its LoROM bank.
+  int physical_end = -1;
+  // Another room points at the same address.
+  bool shared = false;
+
+  int capacity() const {
+    return physical_end > address ? physical_end - address : 0;
+  }
+};
+
+// Per-room extents of one pointer table, derived from a single sort of its
+// pointers instead of a scan of every other room per lookup.
+struct RoomStreamTable {
+  // Non-OK when the pointer table itself lies outside the ROM; rooms is then
+  // all invalid.
+  absl::Status status;
+  std::vector<RoomStreamExtent> rooms;
+  int stream_count = 0;       // Distinct valid start addresses.
+  int shared_room_count = 0;  // Rooms whose start another room also uses.
+  int unbounded_room_count = 0;  // Valid rooms with no in-place capacity.
+};
+
+// The object, sprite and pot-item pointer tables of one ROM revision.
+struct RoomStreamTables {
+  RoomStreamTable objects;
+  RoomStreamTable sprites;
+  RoomStreamTable pot_items;
+
+  const RoomStreamTable& Get(DungeonStreamKind kind) const;
+};
+
+// Sorts addresses once and bounds each room by the next greater address and
+// region_end(address), failing closed at a LoROM bank end. Negative
+// addresses are invalid rooms.
+RoomStreamTable BuildRoomStreamTable(
+    const std::vector<int>& addresses,
+    const std::function<int(int address)>& region_end);
+
+// Bytes each room's stream spans as the editor's room size readout counts
+// them: up to the next stream or region end, or to the end of its LoROM bank
+// when nothing closer bounds it. A shared stream is counted once, on its
+// lowest room ID; the other rooms sharing it and invalid rooms report 0.
+std::vector<int> RoomStreamSpans(const RoomStreamTable& table);
+
+// Reads and analyzes all three pointer tables. The most recent result is
+// cached against the exact pointer-table bytes and ROM size, so repeated
+// calls for one ROM revision are cheap and any write to a table, including
+// a raw one, is picked up. Safe to call from several threads.
+std::shared_ptr<const RoomStreamTables> GetRoomStreamTables(
+    const std::vector<uint8_t>& rom_data);
+std::shared_ptr<const RoomStreamTables> GetRoomStreamTables(const Rom& rom);
+
+// Pointer-table readers shared with the room loaders and savers.
+absl::Status GetObjectPointerTablePc(const std::vector<uint8_t>& rom_data,
+                                     int* table_pc);
+uint32_t ReadRoomObjectAddressSnes(const std::vector<uint8_t>& rom_data,
+                                   int table_pc, int room_id);
+int ReadRoomObjectAddressPc(const std::vector<uint8_t>& rom_data, int table_pc,
+                            int room_id);
+absl::Status GetSpritePointerTablePc(const std::vector<uint8_t>& rom_data,
+                                     int* table_pc);
+int ReadRoomSpriteAddressPc(const std::vector<uint8_t>& rom_data, int table_pc,
+                            int room_id);
+int ReadRoomPotItemAddressPc(const std::vector<uint8_t>& rom_data,
+                             int room_id);
+
+}  // namespace zelda3
+}  // namespace yaze
+
+#endif  // YAZE_ZELDA3_DUNGEON_ROOM_STREAM_TABLE_H_
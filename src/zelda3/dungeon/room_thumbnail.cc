@@ -0,0 +1,291 @@
+#include "zelda3/dungeon/room_thumbnail.h"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <system_error>
+
+#include "absl/strings/str_format.h"
+#include "app/gfx/core/bitmap.h"
+#include "app/platform/sdl_compat.h"
+#include "util/rom_hash.h"
+#include "zelda3/dungeon/palette_debug.h"
+#include "zelda3/dungeon/room.h"
+#include "zelda3/dungeon/room_layer_manager.h"
+#include "zelda3/game_data.h"
+
+namespace yaze {
+namespace zelda3 {
+
+namespace {
+
+constexpr int kCompositeSize = 512;
+constexpr uint8_t kTransparentIndex = 255;
+constexpr std::array<char, 4> kCacheMagic = {'Y', 'Z', 'R', 'T'};
+constexpr uint32_t kCacheVersion = 1;
+
+uint32_t PackRgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+  return (static_cast<uint32_t>(r) << 24) | (static_cast<uint32_t>(g) << 16) |
+         (static_cast<uint32_t>(b) << 8) | a;
+}
+
+void AppendU16(std::vector<uint8_t>& out, uint16_t value) {
+  out.push_back(value & 0xFF);
+  out.push_back(value >> 8);
+}
+
+void AppendU32(std::vector<uint8_t>& out, uint32_t value) {
+  for (int shift = 0; shift < 32; shift += 8) {
+    out.push_back((value >> shift) & 0xFF);
+  }
+}
+
+class CacheReader {
+ public:
+  explicit CacheReader(const std::vector<uint8_t>& data) : data_(data) {}
+
+  bool Read(void* dst, size_t size) {
+    if (pos_ + size > data_.size()) {
+      return false;
+    }
+    std::copy_n(data_.begin() + pos_, size, static_cast<uint8_t*>(dst));
+    pos_ += size;
+    return true;
+  }
+  bool ReadU16(uint16_t* value) {
+    uint8_t bytes[2];
+    if (!Read(bytes, sizeof(bytes))) {
+      return false;
+    }
+    *value = static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+    return true;
+  }
+  bool ReadU32(uint32_t* value) {
+    uint8_t bytes[4];
+    if (!Read(bytes, sizeof(bytes))) {
+      return false;
+    }
+    *value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) |
+             (static_cast<uint32_t>(bytes[3]) << 24);
+    return true;
+  }
+
+ private:
+  const std::vector<uint8_t>& data_;
+  size_t pos_ = 0;
+};
+
+}  // namespace
+
+uint32_t ComputeRoomThumbnailCrc(Room& room) {
+  if (room.get_gfx_buffer().data() == RoomGraphicsBuffer::Empty().data()) {
+    room.LoadRoomGraphics();
+    room.CopyRoomGraphicsToBuffer();
+  }
+
+  std::vector<uint8_t> inputs = {
+      room.blockset(),
+      room.palette(),
+      room.layout_id(),
+      room.floor1(),
+      room.floor2(),
+      static_cast<uint8_t>(room.effect()),
+      static_cast<uint8_t>(room.tag1()),
+      static_cast<uint8_t>(room.tag2()),
+      room.layer_merging().ID,
+      static_cast<uint8_t>(room.bg2()),
+  };
+  const auto stream = room.EncodeObjects();
+  inputs.insert(inputs.end(), stream.begin(), stream.end());
+
+  if (auto* game_data = room.game_data()) {
+    const auto& dungeon_main = game_data->palette_groups.dungeon_main;
+    const int palette_id = room.ResolveDungeonPaletteId();
+    if (palette_id >= 0 &&
+        palette_id < static_cast<int>(dungeon_main.size())) {
+      for (const auto& color : dungeon_main[palette_id]) {
+        AppendU16(inputs, color.snes());
+      }
+    }
+  }
+
+  const auto& gfx = room.get_gfx_buffer();
+  inputs.insert(inputs.end(), gfx.begin(), gfx.end());
+  return util::CalculateCrc32(inputs.data(), inputs.size());
+}
+
+RoomThumbnail DownsampleRoomComposite(std::span<const uint8_t> pixels,
+                                      std::span<const uint32_t> palette) {
+  constexpr int kScale = RoomThumbnail::kScale;
+  RoomThumbnail thumbnail;
+  thumbnail.pixels.assign(RoomThumbnail::kPixelCount, 0);
+  if (pixels.size() < static_cast<size_t>(kCompositeSize * kCompositeSize) ||
+      palette.size() < 256) {
+    return thumbnail;
+  }
+
+  for (int ty = 0; ty < RoomThumbnail::kSize; ++ty) {
+    for (int tx = 0; tx < RoomThumbnail::kSize; ++tx) {
+      uint32_t r = 0, g = 0, b = 0, a = 0, count = 0;
+      for (int y = ty * kScale; y < (ty + 1) * kScale; ++y) {
+        const uint8_t* row = pixels.data() + y * kCompositeSize;
+        for (int x = tx * kScale; x < (tx + 1) * kScale; ++x) {
+          if (row[x] == kTransparentIndex) {
+            continue;
+          }
+          const uint32_t color = palette[row[x]];
+          r += color >> 24;
+          g += (color >> 16) & 0xFF;
+          b += (color >> 8) & 0xFF;
+          a += color & 0xFF;
+          ++count;
+        }
+      }
+      if (count == 0) {
+        continue;
+      }
+      // Partially covered cells fade out instead of darkening toward black.
+      const uint32_t coverage = (a / count) * count / (kScale * kScale);
+      thumbnail.pixels[ty * RoomThumbnail::kSize + tx] =
+          PackRgba(r / count, g / count, b / count, coverage);
+    }
+  }
+  return thumbnail;
+}
+
+absl::StatusOr<RoomThumbnail> RenderRoomThumbnail(Room& room) {
+  if (!room.rom() || !room.rom()->is_loaded() || !room.game_data()) {
+    return absl::FailedPreconditionError(
+        absl::StrFormat("Room 0x%03X has no ROM or game data", room.id()));
+  }
+
+  PaletteDebugger::ScopedMute mute_debugger;
+  const uint32_t source_crc = ComputeRoomThumbnailCrc(room);
+  room.RenderRoomGraphics();
+
+  RoomLayerManager layer_mgr;
+  layer_mgr.ApplyLayerMerging(room.layer_merging());
+  layer_mgr.ApplyRoomEffect(room.effect());
+  gfx::Bitmap composite;
+  layer_mgr.CompositeToOutput(room, composite);
+  if (!composite.is_active() || composite.width() != kCompositeSize ||
+      composite.height() != kCompositeSize || !composite.surface()) {
+    return absl::InternalError(
+        absl::StrFormat("Room 0x%03X produced no composite", room.id()));
+  }
+
+  std::array<uint32_t, 256> palette{};
+  if (SDL_Palette* sdl_palette =
+          platform::GetSurfacePalette(composite.surface())) {
+    const int count = std::min(sdl_palette->ncolors, 256);
+    for (int i = 0; i < count; ++i) {
+      const SDL_Color& c = sdl_palette->colors[i];
+      palette[i] = PackRgba(c.r, c.g, c.b, 255);
+    }
+  }
+
+  RoomThumbnail thumbnail = DownsampleRoomComposite(composite.vector(), palette);
+  thumbnail.room_id = room.id();
+  thumbnail.source_crc = source_crc;
+  return thumbnail;
+}
+
+absl::Status WriteRoomThumbnailCache(
+    const std::filesystem::path& path, const std::string& rom_hash,
+    const std::vector<RoomThumbnail>& entries) {
+  std::vector<uint8_t> out(kCacheMagic.begin(), kCacheMagic.end());
+  AppendU32(out, kCacheVersion);
+  AppendU32(out, static_cast<uint32_t>(rom_hash.size()));
+  out.insert(out.end(), rom_hash.begin(), rom_hash.end());
+  AppendU32(out, static_cast<uint32_t>(entries.size()));
+  for (const auto& entry : entries) {
+    if (entry.pixels.size() != RoomThumbnail::kPixelCount) {
+      return absl::InvalidArgumentError(absl::StrFormat(
+          "Thumbnail for room 0x%03X has %zu pixels", entry.room_id,
+          entry.pixels.size()));
+    }
+    AppendU16(out, static_cast<uint16_t>(entry.room_id));
+    AppendU32(out, entry.source_crc);
+    for (uint32_t pixel : entry.pixels) {
+      AppendU32(out, pixel);
+    }
+  }
+
+  std::error_code ec;
+  std::filesystem::create_directories(path.parent_path(), ec);
+  // Write beside the target and rename so a crash never leaves a torn file.
+  auto temp_path = path;
+  temp_path += ".tmp";
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return absl::InternalError(
+          absl::StrFormat("Cannot write %s", temp_path.string()));
+    }
+    file.write(reinterpret_cast<const char*>(out.data()),
+               static_cast<std::streamsize>(out.size()));
+    if (!file) {
+      return absl::InternalError(
+          absl::StrFormat("Short write to %s", temp_path.string()));
+    }
+  }
+  std::filesystem::rename(temp_path, path, ec);
+  if (ec) {
+    return absl::InternalError(absl::StrFormat(
+        "Cannot replace %s: %s", path.string(), ec.message()));
+  }
+  return absl::OkStatus();
+}
+
+absl::StatusOr<std::vector<RoomThumbnail>> ReadRoomThumbnailCache(
+    const std::filesystem::path& path, const std::string& rom_hash) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return absl::NotFoundError(
+        absl::StrFormat("No thumbnail cache at %s", path.string()));
+  }
+  const std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
+                                  std::istreambuf_iterator<char>());
+  CacheReader reader(data);
+
+  std::array<char, 4> magic{};
+  uint32_t version = 0;
+  uint32_t hash_size = 0;
+  if (!reader.Read(magic.data(), magic.size()) || magic != kCacheMagic ||
+      !reader.ReadU32(&version) || version != kCacheVersion ||
+      !reader.ReadU32(&hash_size) || hash_size > 256) {
+    return absl::DataLossError("Unrecognized thumbnail cache header");
+  }
+  std::string stored_hash(hash_size, '\0');
+  if (!reader.Read(stored_hash.data(), hash_size)) {
+    return absl::DataLossError("Truncated thumbnail cache header");
+  }
+  if (stored_hash != rom_hash) {
+    return absl::FailedPreconditionError(
+        "Thumbnail cache belongs to a different ROM");
+  }
+
+  uint32_t count = 0;
+  if (!reader.ReadU32(&count) || count > kNumberOfRooms) {
+    return absl::DataLossError("Bad thumbnail cache entry count");
+  }
+  std::vector<RoomThumbnail> entries(count);
+  for (auto& entry : entries) {
+    uint16_t room_id = 0;
+    if (!reader.ReadU16(&room_id) || room_id >= kNumberOfRooms ||
+        !reader.ReadU32(&entry.source_crc)) {
+      return absl::DataLossError("Truncated thumbnail cache entry");
+    }
+    entry.room_id = room_id;
+    entry.pixels.resize(RoomThumbnail::kPixelCount);
+    for (auto& pixel : entry.pixels) {
+      if (!reader.ReadU32(&pixel)) {
+        return absl::DataLossError("Truncated thumbnail cache pixels");
+      }
+    }
+  }
+  return entries;
+}
+
+}  // namespace zelda3
+}  // namespace yaze
@@ -0,0 +1,73 @@
+#ifndef YAZE_ZELDA3_DUNGEON_ROOM_THUMBNAIL_H
+#define YAZE_ZELDA3_DUNGEON_ROOM_THUMBNAIL_H
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace yaze {
+namespace zelda3 {
+
+class Room;
+
+/**
+ * @brief Reduced-scale render of a dungeon room for overview grids
+ *
+ * Pixels are packed 0xRRGGBBAA (SDL_PIXELFORMAT_RGBA8888), so they can be
+ * streamed into an RGBA texture without conversion.
+ */
+struct RoomThumbnail {
+  static constexpr int kScale = 8;
+  static constexpr int kSize = 512 / kScale;
+  static constexpr int kPixelCount = kSize * kSize;
+
+  int room_id = -1;
+  // ComputeRoomThumbnailCrc() of the room this was rendered from.
+  uint32_t source_crc = 0;
+  std::vector<uint32_t> pixels;
+};
+
+/**
+ * @brief CRC32 of everything a room thumbnail is drawn from
+ *
+ * Covers the header properties, the encoded object stream, the assembled
+ * graphics buffer and the dungeon palette, so a thumbnail whose CRC still
+ * matches can be reused after unrelated edits. Assembles the room's graphics
+ * if it has not done so yet.
+ */
+uint32_t ComputeRoomThumbnailCrc(Room& room);
+
+/**
+ * @brief Box-filter an indexed 512x512 room composite down to a thumbnail
+ *
+ * @p palette holds 256 packed 0xRRGGBBAA colors. Index 255 is transparent and
+ * does not contribute to a cell's average.
+ */
+RoomThumbnail DownsampleRoomComposite(std::span<const uint8_t> pixels,
+                                      std::span<const uint32_t> palette);
+
+/**
+ * @brief Render a loaded room off-screen and reduce it to a thumbnail
+ *
+ * Never creates or queues textures, so it may run on a worker thread as long
+ * as that thread owns @p room and nothing mutates the room's Rom or GameData.
+ */
+absl::StatusOr<RoomThumbnail> RenderRoomThumbnail(Room& room);
+
+// Thumbnail disk cache. A file belongs to one ROM hash; entries carry their
+// own source CRC so callers can decide which ones are still current.
+absl::Status WriteRoomThumbnailCache(const std::filesystem::path& path,
+                                     const std::string& rom_hash,
+                                     const std::vector<RoomThumbnail>& entries);
+absl::StatusOr<std::vector<RoomThumbnail>> ReadRoomThumbnailCache(
+    const std::filesystem::path& path, const std::string& rom_hash);
+
+}  // namespace zelda3
+}  // namespace yaze
+
+#endif  // YAZE_ZELDA3_DUNGEON_ROOM_THUMBNAIL_H
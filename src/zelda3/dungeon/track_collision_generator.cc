@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <map>
+#include <set>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -11,8 +13,10 @@
 #include "absl/strings/str_format.h"
 #include "core/features.h"
 #include "rom/snes.h"
+#include "rom/write_batch.h"
 #include "rom/write_fence.h"
 #include "util/macro.h"
+#include "util/task_scheduler.h"
 #include "zelda3/dungeon/dimension_service.h"
 #include "zelda3/dungeon/dungeon_rom_addresses.h"
 #include "zelda3/dungeon/room_object.h"
@@ -246,46 +250,37 @@ DimensionService::DimensionResult ResolveTrackObjectDimensions(
   return dims;
 }
 
-}  // namespace
-
-absl::StatusOr<TrackCollisionResult> GenerateTrackCollision(
-    Room* room, const GeneratorOptions& options) {
-  if (!room) {
-    return absl::InvalidArgumentError("Room pointer is null");
-  }
+// Tile rectangle a rail object covers in the 64x64 grid.
+struct TrackFootprint {
+  int x = 0;
+  int y = 0;
+  int width = 1;
+  int height = 1;
+};
 
-  // Ensure objects are loaded
-  if (room->GetTileObjects().empty()) {
-    room->LoadObjects();
-  }
+TrackFootprint MakeTrackFootprint(
+    const RoomObject& obj, const DimensionService::DimensionResult& dims) {
+  return TrackFootprint{obj.x_ + dims.offset_x_tiles,
+                        obj.y_ + dims.offset_y_tiles,
+                        std::max(1, dims.width_tiles),
+                        std::max(1, dims.height_tiles)};
+}
 
+// Steps 2-4 of generation: rasterize footprints, classify each occupied tile,
+// then apply switch promotions and stop overrides. Pure; safe on any thread.
+TrackCollisionResult ClassifyTrackFootprints(
+    int room_id, const std::vector<TrackFootprint>& footprints,
+    const GeneratorOptions& options) {
   TrackCollisionResult result;
-  result.room_id = room->id();
+  result.room_id = room_id;
   result.collision_map.tiles.fill(0);
 
-  // Step 1: Build occupancy grid from rail objects.
-  // Rail objects (ID 0x31) have coordinates in the room's tile space.
-  // RoomObject x_ and y_ are in tile coordinates (each tile = 8 pixels).
-  // The collision grid is 64x64 (covering 512x512 pixels = full room).
   std::array<bool, kGridSize * kGridSize> occupied{};
-  auto& dimension_service = DimensionService::Get();
-
-  for (const auto& obj : room->GetTileObjects()) {
-    if (obj.id_ != static_cast<int16_t>(options.track_object_id)) {
-      continue;
-    }
-
-    const auto dims =
-        ResolveTrackObjectDimensions(obj, options, dimension_service);
-    int base_x = obj.x_ + dims.offset_x_tiles;
-    int base_y = obj.y_ + dims.offset_y_tiles;
-    int w = std::max(1, dims.width_tiles);
-    int h = std::max(1, dims.height_tiles);
-
-    for (int dy = 0; dy < h; ++dy) {
-      for (int dx = 0; dx < w; ++dx) {
-        int gx = base_x + dx;
-        int gy = base_y + dy;
+  for (const auto& footprint : footprints) {
+    for (int dy = 0; dy < footprint.height; ++dy) {
+      for (int dx = 0; dx < footprint.width; ++dx) {
+        int gx = footprint.x + dx;
+        int gy = footprint.y + dy;
         if (gx >= 0 && gx < kGridSize && gy >= 0 && gy < kGridSize) {
           occupied[gy * kGridSize + gx] = true;
         }
@@ -293,7 +288,7 @@ absl::StatusOr<TrackCollisionResult> GenerateTrackCollision(
     }
   }
 
-  // Step 2: Classify each occupied tile by neighbor connectivity.
+  // Classify each occupied tile by neighbor connectivity.
   for (int y = 0; y < kGridSize; ++y) {
     for (int x = 0; x < kGridSize; ++x) {
       if (!occupied[y * kGridSize + x])
@@ -315,7 +310,7 @@ absl::StatusOr<TrackCollisionResult> GenerateTrackCollision(
     }
   }
 
-  // Step 3: Apply switch promotions.
+  // Apply switch promotions.
   for (const auto& [sx, sy] : options.switch_promotions) {
     if (sx < 0 || sx >= kGridSize || sy < 0 || sy >= kGridSize)
       continue;
@@ -329,7 +324,7 @@ absl::StatusOr<TrackCollisionResult> GenerateTrackCollision(
     }
   }
 
-  // Step 4: Apply manual stop overrides.
+  // Apply manual stop overrides.
   for (const auto& [ox, oy, otype] : options.stop_overrides) {
     if (ox < 0 || ox >= kGridSize || oy < 0 || oy >= kGridSize)
       continue;
@@ -340,18 +335,112 @@ absl::StatusOr<TrackCollisionResult> GenerateTrackCollision(
   }
 
   result.collision_map.has_data = (result.tiles_generated > 0);
-  result.ascii_visualization = VisualizeCollisionMap(result.collision_map);
-
   return result;
 }
 
-absl::Status WriteTrackCollision(Rom* rom, int room_id,
-                                 const CustomCollisionMap& map) {
+// Rail objects and stored collision of one room, gathered for a batch.
+struct TrackRoomInput {
+  int room_id = 0;
+  std::vector<RoomObject> track_objects;
+  CustomCollisionMap stored;
+};
+
+void CollectTrackObjects(const Room& room, const GeneratorOptions& options,
+                         TrackRoomInput* input) {
+  input->room_id = room.id();
+  for (const auto& obj : room.GetTileObjects()) {
+    if (obj.id_ == static_cast<int16_t>(options.track_object_id)) {
+      input->track_objects.push_back(obj);
+    }
+  }
+}
+
+absl::StatusOr<TrackCollisionBatch> GenerateFromInputs(
+    std::vector<TrackRoomInput>& inputs,
+    const TrackCollisionBatchOptions& options) {
+  // Rail pieces repeat heavily, so measure each (id, size) once here and
+  // share the result with the workers.
+  std::map<std::pair<int16_t, uint8_t>, DimensionService::DimensionResult>
+      dimensions;
+  auto& dimension_service = DimensionService::Get();
+  std::vector<std::vector<TrackFootprint>> footprints(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    footprints[i].reserve(inputs[i].track_objects.size());
+    for (const auto& obj : inputs[i].track_objects) {
+      auto [it, inserted] = dimensions.try_emplace({obj.id_, obj.size_});
+      if (inserted) {
+        it->second = ResolveTrackObjectDimensions(obj, options.generator,
+                                                  dimension_service);
+      }
+      footprints[i].push_back(MakeTrackFootprint(obj, it->second));
+    }
+  }
+
+  TrackCollisionBatch batch;
+  batch.rooms.resize(inputs.size());
+  util::TaskGroup group;
+  group.RunEach(static_cast<int>(inputs.size()), [&](int i) {
+    const TrackRoomInput& input = inputs[i];
+    TrackCollisionBatchRoom& room = batch.rooms[i];
+    room.result = ClassifyTrackFootprints(input.room_id, footprints[i],
+                                          options.generator);
+    if (options.skip_rooms_without_track && room.result.tiles_generated == 0) {
+      return absl::OkStatus();
+    }
+    if (options.preserve_stops) {
+      MergeTrackStopTiles(input.stored, room.result.collision_map);
+    }
+    room.result.ascii_visualization =
+        VisualizeCollisionMap(room.result.collision_map);
+    room.changed = room.result.collision_map.tiles != input.stored.tiles;
+    return absl::OkStatus();
+  });
+  RETURN_IF_ERROR(group.Wait());
+
+  for (const auto& room : batch.rooms) {
+    batch.changed_count += room.changed ? 1 : 0;
+  }
+  return batch;
+}
+
+std::vector<uint8_t> EncodeSingleTileCollision(const CustomCollisionMap& map) {
+  // Format: [F0 F0] [offset_lo offset_hi tile] ... [FF FF]
+  std::vector<uint8_t> encoded;
+  encoded.push_back(0xF0);
+  encoded.push_back(0xF0);
+
+  for (int y = 0; y < kGridSize; ++y) {
+    for (int x = 0; x < kGridSize; ++x) {
+      uint8_t tile = map.tiles[y * kGridSize + x];
+      if (tile == 0)
+        continue;
+      uint16_t offset = static_cast<uint16_t>(y * kGridSize + x);
+      encoded.push_back(offset & 0xFF);
+      encoded.push_back(offset >> 8);
+      encoded.push_back(tile);
+    }
+  }
+  encoded.push_back(0xFF);
+  encoded.push_back(0xFF);
+  return encoded;
+}
+
+struct CollisionWrite {
+  int room_id = 0;
+  const CustomCollisionMap* map = nullptr;
+};
+
+// Places every map as WriteTrackCollision documents and commits all blobs and
+// pointers as one WriteBatch, so a failure leaves the ROM untouched.
+absl::Status WriteCollisionMaps(Rom* rom,
+                                const std::vector<CollisionWrite>& writes) {
   if (!rom || !rom->is_loaded()) {
     return absl::InvalidArgumentError("ROM not loaded");
   }
-  if (room_id < 0 || room_id >= kNumberOfRooms) {
-    return absl::OutOfRangeError("Room ID out of range");
+  for (const auto& write : writes) {
+    if (write.room_id < 0 || write.room_id >= kNumberOfRooms) {
+      return absl::OutOfRangeError("Room ID out of range");
+    }
   }
 
   const auto& data = rom->vector();
@@ -387,26 +476,6 @@ absl::Status WriteTrackCollision(Rom* rom, int room_id,
                   "CustomCollisionData"));
   yaze::rom::ScopedWriteFence scope(rom, &fence);
 
-  // Encode collision data in single-tile format.
-  // Format: [F0 F0] [offset_lo offset_hi tile] ... [FF FF]
-  std::vector<uint8_t> encoded;
-  encoded.push_back(0xF0);
-  encoded.push_back(0xF0);
-
-  for (int y = 0; y < kGridSize; ++y) {
-    for (int x = 0; x < kGridSize; ++x) {
-      uint8_t tile = map.tiles[y * kGridSize + x];
-      if (tile == 0)
-        continue;
-      uint16_t offset = static_cast<uint16_t>(y * kGridSize + x);
-      encoded.push_back(offset & 0xFF);
-      encoded.push_back(offset >> 8);
-      encoded.push_back(tile);
-    }
-  }
-  encoded.push_back(0xFF);
-  encoded.push_back(0xFF);
-
   // Find the end of existing collision data by scanning all room pointers
   // to determine the highest used offset.
   const size_t safe_end =
@@ -449,48 +518,199 @@ absl::Status WriteTrackCollision(Rom* rom, int room_id,
     }
   }
 
-  // Reuse the selected room's current blob only when its entire physical span
-  // is uniquely owned and the replacement fits. Aliased or overlapping blobs
-  // remain copy-on-write so editing one room cannot mutate another room.
-  uint32_t write_pos = max_used_pc;
-  const auto target = std::find_if(
-      blobs.begin(), blobs.end(),
-      [room_id](const CollisionBlob& blob) { return blob.room_id == room_id; });
-  if (target != blobs.end() && encoded.size() <= target->end - target->start) {
-    const bool overlaps_other = std::any_of(
-        blobs.begin(), blobs.end(), [&](const CollisionBlob& other) {
-          return other.room_id != room_id && BlobsOverlap(*target, other);
+  yaze::rom::WriteBatch batch;
+  uint32_t append_pos = max_used_pc;
+  std::set<int> written;
+  for (const auto& write : writes) {
+    // A room listed twice keeps its first map.
+    if (!written.insert(write.room_id).second) {
+      continue;
+    }
+    // Encode collision data in single-tile format.
+    const std::vector<uint8_t> encoded = EncodeSingleTileCollision(*write.map);
+
+    // Reuse the room's current blob only when its entire physical span is
+    // uniquely owned and the replacement fits. Aliased or overlapping blobs
+    // remain copy-on-write so editing one room cannot mutate another room.
+    // Appended blobs start past every scanned blob, so reuse never overlaps
+    // an earlier write in this batch.
+    uint32_t write_pos = append_pos;
+    const auto target = std::find_if(
+        blobs.begin(), blobs.end(), [&write](const CollisionBlob& blob) {
+          return blob.room_id == write.room_id;
         });
-    if (!overlaps_other) {
-      write_pos = target->start;
+    if (target != blobs.end() &&
+        encoded.size() <= target->end - target->start) {
+      const bool overlaps_other = std::any_of(
+          blobs.begin(), blobs.end(), [&](const CollisionBlob& other) {
+            return other.room_id != write.room_id &&
+                   BlobsOverlap(*target, other);
+          });
+      if (!overlaps_other) {
+        write_pos = target->start;
+      }
+    }
+
+    // Append when there is no safe reusable span, then check available space.
+    if (write_pos + encoded.size() > kCustomCollisionDataSoftEnd) {
+      return absl::ResourceExhaustedError(absl::StrFormat(
+          "Not enough collision data space for room 0x%03X. Need %d bytes "
+          "at 0x%06X, region ends at 0x%06X",
+          write.room_id, encoded.size(), write_pos,
+          kCustomCollisionDataSoftEnd));
+    }
+    if (write_pos + encoded.size() > data.size()) {
+      return absl::OutOfRangeError(
+          absl::StrFormat("ROM too small for custom collision write (need "
+                          "end=0x%06X, size=0x%06X)",
+                          write_pos + encoded.size(), data.size()));
+    }
+    if (write_pos == append_pos) {
+      append_pos += static_cast<uint32_t>(encoded.size());
     }
+
+    // Pointer table entry: 3-byte SNES address.
+    batch.WriteVector(write_pos, encoded);
+    batch.WriteLong(
+        static_cast<uint32_t>(kCustomCollisionRoomPointers +
+                              (write.room_id * 3)),
+        PcToSnes(write_pos));
   }
 
-  // Append when there is no safe reusable span, then check available space.
-  if (write_pos + encoded.size() > kCustomCollisionDataSoftEnd) {
-    return absl::ResourceExhaustedError(absl::StrFormat(
-        "Not enough collision data space. Need %d bytes at 0x%06X, "
-        "region ends at 0x%06X",
-        encoded.size(), write_pos, kCustomCollisionDataSoftEnd));
+  return batch.Commit(*rom).status();
+}
+
+}  // namespace
+
+absl::StatusOr<TrackCollisionResult> GenerateTrackCollision(
+    Room* room, const GeneratorOptions& options) {
+  if (!room) {
+    return absl::InvalidArgumentError("Room pointer is null");
   }
 
-  if (write_pos + encoded.size() > data.size()) {
-    return absl::OutOfRangeError(
-        absl::StrFormat("ROM too small for custom collision write (need "
-                        "end=0x%06X, size=0x%06X)",
-                        write_pos + encoded.size(), data.size()));
+  // Ensure objects are loaded
+  if (room->GetTileObjects().empty()) {
+    room->LoadObjects();
   }
-  RETURN_IF_ERROR(
-      rom->WriteVector(static_cast<int>(write_pos), std::move(encoded)));
 
-  // Update pointer table: 3-byte SNES address
-  uint32_t snes_addr = PcToSnes(write_pos);
-  int ptr_offset = kCustomCollisionRoomPointers + (room_id * 3);
-  RETURN_IF_ERROR(rom->WriteByte(ptr_offset, snes_addr & 0xFF));
-  RETURN_IF_ERROR(rom->WriteByte(ptr_offset + 1, (snes_addr >> 8) & 0xFF));
-  RETURN_IF_ERROR(rom->WriteByte(ptr_offset + 2, (snes_addr >> 16) & 0xFF));
+  // Step 1: Measure rail objects (ID 0x31) in the room's tile space.
+  // RoomObject x_ and y_ are in tile coordinates (each tile = 8 pixels).
+  // The collision grid is 64x64 (covering 512x512 pixels = full room).
+  std::vector<TrackFootprint> footprints;
+  auto& dimension_service = DimensionService::Get();
+  for (const auto& obj : room->GetTileObjects()) {
+    if (obj.id_ != static_cast<int16_t>(options.track_object_id)) {
+      continue;
+    }
+    footprints.push_back(MakeTrackFootprint(
+        obj, ResolveTrackObjectDimensions(obj, options, dimension_service)));
+  }
+
+  // Steps 2-4: Rasterize, classify, then apply promotions and overrides.
+  TrackCollisionResult result =
+      ClassifyTrackFootprints(room->id(), footprints, options);
+  result.ascii_visualization = VisualizeCollisionMap(result.collision_map);
+
+  return result;
+}
 
-  return absl::OkStatus();
+absl::StatusOr<TrackCollisionBatch> GenerateTrackCollisionBatch(
+    Rom* rom, const std::vector<int>& room_ids,
+    const TrackCollisionBatchOptions& options) {
+  if (!rom || !rom->is_loaded()) {
+    return absl::InvalidArgumentError("ROM not loaded");
+  }
+  for (int room_id : room_ids) {
+    if (room_id < 0 || room_id >= kNumberOfRooms) {
+      return absl::OutOfRangeError(
+          absl::StrFormat("Room ID 0x%X out of range", room_id));
+    }
+  }
+
+  // Each task loads one room and keeps only its rail objects, so a sweep
+  // over every room never holds more than a worker's worth of Room objects.
+  std::vector<TrackRoomInput> inputs(room_ids.size());
+  util::TaskGroup group;
+  group.RunEach(static_cast<int>(room_ids.size()), [&](int i) {
+    Room room = LoadRoomHeaderFromRom(rom, room_ids[i]);
+    room.LoadObjects();
+    CollectTrackObjects(room, options.generator, &inputs[i]);
+    inputs[i].stored = room.custom_collision();
+    return absl::OkStatus();
+  });
+  RETURN_IF_ERROR(group.Wait());
+
+  return GenerateFromInputs(inputs, options);
+}
+
+absl::StatusOr<TrackCollisionBatch> GenerateTrackCollisionBatch(
+    const std::vector<Room*>& rooms,
+    const TrackCollisionBatchOptions& options) {
+  for (const Room* room : rooms) {
+    if (!room) {
+      return absl::InvalidArgumentError("Room pointer is null");
+    }
+  }
+  // The rooms belong to the caller, so any loading happens here; the
+  // workers below only read them.
+  for (Room* room : rooms) {
+    if (room->GetTileObjects().empty()) {
+      room->LoadObjects();
+    }
+  }
+
+  std::vector<TrackRoomInput> inputs(rooms.size());
+  util::TaskGroup group;
+  group.RunEach(static_cast<int>(rooms.size()), [&](int i) {
+    const Room* room = rooms[i];
+    CollectTrackObjects(*room, options.generator, &inputs[i]);
+    // Diff against the ROM, not the room's possibly edited collision.
+    if (room->rom() && room->rom()->is_loaded()) {
+      if (auto stored = LoadCustomCollisionMap(room->rom(), room->id());
+          stored.ok()) {
+        inputs[i].stored = std::move(stored.value());
+      }
+    }
+    return absl::OkStatus();
+  });
+  RETURN_IF_ERROR(group.Wait());
+
+  return GenerateFromInputs(inputs, options);
+}
+
+void MergeTrackStopTiles(const CustomCollisionMap& existing,
+                         CustomCollisionMap& generated) {
+  for (size_t i = 0; i < generated.tiles.size(); ++i) {
+    const uint8_t tile = existing.tiles[i];
+    if (tile >= static_cast<uint8_t>(TrackTileType::StopNorth) &&
+        tile <= static_cast<uint8_t>(TrackTileType::StopEast) &&
+        generated.tiles[i] == 0) {
+      generated.tiles[i] = tile;
+    }
+  }
+  generated.has_data = std::any_of(generated.tiles.begin(),
+                                   generated.tiles.end(),
+                                   [](uint8_t tile) { return tile != 0; });
+}
+
+absl::Status WriteTrackCollision(Rom* rom, int room_id,
+                                 const CustomCollisionMap& map) {
+  return WriteCollisionMaps(rom, {CollisionWrite{room_id, &map}});
+}
+
+absl::Status WriteTrackCollisionBatch(Rom* rom,
+                                      const TrackCollisionBatch& batch) {
+  std::vector<CollisionWrite> writes;
+  writes.reserve(batch.changed_count);
+  for (const auto& room : batch.rooms) {
+    if (room.changed) {
+      writes.push_back({room.result.room_id, &room.result.collision_map});
+    }
+  }
+  if (writes.empty()) {
+    return absl::OkStatus();
+  }
+  return WriteCollisionMaps(rom, writes);
 }
 
 std::string VisualizeCollisionMap(const CustomCollisionMap& map) {
@@ -64,18 +64,64 @@ struct GeneratorOptions {
   std::vector<std::tuple<int, int, TrackTileType>> stop_overrides;
 };
 
+struct TrackCollisionBatchOptions {
+  GeneratorOptions generator;
+
+  // Keep stop tiles already stored in the ROM on cells the generator leaves
+  // empty, so hand-placed stops survive regeneration.
+  bool preserve_stops = false;
+
+  // Leave rooms without any rail tiles unchanged instead of clearing their
+  // stored collision. Use when sweeping rooms that may not have tracks.
+  bool skip_rooms_without_track = false;
+};
+
+struct TrackCollisionBatchRoom {
+  TrackCollisionResult result;
+  // The generated map differs from the collision stored in the ROM.
+  bool changed = false;
+};
+
+struct TrackCollisionBatch {
+  std::vector<TrackCollisionBatchRoom> rooms;  // In request order.
+  int changed_count = 0;
+};
+
 // Build a collision map from rail objects in a room.
 // Reads Object 0x31 (rail) positions, builds an occupancy grid,
 // then classifies each tile by its neighbor connectivity.
 absl::StatusOr<TrackCollisionResult> GenerateTrackCollision(
     Room* room, const GeneratorOptions& options = {});
 
+// Generate collision for many rooms at once on the shared TaskScheduler and
+// diff each map against the collision stored in the ROM. Rail footprints are
+// measured once per object ID and size for the whole batch. The first
+// overload loads each room's objects from rom; the second uses rooms already
+// in memory, e.g. with unsaved object edits, and loads objects for any room
+// that has none on the calling thread before the workers start.
+absl::StatusOr<TrackCollisionBatch> GenerateTrackCollisionBatch(
+    Rom* rom, const std::vector<int>& room_ids,
+    const TrackCollisionBatchOptions& options = {});
+absl::StatusOr<TrackCollisionBatch> GenerateTrackCollisionBatch(
+    const std::vector<Room*>& rooms,
+    const TrackCollisionBatchOptions& options = {});
+
+// Merge stop tiles from |existing| into |generated| without overwriting
+// track tiles that were just produced.
+void MergeTrackStopTiles(const CustomCollisionMap& existing,
+                         CustomCollisionMap& generated);
+
 // Write a generated collision map into the ROM. Reuses a room's uniquely owned
 // blob when the replacement fits; otherwise appends encoded single-tile data
 // and updates the pointer table at kCustomCollisionRoomPointers.
 absl::Status WriteTrackCollision(Rom* rom, int room_id,
                                  const CustomCollisionMap& map);
 
+// Write every changed map in batch as one ROM write batch, placed as
+// WriteTrackCollision would. Either all rooms are written or none is.
+absl::Status WriteTrackCollisionBatch(Rom* rom,
+                                      const TrackCollisionBatch& batch);
+
 // Generate an ASCII visualization of a collision map for debug/review.
 std::string VisualizeCollisionMap(const CustomCollisionMap& map);
 
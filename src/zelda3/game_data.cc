@@ -3,11 +3,18 @@
 #include "absl/strings/str_format.h"
 #include "app/gfx/util/compression.h"
 #include "core/rom_settings.h"
+#include "rom/write_batch.h"
 #include "util/log.h"
 #include "util/macro.h"
+#include "util/task_scheduler.h"
 #include "zelda3/dungeon/dungeon_rom_addresses.h"
+#include "zelda3/dungeon/object_dimensions.h"
+#include "zelda3/dungeon/room_graphics_cache.h"
 
 #include <algorithm>
+#include <map>
+#include <optional>
+#include <string>
 
 #ifdef __EMSCRIPTEN__
 #include "app/platform/wasm/wasm_loading_manager.h"
@@ -31,6 +38,11 @@ uint32_t SnesToPc(uint32_t snes_addr) {
   return (snes_addr & 0x7FFF) | ((snes_addr & 0x7F0000) >> 1);
 }
 
+// Helper to convert PC to SNES (LoROM) address
+uint32_t PcToSnes(uint32_t pc_addr) {
+  return ((pc_addr << 1) & 0x7F0000) | (pc_addr & 0x7FFF) | 0x8000;
+}
+
 struct PaletteSlice {
   size_t offset = 0;
   int length = 0;
@@ -149,6 +161,14 @@ absl::Status LoadGameData(Rom& rom, GameData& data,
 
   RETURN_IF_ERROR(PitDamageTable::LoadFromRom(&rom, &data.pit_damage_table));
 
+  // Dungeon renders read the dimension table for pit masks, possibly from
+  // worker threads, so it is filled here rather than on first draw. Its
+  // contents do not depend on the ROM, so the first load serves every ROM.
+  auto& dimension_table = ObjectDimensionTable::Get();
+  if (!dimension_table.IsLoaded()) {
+    RETURN_IF_ERROR(dimension_table.LoadFromRom(&rom));
+  }
+
   return absl::OkStatus();
 }
 
@@ -473,6 +493,8 @@ absl::Status LoadGraphics(Rom& rom, GameData& data) {
       version_constants.kOverworldGfxPtr3);
 
   data.graphics_buffer.clear();
+  // Room buffers are keyed by this storage, which may be reused in place.
+  RoomGraphicsCache::Get().Clear();
 
 #ifdef __EMSCRIPTEN__
   auto loading_handle =
@@ -488,14 +510,26 @@ absl::Status LoadGraphics(Rom& rom, GameData& data) {
 
   LOG_INFO("Graphics", "Loading %d graphics sheets...", kNumGfxSheets);
 
-  for (uint32_t i = 0; i < kNumGfxSheets; i++) {
+  // Decompression only reads the ROM, so every sheet decompresses on the
+  // scheduler; bitmaps and the graphics buffer are then built in sheet order.
+  std::vector<SheetLoadResult> results(kNumGfxSheets);
+  {
+    util::TaskGroup group;
 #ifdef __EMSCRIPTEN__
-    app::platform::WasmLoadingManager::UpdateProgress(
-        loading_handle, static_cast<float>(i) / kNumGfxSheets);
+    group.SetProgressCallback([loading_handle](int completed, int total) {
+      app::platform::WasmLoadingManager::UpdateProgress(
+          loading_handle, static_cast<float>(completed) / total);
+    });
 #endif
+    group.RunEach(kNumGfxSheets, [&](int i) {
+      results[i] = LoadSheetRaw(rom, i, gfx_ptr1, gfx_ptr2, gfx_ptr3);
+      return absl::OkStatus();
+    });
+    RETURN_IF_ERROR(group.Wait());
+  }
 
-    // Inside LoadGraphics loop:
-    auto result = LoadSheetRaw(rom, i, gfx_ptr1, gfx_ptr2, gfx_ptr3);
+  for (uint32_t i = 0; i < kNumGfxSheets; i++) {
+    const auto& result = results[i];
 
     // Update Diagnostics
     auto& sd = diag.sheets[i];
@@ -630,13 +664,278 @@ absl::StatusOr<gfx::Bitmap> LoadFontGraphics(const Rom& rom) {
 // Graphics Saving
 // ============================================================================
 
+namespace {
+
+struct SheetSaveJob {
+  uint16_t sheet_id = 0;
+  int bpp = 3;
+  bool compressed = true;
+  uint32_t offset = 0;
+  size_t slot_size = 0;  // Bytes the current ROM data occupies
+  std::vector<uint8_t> encoded;
+  bool skipped = false;
+  bool unchanged = false;
+  absl::Status status;
+};
+
+// Mirrors the sheet layout used by LoadGraphics: 113-114 and 218+ are 2BPP,
+// 115-126 are stored uncompressed.
+void ResolveSheetFormat(SheetSaveJob& job) {
+  const uint16_t id = job.sheet_id;
+  job.bpp = (id == 113 || id == 114 || id >= 218) ? 2 : 3;
+  job.compressed = !(id >= 115 && id <= 126);
+}
+
+// Reads the sheet's current ROM data and produces the bytes to write back.
+// Runs on worker threads, so it only reads from the ROM.
+void EncodeSheet(const Rom& rom, const gfx::Bitmap& sheet, SheetSaveJob& job) {
+  if (!sheet.is_active() || sheet.vector().empty()) {
+    job.skipped = true;
+    return;
+  }
+  if (job.bpp == 2 && sheet.vector().size() < static_cast<size_t>(
+                                                  gfx::kTilesheetWidth *
+                                                  gfx::kTilesheetHeight * 2)) {
+    job.skipped = true;
+    return;
+  }
+
+  auto snes_tile_data = gfx::IndexedToSnesSheet(sheet.vector(), job.bpp);
+
+  std::vector<uint8_t> base_data;
+  if (job.compressed) {
+    auto stream_size = gfx::lc_lz2::CompressedStreamSize(
+        rom.data(), static_cast<int>(job.offset), rom.size());
+    if (!stream_size.ok()) {
+      job.status = stream_size.status();
+      return;
+    }
+    job.slot_size = *stream_size;
+    auto decomp_result = gfx::lc_lz2::DecompressV2(
+        rom.data(), static_cast<int>(job.offset),
+        static_cast<int>(kUncompressedSheetSize), 1, rom.size());
+    if (!decomp_result.ok()) {
+      job.status = decomp_result.status();
+      return;
+    }
+    base_data = std::move(*decomp_result);
+  } else {
+    job.slot_size = snes_tile_data.size();
+    auto read_result = rom.ReadByteVector(
+        job.offset, static_cast<uint32_t>(snes_tile_data.size()));
+    if (!read_result.ok()) {
+      job.status = read_result.status();
+      return;
+    }
+    base_data = std::move(*read_result);
+  }
+
+  // Bytes past the tile data are kept as decompressed from the ROM.
+  if (base_data.size() < snes_tile_data.size()) {
+    base_data.resize(snes_tile_data.size(), 0);
+  }
+  if (std::equal(snes_tile_data.begin(), snes_tile_data.end(),
+                 base_data.begin())) {
+    job.unchanged = true;
+    return;
+  }
+  std::copy(snes_tile_data.begin(), snes_tile_data.end(), base_data.begin());
+
+  if (job.compressed) {
+    // The compressor's match search reads ahead of the end of its input;
+    // give it zeroed slack instead of running off the allocation.
+    const int sheet_size = static_cast<int>(base_data.size());
+    base_data.resize(base_data.size() * 2, 0);
+    int compressed_size = 0;
+    auto compressed_data = gfx::HyruleMagicCompress(
+        base_data.data(), sheet_size, &compressed_size, 1);
+    job.encoded.assign(compressed_data.begin(),
+                       compressed_data.begin() + compressed_size);
+  } else {
+    job.encoded = std::move(base_data);
+  }
+}
+
+void RunEncodeJobs(const Rom& rom,
+                   const std::array<gfx::Bitmap, kNumGfxSheets>& sheets,
+                   std::vector<SheetSaveJob>& jobs, int worker_count) {
+  // The waiting thread encodes too, so a private pool needs one thread fewer
+  // than the requested count.
+  std::optional<util::TaskScheduler> private_pool;
+  if (worker_count > 0) {
+    private_pool.emplace(
+        std::min(worker_count, static_cast<int>(jobs.size())) - 1);
+  }
+  util::TaskGroup group(
+      private_pool ? *private_pool : util::TaskScheduler::Get(),
+      util::TaskPriority::kNormal);
+  group.RunEach(static_cast<int>(jobs.size()), [&](int i) {
+    EncodeSheet(rom, sheets[jobs[i].sheet_id], jobs[i]);
+    return absl::OkStatus();
+  });
+  group.Wait().IgnoreError();
+}
+
+struct FreeRegion {
+  uint32_t start = 0;
+  uint32_t end = 0;
+  size_t size() const { return end - start; }
+};
+
+}  // namespace
+
+absl::StatusOr<GraphicsSaveResult> SaveGraphicsSheets(
+    Rom& rom, const std::array<gfx::Bitmap, kNumGfxSheets>& sheets,
+    std::span<const uint16_t> sheet_ids, const GraphicsSaveOptions& options) {
+  GraphicsSaveResult result;
+  if (!rom.is_loaded()) {
+    return absl::FailedPreconditionError("ROM not loaded");
+  }
+  if (kVersionConstantsMap.find(options.version) ==
+      kVersionConstantsMap.end()) {
+    return absl::FailedPreconditionError(
+        "Unsupported ROM version for graphics");
+  }
+  auto version_constants = kVersionConstantsMap.at(options.version);
+  const uint32_t gfx_ptr1 = core::RomSettings::Get().GetAddressOr(
+      core::RomAddressKey::kOverworldGfxPtr1,
+      version_constants.kOverworldGfxPtr1);
+  const uint32_t gfx_ptr2 = core::RomSettings::Get().GetAddressOr(
+      core::RomAddressKey::kOverworldGfxPtr2,
+      version_constants.kOverworldGfxPtr2);
+  const uint32_t gfx_ptr3 = core::RomSettings::Get().GetAddressOr(
+      core::RomAddressKey::kOverworldGfxPtr3,
+      version_constants.kOverworldGfxPtr3);
+
+  // Every sheet's current offset, so sheets sharing ROM data are detected.
+  std::array<uint32_t, kNumGfxSheets> offsets;
+  std::map<uint32_t, int> offset_users;
+  for (uint32_t i = 0; i < kNumGfxSheets; ++i) {
+    offsets[i] = GetGraphicsAddress(rom.data(), static_cast<uint8_t>(i),
+                                    gfx_ptr1, gfx_ptr2, gfx_ptr3, rom.size());
+    offset_users[offsets[i]]++;
+  }
+
+  std::vector<SheetSaveJob> jobs;
+  std::vector<bool> queued(kNumGfxSheets, false);
+  for (uint16_t sheet_id : sheet_ids) {
+    if (sheet_id >= kNumGfxSheets || queued[sheet_id]) {
+      continue;
+    }
+    queued[sheet_id] = true;
+    SheetSaveJob job;
+    job.sheet_id = sheet_id;
+    job.offset = offsets[sheet_id];
+    ResolveSheetFormat(job);
+    if (job.offset >= rom.size()) {
+      return absl::OutOfRangeError(absl::StrFormat(
+          "Graphics sheet %02X offset %06X exceeds ROM size %zu", sheet_id,
+          job.offset, rom.size()));
+    }
+    jobs.push_back(std::move(job));
+  }
+  if (jobs.empty()) {
+    return result;
+  }
+
+  RunEncodeJobs(rom, sheets, jobs, options.worker_count);
+
+  // Plan every placement before touching the ROM. Sheets that grew (or whose
+  // data is shared with another sheet) move; the rest are rewritten in place.
+  std::vector<FreeRegion> free_regions;
+  for (const auto& [start, end] : options.free_regions) {
+    if (start < end && end <= rom.size()) {
+      free_regions.push_back({start, end});
+    }
+  }
+
+  std::vector<SheetSaveJob*> to_relocate;
+  for (auto& job : jobs) {
+    RETURN_IF_ERROR(job.status);
+    if (job.skipped) {
+      result.skipped_sheets.push_back(job.sheet_id);
+      continue;
+    }
+    if (job.unchanged) {
+      result.unchanged_sheets.push_back(job.sheet_id);
+      continue;
+    }
+    const bool shared = offset_users[job.offset] > 1;
+    if (job.compressed && (shared || job.encoded.size() > job.slot_size)) {
+      to_relocate.push_back(&job);
+      if (!shared) {
+        free_regions.push_back(
+            {job.offset, job.offset + static_cast<uint32_t>(job.slot_size)});
+      }
+    }
+  }
+
+  // Largest first, each into the smallest region that holds it.
+  std::sort(to_relocate.begin(), to_relocate.end(),
+            [](const SheetSaveJob* a, const SheetSaveJob* b) {
+              return a->encoded.size() > b->encoded.size();
+            });
+  std::vector<uint16_t> unplaced;
+  for (SheetSaveJob* job : to_relocate) {
+    FreeRegion* best = nullptr;
+    for (auto& region : free_regions) {
+      if (region.size() >= job->encoded.size() &&
+          (!best || region.size() < best->size())) {
+        best = &region;
+      }
+    }
+    if (!best) {
+      unplaced.push_back(job->sheet_id);
+      continue;
+    }
+    job->offset = best->start;
+    best->start += static_cast<uint32_t>(job->encoded.size());
+    result.relocated_sheets.push_back(job->sheet_id);
+  }
+  if (!unplaced.empty()) {
+    std::string ids;
+    for (uint16_t id : unplaced) {
+      absl::StrAppendFormat(&ids, "%s%02X", ids.empty() ? "" : ", ", id);
+    }
+    return absl::ResourceExhaustedError(absl::StrFormat(
+        "No free space for recompressed graphics sheet(s) %s; ROM unchanged",
+        ids));
+  }
+
+  // Stage every sheet and pointer, then commit once: a rejected write (for
+  // example by a WriteFence) leaves the ROM untouched.
+  yaze::rom::WriteBatch batch;
+  for (const auto& job : jobs) {
+    if (job.skipped || job.unchanged) {
+      continue;
+    }
+    batch.WriteVector(job.offset, job.encoded);
+    if (job.offset != offsets[job.sheet_id]) {
+      const uint32_t snes_addr = PcToSnes(job.offset);
+      batch.WriteByte(gfx_ptr1 + job.sheet_id,
+                      static_cast<uint8_t>(snes_addr >> 16));
+      batch.WriteByte(gfx_ptr2 + job.sheet_id,
+                      static_cast<uint8_t>(snes_addr >> 8));
+      batch.WriteByte(gfx_ptr3 + job.sheet_id, static_cast<uint8_t>(snes_addr));
+    }
+    result.written_sheets.push_back(job.sheet_id);
+  }
+  RETURN_IF_ERROR(batch.Commit(rom).status());
+
+  LOG_INFO("SaveGraphicsSheets",
+           "Wrote %zu sheet(s) (%zu relocated), %zu unchanged, %zu skipped",
+           result.written_sheets.size(), result.relocated_sheets.size(),
+           result.unchanged_sheets.size(), result.skipped_sheets.size());
+  return result;
+}
+
 absl::Status SaveAllGraphicsData(
-    [[maybe_unused]] Rom& rom,
-    [[maybe_unused]] const std::array<gfx::Bitmap, kNumGfxSheets>& sheets) {
-  // For now, return OK status - full implementation would write sheets back
-  // to ROM at their respective addresses with proper compression
-  LOG_INFO("SaveAllGraphicsData", "Graphics save not yet fully implemented");
-  return absl::OkStatus();
+    Rom& rom, const std::array<gfx::Bitmap, kNumGfxSheets>& sheets) {
+  std::vector<uint16_t> sheet_ids(kNumGfxSheets);
+  for (uint16_t i = 0; i < kNumGfxSheets; ++i) {
+    sheet_ids[i] = i;
+  }
+  return SaveGraphicsSheets(rom, sheets, sheet_ids).status();
 }
 
 }  // namespace zelda3
@@ -4,6 +4,8 @@
 #include <array>
 #include <cstdint>
 #include <map>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "absl/status/status.h"
@@ -182,6 +184,46 @@ absl::StatusOr<gfx::Bitmap> LoadFontGraphics(const Rom& rom);
 absl::Status SaveAllGraphicsData(
     Rom& rom, const std::array<gfx::Bitmap, kNumGfxSheets>& sheets);
 
+struct GraphicsSaveOptions {
+  // Selects the sheet pointer tables
+  zelda3_version version = zelda3_version::US;
+  // Threads used to encode and recompress sheets, counting the caller.
+  // <= 0 runs on the shared util::TaskScheduler.
+  int worker_count = 0;
+  // PC ranges [first, second) that may receive sheets whose recompressed
+  // data no longer fits in their original slot
+  std::vector<std::pair<uint32_t, uint32_t>> free_regions;
+};
+
+struct GraphicsSaveResult {
+  std::vector<uint16_t> written_sheets;    // Written in place or relocated
+  std::vector<uint16_t> relocated_sheets;  // Subset moved to a free region
+  std::vector<uint16_t> unchanged_sheets;  // Encoded data matched the ROM
+  std::vector<uint16_t> skipped_sheets;    // Inactive or unsupported format
+};
+
+/**
+ * @brief Saves only the given graphics sheets back to ROM.
+ *
+ * Sheets are encoded and recompressed in parallel; sheets whose encoded
+ * data already matches the ROM are left untouched. Placement is then planned
+ * in a single pass before anything is written: sheets that still fit are
+ * rewritten in place, the rest are moved into @p options.free_regions (or
+ * slots vacated by other moved sheets) and their pointer table entries are
+ * updated. All writes commit as one batch: if any sheet cannot be placed or
+ * written, the ROM is not modified.
+ *
+ * @param rom The target ROM
+ * @param sheets The graphics sheets (8BPP indexed)
+ * @param sheet_ids Sheets to save, typically those reported modified
+ * @param options Worker count and relocation space
+ * @return What happened to each requested sheet, or error status
+ */
+absl::StatusOr<GraphicsSaveResult> SaveGraphicsSheets(
+    Rom& rom, const std::array<gfx::Bitmap, kNumGfxSheets>& sheets,
+    std::span<const uint16_t> sheet_ids,
+    const GraphicsSaveOptions& options = {});
+
 /**
  * @brief Gets the graphics address for a sheet index.
  * @param data ROM data pointer
@@ -17,6 +17,7 @@
 #include "core/rom_settings.h"
 #include "nlohmann/json.hpp"
 #include "rom/rom.h"
+#include "rom/write_batch.h"
 #include "util/macro.h"
 #include "zelda3/music/song_data.h"
 #include "zelda3/music/spc_parser.h"
@@ -133,38 +134,32 @@ uint8_t EncodeLoRomLow(uint32_t pc_offset) {
   return static_cast<uint8_t>(pc_offset & 0xFF);
 }
 
-absl::Status UpdateBankPointerRegisters(Rom& rom,
-                                        const BankPointerRegisters& regs,
-                                        uint32_t pc_offset) {
+void UpdateBankPointerRegisters(const Rom& rom, rom::WriteBatch& batch,
+                                const BankPointerRegisters& regs,
+                                uint32_t pc_offset) {
   uint8_t preserved_mid = 0;
   auto mid_read = rom.ReadByte(regs.mid);
   if (mid_read.ok()) {
     preserved_mid = mid_read.value() & 0x80;
   }
 
-  auto status = rom.WriteByte(regs.low, EncodeLoRomLow(pc_offset));
-  if (!status.ok())
-    return status;
-
-  status = rom.WriteByte(
-      regs.mid,
-      static_cast<uint8_t>(preserved_mid | EncodeLoRomMid(pc_offset)));
-  if (!status.ok())
-    return status;
-
-  status = rom.WriteByte(regs.bank, EncodeLoRomBank(pc_offset));
-  return status;
+  batch.WriteByte(regs.low, EncodeLoRomLow(pc_offset))
+      .WriteByte(regs.mid, static_cast<uint8_t>(preserved_mid |
+                                                EncodeLoRomMid(pc_offset)))
+      .WriteByte(regs.bank, EncodeLoRomBank(pc_offset));
 }
 
-absl::Status UpdateDynamicBankPointer(Rom& rom, MusicBank::Bank bank,
-                                      uint32_t pc_offset) {
+void UpdateDynamicBankPointer(const Rom& rom, rom::WriteBatch& batch,
+                              MusicBank::Bank bank, uint32_t pc_offset) {
   switch (bank) {
     case MusicBank::Bank::Overworld:
-      return UpdateBankPointerRegisters(rom, kOverworldPointerRegs, pc_offset);
+      UpdateBankPointerRegisters(rom, batch, kOverworldPointerRegs, pc_offset);
+      break;
     case MusicBank::Bank::Credits:
-      return UpdateBankPointerRegisters(rom, kCreditsPointerRegs, pc_offset);
+      UpdateBankPointerRegisters(rom, batch, kCreditsPointerRegs, pc_offset);
+      break;
     default:
-      return absl::OkStatus();
+      break;
   }
 }
 
@@ -257,16 +252,18 @@ absl::Status MusicBank::SaveToRom(Rom& rom) {
         "Songs do not fit in ROM banks. Reduce song size or remove songs.");
   }
 
-  // Save songs to each bank
-  auto status = SaveSongTable(rom, Bank::Overworld);
+  // Stage every bank, then commit them together: a bank that fails to
+  // serialize no longer leaves the banks before it written.
+  rom::WriteBatch batch;
+  auto status = SaveSongTable(rom, Bank::Overworld, batch);
   if (!status.ok())
     return status;
 
-  status = SaveSongTable(rom, Bank::Dungeon);
+  status = SaveSongTable(rom, Bank::Dungeon, batch);
   if (!status.ok())
     return status;
 
-  status = SaveSongTable(rom, Bank::Credits);
+  status = SaveSongTable(rom, Bank::Credits, batch);
   if (!status.ok())
     return status;
 
@@ -284,6 +281,10 @@ absl::Status MusicBank::SaveToRom(Rom& rom) {
       return status;
   }
 
+  auto journal = batch.Commit(rom);
+  if (!journal.ok())
+    return journal.status();
+
   ClearModifications();
   return absl::OkStatus();
 }
@@ -808,7 +809,8 @@ absl::Status MusicBank::LoadSongTable(Rom& rom, Bank bank,
   return absl::OkStatus();
 }
 
-absl::Status MusicBank::SaveSongTable(Rom& rom, Bank bank) {
+absl::Status MusicBank::SaveSongTable(Rom& rom, Bank bank,
+                                      rom::WriteBatch& batch) {
   auto songs_in_bank = GetSongsInBank(bank);
   if (songs_in_bank.empty()) {
     return absl::OkStatus();
@@ -891,15 +893,8 @@ absl::Status MusicBank::SaveSongTable(Rom& rom, Bank bank) {
         static_cast<int>(bank), rom_offset, block_data.size(), rom.size()));
   }
 
-  auto status =
-      rom.WriteVector(static_cast<int>(rom_offset), std::move(block_data));
-  if (!status.ok())
-    return status;
-
-  status = UpdateDynamicBankPointer(rom, bank, rom_offset);
-  if (!status.ok())
-    return status;
-
+  batch.WriteVector(rom_offset, block_data);
+  UpdateDynamicBankPointer(rom, batch, bank, rom_offset);
   return absl::OkStatus();
 }
 
@@ -8,6 +8,7 @@
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "rom/rom.h"
+#include "rom/write_batch.h"
 #include "nlohmann/json.hpp"
 #include "zelda3/music/song_data.h"
 
@@ -270,7 +271,7 @@ class MusicBank {
                                      std::vector<MusicSong>* custom_songs);
 
   // Internal saving methods
-  absl::Status SaveSongTable(Rom& rom, Bank bank);
+  absl::Status SaveSongTable(Rom& rom, Bank bank, rom::WriteBatch& batch);
   absl::Status SaveInstruments(Rom& rom);
   absl::Status SaveSamples(Rom& rom);
 
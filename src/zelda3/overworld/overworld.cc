@@ -4,7 +4,6 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
-#include <future>
 #include <iostream>
 #include <limits>
 #include <ostream>
@@ -22,9 +21,11 @@
 #include "core/features.h"
 #include "rom/rom.h"
 #include "rom/snes.h"
+#include "rom/write_batch.h"
 #include "util/hex.h"
 #include "util/log.h"
 #include "util/macro.h"
+#include "util/task_scheduler.h"
 #include "zelda3/common.h"
 #include "zelda3/overworld/overworld_entrance.h"
 #include "zelda3/overworld/overworld_exit.h"
@@ -36,6 +37,19 @@ namespace yaze::zelda3 {
 
 namespace {
 
+// Fingerprint of the tile16 definitions that feed BuildTiles16Gfx, so cached
+// tile16 pixels are dropped once the editor changes the table in place.
+uint64_t ComputeTiles16Hash(const std::vector<gfx::Tile16>& tiles16) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const auto& tile16 : tiles16) {
+    for (const auto& info : tile16.tiles_info) {
+      hash ^= gfx::TileInfoToWord(info);
+      hash *= 0x100000001b3ULL;
+    }
+  }
+  return hash ^ tiles16.size();
+}
+
 struct Map32StorageLayout {
   std::array<int, 4> destinations{};
   int storage_bytes_per_quadrant = 0;
@@ -178,40 +192,39 @@ absl::Status Overworld::Load(Rom* rom) {
     gfx::ScopedTimer data_loading_timer("LoadOverworldData");
 
     {
-      gfx::ScopedTimer tile_types_timer("LoadTileTypes");
-      LoadTileTypes();
-    }
-
-    {
-      gfx::ScopedTimer diggable_tiles_timer("LoadDiggableTiles");
-      RETURN_IF_ERROR(LoadDiggableTiles());
+      gfx::ScopedTimer items_timer("LoadItems");
+      ASSIGN_OR_RETURN(all_items_, LoadItems(rom_, overworld_maps_));
     }
 
-    {
-      gfx::ScopedTimer entrances_timer("LoadEntrances");
+    // These tables only read the ROM and fill their own members, so they
+    // load on the scheduler while this thread builds the essential maps.
+    util::TaskGroup tables;
+    tables.Run([this]() {
+      LoadTileTypes();
+      return absl::OkStatus();
+    });
+    tables.Run([this]() { return LoadDiggableTiles(); });
+    tables.Run([this]() -> absl::Status {
       ASSIGN_OR_RETURN(all_entrances_, LoadEntrances(rom_));
-    }
-
-    {
-      gfx::ScopedTimer holes_timer("LoadHoles");
+      return absl::OkStatus();
+    });
+    tables.Run([this]() -> absl::Status {
       ASSIGN_OR_RETURN(all_holes_, LoadHoles(rom_));
-    }
-
-    {
-      gfx::ScopedTimer exits_timer("LoadExits");
+      return absl::OkStatus();
+    });
+    tables.Run([this]() -> absl::Status {
       ASSIGN_OR_RETURN(all_exits_, LoadExits(rom_));
-    }
-
-    {
-      gfx::ScopedTimer items_timer("LoadItems");
-      ASSIGN_OR_RETURN(all_items_, LoadItems(rom_, overworld_maps_));
-    }
+      return absl::OkStatus();
+    });
 
     {
       gfx::ScopedTimer overworld_maps_timer("LoadOverworldMaps");
       RETURN_IF_ERROR(LoadOverworldMaps());
     }
+    RETURN_IF_ERROR(tables.Wait());
 
+    // Sprites keep a reference to their map's graphics, so they wait for
+    // the maps to be built.
     {
       gfx::ScopedTimer sprites_timer("LoadSprites");
       RETURN_IF_ERROR(LoadSprites());
@@ -755,89 +768,65 @@ absl::Status Overworld::DecompressAllMapTilesParallel() {
     return SnesToPc(p);
   };
 
-  constexpr uint32_t kBaseLowest = 0x0FFFFF;
-  constexpr uint32_t kBaseHighest = 0x0F8000;
-
-  uint32_t lowest = kBaseLowest;
-  uint32_t highest = kBaseHighest;
-  int sx = 0;
-  int sy = 0;
-  int c = 0;
   // Tail maps (0xA0-0xBF) require BOTH:
   // 1. Feature flag enabled in settings
   // 2. TailMapExpansion.asm patch applied to ROM (marker at 0x1423FF)
   const bool allow_special_tail =
       core::FeatureFlags::get().overworld.kEnableSpecialWorldExpansion &&
       HasExpandedPointerTables();
-
-  for (int i = 0; i < kNumOverworldMaps; i++) {
-    // Guard: skip building tail special maps unless expansion is available
-    if (!allow_special_tail &&
-        i >= kSpecialWorldMapIdStart + 0x20) {  // 0xA0-0xBF
-      FillBlankMapTiles(i);
-      sx++;
-      if (sx >= 8) {
-        sy++;
-        sx = 0;
-      }
-      c++;
-      if (c >= 64) {
-        sx = 0;
-        sy = 0;
-        c = 0;
+  const uint32_t pointers_high =
+      version_constants().kCompressedAllMap32PointersHigh;
+  const uint32_t pointers_low =
+      version_constants().kCompressedAllMap32PointersLow;
+
+  // Decompress every map's tile32 streams on the scheduler. A map left with
+  // an empty stream gets blank tiles below.
+  struct MapTileStreams {
+    std::vector<uint8_t> low;
+    std::vector<uint8_t> high;
+  };
+  std::vector<MapTileStreams> streams(kNumOverworldMaps);
+  {
+    util::TaskGroup group;
+    group.RunEach(kNumOverworldMaps, [&](int i) {
+      // Guard: skip building tail special maps unless expansion is available
+      if (!allow_special_tail &&
+          i >= kSpecialWorldMapIdStart + 0x20) {  // 0xA0-0xBF
+        return absl::OkStatus();
       }
-      continue;
-    }
 
-    auto p1 = get_ow_map_gfx_ptr(
-        i, version_constants().kCompressedAllMap32PointersHigh);
-    auto p2 = get_ow_map_gfx_ptr(
-        i, version_constants().kCompressedAllMap32PointersLow);
-
-    int ttpos = 0;
-
-    bool pointers_valid =
-        (p1 > 0 && p2 > 0 && p1 < rom()->size() && p2 < rom()->size());
-    if (!pointers_valid) {
-      // Missing/invalid pointers -> use blank map tiles to avoid crashes
-      FillBlankMapTiles(i);
-      sx++;
-      if (sx >= 8) {
-        sy++;
-        sx = 0;
+      auto p1 = get_ow_map_gfx_ptr(i, pointers_high);
+      auto p2 = get_ow_map_gfx_ptr(i, pointers_low);
+      bool pointers_valid =
+          (p1 > 0 && p2 > 0 && p1 < rom()->size() && p2 < rom()->size());
+      if (!pointers_valid) {
+        // Missing/invalid pointers -> use blank map tiles to avoid crashes
+        return absl::OkStatus();
       }
-      c++;
-      if (c >= 64) {
-        sx = 0;
-        sy = 0;
-        c = 0;
-      }
-      continue;
-    }
-
-    if (p1 >= highest)
-      highest = p1;
-    if (p2 >= highest)
-      highest = p2;
-
-    if (p1 <= lowest && p1 > kBaseHighest)
-      lowest = p1;
-    if (p2 <= lowest && p2 > kBaseHighest)
-      lowest = p2;
 
-    int size1, size2;
-    size_t max_size_p2 = rom()->size() - p2;
-    auto bytes =
-        gfx::HyruleMagicDecompress(rom()->data() + p2, &size1, 1, max_size_p2);
-    size_t max_size_p1 = rom()->size() - p1;
-    auto bytes2 =
-        gfx::HyruleMagicDecompress(rom()->data() + p1, &size2, 1, max_size_p1);
+      int size1, size2;
+      size_t max_size_p2 = rom()->size() - p2;
+      streams[i].low = gfx::HyruleMagicDecompress(rom()->data() + p2, &size1,
+                                                  1, max_size_p2);
+      size_t max_size_p1 = rom()->size() - p1;
+      streams[i].high = gfx::HyruleMagicDecompress(rom()->data() + p1,
+                                                   &size2, 1, max_size_p1);
+      return absl::OkStatus();
+    });
+    RETURN_IF_ERROR(group.Wait());
+  }
 
+  // Organizing writes the shared world blocksets, so it stays in map order.
+  int sx = 0;
+  int sy = 0;
+  int c = 0;
+  for (int i = 0; i < kNumOverworldMaps; i++) {
     // If decompression fails, use blank tiles to keep map index usable
-    if (bytes.empty() || bytes2.empty()) {
+    if (streams[i].low.empty() || streams[i].high.empty()) {
       FillBlankMapTiles(i);
     } else {
-      OrganizeMapTiles(bytes, bytes2, i, sx, sy, ttpos);
+      int ttpos = 0;
+      OrganizeMapTiles(streams[i].low, streams[i].high, i, sx, sy, ttpos);
     }
 
     sx++;
@@ -938,20 +927,25 @@ absl::Status Overworld::LoadOverworldMaps() {
       uint64_t config_hash = ComputeGraphicsConfigHash(i);
       const std::vector<uint8_t>* cached_tileset =
           GetCachedTileset(config_hash);
+      const std::vector<uint8_t>* cached_tile16_pixels =
+          GetCachedTile16Pixels(config_hash);
       RETURN_IF_ERROR(overworld_maps_[i].BuildMapWithCache(
           size, game_state_, world_type, tiles16_, GetMapTiles(world_type),
-          cached_tileset));
+          cached_tileset, cached_tile16_pixels));
       if (!cached_tileset) {
         CacheTileset(config_hash, overworld_maps_[i].current_graphics());
       }
+      if (!cached_tile16_pixels) {
+        CacheTile16Pixels(config_hash, overworld_maps_[i].tile16_pixels());
+      }
       built_map_lru_.push_front(i);
     } else {
       overworld_maps_[i].SetNotBuilt();
     }
   }
 #else
-  // Native: Use parallel loading with std::async for faster performance
-  std::vector<std::future<absl::Status>> futures;
+  // Native: one task per essential map on the shared scheduler
+  util::TaskGroup group;
 
   // Build essential maps only
   for (int i = 0; i < kNumOverworldMaps; ++i) {
@@ -974,11 +968,10 @@ absl::Status Overworld::LoadOverworldMaps() {
         world_type = 2;
       }
 
-      auto task_function = [this, i, size, world_type]() {
+      group.Run([this, i, size, world_type]() {
         return overworld_maps_[i].BuildMap(size, game_state_, world_type,
                                            tiles16_, GetMapTiles(world_type));
-      };
-      futures.emplace_back(std::async(std::launch::async, task_function));
+      });
     } else {
       // Mark non-essential maps as not built yet
       overworld_maps_[i].SetNotBuilt();
@@ -986,10 +979,7 @@ absl::Status Overworld::LoadOverworldMaps() {
   }
 
   // Wait for essential maps to complete
-  for (auto& future : futures) {
-    future.wait();
-    RETURN_IF_ERROR(future.get());
-  }
+  RETURN_IF_ERROR(group.Wait());
 
   built_map_lru_.clear();
   for (int map_index : essential_map_ids) {
@@ -1093,16 +1083,24 @@ absl::Status Overworld::EnsureMapBuilt(int map_index) {
 
   // Try to use cached tileset for faster build
   const std::vector<uint8_t>* cached_tileset = GetCachedTileset(config_hash);
+  // Maps sharing a graphics config also share their tile16 pixels, so most
+  // on-demand builds skip BuildTiles16Gfx and only compose the bitmap.
+  const std::vector<uint8_t>* cached_tile16_pixels =
+      GetCachedTile16Pixels(config_hash);
 
   auto status = overworld_maps_[map_index].BuildMapWithCache(
       size, game_state_, world_type, tiles16_, GetMapTiles(world_type),
-      cached_tileset);
+      cached_tileset, cached_tile16_pixels);
 
   if (status.ok()) {
     // Cache the tileset if we didn't use cached data
     if (!cached_tileset) {
       CacheTileset(config_hash, overworld_maps_[map_index].current_graphics());
     }
+    if (!cached_tile16_pixels) {
+      CacheTile16Pixels(config_hash,
+                        overworld_maps_[map_index].tile16_pixels());
+    }
     // Add to front of LRU cache
     built_map_lru_.push_front(map_index);
   }
@@ -1223,6 +1221,26 @@ void Overworld::CacheTileset(uint64_t config_hash,
   gfx_config_cache_[config_hash] = {tileset, 1};
 }
 
+const std::vector<uint8_t>* Overworld::GetCachedTile16Pixels(
+    uint64_t config_hash) {
+  auto it = gfx_config_cache_.find(config_hash);
+  if (it == gfx_config_cache_.end() || it->second.tile16_pixels.empty() ||
+      it->second.tiles16_hash != ComputeTiles16Hash(tiles16_)) {
+    return nullptr;
+  }
+  return &it->second.tile16_pixels;
+}
+
+void Overworld::CacheTile16Pixels(uint64_t config_hash,
+                                  const std::vector<uint8_t>& tile16_pixels) {
+  auto it = gfx_config_cache_.find(config_hash);
+  if (it == gfx_config_cache_.end()) {
+    return;
+  }
+  it->second.tile16_pixels = tile16_pixels;
+  it->second.tiles16_hash = ComputeTiles16Hash(tiles16_);
+}
+
 void Overworld::InvalidateMapCache(int map_index) {
   if (map_index < 0 || map_index >= kNumOverworldMaps) {
     return;
@@ -1303,37 +1321,34 @@ absl::Status Overworld::LoadSprites() {
     RETURN_IF_ERROR(LoadSpritesFromMap(kOverworldSpritesAgahnim, 144, 2));
   }
 #else
-  // Native: Parallel loading for performance
-  std::vector<std::future<absl::Status>> futures;
+  // Native: one task per game state; each fills its own sprite list
+  util::TaskGroup group;
 
   if (OverworldVersionHelper::SupportsAreaEnum(cached_version_)) {
     // v3: Use expanded sprite tables
-    futures.emplace_back(std::async(std::launch::async, [this]() {
+    group.Run([this]() {
       return LoadSpritesFromMap(overworldSpritesBeginingExpanded, 64, 0);
-    }));
-    futures.emplace_back(std::async(std::launch::async, [this]() {
+    });
+    group.Run([this]() {
       return LoadSpritesFromMap(overworldSpritesZeldaExpanded, 144, 1);
-    }));
-    futures.emplace_back(std::async(std::launch::async, [this]() {
+    });
+    group.Run([this]() {
       return LoadSpritesFromMap(overworldSpritesAgahnimExpanded, 144, 2);
-    }));
+    });
   } else {
     // Vanilla/v2: Use original sprite tables
-    futures.emplace_back(std::async(std::launch::async, [this]() {
+    group.Run([this]() {
       return LoadSpritesFromMap(kOverworldSpritesBeginning, 64, 0);
-    }));
-    futures.emplace_back(std::async(std::launch::async, [this]() {
+    });
+    group.Run([this]() {
       return LoadSpritesFromMap(kOverworldSpritesZelda, 144, 1);
-    }));
-    futures.emplace_back(std::async(std::launch::async, [this]() {
+    });
+    group.Run([this]() {
       return LoadSpritesFromMap(kOverworldSpritesAgahnim, 144, 2);
-    }));
+    });
   }
 
-  for (auto& future : futures) {
-    future.wait();
-    RETURN_IF_ERROR(future.get());
-  }
+  RETURN_IF_ERROR(group.Wait());
 #endif
   return absl::OkStatus();
 }
@@ -1380,28 +1395,40 @@ absl::Status Overworld::LoadSpritesFromMap(int sprites_per_gamestate_ptr,
 }
 
 absl::Status Overworld::Save(Rom* rom) {
+  // The sub-savers write to a copy-on-write clone (and may read back what
+  // they wrote). Only the bytes that changed are then applied to `rom`, as
+  // one batch, so a failure anywhere leaves `rom` untouched.
+  Rom staged(*rom);
+  rom_ = &staged;
+  const absl::Status status = [this]() -> absl::Status {
+    RETURN_IF_ERROR(CreateTile32Tilemap())
+    if (expanded_tile16_) {
+      RETURN_IF_ERROR(SaveMap16Expanded())
+    } else {
+      RETURN_IF_ERROR(SaveMap16Tiles())
+    }
+    if (expanded_tile32_) {
+      RETURN_IF_ERROR(SaveMap32Expanded())
+    } else {
+      RETURN_IF_ERROR(SaveMap32Tiles())
+    }
+    RETURN_IF_ERROR(SaveOverworldMaps())
+    RETURN_IF_ERROR(SaveEntrances())
+    RETURN_IF_ERROR(SaveExits())
+    RETURN_IF_ERROR(SaveItems())
+    RETURN_IF_ERROR(SaveMapOverlays())
+    RETURN_IF_ERROR(SaveOverworldTilesType())
+    RETURN_IF_ERROR(SaveDiggableTiles())
+    RETURN_IF_ERROR(SaveMusic())
+    RETURN_IF_ERROR(SaveCustomOverworldData())
+    return absl::OkStatus();
+  }();
   rom_ = rom;
-  RETURN_IF_ERROR(CreateTile32Tilemap())
-  if (expanded_tile16_) {
-    RETURN_IF_ERROR(SaveMap16Expanded())
-  } else {
-    RETURN_IF_ERROR(SaveMap16Tiles())
-  }
-  if (expanded_tile32_) {
-    RETURN_IF_ERROR(SaveMap32Expanded())
-  } else {
-    RETURN_IF_ERROR(SaveMap32Tiles())
-  }
-  RETURN_IF_ERROR(SaveOverworldMaps())
-  RETURN_IF_ERROR(SaveEntrances())
-  RETURN_IF_ERROR(SaveExits())
-  RETURN_IF_ERROR(SaveItems())
-  RETURN_IF_ERROR(SaveMapOverlays())
-  RETURN_IF_ERROR(SaveOverworldTilesType())
-  RETURN_IF_ERROR(SaveDiggableTiles())
-  RETURN_IF_ERROR(SaveMusic())
-  RETURN_IF_ERROR(SaveCustomOverworldData())
-  return absl::OkStatus();
+  RETURN_IF_ERROR(status);
+
+  rom::WriteBatch batch;
+  RETURN_IF_ERROR(batch.StageChanges(*rom, staged));
+  return batch.Commit(*rom).status();
 }
 
 absl::Status Overworld::SaveOverworldMaps() {
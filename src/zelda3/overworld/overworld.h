@@ -441,6 +441,14 @@ class Overworld {
   /// @brief Cache tileset data for future reuse
   void CacheTileset(uint64_t config_hash, const std::vector<uint8_t>& tileset);
 
+  /// @brief Try to get cached tile16 pixels for a graphics configuration
+  /// @return nullptr if not cached or built from a different tiles16 table
+  const std::vector<uint8_t>* GetCachedTile16Pixels(uint64_t config_hash);
+
+  /// @brief Attach built tile16 pixels to an existing tileset cache entry
+  void CacheTile16Pixels(uint64_t config_hash,
+                         const std::vector<uint8_t>& tile16_pixels);
+
   /// @brief Clear entire graphics config cache
   /// Call when palette or graphics settings change globally
   void ClearGraphicsConfigCache() { gfx_config_cache_.clear(); }
@@ -466,6 +474,9 @@ class Overworld {
   //   4. SaveOverworldMaps() - Write compressed map data
 
   /// @brief Master save method (calls sub-methods in correct order)
+  ///
+  /// Every write reaches @p rom as a single rom::WriteBatch: if any step
+  /// fails, or an active write fence rejects any byte, @p rom is unchanged.
   absl::Status Save(Rom* rom);
 
   /// @brief Save compressed map tile data to ROM
@@ -821,6 +832,10 @@ class Overworld {
   struct GraphicsConfigCache {
     std::vector<uint8_t> current_gfx;  // 64KB tileset
     int reference_count = 0;
+    // Tile16 pixels built from current_gfx, valid while tiles16_ still
+    // hashes to tiles16_hash (the table is edited in place by the editor)
+    std::vector<uint8_t> tile16_pixels;
+    uint64_t tiles16_hash = 0;
   };
   std::unordered_map<uint64_t, GraphicsConfigCache> gfx_config_cache_;
 #ifdef __EMSCRIPTEN__
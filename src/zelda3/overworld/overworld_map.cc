@@ -2,8 +2,10 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <unordered_map>
 #include <vector>
 
@@ -21,6 +23,19 @@
 
 namespace yaze::zelda3 {
 
+namespace {
+
+constexpr int kTile16Size = 0x10;
+constexpr size_t kTile16Bytes = kTile16Size * kTile16Size;
+constexpr int kGfxStride = 0x80;          // current_gfx_: 16 tile8 per row
+constexpr int kBlocksetStride = 0x80;     // current_blockset_: 8 tile16 per row
+constexpr size_t kBlocksetBytes = 0x100000;
+constexpr int kBitmapStride = 0x200;      // 512x512 map bitmap
+constexpr size_t kBitmapBytes = 0x40000;
+constexpr uint64_t kLowNibbles = 0x0F0F0F0F0F0F0F0FULL;
+
+}  // namespace
+
 OverworldMap::OverworldMap(int index, Rom* rom, GameData* game_data)
     : index_(index), parent_(index), rom_(rom), game_data_(game_data) {
   // Load parent ID from ROM data for all versions
@@ -79,7 +94,8 @@ absl::Status OverworldMap::BuildMap(int count, int game_state, int world,
 absl::Status OverworldMap::BuildMapWithCache(
     int count, int game_state, int world, std::vector<gfx::Tile16>& tiles16,
     OverworldBlockset& world_blockset,
-    const std::vector<uint8_t>* cached_tileset) {
+    const std::vector<uint8_t>* cached_tileset,
+    const std::vector<uint8_t>* cached_tile16_pixels) {
   game_state_ = game_state;
   world_ = world;
   auto version = OverworldVersionHelper::GetVersion(*rom_);
@@ -124,7 +140,12 @@ absl::Status OverworldMap::BuildMapWithCache(
     RETURN_IF_ERROR(BuildTileset())
   }
 
-  RETURN_IF_ERROR(BuildTiles16Gfx(tiles16, count))
+  const size_t tile16_bytes = static_cast<size_t>(count) * kTile16Bytes;
+  if (cached_tile16_pixels && cached_tile16_pixels->size() == tile16_bytes) {
+    UseCachedTile16Pixels(*cached_tile16_pixels);
+  } else {
+    RETURN_IF_ERROR(BuildTiles16Gfx(tiles16, count))
+  }
   RETURN_IF_ERROR(LoadPalette());
   RETURN_IF_ERROR(LoadOverlay());
   RETURN_IF_ERROR(BuildBitmap(world_blockset))
@@ -1253,58 +1274,78 @@ absl::Status OverworldMap::BuildTileset() {
 
 absl::Status OverworldMap::BuildTiles16Gfx(std::vector<gfx::Tile16>& tiles16,
                                            int count) {
-  if (current_blockset_.size() == 0)
-    current_blockset_.resize(0x100000, 0x00);
-
-  const int offsets[] = {0x00, 0x08, 0x400, 0x408};
-  auto yy = 0;
-  auto xx = 0;
-
-  for (auto i = 0; i < count; i++) {
-    for (auto tile = 0; tile < 0x04; tile++) {
-      gfx::TileInfo info = tiles16[i].tiles_info[tile];
-      int offset = offsets[tile];
-      for (auto y = 0; y < 0x08; ++y) {
-        for (auto x = 0; x < 0x08; ++x) {
-          int mx = x;
-          int my = y;
-
-          if (info.horizontal_mirror_ != 0) {
-            mx = 0x07 - x;
-          }
-
-          if (info.vertical_mirror_ != 0) {
-            my = 0x07 - y;
-          }
-
-          int xpos = ((info.id_ % 0x10) * 0x08);
-          int ypos = (((info.id_ / 0x10)) * 0x400);
-          int source = ypos + xpos + (x + (y * 0x80));
-
-          auto destination = xx + yy + offset + (mx + (my * 0x80));
-          current_blockset_[destination] =
-              (current_gfx_[source] & 0x0F) + (info.palette_ * 0x10);
+  count = std::clamp(count, 0, static_cast<int>(tiles16.size()));
+  tile16_pixels_.resize(static_cast<size_t>(count) * kTile16Bytes);
+
+  // Each tile8 row is 8 contiguous bytes in current_gfx_, so a quadrant is
+  // built a row at a time: mask to the 4bpp index, OR in the palette row
+  // (the low nibble is free, so this matches the per-pixel add), and reverse
+  // the byte order for horizontal mirroring.
+  const uint8_t* gfx = current_gfx_.data();
+  const size_t gfx_size = current_gfx_.size();
+  for (int i = 0; i < count; ++i) {
+    uint8_t* tile16 = tile16_pixels_.data() + (i * kTile16Bytes);
+    for (int tile = 0; tile < 4; ++tile) {
+      const gfx::TileInfo& info = tiles16[i].tiles_info[tile];
+      uint8_t* quadrant =
+          tile16 + ((tile & 1) * 8) + ((tile >> 1) * 8 * kTile16Size);
+      const size_t source =
+          ((info.id_ / 0x10) * 0x400) + ((info.id_ % 0x10) * 0x08);
+      const bool in_range = source + (7 * kGfxStride) + 8 <= gfx_size;
+      const uint64_t palette =
+          0x0101010101010101ULL * static_cast<uint8_t>(info.palette_ * 0x10);
+
+      for (int y = 0; y < 8; ++y) {
+        uint64_t row = 0;
+        if (in_range) {
+          std::memcpy(&row, gfx + source + (y * kGfxStride), sizeof(row));
         }
+        row = (row & kLowNibbles) | palette;
+        if (info.horizontal_mirror_) {
+          row = std::byteswap(row);
+        }
+        const int dest_y = info.vertical_mirror_ ? 7 - y : y;
+        std::memcpy(quadrant + (dest_y * kTile16Size), &row, sizeof(row));
       }
     }
-
-    xx += 0x10;
-    if (xx >= 0x80) {
-      yy += 0x800;
-      xx = 0;
-    }
   }
 
+  CopyTile16PixelsToBlockset(count);
   return absl::OkStatus();
 }
 
-absl::Status OverworldMap::BuildBitmap(OverworldBlockset& world_blockset) {
-  if (bitmap_data_.size() != 0) {
-    bitmap_data_.clear();
+void OverworldMap::UseCachedTile16Pixels(
+    const std::vector<uint8_t>& cached_pixels) {
+  tile16_pixels_ = cached_pixels;
+  CopyTile16PixelsToBlockset(
+      static_cast<int>(tile16_pixels_.size() / kTile16Bytes));
+}
+
+void OverworldMap::CopyTile16PixelsToBlockset(int count) {
+  // current_blockset_ keeps the 128-pixel-wide sheet layout used by the
+  // tile16 selector; it is filled from the contiguous tile16 pixels.
+  if (current_blockset_.size() != kBlocksetBytes) {
+    current_blockset_.resize(kBlocksetBytes, 0x00);
+  }
+
+  const int limit =
+      std::min(count, static_cast<int>(kBlocksetBytes / kTile16Bytes));
+  for (int i = 0; i < limit; ++i) {
+    const uint8_t* src = tile16_pixels_.data() + (i * kTile16Bytes);
+    uint8_t* dst = current_blockset_.data() + ((i % 8) * kTile16Size) +
+                   ((i / 8) * kTile16Size * kBlocksetStride);
+    for (int y = 0; y < kTile16Size; ++y) {
+      std::memcpy(dst + (y * kBlocksetStride), src + (y * kTile16Size),
+                  kTile16Size);
+    }
   }
-  bitmap_data_.reserve(0x40000);
-  for (int i = 0; i < 0x40000; i++) {
-    bitmap_data_.push_back(0x00);
+}
+
+absl::Status OverworldMap::BuildBitmap(OverworldBlockset& world_blockset) {
+  // Every pixel is written below, so a previously built bitmap is reused in
+  // place rather than reallocated.
+  if (bitmap_data_.size() != kBitmapBytes) {
+    bitmap_data_.assign(kBitmapBytes, 0x00);
   }
 
   // BuildBitmap is used by both full map builds and editor refresh paths.
@@ -1320,6 +1361,7 @@ absl::Status OverworldMap::BuildBitmap(OverworldBlockset& world_blockset) {
   int superY = local_index / 0x08;
   int superX = local_index - (superY * 0x08);
 
+  const size_t tile16_count = tile16_pixels_.size() / kTile16Bytes;
   for (int y = 0; y < 0x20; y++) {
     for (int x = 0; x < 0x20; x++) {
       auto xt = x + (superX * 0x20);
@@ -1329,8 +1371,21 @@ absl::Status OverworldMap::BuildBitmap(OverworldBlockset& world_blockset) {
         return absl::InvalidArgumentError(
             "Overworld blockset is too small for map bitmap build");
       }
-      gfx::CopyTile8bpp16((x * 0x10), (y * 0x10), world_blockset[xt][yt],
-                          bitmap_data_, current_blockset_);
+
+      const size_t tile = world_blockset[xt][yt];
+      uint8_t* dst = bitmap_data_.data() + (x * kTile16Size) +
+                     (y * kTile16Size * kBitmapStride);
+      if (tile >= tile16_count) {
+        for (int row = 0; row < kTile16Size; ++row) {
+          std::memset(dst + (row * kBitmapStride), 0x00, kTile16Size);
+        }
+        continue;
+      }
+      const uint8_t* src = tile16_pixels_.data() + (tile * kTile16Bytes);
+      for (int row = 0; row < kTile16Size; ++row) {
+        std::memcpy(dst + (row * kBitmapStride), src + (row * kTile16Size),
+                    kTile16Size);
+      }
     }
   }
   return absl::OkStatus();
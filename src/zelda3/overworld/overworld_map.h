@@ -159,11 +159,14 @@ class OverworldMap : public gfx::GfxContext {
   /**
    * @brief Build map with optional cached tileset for performance
    * @param cached_tileset Pre-computed tileset data (nullptr to build fresh)
+   * @param cached_tile16_pixels Pre-computed tile16 pixels for the same
+   *        tileset and tiles16 table (nullptr to run BuildTiles16Gfx)
    */
-  absl::Status BuildMapWithCache(int count, int game_state, int world,
-                                 std::vector<gfx::Tile16>& tiles16,
-                                 OverworldBlockset& world_blockset,
-                                 const std::vector<uint8_t>* cached_tileset);
+  absl::Status BuildMapWithCache(
+      int count, int game_state, int world, std::vector<gfx::Tile16>& tiles16,
+      OverworldBlockset& world_blockset,
+      const std::vector<uint8_t>* cached_tileset,
+      const std::vector<uint8_t>* cached_tile16_pixels = nullptr);
 
   void LoadAreaGraphics();
   absl::Status LoadPalette();
@@ -181,11 +184,20 @@ class OverworldMap : public gfx::GfxContext {
     current_gfx_ = cached_gfx;
   }
 
+  /**
+   * @brief Use pre-built tile16 pixels instead of running BuildTiles16Gfx
+   * @param cached_pixels Output of tile16_pixels() from a map with the same
+   *        tileset and tiles16 table
+   */
+  void UseCachedTile16Pixels(const std::vector<uint8_t>& cached_pixels);
+
   void DrawAnimatedTiles();
 
   const std::vector<uint8_t>& current_tile16_blockset() const {
     return current_blockset_;
   }
+  /// Tile16 pixels from BuildTiles16Gfx: 16x16 row-major, 256 bytes each.
+  const std::vector<uint8_t>& tile16_pixels() const { return tile16_pixels_; }
   const std::vector<uint8_t>& current_graphics() const { return current_gfx_; }
   const gfx::SnesPalette& current_palette() const { return current_palette_; }
   const std::vector<uint8_t>& bitmap_data() const { return bitmap_data_; }
@@ -302,6 +314,7 @@ class OverworldMap : public gfx::GfxContext {
     current_blockset_.clear();
     current_gfx_.clear();
     bitmap_data_.clear();
+    tile16_pixels_.clear();
     map_tiles_.light_world.clear();
     map_tiles_.dark_world.clear();
     map_tiles_.special_world.clear();
@@ -385,9 +398,12 @@ class OverworldMap : public gfx::GfxContext {
   bool has_overlay_ = false;
   std::vector<uint8_t> overlay_data_;
 
+  void CopyTile16PixelsToBlockset(int count);
+
   std::vector<uint8_t> current_blockset_;
   std::vector<uint8_t> current_gfx_;
   std::vector<uint8_t> bitmap_data_;
+  std::vector<uint8_t> tile16_pixels_;
 
   OverworldMapTiles map_tiles_;
   gfx::SnesPalette current_palette_;
@@ -5,6 +5,7 @@ set(
   zelda3/dungeon/door_position.cc
   zelda3/dungeon/dungeon_stream_allocator.cc
   zelda3/dungeon/dungeon_editor_system.cc
+  zelda3/dungeon/dungeon_room_index.cc
   zelda3/dungeon/custom_collision.cc
   zelda3/dungeon/oracle_rom_safety_preflight.cc
   zelda3/dungeon/track_collision_generator.cc
@@ -13,18 +14,24 @@ set(
   zelda3/dungeon/dungeon_object_editor.cc
   zelda3/dungeon/dungeon_object_registry.cc
   zelda3/dungeon/dungeon_validator.cc
+  zelda3/dungeon/incremental_dungeon_validator.cc
   zelda3/dungeon/dimension_service.cc
   zelda3/dungeon/object_dimensions.cc
   zelda3/dungeon/geometry/object_geometry.cc
   zelda3/dungeon/object_drawer.cc
+  zelda3/dungeon/object_footprint_index.cc
+  zelda3/dungeon/object_spatial_index.cc
   zelda3/dungeon/object_parser.cc
   zelda3/dungeon/object_tile_editor.cc
   zelda3/dungeon/object_templates.cc
   zelda3/dungeon/pit_damage_table.cc
   zelda3/dungeon/room.cc
+  zelda3/dungeon/room_graphics_cache.cc
   zelda3/dungeon/room_layer_manager.cc
   zelda3/dungeon/room_layout.cc
   zelda3/dungeon/room_object.cc
+  zelda3/dungeon/room_stream_table.cc
+  zelda3/dungeon/room_thumbnail.cc
   # Draw routine modules (Phase 2 modularization)
   zelda3/dungeon/draw_routines/draw_routine_types.cc
   zelda3/dungeon/draw_routines/draw_routine_registry.cc
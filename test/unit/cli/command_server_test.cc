@@ -0,0 +1,129 @@
+#include "cli/service/command_server.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+#include "rom/rom.h"
+
+namespace yaze::cli {
+namespace {
+
+using json = nlohmann::json;
+
+class CommandServerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::vector<uint8_t> data(0x8000, 0x00);
+    data[0x100] = 0x11;
+    ASSERT_TRUE(rom_.LoadFromData(data).ok());
+    server_.Attach(&rom_);
+  }
+
+  json Send(const std::string& line) {
+    return json::parse(server_.HandleLine(line));
+  }
+
+  Rom rom_;
+  CommandServer server_;
+};
+
+TEST_F(CommandServerTest, PingEchoesRequestId) {
+  const json response = Send(R"({"id": 7, "command": "ping"})");
+  EXPECT_TRUE(response["ok"].get<bool>());
+  EXPECT_EQ(response["id"], 7);
+  EXPECT_TRUE(response.contains("elapsed_ms"));
+}
+
+TEST_F(CommandServerTest, RejectsMalformedAndUnknownRequests) {
+  const json malformed = Send("not json");
+  EXPECT_FALSE(malformed["ok"].get<bool>());
+  EXPECT_EQ(malformed["code"], "INVALID_ARGUMENT");
+
+  const json unknown = Send(R"({"command": "no-such-command"})");
+  EXPECT_FALSE(unknown["ok"].get<bool>());
+  EXPECT_EQ(unknown["code"], "NOT_FOUND");
+}
+
+TEST_F(CommandServerTest, WritesStayInSandboxUnlessCommitted) {
+  const json dry = Send(
+      R"({"command": "hex-write", "args": ["--address=0x100", "--data=AB"]})");
+  ASSERT_TRUE(dry["ok"].get<bool>()) << dry.dump();
+  EXPECT_TRUE(dry["rom_changed"].get<bool>());
+  EXPECT_FALSE(dry["committed"].get<bool>());
+  EXPECT_EQ(rom_.data()[0x100], 0x11);
+
+  const json kept = Send(
+      R"({"command": "hex-write", "args": ["--address=0x100", "--data=AB"],)"
+      R"( "commit": true})");
+  ASSERT_TRUE(kept["ok"].get<bool>()) << kept.dump();
+  EXPECT_TRUE(kept["committed"].get<bool>());
+  EXPECT_EQ(rom_.data()[0x100], 0xAB);
+
+  // Read-only commands see the resident ROM directly.
+  const json read = Send(
+      R"({"command": "hex-read", "args": ["--address=0x100", "--length=1",)"
+      R"( "--format=json"]})");
+  ASSERT_TRUE(read["ok"].get<bool>()) << read.dump();
+  EXPECT_THAT(read["output"].dump(), ::testing::HasSubstr("AB"));
+}
+
+TEST_F(CommandServerTest, CommittedWritesAdvanceTheWorldRevision) {
+  EXPECT_EQ(server_.world().rom(), &rom_);
+  const uint64_t initial = server_.rom_revision();
+
+  Send(R"({"command": "hex-write", "args": ["--address=0x100", "--data=AB"]})");
+  EXPECT_EQ(server_.rom_revision(), initial);
+
+  const json kept = Send(
+      R"({"command": "hex-write", "args": ["--address=0x100", "--data=AB"],)"
+      R"( "commit": true})");
+  ASSERT_TRUE(kept["committed"].get<bool>()) << kept.dump();
+  EXPECT_GT(server_.rom_revision(), initial);
+  EXPECT_EQ(server_.world().revision(), server_.rom_revision());
+  EXPECT_EQ(server_.world().cached_room_count(), 0u);
+}
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+TEST_F(CommandServerTest, SocketRefusesToReplaceARegularFile) {
+  const std::filesystem::path path =
+      std::filesystem::temp_directory_path() / "command_server_not_a_socket";
+  {
+    std::ofstream file(path);
+    file << "keep me";
+  }
+
+  const absl::Status status = server_.ServeUnixSocket(path.string());
+  EXPECT_TRUE(absl::IsFailedPrecondition(status)) << status;
+  EXPECT_TRUE(std::filesystem::exists(path));
+  std::filesystem::remove(path);
+}
+#endif
+
+TEST_F(CommandServerTest, ServeStreamStopsOnShutdown) {
+  std::istringstream in(
+      "{\"id\": 1, \"command\": \"ping\"}\n"
+      "\n"
+      "{\"id\": 2, \"command\": \"shutdown\"}\n"
+      "{\"id\": 3, \"command\": \"ping\"}\n");
+  std::ostringstream out;
+  ASSERT_TRUE(server_.ServeStream(in, out).ok());
+  EXPECT_TRUE(server_.shutdown_requested());
+
+  std::istringstream lines(out.str());
+  std::string line;
+  int responses = 0;
+  while (std::getline(lines, line)) {
+    ++responses;
+  }
+  EXPECT_EQ(responses, 2);
+}
+
+}  // namespace
+}  // namespace yaze::cli
@@ -0,0 +1,183 @@
+#include "cli/handlers/tools/doctor_pipeline.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rom/rom.h"
+#include "zelda3/dungeon/dungeon_rom_addresses.h"
+
+namespace yaze::cli {
+namespace {
+
+Rom MakeRom() {
+  Rom rom;
+  std::vector<uint8_t> data(0x10000, 0x00);
+  EXPECT_TRUE(rom.LoadFromData(data).ok());
+  return rom;
+}
+
+// Reports the byte at `offset` so results reveal which snapshot they saw.
+DoctorCheck ByteCheck(const std::string& id, uint32_t offset,
+                      std::atomic<int>* runs) {
+  return {id, 1, {{offset, offset + 1}},
+          [offset, runs](const DoctorSnapshot& snapshot,
+                         DoctorCheckResult& result) {
+            ++*runs;
+            result.metrics.emplace_back("value", snapshot.data()[offset]);
+          }};
+}
+
+class DoctorPipelineTest : public ::testing::Test {
+ protected:
+  void SetUp() override { DoctorPipeline::ClearCache(); }
+  void TearDown() override { DoctorPipeline::ClearCache(); }
+};
+
+TEST_F(DoctorPipelineTest, RerunsOnlyChecksWhoseInputsChanged) {
+  Rom rom = MakeRom();
+  std::atomic<int> low_runs{0};
+  std::atomic<int> high_runs{0};
+  std::atomic<int> whole_runs{0};
+
+  DoctorPipeline pipeline;
+  pipeline.AddCheck(ByteCheck("low", 0x100, &low_runs))
+      .AddCheck(ByteCheck("high", 0x8000, &high_runs))
+      .AddCheck({"whole", 1, {},
+                 [&whole_runs](const DoctorSnapshot&, DoctorCheckResult&) {
+                   ++whole_runs;
+                 }});
+
+  auto first = pipeline.Run(DoctorSnapshot(rom));
+  ASSERT_EQ(first.size(), 3u);
+  EXPECT_FALSE(first[0].cached);
+  EXPECT_EQ(DoctorPipeline::CacheSize(), 3u);
+
+  auto second = pipeline.Run(DoctorSnapshot(rom));
+  EXPECT_TRUE(second[0].cached);
+  EXPECT_TRUE(second[1].cached);
+  EXPECT_TRUE(second[2].cached);
+  EXPECT_EQ(low_runs, 1);
+  EXPECT_EQ(whole_runs, 1);
+
+  ASSERT_TRUE(rom.WriteByte(0x8000, 0x42).ok());
+  auto third = pipeline.Run(DoctorSnapshot(rom));
+  EXPECT_TRUE(third[0].cached);
+  EXPECT_FALSE(third[1].cached);
+  EXPECT_FALSE(third[2].cached);
+  EXPECT_EQ(low_runs, 1);
+  EXPECT_EQ(high_runs, 2);
+  EXPECT_EQ(whole_runs, 2);
+  ASSERT_NE(third[1].FindMetric("value"), nullptr);
+  EXPECT_EQ(*third[1].FindMetric("value"), 0x42);
+
+  // A new check version invalidates its cached result.
+  DoctorPipeline bumped;
+  DoctorCheck check = ByteCheck("low", 0x100, &low_runs);
+  check.version = 2;
+  bumped.AddCheck(check);
+  EXPECT_FALSE(bumped.Run(DoctorSnapshot(rom))[0].cached);
+  EXPECT_EQ(low_runs, 2);
+}
+
+TEST_F(DoctorPipelineTest, ParallelResultsKeepRegistrationOrder) {
+  Rom rom = MakeRom();
+  for (uint32_t i = 0; i < 64; ++i) {
+    ASSERT_TRUE(rom.WriteByte(0x200 + i, static_cast<uint8_t>(i)).ok());
+  }
+
+  std::atomic<int> runs{0};
+  DoctorPipeline pipeline;
+  for (uint32_t i = 0; i < 64; ++i) {
+    pipeline.AddCheck(ByteCheck("byte_" + std::to_string(i), 0x200 + i, &runs));
+  }
+  pipeline.AddCheck({"throws", 1, {{0, 1}},
+                     [](const DoctorSnapshot&, DoctorCheckResult&) {
+                       throw std::runtime_error("boom");
+                     }});
+
+  DoctorSnapshot snapshot(rom);
+  // The snapshot is a copy: later edits to the ROM do not leak into it.
+  ASSERT_TRUE(rom.WriteByte(0x200, 0xFF).ok());
+
+  auto results = pipeline.Run(snapshot, {.worker_count = 8, .use_cache = false});
+  ASSERT_EQ(results.size(), 65u);
+  EXPECT_EQ(runs, 64);
+  for (int i = 0; i < 64; ++i) {
+    EXPECT_EQ(results[i].check_id, "byte_" + std::to_string(i));
+    ASSERT_NE(results[i].FindMetric("value"), nullptr);
+    EXPECT_EQ(*results[i].FindMetric("value"), i);
+  }
+  ASSERT_EQ(results[64].findings.size(), 1u);
+  EXPECT_EQ(results[64].findings[0].id, "doctor_check_failed");
+  EXPECT_EQ(DoctorPipeline::CacheSize(), 0u);
+}
+
+TEST_F(DoctorPipelineTest, SingleWorkerRunsChecksOnTheCaller) {
+  Rom rom = MakeRom();
+  const std::thread::id caller = std::this_thread::get_id();
+  std::atomic<int> off_caller{0};
+
+  DoctorPipeline pipeline;
+  for (int i = 0; i < 8; ++i) {
+    pipeline.AddCheck({"check_" + std::to_string(i), 1, {{0, 1}},
+                       [&](const DoctorSnapshot&, DoctorCheckResult&) {
+                         if (std::this_thread::get_id() != caller) {
+                           ++off_caller;
+                         }
+                       }});
+  }
+
+  DoctorSnapshot snapshot(rom);
+  auto results =
+      pipeline.Run(snapshot, {.worker_count = 1, .use_cache = false});
+  EXPECT_EQ(results.size(), 8u);
+  EXPECT_EQ(off_caller, 0);
+}
+
+TEST_F(DoctorPipelineTest, SheetsAreDecodedOnceForAllChecks) {
+  Rom rom = MakeRom();
+  // Sheet 0 points at $01:9000 (PC 0x9000): copy 0xAB 0xCD, then end.
+  const uint32_t table = zelda3::kGfxGroupsPointer;
+  ASSERT_TRUE(rom.WriteByte(table, 0x01).ok());
+  ASSERT_TRUE(rom.WriteByte(table + 0x100, 0x90).ok());
+  ASSERT_TRUE(rom.WriteByte(table + 0x200, 0x00).ok());
+  ASSERT_TRUE(rom.WriteByte(0x9000, 0x01).ok());
+  ASSERT_TRUE(rom.WriteByte(0x9001, 0xAB).ok());
+  ASSERT_TRUE(rom.WriteByte(0x9002, 0xCD).ok());
+  ASSERT_TRUE(rom.WriteByte(0x9003, 0xFF).ok());
+
+  DoctorSnapshot snapshot(rom);
+  std::vector<const std::vector<DoctorSheet>*> seen(16, nullptr);
+  DoctorPipeline pipeline;
+  for (int i = 0; i < 16; ++i) {
+    pipeline.AddCheck({"sheets_" + std::to_string(i), 1, {},
+                       [&seen, i](const DoctorSnapshot& snapshot,
+                                  DoctorCheckResult&) {
+                         seen[i] = &snapshot.sheets();
+                       }});
+  }
+  pipeline.Run(snapshot, {.worker_count = 4, .use_cache = false});
+
+  const std::vector<DoctorSheet>& sheets = snapshot.sheets();
+  for (const auto* view : seen) {
+    EXPECT_EQ(view, &sheets);
+  }
+  ASSERT_EQ(sheets.size(), 223u);
+  EXPECT_EQ(sheets[0].address, 0x9000u);
+  ASSERT_TRUE(sheets[0].status.ok()) << sheets[0].status;
+  ASSERT_GE(sheets[0].data.size(), 2u);
+  EXPECT_EQ(sheets[0].data[0], 0xAB);
+  EXPECT_EQ(sheets[0].data[1], 0xCD);
+  // Zeroed pointers are reported, not decoded.
+  EXPECT_EQ(sheets[1].address, 0u);
+  EXPECT_TRUE(absl::IsOutOfRange(sheets[1].status));
+}
+
+}  // namespace
+}  // namespace yaze::cli
@@ -22,6 +22,7 @@
 #include "zelda3/dungeon/custom_collision.h"
 #include "zelda3/dungeon/dungeon_rom_addresses.h"
 #include "zelda3/dungeon/room.h"
+#include "zelda3/dungeon/room_entrance.h"
 #include "zelda3/dungeon/room_object.h"
 
 #if !defined(_WIN32)
@@ -350,10 +351,9 @@ TEST(DungeonTrackCollisionCommandsTest,
       {"--rooms=0x00,0x01", "--write", "--format=json"}, &rom, &output);
 
   EXPECT_TRUE(absl::IsResourceExhausted(status)) << status;
-  EXPECT_THAT(std::string(status.message()),
-              HasSubstr("Write failed for room 0x001"));
-  EXPECT_THAT(output, HasSubstr("\"write_status\": \"success\""));
+  EXPECT_THAT(std::string(status.message()), HasSubstr("room 0x001"));
   EXPECT_THAT(output, HasSubstr("\"write_error\""));
+  EXPECT_THAT(output, ::testing::Not(HasSubstr("\"write_status\"")));
   EXPECT_EQ(rom.vector(), before);
   EXPECT_FALSE(rom.dirty());
   EXPECT_EQ(ReadFile(cleanup.rom_path), disk_before);
@@ -397,5 +397,43 @@ TEST(DungeonTrackCollisionCommandsTest,
   ExpectValidJson(output);
 }
 
+TEST(DungeonTrackCollisionCommandsTest, DungeonSelectorWritesOnlyItsRooms) {
+  Rom rom;
+  InitializeTrackCollisionRom(&rom);
+  // Entrance 1 leads into room 1 of dungeon 0x02; every other entrance leads
+  // into room 0 of dungeon 0x00.
+  ASSERT_TRUE(rom.WriteWord(zelda3::kEntranceRoom + 2, 0x0001).ok());
+  ASSERT_TRUE(rom.WriteByte(zelda3::kEntranceDungeon + 1, 0x02).ok());
+  rom.set_dirty(false);
+
+  handlers::DungeonGenerateTrackCollisionCommandHandler handler;
+  std::string output;
+  const absl::Status status = handler.Run(
+      {"--mock-rom", "--dungeon=0x02", "--write", "--format=json"}, &rom,
+      &output);
+
+  ASSERT_TRUE(status.ok()) << status;
+  EXPECT_THAT(output, HasSubstr("\"room_count\": 1"));
+  auto room0 = zelda3::LoadCustomCollisionMap(&rom, 0);
+  auto room1 = zelda3::LoadCustomCollisionMap(&rom, 1);
+  ASSERT_TRUE(room0.ok()) << room0.status();
+  ASSERT_TRUE(room1.ok()) << room1.status();
+  EXPECT_FALSE(room0->has_data);
+  EXPECT_TRUE(room1->has_data);
+  ExpectValidJson(output);
+}
+
+TEST(DungeonTrackCollisionCommandsTest, DungeonSelectorRejectsUnknownDungeon) {
+  Rom rom;
+  InitializeTrackCollisionRom(&rom);
+
+  handlers::DungeonGenerateTrackCollisionCommandHandler handler;
+  std::string output;
+  const absl::Status status =
+      handler.Run({"--dungeon=0x1F", "--format=json"}, &rom, &output);
+
+  EXPECT_TRUE(absl::IsNotFound(status)) << status;
+}
+
 }  // namespace
 }  // namespace yaze::cli
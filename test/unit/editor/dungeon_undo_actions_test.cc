@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 namespace yaze::editor {
 namespace {
 
@@ -63,5 +65,64 @@ TEST(DungeonUndoActionsTest, WaterFillUndoRedoRestoresSnapshot) {
   EXPECT_EQ(restored.offsets, after.offsets);
 }
 
+std::vector<int> ObjectXs(const std::vector<zelda3::RoomObject>& objects) {
+  std::vector<int> xs;
+  for (const auto& object : objects) {
+    xs.push_back(object.x());
+  }
+  return xs;
+}
+
+TEST(DungeonUndoActionsTest, ObjectsActionUndoesMoveFromCurrentRoomState) {
+  std::vector<zelda3::RoomObject> room;
+  for (int i = 0; i < 100; ++i) {
+    room.emplace_back(/*id=*/0x21, /*x=*/i % 64, /*y=*/i / 64, /*size=*/0);
+  }
+  const std::vector<zelda3::RoomObject> before = room;
+  room[42].set_x(5);
+  const std::vector<zelda3::RoomObject> after = room;
+
+  DungeonObjectsAction action(
+      /*room_id=*/0x10, before, /*before_selection=*/{42}, after,
+      /*after_selection=*/{42},
+      [&](int, const std::vector<zelda3::RoomObject>& objects,
+          const std::vector<size_t>&) { room = objects; },
+      [&](int) { return room; });
+
+  // Only the moved object is stored, not two copies of the room.
+  EXPECT_LT(action.MemoryUsage(), 4 * sizeof(zelda3::RoomObject));
+
+  ASSERT_TRUE(action.Undo().ok());
+  EXPECT_EQ(ObjectXs(room), ObjectXs(before));
+  ASSERT_TRUE(action.Redo().ok());
+  EXPECT_EQ(ObjectXs(room), ObjectXs(after));
+}
+
+TEST(DungeonUndoActionsTest, ObjectsActionUndoesInsertAndDelete) {
+  std::vector<zelda3::RoomObject> room;
+  for (int i = 0; i < 6; ++i) {
+    room.emplace_back(/*id=*/0x21, /*x=*/i, /*y=*/0, /*size=*/0);
+  }
+  const std::vector<zelda3::RoomObject> before = room;
+  room.erase(room.begin() + 2);
+  room.insert(room.begin() + 4, zelda3::RoomObject(0x22, 40, 1, 0));
+  const std::vector<zelda3::RoomObject> after = room;
+
+  DungeonObjectsAction action(
+      /*room_id=*/0x11, before, {}, after, {},
+      [&](int, const std::vector<zelda3::RoomObject>& objects,
+          const std::vector<size_t>&) { room = objects; },
+      [&](int) { return room; });
+
+  ASSERT_TRUE(action.Undo().ok());
+  EXPECT_EQ(ObjectXs(room), ObjectXs(before));
+  ASSERT_TRUE(action.Redo().ok());
+  EXPECT_EQ(ObjectXs(room), ObjectXs(after));
+
+  // A room changed outside the history is reported, not clobbered.
+  room.pop_back();
+  EXPECT_FALSE(action.Undo().ok());
+}
+
 }  // namespace
 }  // namespace yaze::editor
@@ -2216,6 +2216,50 @@ TEST(GraphicsSaveStoplossTest, PixelUndoAndRedoRemarkTheSheetDirty) {
   EXPECT_TRUE(state.modified_sheets.contains(kSheetId));
 }
 
+TEST(GraphicsSaveStoplossTest, PixelUndoRefusesSheetChangedOutsideHistory) {
+  constexpr uint16_t kSheetId = 0x20;
+  const std::vector<uint8_t> before_data = {0x01, 0x02, 0x03, 0x04};
+  const std::vector<uint8_t> after_data = {0x05, 0x06, 0x07, 0x08};
+  const std::vector<uint8_t> reloaded_data = {0x05, 0x06, 0x00, 0x08};
+
+  GraphicsEditorState state;
+  auto& sheet = gfx::Arena::Get().mutable_gfx_sheets()->at(kSheetId);
+  ScopedGraphicsSheetRestore restore_sheet(&sheet);
+  sheet.set_data(reloaded_data);
+
+  GraphicsPixelEditAction action(
+      kSheetId, before_data, after_data, "Edit pixels",
+      [&state](uint16_t sheet_id) { state.MarkSheetModified(sheet_id); });
+
+  EXPECT_TRUE(absl::IsFailedPrecondition(action.Undo()));
+  EXPECT_EQ(sheet.vector(), reloaded_data);
+  EXPECT_FALSE(state.HasUnsavedChanges());
+
+  // Redo expects the before state, so it is refused on the after state.
+  sheet.set_data(after_data);
+  EXPECT_TRUE(absl::IsFailedPrecondition(action.Redo()));
+  EXPECT_EQ(sheet.vector(), after_data);
+}
+
+TEST(GraphicsSaveStoplossTest, OnlyPixelEditsMarkSheetsPendingSave) {
+  constexpr int kSheetId = 0x21;
+  auto& arena = gfx::Arena::Get();
+  arena.ClearSheetsPendingSave();
+
+  // Palette and gfx group previews only redraw the sheet.
+  arena.NotifySheetModified(kSheetId);
+  EXPECT_FALSE(arena.IsSheetPendingSave(kSheetId));
+  EXPECT_TRUE(arena.GetSheetsPendingSave().empty());
+
+  arena.NotifySheetPixelsModified(kSheetId);
+  EXPECT_TRUE(arena.IsSheetPendingSave(kSheetId));
+  EXPECT_EQ(arena.GetSheetsPendingSave(),
+            std::vector<uint16_t>{static_cast<uint16_t>(kSheetId)});
+
+  arena.ClearSheetsPendingSave();
+  EXPECT_FALSE(arena.IsSheetPendingSave(kSheetId));
+}
+
 TEST(ScreenSaveStoplossTest,
      PendingQueryDoesNotMaterializeTheLazyScreenEditor) {
   EditorSet editor_set;
@@ -530,8 +530,7 @@ TEST_F(TileObjectHandlerTest,
   rooms_.SetRom(&rom);
   rooms_[0].SetLoaded(true);
   ctx_.rom = &rom;
-  auto& room_gfx =
-      const_cast<std::array<uint8_t, 0x10000>&>(rooms_[0].get_gfx_buffer());
+  auto& room_gfx = rooms_[0].mutable_gfx_buffer_for_testing();
   room_gfx.fill(1);
   rooms_[0].bg1_buffer().EnsureBitmapInitialized();
   std::vector<SDL_Color> room_palette(256);
@@ -587,8 +586,7 @@ TEST_F(TileObjectHandlerTest,
   ASSERT_TRUE(rom_.LoadFromData(std::vector<uint8_t>(0x200000, 0)).ok());
   rooms_.SetRom(&rom_);
   rooms_[0].SetLoaded(true);
-  auto& room_gfx =
-      const_cast<std::array<uint8_t, 0x10000>&>(rooms_[0].get_gfx_buffer());
+  auto& room_gfx = rooms_[0].mutable_gfx_buffer_for_testing();
   room_gfx.fill(1);
   rooms_[0].bg1_buffer().EnsureBitmapInitialized();
 
@@ -2,6 +2,9 @@
 
 #include <memory>
 #include <string>
+#include <vector>
+
+#include "app/editor/registry/undo_delta.h"
 
 #include <gtest/gtest.h>
 
@@ -42,6 +45,17 @@ class IntAction : public UndoAction {
   std::string desc_;
 };
 
+class SizedAction final : public IntAction {
+ public:
+  SizedAction(int* target, int before, int after, size_t bytes)
+      : IntAction(target, before, after, "Sized"), bytes_(bytes) {}
+
+  size_t MemoryUsage() const override { return bytes_; }
+
+ private:
+  size_t bytes_;
+};
+
 class MergeableIntAction final : public IntAction {
  public:
   using IntAction::IntAction;
@@ -141,4 +155,72 @@ TEST(UndoManagerTest, MergeReplacesPreviousUndoAction) {
   EXPECT_EQ(value, 2);
 }
 
+TEST(UndoManagerTest, EvictsOldestActionsOverMemoryBudget) {
+  int value = 0;
+  UndoManager mgr;
+  mgr.SetMemoryBudget(1000);
+
+  for (int i = 1; i <= 5; ++i) {
+    value = i;
+    mgr.Push(std::make_unique<SizedAction>(&value, i - 1, i, /*bytes=*/300));
+  }
+
+  // Only three 300-byte steps fit in 1000 bytes.
+  EXPECT_EQ(mgr.UndoStackSize(), 3u);
+  EXPECT_EQ(mgr.MemoryUsage(), 900u);
+
+  // Undone steps still count while they sit on the redo stack.
+  ASSERT_TRUE(mgr.Undo().ok());
+  EXPECT_EQ(mgr.MemoryUsage(), 900u);
+  EXPECT_EQ(mgr.RedoStackSize(), 1u);
+
+  // A new push clears the redo bytes.
+  value = 9;
+  mgr.Push(std::make_unique<SizedAction>(&value, 4, 9, /*bytes=*/100));
+  EXPECT_EQ(mgr.RedoStackSize(), 0u);
+  EXPECT_EQ(mgr.MemoryUsage(), 700u);
+
+  // An oversized action evicts everything else but stays undoable itself.
+  value = 10;
+  mgr.Push(std::make_unique<SizedAction>(&value, 9, 10, /*bytes=*/5000));
+  EXPECT_EQ(mgr.UndoStackSize(), 1u);
+  ASSERT_TRUE(mgr.Undo().ok());
+  EXPECT_EQ(value, 9);
+
+  mgr.Clear();
+  EXPECT_EQ(mgr.MemoryUsage(), 0u);
+}
+
+TEST(XorRleDeltaTest, TogglesBetweenStatesAndStaysCompact) {
+  std::vector<uint8_t> before(4096, 0x11);
+  std::vector<uint8_t> after = before;
+  after[10] = 0x22;
+  after[11] = 0x23;
+  after[3000] = 0x00;
+
+  const XorRleDelta delta = XorRleDelta::Encode(before, after);
+  EXPECT_LT(delta.encoded_size(), 16u);
+
+  std::vector<uint8_t> data = after;
+  ASSERT_TRUE(delta.Apply(data).ok());
+  EXPECT_EQ(data, before);
+  ASSERT_TRUE(delta.Apply(data).ok());
+  EXPECT_EQ(data, after);
+
+  std::vector<uint8_t> wrong_size(100, 0);
+  EXPECT_FALSE(delta.Apply(wrong_size).ok());
+}
+
+TEST(XorRleDeltaTest, RoundTripsResizedBuffers) {
+  const std::vector<uint8_t> before = {1, 2, 3, 4, 5, 6};
+  const std::vector<uint8_t> after = {1, 2, 9};
+
+  const XorRleDelta delta = XorRleDelta::Encode(before, after);
+  std::vector<uint8_t> data = after;
+  ASSERT_TRUE(delta.Apply(data).ok());
+  EXPECT_EQ(data, before);
+  ASSERT_TRUE(delta.Apply(data).ok());
+  EXPECT_EQ(data, after);
+}
+
 }  // namespace yaze::editor
@@ -0,0 +1,146 @@
+#include "app/gfx/types/color_index_lut.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace yaze::gfx {
+namespace {
+
+constexpr uint16_t Snes(int r, int g, int b) {
+  return static_cast<uint16_t>(r | (g << 5) | (b << 10));
+}
+
+TEST(ColorIndexLutTest, ExactColorsMapToTheirIndex) {
+  const std::vector<uint16_t> colors = {Snes(0, 0, 0), Snes(31, 0, 0),
+                                        Snes(0, 31, 0), Snes(0, 0, 31),
+                                        Snes(31, 31, 31)};
+  ColorIndexLut lut;
+  lut.SetColors(colors);
+  for (size_t i = 0; i < colors.size(); ++i) {
+    EXPECT_EQ(lut.Lookup(colors[i]), i);
+  }
+}
+
+TEST(ColorIndexLutTest, UnknownColorsMapToNearestEntry) {
+  const std::vector<uint16_t> colors = {Snes(0, 0, 0), Snes(31, 0, 0),
+                                        Snes(0, 31, 0), Snes(31, 31, 31)};
+  ColorIndexLut lut;
+  lut.SetColors(colors);
+  EXPECT_EQ(lut.Lookup(Snes(28, 2, 1)), 1);
+  EXPECT_EQ(lut.Lookup(Snes(3, 27, 4)), 2);
+  EXPECT_EQ(lut.Lookup(Snes(25, 26, 29)), 3);
+  EXPECT_EQ(lut.Lookup(Snes(2, 1, 3)), 0);
+  // Bit 15 is ignored
+  EXPECT_EQ(lut.Lookup(0x8000 | Snes(31, 0, 0)), 1);
+}
+
+TEST(ColorIndexLutTest, DuplicateColorsResolveToLaterEntry) {
+  ColorIndexLut lut;
+  lut.SetColors(std::vector<uint16_t>{Snes(5, 5, 5), Snes(9, 9, 9),
+                                      Snes(5, 5, 5)});
+  EXPECT_EQ(lut.Lookup(Snes(5, 5, 5)), 2);
+}
+
+TEST(ColorIndexLutTest, PaletteChangeDropsResolvedEntries) {
+  ColorIndexLut lut;
+  lut.SetColors(std::vector<uint16_t>{Snes(0, 0, 0), Snes(31, 0, 0)});
+  EXPECT_EQ(lut.Lookup(Snes(30, 0, 0)), 1);
+  EXPECT_EQ(lut.resolved_count(), 1u);
+
+  // Same colors keep the table warm
+  lut.SetColors(std::vector<uint16_t>{Snes(0, 0, 0), Snes(31, 0, 0)});
+  EXPECT_EQ(lut.resolved_count(), 1u);
+
+  lut.SetColors(std::vector<uint16_t>{Snes(31, 0, 0), Snes(0, 0, 0)});
+  EXPECT_EQ(lut.resolved_count(), 0u);
+  EXPECT_EQ(lut.Lookup(Snes(30, 0, 0)), 0);
+}
+
+TEST(ColorIndexLutTest, EmptyPaletteMapsToZero) {
+  ColorIndexLut lut;
+  EXPECT_EQ(lut.Lookup(Snes(12, 3, 7)), 0);
+}
+
+TEST(ColorIndexLutTest, QuantizeToPaletteConvertsRgbaImage) {
+  ColorIndexLut lut;
+  lut.SetColors(std::vector<uint16_t>{Snes(0, 0, 0), Snes(31, 0, 0),
+                                      Snes(0, 31, 0), Snes(0, 0, 31)});
+
+  // Larger than one internal chunk so the chunk boundary is exercised
+  constexpr int kPixels = 128 * 128;
+  std::vector<uint8_t> rgba(kPixels * 4);
+  std::vector<uint8_t> expected(kPixels);
+  for (int i = 0; i < kPixels; ++i) {
+    const int pick = i % 5;
+    uint8_t* px = &rgba[i * 4];
+    px[3] = 0xFF;
+    switch (pick) {
+      case 0:
+        px[0] = 250;  // Red
+        expected[i] = 1;
+        break;
+      case 1:
+        px[1] = 240;  // Green
+        expected[i] = 2;
+        break;
+      case 2:
+        px[2] = 255;  // Blue
+        expected[i] = 3;
+        break;
+      case 3:
+        px[0] = px[1] = px[2] = 10;  // Near black
+        expected[i] = 0;
+        break;
+      default:
+        px[0] = 255;
+        px[3] = 0x10;  // Transparent
+        expected[i] = 7;
+        break;
+    }
+  }
+
+  std::vector<uint8_t> indices(kPixels, 0xEE);
+  ASSERT_TRUE(lut.QuantizeToPalette(rgba, indices, 7).ok());
+  EXPECT_EQ(indices, expected);
+}
+
+TEST(ColorIndexLutTest, QuantizeToPaletteMatchesPerPixelLookup) {
+  std::vector<uint16_t> colors;
+  for (int i = 0; i < 16; ++i) {
+    colors.push_back(Snes((i * 7) % 32, (i * 13) % 32, (i * 3) % 32));
+  }
+  ColorIndexLut lut;
+  lut.SetColors(colors);
+
+  // Not a multiple of the SIMD width, so the scalar tail runs too.
+  constexpr int kPixels = 128 * 128 + 5;
+  std::vector<uint8_t> rgba(kPixels * 4);
+  uint32_t state = 0x2545F491;
+  for (auto& byte : rgba) {
+    state = state * 1664525u + 1013904223u;
+    byte = static_cast<uint8_t>(state >> 24);
+  }
+
+  std::vector<uint8_t> indices(kPixels);
+  ASSERT_TRUE(lut.QuantizeToPalette(rgba, indices, 0xAA).ok());
+  for (int i = 0; i < kPixels; ++i) {
+    const uint8_t* px = &rgba[i * 4];
+    const uint16_t key = ColorIndexLut::RgbToSnes(px[0], px[1], px[2]);
+    const uint8_t expected = px[3] < 0x80 ? 0xAA : lut.Lookup(key);
+    ASSERT_EQ(indices[i], expected) << "pixel " << i;
+  }
+}
+
+TEST(ColorIndexLutTest, QuantizeToPaletteRejectsBadBuffers) {
+  ColorIndexLut lut;
+  std::vector<uint8_t> indices(4);
+  std::vector<uint8_t> ragged(7);
+  EXPECT_FALSE(lut.QuantizeToPalette(ragged, indices).ok());
+  std::vector<uint8_t> too_big(4 * 5);
+  EXPECT_FALSE(lut.QuantizeToPalette(too_big, indices).ok());
+}
+
+}  // namespace
+}  // namespace yaze::gfx
@@ -3,6 +3,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 
@@ -16,6 +17,7 @@ namespace test {
 
 using yaze::Rom;
 using yaze::gfx::lc_lz2::CompressionContext;
+using yaze::gfx::lc_lz2::CompressedStreamSize;
 using yaze::gfx::lc_lz2::CompressionPiece;
 using yaze::gfx::lc_lz2::CompressV2;
 using yaze::gfx::lc_lz2::CompressV3;
@@ -434,5 +436,77 @@ TEST(LC_LZ2_CompressionTest, DecompressionMixingCommand) {
   EXPECT_THAT(random1_o, ElementsAreArray(decomp_result.data(), 9));
 }
 
+TEST(LC_LZ2_CompressionTest, CompressedStreamSizeCountsThroughTerminator) {
+  // Leading and trailing padding around the same stream as above
+  std::vector<uint8_t> data = {0x55,
+                               BUILD_HEADER(0x01, 0x03),
+                               0x2A,
+                               BUILD_HEADER(0x00, 0x04),
+                               0x01,
+                               0x02,
+                               0x03,
+                               0x04,
+                               BUILD_HEADER(0x02, 0x02),
+                               0x0B,
+                               0x16,
+                               0xFF,
+                               0x77,
+                               0x77};
+  auto size = CompressedStreamSize(data.data(), 1, data.size());
+  ASSERT_TRUE(size.ok());
+  EXPECT_EQ(*size, 11u);
+}
+
+TEST(LC_LZ2_CompressionTest, CompressedStreamSizeMatchesCompressorOutput) {
+  constexpr int kSheetSize = 0x800;
+  // HyruleMagicCompress looks ahead past the end of its input, so keep the
+  // buffer larger than the range being compressed.
+  std::vector<uint8_t> sheet(kSheetSize * 2);
+  for (int i = 0; i < kSheetSize; ++i) {
+    sheet[i] = static_cast<uint8_t>((i % 96 < 32) ? i * 7 : i / 64);
+  }
+  int compressed_size = 0;
+  auto compressed = gfx::HyruleMagicCompress(sheet.data(), kSheetSize,
+                                             &compressed_size, 1);
+  compressed.resize(compressed_size);
+  compressed.push_back(0xAA);  // Trailing data must not be counted
+
+  auto size = CompressedStreamSize(compressed.data(), 0, compressed.size());
+  ASSERT_TRUE(size.ok());
+  EXPECT_EQ(*size, static_cast<size_t>(compressed_size));
+}
+
+TEST(LC_LZ2_CompressionTest, HyruleMagicSplitsRunsLongerThanMaxLength) {
+  constexpr int kSheetSize = 0x800;
+  std::vector<uint8_t> blank(kSheetSize * 2, 0);
+  std::vector<uint8_t> noise(kSheetSize * 2, 0);
+  uint32_t state = 1;
+  for (int i = 0; i < kSheetSize; ++i) {
+    state = state * 1664525u + 1013904223u;
+    noise[i] = static_cast<uint8_t>(state >> 24);
+  }
+
+  for (const auto* input : {&blank, &noise}) {
+    int compressed_size = 0;
+    auto compressed = gfx::HyruleMagicCompress(input->data(), kSheetSize,
+                                               &compressed_size, 1);
+    auto size = CompressedStreamSize(compressed.data(), 0, compressed.size());
+    ASSERT_TRUE(size.ok()) << size.status();
+    EXPECT_EQ(*size, static_cast<size_t>(compressed_size));
+
+    auto decompressed = DecompressV2(compressed.data(), 0, kSheetSize, 1,
+                                     compressed.size());
+    ASSERT_TRUE(decompressed.ok()) << decompressed.status();
+    EXPECT_TRUE(std::equal(input->begin(), input->begin() + kSheetSize,
+                           decompressed->begin()));
+  }
+}
+
+TEST(LC_LZ2_CompressionTest, CompressedStreamSizeRejectsUnterminatedStream) {
+  std::vector<uint8_t> data = {BUILD_HEADER(0x00, 0x04), 0x01, 0x02, 0x03};
+  EXPECT_FALSE(CompressedStreamSize(data.data(), 0, data.size()).ok());
+  EXPECT_FALSE(CompressedStreamSize(data.data(), 8, data.size()).ok());
+}
+
 }  // namespace test
 }  // namespace yaze
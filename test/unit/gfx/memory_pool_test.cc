@@ -0,0 +1,137 @@
+#include "app/gfx/resource/memory_pool.h"
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace yaze::gfx {
+namespace {
+
+TEST(MemoryPoolTest, AllocationsAreDistinctAndWritable) {
+  auto& pool = MemoryPool::Get();
+  std::vector<void*> blocks;
+  std::set<void*> unique;
+  for (int i = 0; i < 256; ++i) {
+    void* ptr = pool.Allocate(512);
+    ASSERT_NE(ptr, nullptr);
+    std::memset(ptr, i & 0xFF, 512);
+    blocks.push_back(ptr);
+    unique.insert(ptr);
+  }
+  EXPECT_EQ(unique.size(), blocks.size());
+  for (void* ptr : blocks) {
+    pool.Deallocate(ptr);
+  }
+}
+
+TEST(MemoryPoolTest, BlockSizeMatchesSizeClass) {
+  auto& pool = MemoryPool::Get();
+  void* small = pool.Allocate(64);
+  void* medium = pool.Allocate(2048);
+  void* huge = pool.Allocate(MemoryPool::kHugeBlockSize);
+  void* system = pool.Allocate(MemoryPool::kHugeBlockSize + 1);
+
+  EXPECT_EQ(MemoryPool::GetBlockSize(small), MemoryPool::kSmallBlockSize);
+  EXPECT_EQ(MemoryPool::GetBlockSize(medium), MemoryPool::kMediumBlockSize);
+  EXPECT_EQ(MemoryPool::GetBlockSize(huge), MemoryPool::kHugeBlockSize);
+  EXPECT_EQ(MemoryPool::GetBlockSize(system), MemoryPool::kHugeBlockSize + 1);
+
+  for (void* ptr : {small, medium, huge, system}) {
+    pool.Deallocate(ptr);
+  }
+}
+
+TEST(MemoryPoolTest, DeallocatedBlockIsReused) {
+  auto& pool = MemoryPool::Get();
+  void* first = pool.Allocate(MemoryPool::kLargeBlockSize);
+  pool.Deallocate(first);
+  void* second = pool.Allocate(MemoryPool::kLargeBlockSize);
+  EXPECT_EQ(first, second);
+  pool.Deallocate(second);
+}
+
+TEST(MemoryPoolTest, SlabsGrowInsteadOfExhausting) {
+  auto& pool = MemoryPool::Get();
+  auto before = pool.GetSizeClassStats(3);
+  std::vector<void*> blocks;
+  for (size_t i = 0; i < before.total_blocks + 1; ++i) {
+    blocks.push_back(pool.Allocate(MemoryPool::kHugeBlockSize));
+  }
+  auto after = pool.GetSizeClassStats(3);
+  EXPECT_GT(after.total_blocks, before.total_blocks);
+  EXPECT_GT(after.slab_count, before.slab_count);
+  for (void* ptr : blocks) {
+    EXPECT_EQ(MemoryPool::GetBlockSize(ptr), MemoryPool::kHugeBlockSize);
+    pool.Deallocate(ptr);
+  }
+}
+
+TEST(MemoryPoolTest, AlignedAllocationHonorsAlignment) {
+  auto& pool = MemoryPool::Get();
+  for (size_t alignment : {16u, 32u, 64u, 256u, 4096u}) {
+    void* ptr = pool.AllocateAligned(300, alignment);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0u)
+        << "alignment " << alignment;
+    EXPECT_GE(MemoryPool::GetBlockSize(ptr), 300u);
+    std::memset(ptr, 0xAB, 300);
+    pool.Deallocate(ptr);
+  }
+  EXPECT_EQ(pool.AllocateAligned(16, 3), nullptr);
+}
+
+TEST(MemoryPoolTest, StatsTrackUsage) {
+  auto& pool = MemoryPool::Get();
+  auto [used_before, total_before] = pool.GetMemoryStats();
+  auto [allocs_before, frees_before] = pool.GetAllocationStats();
+
+  void* ptr = pool.Allocate(100);
+  auto [used_during, total_during] = pool.GetMemoryStats();
+  EXPECT_EQ(used_during, used_before + MemoryPool::kSmallBlockSize);
+  EXPECT_GE(total_during, total_before);
+
+  pool.Deallocate(ptr);
+  auto [used_after, total_after] = pool.GetMemoryStats();
+  auto [allocs_after, frees_after] = pool.GetAllocationStats();
+  EXPECT_EQ(used_after, used_before);
+  EXPECT_EQ(allocs_after, allocs_before + 1);
+  EXPECT_EQ(frees_after, frees_before + 1);
+}
+
+TEST(MemoryPoolTest, ThreadCachesReturnBlocksOnExit) {
+  auto& pool = MemoryPool::Get();
+  auto before = pool.GetSizeClassStats(1);
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; ++t) {
+    workers.emplace_back([&pool] {
+      pool.SetThreadCacheEnabled(true);
+      EXPECT_TRUE(pool.IsThreadCacheEnabled());
+      std::vector<void*> blocks;
+      for (int round = 0; round < 8; ++round) {
+        for (int i = 0; i < 100; ++i) {
+          blocks.push_back(pool.Allocate(MemoryPool::kMediumBlockSize));
+        }
+        for (void* ptr : blocks) {
+          pool.Deallocate(ptr);
+        }
+        blocks.clear();
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  auto after = pool.GetSizeClassStats(1);
+  EXPECT_EQ(after.total_blocks - after.free_blocks,
+            before.total_blocks - before.free_blocks);
+  EXPECT_FALSE(pool.IsThreadCacheEnabled());
+}
+
+}  // namespace
+}  // namespace yaze::gfx
@@ -0,0 +1,147 @@
+#include "app/gfx/render/tile_pixel_cache.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace yaze::gfx {
+namespace {
+
+// Two sheets of 8BPP data where every pixel encodes its (x, y) position so
+// flips are easy to verify.
+std::vector<uint8_t> MakeSheetBuffer(int sheets) {
+  std::vector<uint8_t> buffer(
+      static_cast<size_t>(sheets) * TilePixelCache::kSheetBytes);
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    const int x = static_cast<int>(i % 128) % 8;
+    const int y = static_cast<int>(i / 128) % 8;
+    buffer[i] = static_cast<uint8_t>((y << 3) | x);
+  }
+  return buffer;
+}
+
+TEST(TilePixelCacheTest, DecodesAllFlipVariants) {
+  auto buffer = MakeSheetBuffer(2);
+  TilePixelCache cache(2);
+
+  const uint8_t* plain = cache.GetTile(buffer.data(), buffer.size(), 1, 5,
+                                       TilePixelCache::FlipIndex(false, false));
+  const uint8_t* h = cache.GetTile(buffer.data(), buffer.size(), 1, 5,
+                                   TilePixelCache::FlipIndex(true, false));
+  const uint8_t* v = cache.GetTile(buffer.data(), buffer.size(), 1, 5,
+                                   TilePixelCache::FlipIndex(false, true));
+  const uint8_t* hv = cache.GetTile(buffer.data(), buffer.size(), 1, 5,
+                                    TilePixelCache::FlipIndex(true, true));
+  ASSERT_NE(plain, nullptr);
+  ASSERT_NE(h, nullptr);
+  ASSERT_NE(v, nullptr);
+  ASSERT_NE(hv, nullptr);
+
+  for (int y = 0; y < 8; ++y) {
+    for (int x = 0; x < 8; ++x) {
+      EXPECT_EQ(plain[y * 8 + x], (y << 3) | x);
+      EXPECT_EQ(h[y * 8 + x], (y << 3) | (7 - x));
+      EXPECT_EQ(v[y * 8 + x], ((7 - y) << 3) | x);
+      EXPECT_EQ(hv[y * 8 + x], ((7 - y) << 3) | (7 - x));
+    }
+  }
+  EXPECT_EQ(cache.stats().misses, 1u);
+  EXPECT_EQ(cache.stats().hits, 3u);
+}
+
+TEST(TilePixelCacheTest, ReadsTileFromSheetLayout) {
+  std::vector<uint8_t> buffer(2 * TilePixelCache::kSheetBytes, 0);
+  // Tile 17 of sheet 1 starts at row 8, column 8.
+  const size_t origin = TilePixelCache::kSheetBytes + 8 * 128 + 8;
+  buffer[origin] = 0x0A;
+  buffer[origin + 7 * 128 + 7] = 0x0B;
+
+  TilePixelCache cache(2);
+  const uint8_t* tile =
+      cache.GetTileById(buffer.data(), buffer.size(), 64 + 17, 0);
+  ASSERT_NE(tile, nullptr);
+  EXPECT_EQ(tile[0], 0x0A);
+  EXPECT_EQ(tile[63], 0x0B);
+}
+
+TEST(TilePixelCacheTest, ArenaSheetNotificationInvalidatesBoundSlots) {
+  auto buffer = MakeSheetBuffer(2);
+  TilePixelCache cache(2);
+  cache.BindSheet(0, 40);
+  cache.BindSheet(1, 41);
+
+  ASSERT_NE(cache.GetTile(buffer.data(), buffer.size(), 0, 0, 0), nullptr);
+  buffer[0] = 0xEE;
+  // Still served from the cache until the sheet is reported as modified.
+  EXPECT_EQ(cache.GetTile(buffer.data(), buffer.size(), 0, 0, 0)[0], 0x00);
+
+  TilePixelCache::NotifySheetModified(41);
+  EXPECT_EQ(cache.GetTile(buffer.data(), buffer.size(), 0, 0, 0)[0], 0x00);
+
+  TilePixelCache::NotifySheetModified(40);
+  EXPECT_EQ(cache.GetTile(buffer.data(), buffer.size(), 0, 0, 0)[0], 0xEE);
+}
+
+TEST(TilePixelCacheTest, ScopedUnregisteredCachesIgnoreNotifications) {
+  auto buffer = MakeSheetBuffer(1);
+  std::optional<TilePixelCache> cache;
+  {
+    TilePixelCache::ScopedUnregistered unregistered;
+    cache.emplace(1);
+  }
+  cache->BindSheet(0, 40);
+
+  ASSERT_NE(cache->GetTile(buffer.data(), buffer.size(), 0, 0, 0), nullptr);
+  buffer[0] = 0xEE;
+  TilePixelCache::NotifySheetModified(40);
+  EXPECT_EQ(cache->GetTile(buffer.data(), buffer.size(), 0, 0, 0)[0], 0x00);
+  EXPECT_EQ(cache->stats().invalidations, 0u);
+
+  // Caches created after the scope ends register again.
+  TilePixelCache registered(1);
+  registered.BindSheet(0, 40);
+  ASSERT_NE(registered.GetTile(buffer.data(), buffer.size(), 0, 0, 0),
+            nullptr);
+  TilePixelCache::NotifySheetModified(40);
+  EXPECT_EQ(registered.stats().invalidations, 1u);
+}
+
+TEST(TilePixelCacheTest, SwitchingSourceDropsDecodedTiles) {
+  auto first = MakeSheetBuffer(1);
+  std::vector<uint8_t> second(TilePixelCache::kSheetBytes, 0x05);
+  TilePixelCache cache(1);
+  EXPECT_EQ(cache.GetTile(first.data(), first.size(), 0, 0, 0)[9], 0x09);
+  EXPECT_EQ(cache.GetTile(second.data(), second.size(), 0, 0, 0)[9], 0x05);
+}
+
+TEST(TilePixelCacheTest, RejectsOutOfRangeLookups) {
+  auto buffer = MakeSheetBuffer(1);
+  TilePixelCache cache(2);
+  EXPECT_EQ(cache.GetTile(buffer.data(), buffer.size(), 2, 0, 0), nullptr);
+  EXPECT_EQ(cache.GetTile(buffer.data(), buffer.size(), 0, 64, 0), nullptr);
+  EXPECT_EQ(cache.GetTile(buffer.data(), buffer.size(), 0, 0, 4), nullptr);
+  // Sheet 1 is addressable but the buffer only holds one sheet.
+  EXPECT_EQ(cache.GetTile(buffer.data(), buffer.size(), 1, 0, 0), nullptr);
+}
+
+TEST(TilePixelCacheTest, RowHelpersMatchPerPixelSemantics) {
+  const uint8_t row_bytes[8] = {0x00, 0x01, 0x0F, 0x00, 0x7F, 0x80, 0xFF, 0x09};
+  const uint64_t row = TilePixelCache::LoadRow(row_bytes, 0);
+  const uint64_t mask = TilePixelCache::OpaqueMask(row);
+  const uint64_t shifted = TilePixelCache::AddToLanes(row, 0x70);
+
+  uint8_t mask_bytes[8];
+  uint8_t shifted_bytes[8];
+  TilePixelCache::StoreRow(mask_bytes, mask);
+  TilePixelCache::StoreRow(shifted_bytes, shifted);
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(mask_bytes[i], row_bytes[i] != 0 ? 0xFF : 0x00) << i;
+    EXPECT_EQ(shifted_bytes[i], static_cast<uint8_t>(row_bytes[i] + 0x70))
+        << i;
+  }
+}
+
+}  // namespace
+}  // namespace yaze::gfx
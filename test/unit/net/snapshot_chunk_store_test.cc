@@ -0,0 +1,108 @@
+#include "app/net/snapshot_chunk_store.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace yaze::net {
+namespace {
+
+std::vector<uint8_t> MakeImage(size_t size, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::vector<uint8_t> data(size);
+  for (size_t i = 0; i < size; ++i) {
+    // Half noise, half compressible runs
+    data[i] = (i / 1024) % 2 ? static_cast<uint8_t>(rng())
+                             : static_cast<uint8_t>(i / 256);
+  }
+  return data;
+}
+
+TEST(SnapshotChunkStoreTest, RoundTripsImages) {
+  SnapshotChunkStore store;
+  const auto image = MakeImage(64 * 1024 + 100, 1);
+  const auto ids = store.AddImage(image);
+  ASSERT_EQ(ids.size(), 17u);
+
+  auto restored = store.ReadImage(ids, image.size());
+  ASSERT_TRUE(restored.ok()) << restored.status().message();
+  EXPECT_EQ(*restored, image);
+  EXPECT_LT(store.stored_bytes(), image.size());
+}
+
+TEST(SnapshotChunkStoreTest, SharesUnchangedChunksBetweenSnapshots) {
+  SnapshotChunkStore store;
+  auto image = MakeImage(256 * 1024, 2);
+  size_t first_added = 0;
+  const auto first = store.AddImage(image, &first_added);
+  const size_t chunks_after_first = store.unique_chunks();
+
+  image[5000] ^= 0xFF;
+  image[200000] ^= 0xFF;
+  size_t second_added = 0;
+  const auto second = store.AddImage(image, &second_added);
+
+  EXPECT_EQ(store.unique_chunks(), chunks_after_first + 2);
+  EXPECT_GT(second_added, 0u);
+  EXPECT_LT(second_added * 20, first_added);
+
+  size_t differing = 0;
+  for (size_t i = 0; i < first.size(); ++i) {
+    differing += first[i] == second[i] ? 0 : 1;
+  }
+  EXPECT_EQ(differing, 2u);
+}
+
+TEST(SnapshotChunkStoreTest, ReleaseFreesOnlyUnreferencedChunks) {
+  SnapshotChunkStore store;
+  auto image = MakeImage(32 * 1024, 3);
+  const auto first = store.AddImage(image);
+  image[0] ^= 0x01;
+  const auto second = store.AddImage(image);
+  const size_t both = store.unique_chunks();
+
+  store.Release(first);
+  EXPECT_EQ(store.unique_chunks(), both - 1);
+  auto restored = store.ReadImage(second, image.size());
+  ASSERT_TRUE(restored.ok());
+  EXPECT_EQ(*restored, image);
+
+  store.Release(second);
+  EXPECT_EQ(store.unique_chunks(), 0u);
+  EXPECT_EQ(store.stored_bytes(), 0u);
+}
+
+TEST(SnapshotChunkStoreTest, SpillsOldChunksToDisk) {
+  const auto dir = std::filesystem::temp_directory_path() /
+                   "yaze_snapshot_chunk_store_test";
+  std::filesystem::remove_all(dir);
+  {
+    SnapshotChunkStore::Options options;
+    options.spill_directory = dir;
+    options.max_resident_bytes = 8 * 1024;
+    SnapshotChunkStore store(options);
+
+    const auto image = MakeImage(128 * 1024, 4);
+    const auto ids = store.AddImage(image);
+    EXPECT_LE(store.resident_bytes(), options.max_resident_bytes);
+    EXPECT_GT(store.spilled_bytes(), 0u);
+
+    auto restored = store.ReadImage(ids, image.size());
+    ASSERT_TRUE(restored.ok()) << restored.status().message();
+    EXPECT_EQ(*restored, image);
+  }
+  // Spill files go away with the store
+  EXPECT_TRUE(!std::filesystem::exists(dir) || std::filesystem::is_empty(dir));
+  std::filesystem::remove_all(dir);
+}
+
+TEST(SnapshotChunkStoreTest, UnknownChunkIsNotFound) {
+  SnapshotChunkStore store;
+  EXPECT_FALSE(store.ReadChunk({1, 2}).ok());
+}
+
+}  // namespace
+}  // namespace yaze::net
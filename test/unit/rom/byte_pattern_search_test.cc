@@ -0,0 +1,126 @@
+#include "rom/byte_pattern_search.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace yaze::test {
+
+namespace {
+
+std::vector<uint32_t> NaiveFind(const std::vector<uint8_t>& data,
+                                const rom::BytePattern& pattern) {
+  std::vector<uint32_t> matches;
+  for (size_t i = 0; i + pattern.size() <= data.size(); ++i) {
+    bool match = true;
+    for (size_t j = 0; j < pattern.size() && match; ++j) {
+      match = pattern.wildcard[j] || data[i + j] == pattern.bytes[j];
+    }
+    if (match) {
+      matches.push_back(static_cast<uint32_t>(i));
+    }
+  }
+  return matches;
+}
+
+// Low-entropy data so short patterns hit often.
+std::vector<uint8_t> MakeData(size_t size, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::vector<uint8_t> data(size);
+  for (auto& b : data) {
+    b = static_cast<uint8_t>(rng() % 4);
+  }
+  return data;
+}
+
+}  // namespace
+
+TEST(BytePatternSearchTest, ParsesWildcardsAndLabels) {
+  auto pattern = rom::ParseBytePattern("A9 ?? 8D ** 0x21");
+  ASSERT_TRUE(pattern.ok());
+  EXPECT_EQ(pattern->bytes, (std::vector<uint8_t>{0xA9, 0, 0x8D, 0, 0x21}));
+  EXPECT_EQ(pattern->wildcard,
+            (std::vector<bool>{false, true, false, true, false}));
+
+  EXPECT_FALSE(rom::ParseBytePattern("").ok());
+  EXPECT_FALSE(rom::ParseBytePattern("A9 1FF").ok());
+  EXPECT_FALSE(rom::ParseBytePattern("ZZ").ok());
+
+  auto list = rom::ParseBytePatternList(
+      "# signatures\n"
+      "\n"
+      "LoadRoom: 22 ?? ?? 01\n"
+      "A9 00\n");
+  ASSERT_TRUE(list.ok());
+  ASSERT_EQ(list->size(), 2u);
+  EXPECT_EQ((*list)[0].label, "LoadRoom");
+  EXPECT_EQ((*list)[0].size(), 4u);
+  EXPECT_TRUE((*list)[1].label.empty());
+
+  auto bad = rom::ParseBytePatternList("A9\nfoo: XX\n");
+  ASSERT_FALSE(bad.ok());
+  EXPECT_NE(bad.status().message().find("Line 2"), std::string::npos);
+}
+
+TEST(BytePatternSearchTest, HorspoolMatchesNaiveScan) {
+  const auto data = MakeData(20000, 7);
+  for (const char* text :
+       {"01", "?? 02", "00 01 02", "03 ?? ?? 00 01", "?? 00 01 02 03 ??",
+        "02 ?? 01 ?? 00", "?? ??", "00 00 00 00 00 00 00 00 00 00 00 00"}) {
+    auto pattern = rom::ParseBytePattern(text);
+    ASSERT_TRUE(pattern.ok()) << text;
+    rom::PatternSearcher searcher(*pattern);
+    EXPECT_EQ(searcher.FindAll(data), NaiveFind(data, *pattern)) << text;
+  }
+}
+
+TEST(BytePatternSearchTest, HorspoolHonorsMaxMatchesAndShortInput) {
+  const std::vector<uint8_t> data = {1, 2, 1, 2, 1, 2};
+  rom::PatternSearcher searcher(*rom::ParseBytePattern("01 02"));
+  EXPECT_EQ(searcher.FindAll(data, 2), (std::vector<uint32_t>{0, 2}));
+
+  rom::PatternSearcher too_long(*rom::ParseBytePattern("01 02 01 02 01 02 01"));
+  EXPECT_TRUE(too_long.FindAll(data).empty());
+}
+
+TEST(BytePatternSearchTest, MultiPatternMatchesPerPatternSearch) {
+  const auto data = MakeData(8000, 11);
+  std::mt19937 rng(3);
+  std::vector<rom::BytePattern> patterns;
+  for (int p = 0; p < 200; ++p) {
+    rom::BytePattern pattern;
+    const size_t length = 1 + rng() % 8;
+    for (size_t j = 0; j < length; ++j) {
+      const bool wildcard = rng() % 4 == 0;
+      pattern.bytes.push_back(wildcard ? 0 : static_cast<uint8_t>(rng() % 4));
+      pattern.wildcard.push_back(wildcard);
+    }
+    patterns.push_back(pattern);
+  }
+  patterns.push_back(patterns.front());  // Duplicate anchors are fine
+
+  std::vector<rom::PatternMatch> expected;
+  for (uint32_t p = 0; p < patterns.size(); ++p) {
+    for (uint32_t offset : NaiveFind(data, patterns[p])) {
+      expected.push_back({offset, p});
+    }
+  }
+  std::sort(expected.begin(), expected.end(),
+            [](const rom::PatternMatch& a, const rom::PatternMatch& b) {
+              return a.offset != b.offset ? a.offset < b.offset
+                                          : a.pattern < b.pattern;
+            });
+
+  rom::MultiPatternSearcher searcher(patterns);
+  const auto matches = searcher.FindAll(data);
+  ASSERT_EQ(matches.size(), expected.size());
+  for (size_t i = 0; i < matches.size(); ++i) {
+    EXPECT_EQ(matches[i].offset, expected[i].offset) << i;
+    EXPECT_EQ(matches[i].pattern, expected[i].pattern) << i;
+  }
+}
+
+}  // namespace yaze::test
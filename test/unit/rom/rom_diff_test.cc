@@ -1,9 +1,12 @@
 #include "rom/rom_diff.h"
 
 #include <cstdint>
+#include <random>
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "rom/rom.h"
+#include "rom/write_fence.h"
 
 namespace yaze::test {
 
@@ -42,5 +45,126 @@ TEST(RomDiffTest, ReportsTailSizeDelta) {
   EXPECT_EQ(diff.ranges[0].second, 4u);
 }
 
+TEST(RomDiffTest, MatchesBytewiseScanAcrossBlockBoundaries) {
+  std::mt19937 rng(1234);
+  std::vector<uint8_t> before(0x4000 + 37);
+  for (auto& b : before) {
+    b = static_cast<uint8_t>(rng());
+  }
+  std::vector<uint8_t> after = before;
+  // Runs that straddle 64-byte blocks and 4 KB pages, plus scattered bytes.
+  for (size_t i = 60; i < 70; ++i) after[i] ^= 0xFF;
+  for (size_t i = 0xFF0; i < 0x1010; ++i) after[i] ^= 0x01;
+  for (int n = 0; n < 200; ++n) after[rng() % after.size()] ^= 0x80;
+  after.back() ^= 0x01;
+
+  std::vector<std::pair<uint32_t, uint32_t>> expected;
+  size_t expected_bytes = 0;
+  for (uint32_t i = 0; i < before.size(); ++i) {
+    if (before[i] == after[i]) continue;
+    ++expected_bytes;
+    if (!expected.empty() && expected.back().second == i) {
+      expected.back().second = i + 1;
+    } else {
+      expected.emplace_back(i, i + 1);
+    }
+  }
+
+  const auto diff = yaze::rom::ComputeDiffRanges(before, after);
+  EXPECT_EQ(diff.total_bytes_changed, expected_bytes);
+  EXPECT_EQ(diff.ranges, expected);
+}
+
+TEST(RomDiffTest, MergeGapCoalescesNearbyRanges) {
+  std::vector<uint8_t> before(256, 0);
+  std::vector<uint8_t> after = before;
+  after[10] = 1;
+  after[14] = 1;  // 3 unchanged bytes after 10
+  after[30] = 1;
+
+  yaze::rom::DiffOptions options;
+  options.merge_gap = 3;
+  const auto diff = yaze::rom::ComputeRomDiff(before, after, options);
+  EXPECT_EQ(diff.total_bytes_changed, 3u);
+  ASSERT_EQ(diff.ranges.size(), 2u);
+  EXPECT_EQ(diff.ranges[0].start, 10u);
+  EXPECT_EQ(diff.ranges[0].end, 15u);
+  EXPECT_EQ(diff.ranges[0].bytes_changed, 2u);
+  EXPECT_EQ(diff.ranges[1].start, 30u);
+  EXPECT_EQ(diff.ranges[1].bytes_changed, 1u);
+}
+
+TEST(RomDiffTest, BuildsBankPageChangeMap) {
+  std::vector<uint8_t> before(0x10000, 0);
+  std::vector<uint8_t> after = before;
+  for (size_t i = 0x0FFE; i < 0x1002; ++i) after[i] = 1;  // Page 0 -> 1
+  after[0x8000] = 1;                                      // Bank 1
+
+  yaze::rom::DiffOptions options;
+  options.build_change_map = true;
+  const auto diff = yaze::rom::ComputeRomDiff(before, after, options);
+  ASSERT_EQ(diff.change_map.size(), 2u);
+
+  const auto& bank0 = diff.change_map[0];
+  EXPECT_EQ(bank0.bank, 0u);
+  EXPECT_EQ(bank0.bytes_changed, 4u);
+  ASSERT_EQ(bank0.pages.size(), 2u);
+  EXPECT_EQ(bank0.pages[0].page, 0u);
+  EXPECT_EQ(bank0.pages[0].ranges,
+            (std::vector<std::pair<uint32_t, uint32_t>>{{0x0FFE, 0x1000}}));
+  EXPECT_EQ(bank0.pages[1].page, 1u);
+  EXPECT_EQ(bank0.pages[1].bytes_changed, 2u);
+
+  EXPECT_EQ(diff.change_map[1].bank, 1u);
+  ASSERT_EQ(diff.change_map[1].pages.size(), 1u);
+  EXPECT_EQ(diff.change_map[1].pages[0].page, 8u);
+}
+
+TEST(RomDiffTest, AnnotatesRangesWithOverlappingRegions) {
+  std::vector<uint8_t> before(0x200, 0);
+  std::vector<uint8_t> after = before;
+  after[0x10] = 1;
+  after[0x150] = 1;
+  after[0x1F0] = 1;
+
+  yaze::rom::WriteFence fence;
+  ASSERT_TRUE(fence.Allow(0x100, 0x180, "Overworld").ok());
+  auto regions = yaze::rom::RegionLabelsFromWriteFence(fence);
+  regions.push_back({0x000, 0x200, "Bank 00"});
+  regions.push_back({0x140, 0x160, "Overworld"});  // Duplicate label
+
+  auto diff = yaze::rom::ComputeRomDiff(before, after);
+  yaze::rom::AnnotateDiff(diff, regions);
+  ASSERT_EQ(diff.ranges.size(), 3u);
+  EXPECT_EQ(diff.ranges[0].region, "Bank 00");
+  EXPECT_EQ(diff.ranges[1].region, "Bank 00, Overworld");
+  EXPECT_EQ(diff.ranges[2].region, "Bank 00");
+}
+
+TEST(RomDiffTest, RomOverloadSkipsSharedPagesWithSameResult) {
+  std::vector<uint8_t> data(0x6000 + 12);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<uint8_t>(i * 13);
+  }
+  Rom before;
+  ASSERT_TRUE(before.LoadFromData(data).ok());
+  Rom after(before);
+  ASSERT_TRUE(after.WriteByte(0x1FFF, 0xEE).ok());
+  ASSERT_TRUE(after.WriteByte(0x2000, 0xEE).ok());
+  ASSERT_TRUE(after.WriteByte(0x6005, 0xEE).ok());
+
+  std::vector<uint8_t> edited = data;
+  edited[0x1FFF] = edited[0x2000] = edited[0x6005] = 0xEE;
+  const auto from_roms = yaze::rom::ComputeRomDiff(before, after);
+  const auto from_spans = yaze::rom::ComputeRomDiff(data, edited);
+
+  EXPECT_EQ(from_roms.total_bytes_changed, 3u);
+  ASSERT_EQ(from_roms.ranges.size(), from_spans.ranges.size());
+  for (size_t i = 0; i < from_roms.ranges.size(); ++i) {
+    EXPECT_EQ(from_roms.ranges[i].start, from_spans.ranges[i].start);
+    EXPECT_EQ(from_roms.ranges[i].end, from_spans.ranges[i].end);
+  }
+}
+
 }  // namespace yaze::test
 
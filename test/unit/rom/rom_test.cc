@@ -3,6 +3,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
@@ -564,6 +565,27 @@ TEST_F(RomTest, TransactionRollbackRestoresOriginals) {
   EXPECT_EQ(*b1, kMockRomData[0x01]);
 }
 
+TEST_F(RomTest, TransactionRollbackRestoresEveryWriteAndDirtyFlag) {
+  EXPECT_OK(rom_.LoadFromData(kMockRomData));
+  rom_.ClearDirty();
+  const gfx::SnesColor color(static_cast<uint16_t>(0x1234));
+  Rom direct(rom_);
+  EXPECT_OK(direct.WriteColor(0x1C, color));
+
+  yaze::Transaction tx{rom_};
+  tx.WriteByte(0x02, 0x11)
+      .WriteWord(0x02, 0x3322)  // Overwrites the first write
+      .WriteVector(0x10, {0x44, 0x55, 0x66})
+      .WriteColor(0x1C, color);
+  EXPECT_EQ(*rom_.ReadWord(0x02), 0x3322);
+  EXPECT_EQ(*rom_.ReadWord(0x1C), *direct.ReadWord(0x1C));
+  EXPECT_TRUE(rom_.dirty());
+
+  tx.Rollback();
+  EXPECT_EQ(rom_.vector(), kMockRomData);
+  EXPECT_FALSE(rom_.dirty());
+}
+
 TEST_F(RomTest, ScopedRomTransactionRollsBackBufferMetadataAndDirtyState) {
   EXPECT_OK(rom_.LoadFromData(kMockRomData));
   rom_.set_filename("before.sfc");
@@ -596,5 +618,143 @@ TEST_F(RomTest, ScopedRomTransactionCommitKeepsChanges) {
   EXPECT_TRUE(rom_.dirty());
 }
 
+std::vector<uint8_t> MakePagedRomData(size_t size) {
+  std::vector<uint8_t> data(size);
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<uint8_t>(i * 7 + (i >> 8));
+  }
+  return data;
+}
+
+TEST_F(RomTest, CopySharesPagesUntilWritten) {
+  constexpr size_t kPage = rom::RomPages::kPageSize;
+  EXPECT_OK(rom_.LoadFromData(MakePagedRomData(16 * kPage + 100)));
+  EXPECT_EQ(rom_.pages().page_count(), 17u);
+
+  Rom clone(rom_);
+  EXPECT_EQ(clone.pages().SharedPageCount(), 17u);
+  EXPECT_TRUE(clone.DirtyPages().empty());
+
+  EXPECT_OK(clone.WriteByte(3 * kPage + 5, 0xAB));
+  EXPECT_OK(clone.WriteWord(5 * kPage - 1, 0x1234));  // Straddles two pages
+  EXPECT_EQ(clone.DirtyPages(), (std::vector<uint32_t>{3, 4, 5}));
+  EXPECT_TRUE(rom_.DirtyPages().empty());
+  EXPECT_EQ(clone.pages().SharedPageCount(), 14u);
+
+  // The original is untouched
+  EXPECT_EQ(*rom_.ReadByte(3 * kPage + 5), rom_.vector()[3 * kPage + 5]);
+  EXPECT_NE(*rom_.ReadByte(3 * kPage + 5), 0xAB);
+  EXPECT_EQ(*clone.ReadByte(3 * kPage + 5), 0xAB);
+  EXPECT_EQ(*clone.ReadWord(5 * kPage - 1), 0x1234);
+
+  clone.ClearDirtyPages();
+  EXPECT_TRUE(clone.DirtyPages().empty());
+}
+
+TEST_F(RomTest, ChangedPagesSkipsSharedPages) {
+  constexpr size_t kPage = rom::RomPages::kPageSize;
+  EXPECT_OK(rom_.LoadFromData(MakePagedRomData(8 * kPage)));
+  Rom a(rom_);
+  Rom b(rom_);
+  EXPECT_TRUE(Rom::ChangedPages(a, b).empty());
+
+  EXPECT_OK(a.WriteByte(2 * kPage, 0x55));
+  EXPECT_OK(b.WriteVector(6 * kPage + 10, {1, 2, 3}));
+  // Unshared but identical content is not a change
+  const uint8_t same = *b.ReadByte(kPage);
+  EXPECT_OK(b.WriteByte(kPage, same));
+
+  EXPECT_EQ(Rom::ChangedPages(a, b), (std::vector<uint32_t>{2, 6}));
+  b.Expand(9 * kPage);
+  EXPECT_EQ(Rom::ChangedPages(a, b), (std::vector<uint32_t>{2, 6, 8}));
+}
+
+TEST_F(RomTest, RawBufferWritesReachPagesAndClones) {
+  constexpr size_t kPage = rom::RomPages::kPageSize;
+  EXPECT_OK(rom_.LoadFromData(MakePagedRomData(4 * kPage)));
+  uint8_t* raw = rom_.mutable_data();
+  raw[kPage + 1] = 0xEE;
+  rom_[3 * kPage] = 0xDD;
+  EXPECT_OK(rom_.WriteByte(2, 0xCC));
+
+  EXPECT_EQ(rom_.DirtyPages(), (std::vector<uint32_t>{0, 1, 3}));
+  Rom clone(rom_);
+  EXPECT_EQ(clone.vector(), rom_.vector());
+  EXPECT_EQ(*clone.ReadByte(kPage + 1), 0xEE);
+  EXPECT_TRUE(Rom::ChangedPages(rom_, clone).empty());
+
+  // Pointers handed out earlier keep working after the copy
+  raw[kPage + 2] = 0x42;
+  EXPECT_EQ(*rom_.ReadByte(kPage + 2), 0x42);
+  EXPECT_NE(*clone.ReadByte(kPage + 2), 0x42);
+  EXPECT_EQ(Rom::ChangedPages(rom_, clone), (std::vector<uint32_t>{1}));
+}
+
+TEST_F(RomTest, PagedRomSavesAndResizes) {
+  constexpr size_t kPage = rom::RomPages::kPageSize;
+  const auto data = MakePagedRomData(3 * kPage + 17);
+  EXPECT_OK(rom_.LoadFromData(data));
+  Rom clone(rom_);
+  EXPECT_OK(clone.WriteByte(3 * kPage + 16, 0x99));
+  clone.Expand(2 * kPage + 3);
+  clone.Expand(3 * kPage);
+  // Shrinking drops bytes; growing again zero-fills
+  EXPECT_EQ(*clone.ReadByte(2 * kPage + 2), data[2 * kPage + 2]);
+  EXPECT_EQ(*clone.ReadByte(2 * kPage + 3), 0);
+
+  ScopedTempDirectory temp_dir;
+  const auto path = temp_dir.path() / "paged.sfc";
+  Rom::SaveSettings settings;
+  settings.filename = path.string();
+  EXPECT_OK(clone.SaveToFile(settings));
+  EXPECT_EQ(ReadFileBytes(path), clone.vector());
+  EXPECT_EQ(rom_.vector(), data);
+}
+
+TEST_F(RomTest, MemoryMappedLoadServesViewsFromTheFile) {
+  constexpr size_t kPage = rom::RomPages::kPageSize;
+  constexpr size_t kRomSize = 1024 * 1024;
+  const auto image = MakePagedRomData(kRomSize);
+  std::vector<uint8_t> file_bytes(0x200, 0xAA);  // SMC copier header
+  file_bytes.insert(file_bytes.end(), image.begin(), image.end());
+
+  ScopedTempDirectory temp_dir;
+  const auto path = temp_dir.path() / "mapped.smc";
+  {
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(file_bytes.data()),
+              file_bytes.size());
+  }
+
+  Rom::LoadOptions options;
+  options.memory_map = true;
+  options.load_resource_labels = false;
+  EXPECT_OK(rom_.LoadFromFile(path.string(), options));
+  ASSERT_EQ(rom_.size(), kRomSize);
+  ASSERT_NE(rom_.pages().contiguous_data(), nullptr);
+
+  auto view = rom_.ReadSpan(kPage - 8, 3 * kPage);
+  ASSERT_TRUE(view.ok());
+  EXPECT_EQ(view->data(), rom_.data() + kPage - 8);
+  EXPECT_TRUE(std::equal(view->begin(), view->end(),
+                         image.begin() + kPage - 8));
+  EXPECT_FALSE(rom_.ReadSpan(kRomSize - 4, 8).ok());
+
+  // Writes copy the page; the file and untouched pages are unaffected
+  EXPECT_OK(rom_.WriteByte(2 * kPage, 0x5A));
+  EXPECT_EQ(rom_.pages().contiguous_data(), nullptr);
+  EXPECT_EQ(rom_.DirtyPages(), (std::vector<uint32_t>{2}));
+  view = rom_.ReadSpan(kPage - 8, 3 * kPage);
+  ASSERT_TRUE(view.ok());
+  EXPECT_EQ((*view)[kPage + 8], 0x5A);
+  EXPECT_EQ(ReadFileBytes(path), file_bytes);
+
+  Rom buffered;
+  options.memory_map = false;
+  EXPECT_OK(buffered.LoadFromFile(path.string(), options));
+  EXPECT_EQ(buffered.vector(), image);
+  EXPECT_EQ(Rom::ChangedPages(rom_, buffered), (std::vector<uint32_t>{2}));
+}
+
 }  // namespace test
 }  // namespace yaze
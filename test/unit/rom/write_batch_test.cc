@@ -0,0 +1,141 @@
+#include "rom/write_batch.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "rom/rom.h"
+#include "rom/write_fence.h"
+
+namespace yaze::rom {
+
+namespace {
+
+Rom MakeRom(size_t size) {
+  Rom rom;
+  std::vector<uint8_t> data(size, 0);
+  auto status = rom.LoadFromData(data);
+  EXPECT_TRUE(status.ok()) << status.message();
+  return rom;
+}
+
+}  // namespace
+
+TEST(WriteBatchTest, AppliesCoalescedWritesAndRollsBack) {
+  Rom rom = MakeRom(0x10000);
+  rom.ClearDirty();
+  const uint64_t revision = rom.object_tile_revision();
+
+  WriteBatch batch;
+  batch.WriteVector(0x100, std::vector<uint8_t>{1, 2, 3, 4})
+      .WriteWord(0x102, 0xBBAA)  // Overlaps; staged later, so it wins
+      .WriteByte(0x104, 0x05)    // Touches the first range
+      .WriteLong(0x8000, 0x123456)
+      .AdvanceObjectTileRevision();
+  EXPECT_EQ(batch.write_count(), 4u);
+
+  auto journal = batch.Commit(rom);
+  ASSERT_TRUE(journal.ok()) << journal.status().message();
+  EXPECT_TRUE(batch.empty());
+  EXPECT_TRUE(rom.dirty());
+  EXPECT_EQ(rom.object_tile_revision(), revision + 1);
+
+  EXPECT_EQ(rom.vector()[0x100], 1);
+  EXPECT_EQ(rom.vector()[0x101], 2);
+  EXPECT_EQ(rom.vector()[0x102], 0xAA);
+  EXPECT_EQ(rom.vector()[0x103], 0xBB);
+  EXPECT_EQ(rom.vector()[0x104], 0x05);
+  EXPECT_EQ(*rom.ReadLong(0x8000), 0x123456u);
+
+  // Two coalesced ranges: [0x100, 0x105) and [0x8000, 0x8003).
+  ASSERT_EQ(journal->ranges().size(), 2u);
+  EXPECT_EQ(journal->byte_count(), 8u);
+
+  ASSERT_TRUE(journal->Rollback(rom).ok());
+  EXPECT_FALSE(rom.dirty());
+  for (uint32_t i = 0x100; i < 0x105; ++i) {
+    EXPECT_EQ(rom.vector()[i], 0) << i;
+  }
+  EXPECT_EQ(*rom.ReadLong(0x8000), 0u);
+}
+
+TEST(WriteBatchTest, RejectedBatchLeavesRomUntouched) {
+  Rom rom = MakeRom(0x1000);
+  rom.ClearDirty();
+
+  WriteFence fence;
+  ASSERT_TRUE(fence.Allow(0x100, 0x200, "table").ok());
+  ASSERT_TRUE(fence.Allow(0x400, 0x480, "pointers").ok());
+
+  {
+    ScopedWriteFence scope(&rom, &fence);
+
+    WriteBatch denied;
+    denied.WriteByte(0x150, 0x11).WriteByte(0x410, 0x22).WriteByte(0x300, 0x33);
+    auto status = denied.Commit(rom);
+    EXPECT_EQ(status.status().code(), absl::StatusCode::kPermissionDenied);
+    EXPECT_FALSE(rom.dirty());
+    EXPECT_EQ(rom.vector()[0x150], 0);
+    EXPECT_EQ(rom.vector()[0x410], 0);
+
+    WriteBatch out_of_range;
+    out_of_range.WriteByte(0x150, 0x11).WriteWord(0xFFF, 0x2222);
+    EXPECT_EQ(out_of_range.Commit(rom).status().code(),
+              absl::StatusCode::kOutOfRange);
+    EXPECT_EQ(rom.vector()[0x150], 0);
+
+    WriteBatch allowed;
+    allowed.WriteByte(0x150, 0x11).WriteWord(0x47E, 0x2222);
+    ASSERT_TRUE(allowed.Commit(rom).ok());
+  }
+
+  EXPECT_EQ(rom.vector()[0x150], 0x11);
+  EXPECT_EQ(*rom.ReadWord(0x47E), 0x2222);
+  ASSERT_EQ(fence.written_ranges().size(), 2u);
+  EXPECT_EQ(fence.written_ranges()[0].first, 0x150u);
+  EXPECT_EQ(fence.written_ranges()[1].second, 0x480u);
+}
+
+TEST(WriteBatchTest, StagesOnlyBytesAClonePatched) {
+  Rom rom = MakeRom(0x4000);
+  rom.ClearDirty();
+
+  Rom staged(rom);
+  ASSERT_TRUE(staged.WriteByte(0x10, 0xAA).ok());
+  ASSERT_TRUE(staged.WriteByte(0x11, 0x00).ok());  // Same as before
+  ASSERT_TRUE(staged.WriteWord(0x12, 0xCCBB).ok());
+  // Crosses the page boundary at 0x1000.
+  ASSERT_TRUE(
+      staged.WriteVector(0x0FFE, std::vector<uint8_t>{1, 2, 3, 4}).ok());
+
+  WriteBatch batch;
+  ASSERT_TRUE(batch.StageChanges(rom, staged).ok());
+  EXPECT_EQ(batch.staged_bytes(), 7u);
+  EXPECT_EQ(batch.write_count(), 4u);  // 0x10, 0x12-0x13, and two page halves
+
+  WriteFence fence;
+  ASSERT_TRUE(fence.Allow(0x10, 0x11, "one byte").ok());
+  ASSERT_TRUE(fence.Allow(0x12, 0x14, "word").ok());
+  {
+    // The unchanged byte at 0x11 is not written, so it needs no permission;
+    // the page-crossing run does.
+    ScopedWriteFence scope(&rom, &fence);
+    EXPECT_EQ(WriteBatch(batch).Commit(rom).status().code(),
+              absl::StatusCode::kPermissionDenied);
+    EXPECT_FALSE(rom.dirty());
+  }
+
+  auto journal = batch.Commit(rom);
+  ASSERT_TRUE(journal.ok()) << journal.status().message();
+  EXPECT_EQ(rom.vector(), staged.vector());
+  EXPECT_EQ(journal->ranges().size(), 3u);
+
+  Rom grown(rom);
+  grown.Expand(0x8000);
+  EXPECT_EQ(WriteBatch().StageChanges(rom, grown).code(),
+            absl::StatusCode::kFailedPrecondition);
+}
+
+}  // namespace yaze::rom
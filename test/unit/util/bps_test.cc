@@ -1,6 +1,9 @@
 #include "util/bps.h"
 
 #include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -17,6 +20,44 @@ std::vector<uint8_t> MakeSourceData(size_t size) {
   return data;
 }
 
+std::vector<uint8_t> MakeNoise(size_t size, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::vector<uint8_t> data(size);
+  for (auto& byte : data) {
+    byte = static_cast<uint8_t>(rng());
+  }
+  return data;
+}
+
+uint32_t Crc32(const std::vector<uint8_t>& data) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (uint8_t byte : data) {
+    crc ^= byte;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+    }
+  }
+  return ~crc;
+}
+
+void PushLE32(std::vector<uint8_t>& out, uint32_t value) {
+  for (int i = 0; i < 4; ++i) {
+    out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+  }
+}
+
+std::vector<uint8_t> RoundTrip(const std::vector<uint8_t>& source,
+                               const std::vector<uint8_t>& patch) {
+  std::vector<uint8_t> applied;
+  auto status = util::ApplyBpsPatch(source, patch, applied);
+  EXPECT_TRUE(status.ok()) << status.message();
+  return applied;
+}
+
+std::string ToString(const std::vector<uint8_t>& data) {
+  return std::string(data.begin(), data.end());
+}
+
 }  // namespace
 
 TEST(BpsTest, CreateAndApplyRoundTrip) {
@@ -90,4 +131,107 @@ TEST(BpsTest, ApplyRejectsWrongSourceRom) {
   EXPECT_FALSE(status.ok());
 }
 
+TEST(BpsTest, DeltaModeEncodesMovedDataAsCopies) {
+  auto source = MakeNoise(64 * 1024, 1);
+  auto target = source;
+  // Swap two 8 KB blocks and duplicate a third over a fourth
+  std::swap_ranges(target.begin() + 0x1000, target.begin() + 0x3000,
+                   target.begin() + 0x8000);
+  std::copy(source.begin() + 0xA000, source.begin() + 0xB000,
+            target.begin() + 0xC000);
+  // Repeated run appended to the end (TargetCopy territory)
+  for (int i = 0; i < 4096; ++i) {
+    target.push_back(static_cast<uint8_t>(i % 3));
+  }
+
+  std::vector<uint8_t> linear;
+  util::BpsEncodeOptions linear_options;
+  linear_options.mode = util::BpsEncodeMode::kLinear;
+  ASSERT_TRUE(
+      util::CreateBpsPatch(source, target, linear, linear_options).ok());
+  std::vector<uint8_t> delta;
+  ASSERT_TRUE(util::CreateBpsPatch(source, target, delta).ok());
+
+  EXPECT_EQ(RoundTrip(source, linear), target);
+  EXPECT_EQ(RoundTrip(source, delta), target);
+  EXPECT_LT(delta.size() * 50, linear.size());
+}
+
+TEST(BpsTest, SpeedPresetsRoundTrip) {
+  auto source = MakeNoise(32 * 1024, 2);
+  auto target = source;
+  std::rotate(target.begin(), target.begin() + 777, target.end());
+  for (size_t i = 0; i < target.size(); i += 1500) {
+    target[i] ^= 0x33;
+  }
+
+  for (const auto& options : {util::BpsEncodeOptions::Fast(),
+                              util::BpsEncodeOptions{},
+                              util::BpsEncodeOptions::Smallest()}) {
+    std::vector<uint8_t> patch;
+    ASSERT_TRUE(util::CreateBpsPatch(source, target, patch, options).ok());
+    EXPECT_EQ(RoundTrip(source, patch), target);
+    EXPECT_LT(patch.size(), target.size() / 8);
+  }
+}
+
+TEST(BpsTest, ApplyDecodesRelativeOffsetsPerSpec) {
+  std::vector<uint8_t> source(16);
+  for (size_t i = 0; i < source.size(); ++i) {
+    source[i] = static_cast<uint8_t>(i);
+  }
+  const std::vector<uint8_t> target = {8, 9, 10, 11, 4, 5, 6, 7, 6, 7};
+
+  std::vector<uint8_t> patch = {'B', 'P', 'S', '1', 0x90, 0x8A, 0x80};
+  patch.push_back(0x80 | ((4 - 1) << 2) | 2);  // SourceCopy 4
+  patch.push_back(0x80 | (8 << 1));            // +8
+  patch.push_back(0x80 | ((4 - 1) << 2) | 2);  // SourceCopy 4
+  patch.push_back(0x80 | (8 << 1) | 1);        // -8
+  patch.push_back(0x80 | ((2 - 1) << 2) | 3);  // TargetCopy 2
+  patch.push_back(0x80 | (6 << 1));            // +6
+  PushLE32(patch, Crc32(source));
+  PushLE32(patch, Crc32(target));
+  PushLE32(patch, Crc32(patch));
+
+  EXPECT_EQ(RoundTrip(source, patch), target);
+}
+
+TEST(BpsTest, StreamApplyMatchesInMemoryApply) {
+  // Larger than the streaming window so TargetCopy reads flushed output
+  auto source = MakeNoise(300 * 1024, 3);
+  auto target = source;
+  std::copy(source.begin(), source.begin() + 100 * 1024,
+            target.begin() + 200 * 1024);
+  auto tail = MakeNoise(1000, 4);
+  target.insert(target.end(), tail.begin(), tail.end());
+  target.insert(target.end(), target.begin() + 10, target.begin() + 5000);
+
+  std::vector<uint8_t> patch;
+  ASSERT_TRUE(util::CreateBpsPatch(source, target, patch).ok());
+
+  std::istringstream source_stream(ToString(source));
+  std::istringstream patch_stream(ToString(patch));
+  std::stringstream target_stream;
+  auto status =
+      util::ApplyBpsPatchStream(source_stream, patch_stream, target_stream);
+  ASSERT_TRUE(status.ok()) << status.message();
+  EXPECT_EQ(target_stream.str(), ToString(target));
+}
+
+TEST(BpsTest, StreamApplyRejectsWrongSource) {
+  auto source = MakeNoise(1024, 5);
+  auto target = source;
+  target[100] ^= 0xFF;
+  std::vector<uint8_t> patch;
+  ASSERT_TRUE(util::CreateBpsPatch(source, target, patch).ok());
+
+  source[0] ^= 0x01;
+  std::istringstream source_stream(ToString(source));
+  std::istringstream patch_stream(ToString(patch));
+  std::stringstream target_stream;
+  EXPECT_FALSE(
+      util::ApplyBpsPatchStream(source_stream, patch_stream, target_stream)
+          .ok());
+}
+
 }  // namespace yaze::test
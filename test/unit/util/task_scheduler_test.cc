@@ -0,0 +1,155 @@
+#include "util/task_scheduler.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace yaze {
+namespace util {
+namespace {
+
+TEST(TaskSchedulerTest, RunsEveryTask) {
+  TaskScheduler scheduler(4);
+  std::vector<int> results(500, 0);
+  TaskGroup group(scheduler, TaskPriority::kNormal);
+  group.RunEach(static_cast<int>(results.size()), [&](int i) {
+    results[i] = i * 2;
+    return absl::OkStatus();
+  });
+
+  ASSERT_TRUE(group.Wait().ok());
+  for (int i = 0; i < static_cast<int>(results.size()); ++i) {
+    EXPECT_EQ(results[i], i * 2);
+  }
+}
+
+TEST(TaskSchedulerTest, ZeroWorkersRunsOnWaitingThread) {
+  TaskScheduler scheduler(0);
+  const auto caller = std::this_thread::get_id();
+  std::atomic<int> off_thread{0};
+  TaskGroup group(scheduler, TaskPriority::kNormal);
+  group.RunEach(16, [&](int) {
+    if (std::this_thread::get_id() != caller) {
+      ++off_thread;
+    }
+    return absl::OkStatus();
+  });
+
+  ASSERT_TRUE(group.Wait().ok());
+  EXPECT_EQ(off_thread.load(), 0);
+}
+
+TEST(TaskSchedulerTest, NestedGroupsDoNotDeadlock) {
+  // More waiting tasks than workers; waiters must help run inner tasks.
+  TaskScheduler scheduler(2);
+  std::atomic<int> inner_runs{0};
+  TaskGroup outer(scheduler, TaskPriority::kNormal);
+  outer.RunEach(8, [&](int) {
+    TaskGroup inner(scheduler, TaskPriority::kNormal);
+    inner.RunEach(8, [&](int) {
+      ++inner_runs;
+      return absl::OkStatus();
+    });
+    return inner.Wait();
+  });
+
+  ASSERT_TRUE(outer.Wait().ok());
+  EXPECT_EQ(inner_runs.load(), 64);
+}
+
+TEST(TaskSchedulerTest, FirstErrorCancelsQueuedTasks) {
+  TaskScheduler scheduler(0);
+  int runs = 0;
+  TaskGroup group(scheduler, TaskPriority::kNormal);
+  group.Run([] { return absl::DataLossError("bad room"); });
+  group.RunEach(10, [&](int) {
+    ++runs;
+    return absl::OkStatus();
+  });
+
+  const absl::Status status = group.Wait();
+  EXPECT_TRUE(absl::IsDataLoss(status)) << status;
+  EXPECT_EQ(runs, 0);
+  EXPECT_TRUE(group.cancelled());
+}
+
+TEST(TaskSchedulerTest, CancelSkipsQueuedTasks) {
+  TaskScheduler scheduler(0);
+  int runs = 0;
+  TaskGroup group(scheduler, TaskPriority::kNormal);
+  group.RunEach(10, [&](int) {
+    ++runs;
+    return absl::OkStatus();
+  });
+  group.Cancel();
+
+  EXPECT_TRUE(absl::IsCancelled(group.Wait()));
+  EXPECT_EQ(runs, 0);
+}
+
+TEST(TaskSchedulerTest, HighPriorityRunsBeforeNormalAndLow) {
+  TaskScheduler scheduler(0);
+  std::vector<char> order;
+  TaskGroup low(scheduler, TaskPriority::kLow);
+  TaskGroup normal(scheduler, TaskPriority::kNormal);
+  TaskGroup high(scheduler, TaskPriority::kHigh);
+  auto record = [&order](char c) {
+    return [&order, c] {
+      order.push_back(c);
+      return absl::OkStatus();
+    };
+  };
+  low.Run(record('l'));
+  normal.Run(record('n'));
+  high.Run(record('h'));
+
+  // Waiting on the low group drains everything queued ahead of it.
+  ASSERT_TRUE(low.Wait().ok());
+  EXPECT_EQ(order, (std::vector<char>{'h', 'n', 'l'}));
+}
+
+TEST(TaskSchedulerTest, ReportsProgressForEveryTask) {
+  TaskScheduler scheduler(3);
+  std::mutex mutex;
+  std::vector<int> completed;
+  int last_total = 0;
+  TaskGroup group(scheduler, TaskPriority::kNormal);
+  group.SetProgressCallback([&](int done, int total) {
+    std::lock_guard<std::mutex> lock(mutex);
+    completed.push_back(done);
+    last_total = total;
+  });
+  group.RunEach(20, [](int) { return absl::OkStatus(); });
+
+  ASSERT_TRUE(group.Wait().ok());
+  ASSERT_EQ(completed.size(), 20u);
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_EQ(completed[i], i + 1);
+  }
+  EXPECT_EQ(last_total, 20);
+}
+
+TEST(TaskSchedulerTest, SharedSchedulerRunsGroups) {
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+  TaskGroup group;
+  group.RunEach(64, [&](int) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    std::lock_guard<std::mutex> lock(mutex);
+    threads.insert(std::this_thread::get_id());
+    return absl::OkStatus();
+  });
+
+  ASSERT_TRUE(group.Wait().ok());
+  EXPECT_GE(threads.size(), 1u);
+  EXPECT_GE(TaskScheduler::Get().worker_count(), 1);
+}
+
+}  // namespace
+}  // namespace util
+}  // namespace yaze
@@ -70,6 +70,27 @@ TEST(CustomCollisionReservedRegionTest,
   }
 }
 
+TEST(CustomCollisionReservedRegionTest,
+     BatchLoadReportsEachRoomLikeTheSingleRoomLoad) {
+  auto rom = MakeDummyRom(0x200000);
+
+  // Room 1 points into the reserved region; rooms 0 and 2 have no map.
+  const uint32_t snes = PcToSnes(static_cast<uint32_t>(kWaterFillTableStart));
+  const int ptr_offset = kCustomCollisionRoomPointers + 3;
+  ASSERT_TRUE(rom->WriteByte(ptr_offset + 0, snes & 0xFF).ok());
+  ASSERT_TRUE(rom->WriteByte(ptr_offset + 1, (snes >> 8) & 0xFF).ok());
+  ASSERT_TRUE(rom->WriteByte(ptr_offset + 2, (snes >> 16) & 0xFF).ok());
+
+  const std::vector<int> room_ids = {0, 1, 2, kNumberOfRooms};
+  const auto maps = LoadCustomCollisionMaps(rom.get(), room_ids);
+  ASSERT_EQ(maps.size(), room_ids.size());
+  ASSERT_TRUE(maps[0].ok()) << maps[0].status();
+  EXPECT_FALSE(maps[0]->has_data);
+  EXPECT_EQ(maps[1].status().code(), absl::StatusCode::kFailedPrecondition);
+  ASSERT_TRUE(maps[2].ok()) << maps[2].status();
+  EXPECT_EQ(maps[3].status().code(), absl::StatusCode::kOutOfRange);
+}
+
 }  // namespace zelda3
 }  // namespace yaze
 
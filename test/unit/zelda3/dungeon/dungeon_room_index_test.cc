@@ -0,0 +1,54 @@
+#include "zelda3/dungeon/dungeon_room_index.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "rom/rom.h"
+#include "zelda3/dungeon/dungeon_spawn_point.h"
+#include "zelda3/dungeon/room_entrance.h"
+
+namespace yaze {
+namespace zelda3 {
+namespace {
+
+void SetEntrance(Rom* rom, int entrance_id, int room_id, int dungeon_id) {
+  ASSERT_TRUE(rom->WriteWord(kEntranceRoom + (entrance_id * 2), room_id).ok());
+  ASSERT_TRUE(rom->WriteByte(kEntranceDungeon + entrance_id, dungeon_id).ok());
+}
+
+void SetSpawn(Rom* rom, int spawn_id, int room_id, int dungeon_id) {
+  ASSERT_TRUE(
+      rom->WriteWord(kDungeonSpawnRoom + (spawn_id * 2), room_id).ok());
+  ASSERT_TRUE(
+      rom->WriteByte(kDungeonSpawnDungeonId + spawn_id, dungeon_id).ok());
+}
+
+TEST(DungeonRoomIndexTest, GroupsEntranceAndSpawnRoomsByDungeon) {
+  Rom rom;
+  ASSERT_TRUE(rom.LoadFromData(std::vector<uint8_t>(0x100000, 0x00)).ok());
+  // Every other entrance and spawn leads to room 0 of dungeon 0.
+  SetEntrance(&rom, 1, 0x12, 0x02);
+  SetEntrance(&rom, kNumRegularDungeonEntrances - 1, 0x34, 0x02);
+  SetEntrance(&rom, 2, 0x56, 0x20);
+  SetSpawn(&rom, 0, 0x78, 0x02);
+  // A spawn naming a dungeon no entrance knows adds no dungeon.
+  SetSpawn(&rom, 1, 0x9A, 0x30);
+
+  auto index = BuildDungeonRoomIndex(rom);
+  ASSERT_TRUE(index.ok()) << index.status();
+
+  EXPECT_EQ(index->RoomsOf(0x02), (std::vector<int>{0x12, 0x34, 0x78}));
+  EXPECT_EQ(index->RoomsOf(0x20), (std::vector<int>{0x56}));
+  EXPECT_EQ(index->RoomsOf(0x00), (std::vector<int>{0x00}));
+  EXPECT_TRUE(index->RoomsOf(0x05).empty());
+  EXPECT_TRUE(index->rooms_by_dungeon.contains(0x05));
+  EXPECT_TRUE(index->RoomsOf(0x30).empty());
+  EXPECT_FALSE(index->rooms_by_dungeon.contains(0x30));
+  EXPECT_EQ(index->dungeon_by_room.at(0x9A), 0x30);
+  EXPECT_FALSE(index->dungeon_by_room.contains(0x13));
+}
+
+}  // namespace
+}  // namespace zelda3
+}  // namespace yaze
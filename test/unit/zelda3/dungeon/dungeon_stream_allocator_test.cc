@@ -155,6 +155,27 @@ TEST_F(DungeonStreamAllocatorTest, InventoriesExactAliasesAndSuffixOverlap) {
       (std::vector<DungeonStreamPcRange>{{kPotData + 0x20, kPotData + 0x40}}));
 }
 
+TEST_F(DungeonStreamAllocatorTest, InventoriesExtentsWithPhysicalCapacity) {
+  auto layout = PotLayout(3, {{kPotData, kPotData + 0x40}}, {});
+  WriteBytes(kPotData, {0xFF, 0xFF});
+  WriteBytes(kPotData + 0x10, {0x01, 0x00, 0x10, 0xFF, 0xFF});
+  SetPointer(layout, 0, kPotData + 0x10);
+  SetPointer(layout, 1, kPotData);
+  SetPointer(layout, 2, kPotData);
+
+  auto inventory = InventoryDungeonStreams(*rom_, layout);
+  ASSERT_TRUE(inventory.ok()) << inventory.status();
+  ASSERT_EQ(inventory->extents.size(), 2);
+  EXPECT_EQ(inventory->extents[0].data_pc, kPotData);
+  EXPECT_EQ(inventory->extents[0].room_ids, (std::vector<uint32_t>{1, 2}));
+  EXPECT_EQ(inventory->extents[0].size(), 2u);
+  EXPECT_EQ(inventory->extents[0].capacity(), 0x10u);
+  // The last stream is bounded by its data range.
+  EXPECT_EQ(inventory->extents[1].data_pc, kPotData + 0x10);
+  EXPECT_EQ(inventory->extents[1].size(), 5u);
+  EXPECT_EQ(inventory->extents[1].capacity(), 0x30u);
+}
+
 TEST_F(DungeonStreamAllocatorTest, InventoriesInteriorOverlap) {
   auto layout = SpriteLayout(2, {kSpriteData, kSpriteData + 0x20});
   // Room 0: sort, one record, terminator => [data,data+5).
@@ -740,6 +761,90 @@ TEST_F(DungeonStreamAllocatorTest,
   EXPECT_EQ(after->streams[2].encoded_stream, empty);
 }
 
+TEST_F(DungeonStreamAllocatorTest, RepackKeepsInPlaceStreamsAndMovesGrownRoom) {
+  auto layout = PotLayout(kNumberOfRooms, {{kPotData, kPotData + 0x40}},
+                          {{kPotData, kPotData + 0x40}});
+  const std::vector<uint8_t> empty = {0xFF, 0xFF};
+  const std::vector<uint8_t> item_a = {0x01, 0x00, 0x10, 0xFF, 0xFF};
+  const std::vector<uint8_t> item_b = {0x02, 0x00, 0x20, 0xFF, 0xFF};
+  const std::vector<uint8_t> grown = {0x02, 0x00, 0x20, 0x04,
+                                      0x00, 0x21, 0xFF, 0xFF};
+  const std::vector<uint8_t> item_c = {0x03, 0x00, 0x30, 0xFF, 0xFF};
+  WriteBytes(kPotData, empty);
+  WriteBytes(kPotData + 0x02, item_a);
+  WriteBytes(kPotData + 0x07, item_b);
+  WriteBytes(kPotData + 0x0C, item_c);
+  SetPointer(layout, 0, kPotData);
+  SetPointer(layout, 1, kPotData + 0x02);
+  SetPointer(layout, 2, kPotData + 0x07);
+  SetPointer(layout, 3, kPotData + 0x0C);
+  SetPointersFrom(layout, 4, kPotData);
+
+  auto inventory = InventoryDungeonStreams(*rom_, layout);
+  ASSERT_TRUE(inventory.ok()) << inventory.status();
+  auto plan = PlanDungeonStreamRepack(*inventory, {{2, grown}});
+  ASSERT_TRUE(plan.ok()) << plan.status();
+  EXPECT_EQ(plan->repack_cost.repointed_rooms, 1);
+  EXPECT_EQ(plan->repack_cost.kept_payloads, 3);
+  EXPECT_EQ(plan->repack_cost.moved_payloads, 1);
+  EXPECT_EQ(plan->repack_cost.moved_bytes, grown.size());
+  EXPECT_EQ(plan->repack_cost.evicted_payloads, 0);
+  EXPECT_EQ(plan->repack_cost.deduplicated_rooms, kNumberOfRooms - 4);
+  ASSERT_TRUE(ApplyDungeonStreamWritePlan(rom_.get(), *plan).ok());
+
+  EXPECT_EQ(ReadFixedPointer(layout, 0), kPotData);
+  EXPECT_EQ(ReadFixedPointer(layout, 1), kPotData + 0x02);
+  EXPECT_EQ(ReadFixedPointer(layout, 3), kPotData + 0x0C);
+  EXPECT_EQ(ReadFixedPointer(layout, kNumberOfRooms - 1), kPotData);
+  auto after = InventoryDungeonStreams(*rom_, layout);
+  ASSERT_TRUE(after.ok()) << after.status();
+  ASSERT_TRUE(after->ok());
+  EXPECT_EQ(after->streams[1].encoded_stream, item_a);
+  EXPECT_EQ(after->streams[2].encoded_stream, grown);
+}
+
+TEST_F(DungeonStreamAllocatorTest,
+       RepackEvictsOneKeptStreamWhenNoFragmentFits) {
+  // Exactly full once room 2 grows. Its old slot and the tail are too small
+  // apart; moving room 3 lets room 2 grow in place and room 3 take the end.
+  auto layout = PotLayout(kNumberOfRooms, {{kPotData, kPotData + 0x40}},
+                          {{kPotData, kPotData + 0x14}});
+  const std::vector<uint8_t> empty = {0xFF, 0xFF};
+  const std::vector<uint8_t> item_a = {0x01, 0x00, 0x10, 0xFF, 0xFF};
+  const std::vector<uint8_t> item_b = {0x02, 0x00, 0x20, 0xFF, 0xFF};
+  const std::vector<uint8_t> item_c = {0x03, 0x00, 0x30, 0xFF, 0xFF};
+  const std::vector<uint8_t> grown = {0x02, 0x00, 0x20, 0x04,
+                                      0x00, 0x21, 0xFF, 0xFF};
+  WriteBytes(kPotData, empty);
+  WriteBytes(kPotData + 0x02, item_a);
+  WriteBytes(kPotData + 0x07, item_b);
+  WriteBytes(kPotData + 0x0C, item_c);
+  SetPointer(layout, 0, kPotData);
+  SetPointer(layout, 1, kPotData + 0x02);
+  SetPointer(layout, 2, kPotData + 0x07);
+  SetPointer(layout, 3, kPotData + 0x0C);
+  SetPointersFrom(layout, 4, kPotData);
+
+  auto inventory = InventoryDungeonStreams(*rom_, layout);
+  ASSERT_TRUE(inventory.ok()) << inventory.status();
+  auto plan = PlanDungeonStreamRepack(*inventory, {{2, grown}});
+  ASSERT_TRUE(plan.ok()) << plan.status();
+  EXPECT_EQ(plan->repack_cost.evicted_payloads, 1);
+  EXPECT_EQ(plan->repack_cost.repointed_rooms, 1);
+  EXPECT_EQ(plan->repack_cost.free_bytes, 0);
+  ASSERT_TRUE(ApplyDungeonStreamWritePlan(rom_.get(), *plan).ok());
+
+  EXPECT_EQ(ReadFixedPointer(layout, 0), kPotData);
+  EXPECT_EQ(ReadFixedPointer(layout, 1), kPotData + 0x02);
+  EXPECT_EQ(ReadFixedPointer(layout, 2), kPotData + 0x07);
+  EXPECT_EQ(ReadFixedPointer(layout, 3), kPotData + 0x0F);
+  auto after = InventoryDungeonStreams(*rom_, layout);
+  ASSERT_TRUE(after.ok()) << after.status();
+  ASSERT_TRUE(after->ok());
+  EXPECT_EQ(after->streams[2].encoded_stream, grown);
+  EXPECT_EQ(after->streams[3].encoded_stream, item_c);
+}
+
 TEST_F(DungeonStreamAllocatorTest,
        RepackRejectsMultipleRangesEvenWhenPackingIsFeasible) {
   const std::vector<uint8_t> item_8 = {0x01, 0x00, 0x10, 0x02,
@@ -7,6 +7,8 @@
 #include <gtest/gtest.h>
 
 #include "rom/rom.h"
+#include "rom/snes.h"
+#include "zelda3/dungeon/dungeon_rom_addresses.h"
 #include "zelda3/dungeon/room.h"
 #include "zelda3/dungeon/room_object.h"
 
@@ -39,6 +41,22 @@ RoomObject MakeCanonicalRoomObject(int16_t id, uint8_t x, uint8_t y,
   return RoomObject(id, x, y, CanonicalRoomObjectSize(id, 0), layer);
 }
 
+void WriteLong(Rom& rom, int pc, uint32_t value) {
+  rom.mutable_data()[pc] = value & 0xFF;
+  rom.mutable_data()[pc + 1] = (value >> 8) & 0xFF;
+  rom.mutable_data()[pc + 2] = (value >> 16) & 0xFF;
+}
+
+// Places room 0's object stream directly before room 1's, leaving room 0
+// |capacity| bytes to grow in place.
+void SetRoomZeroObjectCapacity(Rom& rom, int capacity) {
+  constexpr int kTablePc = 0xF8000;
+  constexpr int kStreamPc = 0x50100;
+  WriteLong(rom, kRoomObjectPointer, PcToSnes(kTablePc));
+  WriteLong(rom, kTablePc, PcToSnes(kStreamPc));
+  WriteLong(rom, kTablePc + 3, PcToSnes(kStreamPc + capacity));
+}
+
 TEST(DungeonValidatorTest, AcceptsBothBgObjectsInOverlayStreams) {
   Rom rom;
   ASSERT_TRUE(rom.LoadFromData(std::vector<uint8_t>(0x200000, 0)).ok());
@@ -460,6 +478,118 @@ TEST(DungeonValidatorTest, RoomId1AStillCountsStatefulChests) {
       HasWarningContaining(result, "RoomFlagMask only defines slots 0-5"));
 }
 
+
+TEST(DungeonValidatorTest, WarnsAboutStackedDuplicateObjects) {
+  Rom rom;
+  ASSERT_TRUE(rom.LoadFromData(std::vector<uint8_t>(0x200000, 0)).ok());
+
+  Room room(/*room_id=*/0, &rom);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(room.AddObject(MakeCanonicalRoomObject(0x21, /*x=*/10,
+                                                       /*y=*/12, /*layer=*/0))
+                    .ok());
+  }
+  // Same origin on another list is not a duplicate.
+  ASSERT_TRUE(room.AddObject(MakeCanonicalRoomObject(0x21, /*x=*/10, /*y=*/12,
+                                                     /*layer=*/1))
+                  .ok());
+
+  const auto result = DungeonValidator().ValidateRoom(room);
+
+  EXPECT_TRUE(result.is_valid);
+  EXPECT_TRUE(HasWarningContaining(
+      result, "2 duplicate object(s) stacked on an identical object (first: "
+              "0x021 at (10, 12))"));
+}
+
+TEST(DungeonValidatorTest, WarnsAboutStackedDuplicateSprites) {
+  Rom rom;
+  ASSERT_TRUE(rom.LoadFromData(std::vector<uint8_t>(0x200000, 0)).ok());
+
+  Room room(/*room_id=*/0, &rom);
+  room.GetSprites().emplace_back(0x41, /*x=*/4, /*y=*/6, /*subtype=*/0,
+                                 /*layer=*/0);
+  room.GetSprites().emplace_back(0x41, /*x=*/4, /*y=*/6, /*subtype=*/0,
+                                 /*layer=*/0);
+  // Same spot on the other layer is not a duplicate.
+  room.GetSprites().emplace_back(0x41, /*x=*/4, /*y=*/6, /*subtype=*/0,
+                                 /*layer=*/1);
+
+  const auto result = DungeonValidator().ValidateRoom(room);
+
+  EXPECT_TRUE(result.is_valid);
+  EXPECT_TRUE(HasWarningContaining(
+      result, "1 duplicate sprite(s) stacked on an identical sprite (first: "
+              "0x41 at (4, 6))"));
+}
+
+TEST(DungeonValidatorTest, WarnsWhenDoorsExceedLimit) {
+  Rom rom;
+  ASSERT_TRUE(rom.LoadFromData(std::vector<uint8_t>(0x200000, 0)).ok());
+
+  Room room(/*room_id=*/0, &rom);
+  for (size_t i = 0; i <= kMaxDoors; ++i) {
+    Room::Door door{};
+    door.position = static_cast<uint8_t>(i);
+    room.AddDoor(door);
+  }
+
+  const auto result = DungeonValidator().ValidateRoom(room);
+
+  EXPECT_TRUE(result.is_valid);
+  EXPECT_TRUE(HasWarningContaining(result, "Too many doors (17 > 16)"));
+}
+
+TEST(DungeonValidatorTest, AcceptsDoorCountAtLimit) {
+  Rom rom;
+  ASSERT_TRUE(rom.LoadFromData(std::vector<uint8_t>(0x200000, 0)).ok());
+
+  Room room(/*room_id=*/0, &rom);
+  for (size_t i = 0; i < kMaxDoors; ++i) {
+    Room::Door door{};
+    door.position = static_cast<uint8_t>(i);
+    room.AddDoor(door);
+  }
+
+  const auto result = DungeonValidator().ValidateRoom(room);
+
+  EXPECT_FALSE(HasWarningContaining(result, "Too many doors"));
+}
+
+TEST(DungeonValidatorTest, WarnsWhenObjectStreamOutgrowsItsSlot) {
+  Rom rom;
+  ASSERT_TRUE(rom.LoadFromData(std::vector<uint8_t>(0x200000, 0)).ok());
+  // Header, list terminators and door marker take 10 bytes; two objects fill
+  // the remaining six.
+  SetRoomZeroObjectCapacity(rom, 16);
+
+  Room room(/*room_id=*/0, &rom);
+  for (uint8_t x = 4; x < 10; x += 2) {
+    ASSERT_TRUE(room.AddObject(MakeCanonicalRoomObject(0x21, x, 4, 0)).ok());
+  }
+
+  const auto result = DungeonValidator().ValidateRoom(room);
+
+  EXPECT_TRUE(result.is_valid);
+  EXPECT_TRUE(HasWarningContaining(
+      result, "Object stream needs 19 bytes but only 16 fit in place"));
+}
+
+TEST(DungeonValidatorTest, AcceptsObjectStreamThatFitsItsSlot) {
+  Rom rom;
+  ASSERT_TRUE(rom.LoadFromData(std::vector<uint8_t>(0x200000, 0)).ok());
+  SetRoomZeroObjectCapacity(rom, 16);
+
+  Room room(/*room_id=*/0, &rom);
+  for (uint8_t x = 4; x < 8; x += 2) {
+    ASSERT_TRUE(room.AddObject(MakeCanonicalRoomObject(0x21, x, 4, 0)).ok());
+  }
+
+  const auto result = DungeonValidator().ValidateRoom(room);
+
+  EXPECT_TRUE(result.warnings.empty());
+}
+
 }  // namespace
 }  // namespace zelda3
 }  // namespace yaze
@@ -0,0 +1,115 @@
+#include "zelda3/dungeon/incremental_dungeon_validator.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "rom/rom.h"
+#include "util/task_scheduler.h"
+#include "zelda3/dungeon/room.h"
+#include "zelda3/dungeon/room_object.h"
+#include "zelda3/sprite/sprite.h"
+
+namespace yaze::zelda3::test {
+namespace {
+
+int CountRulesReading(uint8_t inputs) {
+  int count = 0;
+  for (const auto& rule : GetRoomValidationRules()) {
+    count += (rule.inputs & inputs) != 0 ? 1 : 0;
+  }
+  return count;
+}
+
+class IncrementalDungeonValidatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(rom_.LoadFromData(std::vector<uint8_t>(0x200000, 0)).ok());
+  }
+
+  void AddStackedObjects(Room& room, int count) {
+    for (int i = 0; i < count; ++i) {
+      ASSERT_TRUE(room.AddObject(RoomObject(0x21, /*x=*/10, /*y=*/12,
+                                            CanonicalRoomObjectSize(0x21, 0),
+                                            /*layer=*/0))
+                      .ok());
+    }
+  }
+
+  Rom rom_;
+};
+
+TEST_F(IncrementalDungeonValidatorTest, MatchesFullValidation) {
+  util::TaskScheduler scheduler(0);
+  IncrementalDungeonValidator validator(scheduler);
+  Room room(/*room_id=*/5, &rom_);
+  AddStackedObjects(room, 3);
+  room.GetSprites().emplace_back(0x41, 4, 4, 0, 0);
+  room.GetSprites().emplace_back(0x41, 4, 4, 0, 0);
+
+  const ValidationResult& result = validator.Update(room);
+  const ValidationResult expected = DungeonValidator().ValidateRoom(room);
+
+  EXPECT_EQ(result.warnings, expected.warnings);
+  EXPECT_EQ(result.errors, expected.errors);
+  EXPECT_EQ(result.warnings.size(), 2u);
+  EXPECT_TRUE(validator.IsCurrent(room.id()));
+}
+
+TEST_F(IncrementalDungeonValidatorTest, ReRunsOnlyRulesReadingChangedInput) {
+  util::TaskScheduler scheduler(0);
+  IncrementalDungeonValidator validator(scheduler);
+  Room room(/*room_id=*/5, &rom_);
+  AddStackedObjects(room, 2);
+
+  validator.Update(room);
+  const int rule_count = static_cast<int>(GetRoomValidationRules().size());
+  EXPECT_EQ(validator.rules_run(), rule_count);
+
+  // Nothing changed: nothing re-runs.
+  validator.Update(room);
+  EXPECT_EQ(validator.rules_run(), rule_count);
+
+  validator.NotifyChanged(room.id(), kRoomInputSprites);
+  const ValidationResult& result = validator.Update(room);
+  EXPECT_EQ(validator.rules_run(),
+            rule_count + CountRulesReading(kRoomInputSprites));
+  // Results of the object rules are kept.
+  ASSERT_EQ(result.warnings.size(), 1u);
+  EXPECT_NE(result.warnings[0].find("duplicate object"), std::string::npos);
+}
+
+TEST_F(IncrementalDungeonValidatorTest, CountChangesRefreshWithoutNotify) {
+  util::TaskScheduler scheduler(0);
+  IncrementalDungeonValidator validator(scheduler);
+  Room room(/*room_id=*/5, &rom_);
+  AddStackedObjects(room, 1);
+  EXPECT_TRUE(validator.Update(room).warnings.empty());
+
+  AddStackedObjects(room, 1);
+
+  EXPECT_EQ(validator.Update(room).warnings.size(), 1u);
+}
+
+TEST_F(IncrementalDungeonValidatorTest, RunsOffThreadAndCoalescesEdits) {
+  util::TaskScheduler scheduler(2);
+  IncrementalDungeonValidator validator(scheduler);
+  Room room(/*room_id=*/5, &rom_);
+  AddStackedObjects(room, 2);
+
+  validator.Update(room);
+  // Edits made while a run may be in flight wait for the next Update().
+  room.GetSprites().emplace_back(0x41, 4, 4, 0, 0);
+  room.GetSprites().emplace_back(0x41, 4, 4, 0, 0);
+  validator.NotifyChanged(room.id(), kRoomInputSprites);
+  validator.Wait();
+  validator.Update(room);
+  validator.Wait();
+
+  EXPECT_TRUE(validator.IsCurrent(room.id()));
+  EXPECT_EQ(validator.GetResult(room.id()).warnings,
+            DungeonValidator().ValidateRoom(room).warnings);
+}
+
+}  // namespace
+}  // namespace yaze::zelda3::test
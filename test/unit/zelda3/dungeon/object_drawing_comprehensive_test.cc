@@ -1002,7 +1002,7 @@ TEST_F(ObjectDrawingComprehensiveTest, ParityFullSubtype3RoutineCoverage) {
 }
 
 TEST_F(ObjectDrawingComprehensiveTest, ParityAllRoutineIdsInBounds) {
-  // Every mapped routine ID must be within the draw_routines_ array bounds
+  // Every mapped routine ID must be within the dispatch table bounds
   auto& reg = DrawRoutineRegistry::Get();
   ObjectDrawer drawer(rom_.get(), 0);
   const int max_routine = drawer.GetDrawRoutineCount() - 1;
@@ -0,0 +1,79 @@
+#include "zelda3/dungeon/object_footprint_index.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "zelda3/dungeon/room_object.h"
+
+namespace yaze::zelda3::test {
+namespace {
+
+using Entry = ObjectFootprintIndex::Entry;
+constexpr int kGrid = ObjectFootprintIndex::kGridSize;
+
+Entry MakeEntry(const RoomObject& object, int tile_x, int tile_y, int tiles_w,
+                int tiles_h) {
+  Entry entry;
+  entry.object = object;
+  ObjectFootprintIndex::AddRectCells(tile_x, tile_y, tiles_w, tiles_h,
+                                     entry.cells);
+  ObjectFootprintIndex::Normalize(entry.cells);
+  return entry;
+}
+
+TEST(ObjectFootprintIndexTest, CloseOverFollowsChainsOfOverlap) {
+  // 0 overlaps 1, 1 overlaps 2, 3 is far away.
+  std::vector<Entry> entries;
+  entries.push_back(MakeEntry(RoomObject(0x01, 0, 0, 0), 0, 0, 4, 4));
+  entries.push_back(MakeEntry(RoomObject(0x02, 3, 3, 0), 3, 3, 4, 4));
+  entries.push_back(MakeEntry(RoomObject(0x03, 6, 6, 0), 6, 6, 2, 2));
+  entries.push_back(MakeEntry(RoomObject(0x04, 40, 40, 0), 40, 40, 2, 2));
+
+  ObjectFootprintIndex index;
+  EXPECT_FALSE(index.valid());
+  index.Reset(std::move(entries), 7);
+  EXPECT_TRUE(index.valid());
+  EXPECT_EQ(index.object_tile_revision(), 7u);
+
+  ObjectFootprintIndex::TileMask region;
+  region.set(0);
+  EXPECT_EQ(index.CloseOver(region), (std::vector<size_t>{0, 1, 2}));
+  EXPECT_TRUE(region[7 * kGrid + 7]);
+  EXPECT_FALSE(region[40 * kGrid + 40]);
+}
+
+TEST(ObjectFootprintIndexTest, FindChangedMatchesObjectsByIndex) {
+  std::vector<RoomObject> objects = {RoomObject(0x01, 2, 2, 0),
+                                     RoomObject(0x02, 10, 10, 1, 1)};
+  std::vector<Entry> entries;
+  for (const auto& object : objects) {
+    entries.push_back(MakeEntry(object, object.x(), object.y(), 2, 2));
+  }
+  ObjectFootprintIndex index;
+  index.Reset(std::move(entries), 0);
+
+  std::vector<size_t> changed;
+  ASSERT_TRUE(index.FindChanged(objects, &changed));
+  EXPECT_TRUE(changed.empty());
+
+  objects[1].set_size(3);
+  ASSERT_TRUE(index.FindChanged(objects, &changed));
+  EXPECT_EQ(changed, (std::vector<size_t>{1}));
+
+  // Inserting or removing objects cannot be matched by index.
+  objects.push_back(RoomObject(0x03, 0, 0, 0));
+  changed.clear();
+  EXPECT_FALSE(index.FindChanged(objects, &changed));
+}
+
+TEST(ObjectFootprintIndexTest, RectCellsClipToTheRoom) {
+  std::vector<uint16_t> cells;
+  ObjectFootprintIndex::AddRectCells(kGrid - 1, -1, 3, 2, cells);
+  ObjectFootprintIndex::Normalize(cells);
+  EXPECT_EQ(cells, (std::vector<uint16_t>{kGrid - 1}));
+}
+
+}  // namespace
+}  // namespace yaze::zelda3::test
@@ -0,0 +1,105 @@
+#include "zelda3/dungeon/object_spatial_index.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "zelda3/dungeon/room_object.h"
+
+namespace yaze::zelda3::test {
+namespace {
+
+using Bounds = ObjectSpatialIndex::Bounds;
+
+// Objects cover (size + 1) tiles square from their origin, except id 0x40,
+// whose bounds sit two tiles up-left of the origin.
+ObjectSpatialIndex MakeIndex() {
+  return ObjectSpatialIndex([](const RoomObject& object) {
+    const int extent = object.size_ + 1;
+    if (object.id_ == 0x40) {
+      return Bounds{object.x_ - 2, object.y_ - 2, 2, 2};
+    }
+    return Bounds{object.x_, object.y_, extent, extent};
+  });
+}
+
+std::vector<size_t> LinearPoint(const std::vector<RoomObject>& objects,
+                                const ObjectSpatialIndex& index, int x,
+                                int y) {
+  std::vector<size_t> hits;
+  for (size_t i = 0; i < objects.size(); ++i) {
+    if (index.bounds(i).Contains(x, y)) {
+      hits.push_back(i);
+    }
+  }
+  return hits;
+}
+
+TEST(ObjectSpatialIndexTest, PointAndRectQueriesRespectBoundsAndLists) {
+  std::vector<RoomObject> objects = {
+      RoomObject(0x01, 4, 4, 3, 0),   // 4..7
+      RoomObject(0x02, 6, 6, 1, 0),   // 6..7
+      RoomObject(0x03, 6, 6, 1, 1),   // BG2 overlay list
+      RoomObject(0x04, 62, 62, 7, 2)  // Clipped at the room edge
+  };
+  ObjectSpatialIndex index = MakeIndex();
+  index.Build(objects);
+
+  EXPECT_EQ(index.QueryPoint(7, 7), (std::vector<size_t>{0, 1, 2}));
+  EXPECT_EQ(index.QueryPoint(7, 7, 0), (std::vector<size_t>{0, 1}));
+  EXPECT_EQ(index.QueryPoint(5, 5), (std::vector<size_t>{0}));
+  EXPECT_TRUE(index.QueryPoint(8, 8).empty());
+  EXPECT_EQ(index.QueryPoint(63, 63), (std::vector<size_t>{3}));
+
+  EXPECT_EQ(index.QueryRect(0, 0, 5, 5), (std::vector<size_t>{0}));
+  EXPECT_EQ(index.QueryRect(60, 60, 6, 6), (std::vector<size_t>{0, 1, 2}));
+  EXPECT_EQ(index.QueryOverlapping(1), (std::vector<size_t>{0}));
+}
+
+TEST(ObjectSpatialIndexTest, OriginQueriesFindObjectsWithOffsetBounds) {
+  std::vector<RoomObject> objects = {RoomObject(0x40, 10, 10, 0, 0)};
+  ObjectSpatialIndex index = MakeIndex();
+  index.Build(objects);
+
+  EXPECT_TRUE(index.QueryPoint(10, 10).empty());
+  EXPECT_EQ(index.QueryPoint(8, 8), (std::vector<size_t>{0}));
+  EXPECT_EQ(index.QueryOrigin(10, 10), (std::vector<size_t>{0}));
+}
+
+TEST(ObjectSpatialIndexTest, IncrementalEditsMatchARebuild) {
+  std::vector<RoomObject> objects;
+  ObjectSpatialIndex index = MakeIndex();
+  for (int i = 0; i < 24; ++i) {
+    RoomObject object(static_cast<int16_t>(i), (i * 5) % 60, (i * 7) % 60,
+                      static_cast<uint8_t>(i % 4),
+                      static_cast<uint8_t>(i % 3));
+    objects.push_back(object);
+    index.Insert(objects.size() - 1, object);
+  }
+
+  RoomObject inserted(0x30, 20, 20, 2, 0);
+  objects.insert(objects.begin() + 3, inserted);
+  index.Insert(3, inserted);
+  objects.erase(objects.begin() + 10);
+  index.Remove(10);
+  objects[5].set_x(1);
+  objects[5].set_y(1);
+  index.Update(5, objects[5]);
+  objects[7].set_size(3);
+  EXPECT_EQ(index.Sync(objects), 1u);
+
+  ObjectSpatialIndex rebuilt = MakeIndex();
+  rebuilt.Build(objects);
+  ASSERT_EQ(index.size(), objects.size());
+  for (int y = 0; y < ObjectSpatialIndex::kGridSize; ++y) {
+    for (int x = 0; x < ObjectSpatialIndex::kGridSize; ++x) {
+      ASSERT_EQ(index.QueryPoint(x, y), rebuilt.QueryPoint(x, y))
+          << "tile " << x << "," << y;
+      ASSERT_EQ(index.QueryPoint(x, y), LinearPoint(objects, rebuilt, x, y));
+      ASSERT_EQ(index.QueryOrigin(x, y), rebuilt.QueryOrigin(x, y));
+    }
+  }
+}
+
+}  // namespace
+}  // namespace yaze::zelda3::test
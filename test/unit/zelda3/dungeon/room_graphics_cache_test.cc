@@ -0,0 +1,80 @@
+#include "zelda3/dungeon/room_graphics_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "app/gfx/resource/arena.h"
+#include "rom/rom.h"
+#include "zelda3/dungeon/room.h"
+#include "zelda3/game_data.h"
+
+namespace yaze::zelda3::test {
+namespace {
+
+class RoomGraphicsCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    RoomGraphicsCache::Get().Clear();
+    ASSERT_TRUE(rom_.LoadFromData(std::vector<uint8_t>(0x200000, 0)).ok());
+    game_data_.graphics_buffer.assign(16 * 4096, 0);
+    for (int sheet = 0; sheet < 16; ++sheet) {
+      game_data_.graphics_buffer[sheet * 4096] = static_cast<uint8_t>(sheet);
+    }
+  }
+
+  std::unique_ptr<Room> MakeRoom(int room_id, int first_sheet) {
+    auto room = std::make_unique<Room>(room_id, &rom_, &game_data_);
+    for (int block = 0; block < 16; ++block) {
+      room->mutable_blocks()[block] =
+          static_cast<uint8_t>((first_sheet + block) % 16);
+    }
+    return room;
+  }
+
+  Rom rom_;
+  GameData game_data_;
+};
+
+TEST_F(RoomGraphicsCacheTest, RoomsWithTheSameSheetsShareOneBuffer) {
+  auto first = MakeRoom(0, 0);
+  auto second = MakeRoom(1, 0);
+  auto other = MakeRoom(2, 1);
+  first->CopyRoomGraphicsToBuffer();
+  second->CopyRoomGraphicsToBuffer();
+  other->CopyRoomGraphicsToBuffer();
+
+  EXPECT_EQ(&first->get_gfx_buffer(), &second->get_gfx_buffer());
+  EXPECT_NE(&first->get_gfx_buffer(), &other->get_gfx_buffer());
+  EXPECT_EQ(other->get_gfx_buffer()[0], 1);
+  EXPECT_EQ(RoomGraphicsCache::Get().stats().builds, 2u);
+  EXPECT_EQ(RoomGraphicsCache::Get().stats().hits, 1u);
+
+  // Buffers die with the last room using them.
+  first.reset();
+  EXPECT_EQ(RoomGraphicsCache::Get().LiveCount(), 2u);
+  second.reset();
+  EXPECT_EQ(RoomGraphicsCache::Get().LiveCount(), 1u);
+}
+
+TEST_F(RoomGraphicsCacheTest, SheetEditsRebuildOnlyAffectedBuffers) {
+  auto room = MakeRoom(0, 0);
+  room->CopyRoomGraphicsToBuffer();
+  const uint8_t* before = room->get_gfx_buffer().data();
+
+  game_data_.graphics_buffer[5 * 4096] = 0x42;
+  gfx::Arena::Get().NotifySheetModified(200);  // Not used by the room
+  room->CopyRoomGraphicsToBuffer();
+  EXPECT_EQ(room->get_gfx_buffer().data(), before);
+  EXPECT_EQ(room->get_gfx_buffer()[5 * 4096], 5);
+
+  gfx::Arena::Get().NotifySheetModified(5);
+  EXPECT_EQ(RoomGraphicsCache::Get().stats().invalidations, 1u);
+  room->CopyRoomGraphicsToBuffer();
+  EXPECT_EQ(room->get_gfx_buffer()[5 * 4096], 0x42);
+}
+
+}  // namespace
+}  // namespace yaze::zelda3::test
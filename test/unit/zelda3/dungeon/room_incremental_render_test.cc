@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "app/gfx/render/background_buffer.h"
+#include "rom/rom.h"
+#include "rom/snes.h"
+#include "zelda3/dungeon/dungeon_rom_addresses.h"
+#include "zelda3/dungeon/object_footprint_index.h"
+#include "zelda3/dungeon/room.h"
+#include "zelda3/dungeon/room_layer_manager.h"
+#include "zelda3/dungeon/room_object.h"
+#include "zelda3/game_data.h"
+
+namespace yaze::zelda3::test {
+namespace {
+
+// Incremental object redraws must leave the room exactly as a full render of
+// the same objects would.
+class RoomIncrementalRenderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(rom_.LoadFromData(std::vector<uint8_t>(0x200000, 0)).ok());
+
+    // Empty layouts, so only the test's objects land on the object layers.
+    for (const int layout_pointer : kRoomLayoutPointers) {
+      ASSERT_TRUE(
+          rom_.WriteVector(SnesToPc(layout_pointer), {0xFF, 0xFF}).ok());
+    }
+
+    // Tiles 0 and 1 of sheet 0 draw solid pixels 1 and 2.
+    game_data_.graphics_buffer.assign(kNumGfxSheets * 4096, 0);
+    for (int y = 0; y < 8; ++y) {
+      for (int x = 0; x < 8; ++x) {
+        game_data_.graphics_buffer[y * 128 + x] = 1;
+        game_data_.graphics_buffer[y * 128 + 8 + x] = 2;
+      }
+    }
+
+    gfx::SnesPalette dungeon_palette;
+    for (int i = 0; i < kDungeonPaletteBytes / 2; ++i) {
+      dungeon_palette.AddColor(
+          gfx::SnesColor(i % 32, (i * 2) % 32, (i * 3) % 32));
+    }
+    game_data_.palette_groups.dungeon_main.AddPalette(dungeon_palette);
+  }
+
+  // Object 0x34 draws a row of size + 4 copies of its tile starting three
+  // tiles right of its origin.
+  static RoomObject MakeRow(uint8_t x, uint8_t y, uint8_t size, uint8_t layer,
+                            uint16_t tile_id, uint8_t palette) {
+    RoomObject object(/*id=*/0x34, x, y, size, layer);
+    object.tiles_loaded_ = true;
+    object.tiles_ = {gfx::TileInfo(tile_id, palette, false, false, false)};
+    return object;
+  }
+
+  void Render(Room& room) { room.RenderRoomGraphics(); }
+
+  void ExpectMatchesFullRender(Room& room) {
+    Room full(room.id(), &rom_, &game_data_);
+    full.SetTileObjects(room.GetTileObjects());
+    full.MarkGraphicsDirty();
+    Render(full);
+    ASSERT_FALSE(full.last_object_render_incremental());
+
+    ExpectSameBuffer(room.object_bg1_buffer(), full.object_bg1_buffer());
+    ExpectSameBuffer(room.object_bg2_buffer(), full.object_bg2_buffer());
+    EXPECT_EQ(room.bg1_buffer().bg1_reveal_mask_data(),
+              full.bg1_buffer().bg1_reveal_mask_data());
+
+    RoomLayerManager room_layers;
+    RoomLayerManager full_layers;
+    EXPECT_EQ(room.GetCompositeBitmap(room_layers).vector(),
+              full.GetCompositeBitmap(full_layers).vector());
+
+    const auto& entries = room.object_footprints().entries();
+    const auto& expected = full.object_footprints().entries();
+    ASSERT_TRUE(room.object_footprints().valid());
+    ASSERT_EQ(entries.size(), expected.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+      SCOPED_TRACE(i);
+      EXPECT_TRUE(SameObjectState(entries[i].object, expected[i].object));
+      EXPECT_EQ(entries[i].cells, expected[i].cells);
+      EXPECT_EQ(entries[i].cursor_before, expected[i].cursor_before);
+      EXPECT_EQ(entries[i].cursor_after, expected[i].cursor_after);
+      EXPECT_EQ(entries[i].special_table, expected[i].special_table);
+    }
+  }
+
+  static void ExpectSameBuffer(const gfx::BackgroundBuffer& actual,
+                               const gfx::BackgroundBuffer& expected) {
+    EXPECT_EQ(actual.bitmap().vector(), expected.bitmap().vector());
+    EXPECT_EQ(actual.priority_data(), expected.priority_data());
+    EXPECT_EQ(actual.coverage_data(), expected.coverage_data());
+    EXPECT_EQ(actual.bg1_reveal_mask_data(), expected.bg1_reveal_mask_data());
+  }
+
+  Rom rom_;
+  GameData game_data_;
+};
+
+TEST_F(RoomIncrementalRenderTest, MatchesFullRenderAfterMoveResizeAndDelete) {
+  Room room(/*room_id=*/0, &rom_, &game_data_);
+  room.SetTileObjects({
+      MakeRow(/*x=*/2, /*y=*/3, /*size=*/2, /*layer=*/0, /*tile_id=*/0, 2),
+      // Overlaps the first row, so redrawing either pulls in the other.
+      MakeRow(/*x=*/6, /*y=*/3, /*size=*/0, /*layer=*/0, /*tile_id=*/1, 3),
+      MakeRow(/*x=*/20, /*y=*/10, /*size=*/1, /*layer=*/1, /*tile_id=*/0, 4),
+      MakeRow(/*x=*/30, /*y=*/20, /*size=*/0, /*layer=*/0, /*tile_id=*/1, 2),
+  });
+  room.MarkGraphicsDirty();
+  Render(room);
+  ASSERT_FALSE(room.last_object_render_incremental());
+
+  // Resize the first row under its neighbour and move both lone rows, which
+  // leaves their old cells empty.
+  RoomObject resized = room.GetTileObjects()[0];
+  resized.set_size(5);
+  ASSERT_TRUE(room.UpdateObject(0, resized).ok());
+  RoomObject moved_bg2 = room.GetTileObjects()[2];
+  moved_bg2.set_x(24);
+  moved_bg2.set_y(12);
+  ASSERT_TRUE(room.UpdateObject(2, moved_bg2).ok());
+  RoomObject moved_bg1 = room.GetTileObjects()[3];
+  moved_bg1.set_x(34);
+  moved_bg1.set_y(22);
+  ASSERT_TRUE(room.UpdateObject(3, moved_bg1).ok());
+  room.MarkObjectsDirty();
+  Render(room);
+
+  EXPECT_TRUE(room.last_object_render_incremental());
+  ExpectMatchesFullRender(room);
+
+  // Removing an object changes the list, which takes the full path.
+  ASSERT_TRUE(room.RemoveObject(3).ok());
+  room.MarkObjectsDirty();
+  Render(room);
+
+  EXPECT_FALSE(room.last_object_render_incremental());
+  ExpectMatchesFullRender(room);
+
+  // The rebuilt footprints support the next incremental edit.
+  RoomObject shifted = room.GetTileObjects()[1];
+  shifted.set_x(4);
+  ASSERT_TRUE(room.UpdateObject(1, shifted).ok());
+  room.MarkObjectsDirty();
+  Render(room);
+
+  EXPECT_TRUE(room.last_object_render_incremental());
+  ExpectMatchesFullRender(room);
+}
+
+}  // namespace
+}  // namespace yaze::zelda3::test
@@ -0,0 +1,112 @@
+#include "zelda3/dungeon/room_stream_table.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "rom/rom.h"
+#include "rom/snes.h"
+#include "zelda3/dungeon/dungeon_rom_addresses.h"
+
+namespace yaze::zelda3::test {
+namespace {
+
+int NoRegionEnd(int) {
+  return -1;
+}
+
+TEST(RoomStreamTableTest, BoundsEachRoomByTheNextGreaterAddress) {
+  // Pointer order differs from room order on purpose.
+  const std::vector<int> addresses = {0x1040, 0x1000, 0x1010, -1};
+
+  const RoomStreamTable table = BuildRoomStreamTable(addresses, NoRegionEnd);
+
+  ASSERT_EQ(table.rooms.size(), 4u);
+  EXPECT_EQ(table.rooms[1].physical_end, 0x1010);
+  EXPECT_EQ(table.rooms[2].physical_end, 0x1040);
+  EXPECT_EQ(table.rooms[2].capacity(), 0x30);
+  // Nothing bounds the highest stream, so it fails closed.
+  EXPECT_EQ(table.rooms[0].physical_end, -1);
+  EXPECT_EQ(table.rooms[0].capacity(), 0);
+  EXPECT_EQ(table.rooms[3].address, -1);
+  EXPECT_EQ(table.stream_count, 3);
+  EXPECT_EQ(table.unbounded_room_count, 1);
+}
+
+TEST(RoomStreamTableTest, MarksSharedStartsAndUsesRegionEnd) {
+  const std::vector<int> addresses = {0x2000, 0x2020, 0x2000};
+
+  const RoomStreamTable table =
+      BuildRoomStreamTable(addresses, [](int) { return 0x2030; });
+
+  EXPECT_TRUE(table.rooms[0].shared);
+  EXPECT_TRUE(table.rooms[2].shared);
+  EXPECT_FALSE(table.rooms[1].shared);
+  EXPECT_EQ(table.rooms[0].physical_end, 0x2020);
+  EXPECT_EQ(table.rooms[1].physical_end, 0x2030);
+  EXPECT_EQ(table.stream_count, 2);
+  EXPECT_EQ(table.shared_room_count, 2);
+}
+
+TEST(RoomStreamTableTest, DoesNotGrowAcrossLoRomBankEnd) {
+  // The next pointer lives in the following bank.
+  const std::vector<int> addresses = {0x7FF0, 0x8010};
+
+  const RoomStreamTable table = BuildRoomStreamTable(addresses, NoRegionEnd);
+
+  EXPECT_EQ(table.rooms[0].physical_end, -1);
+}
+
+TEST(RoomStreamTableTest, SpansRunLastStreamToBankEnd) {
+  const std::vector<int> addresses = {0x1000, 0x1040, 0x9000, -1};
+
+  const std::vector<int> spans =
+      RoomStreamSpans(BuildRoomStreamTable(addresses, NoRegionEnd));
+
+  ASSERT_EQ(spans.size(), 4u);
+  EXPECT_EQ(spans[0], 0x40);
+  // The last stream of each bank is sized up to the bank end even though it
+  // has no in-place capacity.
+  EXPECT_EQ(spans[1], 0x8000 - 0x1040);
+  EXPECT_EQ(spans[2], 0x10000 - 0x9000);
+  EXPECT_EQ(spans[3], 0);
+}
+
+TEST(RoomStreamTableTest, SpansCountSharedStreamOnce) {
+  const std::vector<int> addresses = {0x2020, 0x2000, 0x2040, 0x2000};
+
+  const std::vector<int> spans =
+      RoomStreamSpans(BuildRoomStreamTable(addresses, NoRegionEnd));
+
+  // The lowest room ID of the shared stream carries its size.
+  EXPECT_EQ(spans[1], 0x20);
+  EXPECT_EQ(spans[3], 0);
+  EXPECT_EQ(spans[0], 0x20);
+}
+
+TEST(RoomStreamTableTest, CachedTablesFollowRawPointerWrites) {
+  Rom rom;
+  ASSERT_TRUE(rom.LoadFromData(std::vector<uint8_t>(0x100000, 0)).ok());
+  const auto write_word = [&rom](int address, uint16_t value) {
+    rom.mutable_data()[address] = value & 0xFF;
+    rom.mutable_data()[address + 1] = value >> 8;
+  };
+  write_word(kRoomItemsPointers, PcToSnes(0xE000) & 0xFFFF);
+  write_word(kRoomItemsPointers + 2, PcToSnes(0xE010) & 0xFFFF);
+
+  const auto first = GetRoomStreamTables(rom);
+  EXPECT_EQ(GetRoomStreamTables(rom), first);
+  ASSERT_TRUE(first->pot_items.status.ok());
+  EXPECT_EQ(first->pot_items.rooms[0].capacity(), 0x10);
+
+  write_word(kRoomItemsPointers + 2, PcToSnes(0xE008) & 0xFFFF);
+  const auto second = GetRoomStreamTables(rom);
+
+  EXPECT_NE(second, first);
+  EXPECT_EQ(second->pot_items.rooms[0].capacity(), 0x08);
+  EXPECT_EQ(first->pot_items.rooms[0].capacity(), 0x10);
+}
+
+}  // namespace
+}  // namespace yaze::zelda3::test
@@ -0,0 +1,132 @@
+#include "zelda3/dungeon/room_thumbnail.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace yaze::zelda3::test {
+namespace {
+
+constexpr int kCompositeSize = 512;
+
+std::array<uint32_t, 256> MakePalette() {
+  std::array<uint32_t, 256> palette{};
+  palette[1] = 0xFF0000FF;  // red
+  palette[2] = 0x0000FFFF;  // blue
+  return palette;
+}
+
+RoomThumbnail MakeThumbnail(int room_id, uint32_t crc, uint32_t fill) {
+  RoomThumbnail thumbnail;
+  thumbnail.room_id = room_id;
+  thumbnail.source_crc = crc;
+  thumbnail.pixels.assign(RoomThumbnail::kPixelCount, fill);
+  return thumbnail;
+}
+
+class RoomThumbnailCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    dir_ = std::filesystem::temp_directory_path() /
+           ("yaze_room_thumbnail_test_" +
+            std::string(::testing::UnitTest::GetInstance()
+                            ->current_test_info()
+                            ->name()));
+    std::filesystem::remove_all(dir_);
+  }
+  void TearDown() override { std::filesystem::remove_all(dir_); }
+
+  std::filesystem::path dir_;
+};
+
+TEST(RoomThumbnailTest, DownsampleAveragesEachCell) {
+  std::vector<uint8_t> composite(kCompositeSize * kCompositeSize, 255);
+  // Top-left cell: left half red, right half blue.
+  for (int y = 0; y < 8; ++y) {
+    for (int x = 0; x < 8; ++x) {
+      composite[y * kCompositeSize + x] = x < 4 ? 1 : 2;
+    }
+  }
+  const auto palette = MakePalette();
+
+  const RoomThumbnail thumbnail = DownsampleRoomComposite(composite, palette);
+
+  ASSERT_EQ(thumbnail.pixels.size(), RoomThumbnail::kPixelCount);
+  EXPECT_EQ(thumbnail.pixels[0], 0x7F007FFFu);
+  EXPECT_EQ(thumbnail.pixels[1], 0u);
+}
+
+TEST(RoomThumbnailTest, DownsampleFadesPartiallyTransparentCells) {
+  std::vector<uint8_t> composite(kCompositeSize * kCompositeSize, 255);
+  // Half of the second cell is covered.
+  for (int y = 0; y < 4; ++y) {
+    for (int x = 8; x < 16; ++x) {
+      composite[y * kCompositeSize + x] = 1;
+    }
+  }
+  const auto palette = MakePalette();
+
+  const RoomThumbnail thumbnail = DownsampleRoomComposite(composite, palette);
+
+  // Color stays red instead of darkening; coverage goes to alpha.
+  EXPECT_EQ(thumbnail.pixels[1], 0xFF00007Fu);
+}
+
+TEST(RoomThumbnailTest, DownsampleRejectsShortInput) {
+  std::vector<uint8_t> composite(64, 1);
+  const auto palette = MakePalette();
+
+  const RoomThumbnail thumbnail = DownsampleRoomComposite(composite, palette);
+
+  ASSERT_EQ(thumbnail.pixels.size(), RoomThumbnail::kPixelCount);
+  EXPECT_EQ(thumbnail.pixels[0], 0u);
+}
+
+TEST_F(RoomThumbnailCacheTest, RoundTripsEntries) {
+  const auto path = dir_ / "rom.thumbs";
+  const std::vector<RoomThumbnail> entries = {
+      MakeThumbnail(0x000, 0x12345678, 0x11223344),
+      MakeThumbnail(0x127, 0xDEADBEEF, 0xAABBCCDD)};
+
+  ASSERT_TRUE(WriteRoomThumbnailCache(path, "hash", entries).ok());
+  auto loaded = ReadRoomThumbnailCache(path, "hash");
+
+  ASSERT_TRUE(loaded.ok()) << loaded.status();
+  ASSERT_EQ(loaded->size(), 2u);
+  for (size_t i = 0; i < entries.size(); ++i) {
+    EXPECT_EQ((*loaded)[i].room_id, entries[i].room_id);
+    EXPECT_EQ((*loaded)[i].source_crc, entries[i].source_crc);
+    EXPECT_EQ((*loaded)[i].pixels, entries[i].pixels);
+  }
+  EXPECT_FALSE(std::filesystem::exists(dir_ / "rom.thumbs.tmp"));
+}
+
+TEST_F(RoomThumbnailCacheTest, RejectsCacheForDifferentRom) {
+  const auto path = dir_ / "rom.thumbs";
+  ASSERT_TRUE(
+      WriteRoomThumbnailCache(path, "hash", {MakeThumbnail(1, 1, 1)}).ok());
+
+  auto loaded = ReadRoomThumbnailCache(path, "other");
+
+  EXPECT_TRUE(absl::IsFailedPrecondition(loaded.status())) << loaded.status();
+}
+
+TEST_F(RoomThumbnailCacheTest, ReportsMissingAndCorruptFiles) {
+  EXPECT_TRUE(absl::IsNotFound(
+      ReadRoomThumbnailCache(dir_ / "missing.thumbs", "hash").status()));
+
+  const auto path = dir_ / "rom.thumbs";
+  ASSERT_TRUE(
+      WriteRoomThumbnailCache(path, "hash", {MakeThumbnail(1, 1, 1)}).ok());
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+
+  EXPECT_TRUE(
+      absl::IsDataLoss(ReadRoomThumbnailCache(path, "hash").status()));
+}
+
+}  // namespace
+}  // namespace yaze::zelda3::test
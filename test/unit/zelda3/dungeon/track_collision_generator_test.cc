@@ -291,5 +291,103 @@ TEST(TrackCollisionGeneratorTest,
   EXPECT_EQ(replacement_loaded_or->tiles, replacement.tiles);
 }
 
+TEST(TrackCollisionGeneratorTest, BatchMatchesPerRoomAndWritesOnlyChanges) {
+  Rom rom;
+  ASSERT_TRUE(
+      rom.LoadFromData(std::vector<uint8_t>(kCustomCollisionDataEnd, 0x00))
+          .ok());
+  Room unchanged(0x10, &rom);
+  unchanged.AddTileObject(RoomObject(0x31, 10, 10, 0, 0));
+  Room changed(0x11, &rom);
+  changed.AddTileObject(RoomObject(0x31, 20, 20, 0, 0));
+
+  auto stored_or = GenerateTrackCollision(&unchanged, GeneratorOptions{});
+  ASSERT_TRUE(stored_or.ok()) << stored_or.status();
+  ASSERT_TRUE(WriteTrackCollision(&rom, 0x10, stored_or->collision_map).ok());
+  const uint32_t unchanged_pointer = ReadCollisionPointerPc(rom, 0x10);
+  auto expected_or = GenerateTrackCollision(&changed, GeneratorOptions{});
+  ASSERT_TRUE(expected_or.ok()) << expected_or.status();
+
+  auto batch_or = GenerateTrackCollisionBatch({&unchanged, &changed});
+  ASSERT_TRUE(batch_or.ok()) << batch_or.status();
+  ASSERT_EQ(batch_or->rooms.size(), 2u);
+  EXPECT_FALSE(batch_or->rooms[0].changed);
+  EXPECT_TRUE(batch_or->rooms[1].changed);
+  EXPECT_EQ(batch_or->changed_count, 1);
+  EXPECT_EQ(batch_or->rooms[0].result.collision_map.tiles,
+            stored_or->collision_map.tiles);
+  EXPECT_EQ(batch_or->rooms[1].result.collision_map.tiles,
+            expected_or->collision_map.tiles);
+  EXPECT_EQ(batch_or->rooms[1].result.tiles_generated,
+            expected_or->tiles_generated);
+
+  ASSERT_TRUE(WriteTrackCollisionBatch(&rom, *batch_or).ok());
+  EXPECT_EQ(ReadCollisionPointerPc(rom, 0x10), unchanged_pointer);
+  auto loaded_or = LoadCustomCollisionMap(&rom, 0x11);
+  ASSERT_TRUE(loaded_or.ok()) << loaded_or.status();
+  EXPECT_EQ(loaded_or->tiles, expected_or->collision_map.tiles);
+}
+
+TEST(TrackCollisionGeneratorTest, BatchPreservesStopsAndSkipsTracklessRooms) {
+  Rom rom;
+  ASSERT_TRUE(
+      rom.LoadFromData(std::vector<uint8_t>(kCustomCollisionDataEnd, 0x00))
+          .ok());
+  const CustomCollisionMap hand_placed = MakeCollisionMap({{0, 0xB8}});
+  ASSERT_TRUE(WriteTrackCollision(&rom, 0x10, hand_placed).ok());
+  ASSERT_TRUE(WriteTrackCollision(&rom, 0x11, hand_placed).ok());
+  Room track(0x10, &rom);
+  track.AddTileObject(RoomObject(0x31, 10, 10, 0, 0));
+  Room trackless(0x11, &rom);
+  trackless.AddTileObject(RoomObject(0x21, 10, 10, 0, 0));
+
+  TrackCollisionBatchOptions options;
+  options.preserve_stops = true;
+  options.skip_rooms_without_track = true;
+  auto batch_or = GenerateTrackCollisionBatch({&track, &trackless}, options);
+  ASSERT_TRUE(batch_or.ok()) << batch_or.status();
+
+  EXPECT_TRUE(batch_or->rooms[0].changed);
+  EXPECT_EQ(batch_or->rooms[0].result.collision_map.tiles[0], 0xB8);
+  EXPECT_FALSE(batch_or->rooms[1].changed);
+
+  options.skip_rooms_without_track = false;
+  batch_or = GenerateTrackCollisionBatch({&track, &trackless}, options);
+  ASSERT_TRUE(batch_or.ok()) << batch_or.status();
+  EXPECT_FALSE(batch_or->rooms[1].changed);
+  options.preserve_stops = false;
+  batch_or = GenerateTrackCollisionBatch({&track, &trackless}, options);
+  ASSERT_TRUE(batch_or.ok()) << batch_or.status();
+  EXPECT_TRUE(batch_or->rooms[1].changed);
+}
+
+TEST(TrackCollisionGeneratorTest,
+     BatchWriteLeavesRomUntouchedWhenOneRoomFails) {
+  Rom rom;
+  ASSERT_TRUE(
+      rom.LoadFromData(std::vector<uint8_t>(kCustomCollisionDataEnd, 0x00))
+          .ok());
+  // Leave room for exactly one two-tile map before the WaterFill region.
+  constexpr int kTwoTileMapSize = 2 + (2 * 3) + 2;
+  const uint32_t filler = kCustomCollisionDataSoftEnd - kTwoTileMapSize - 2;
+  ASSERT_TRUE(rom.WriteVector(filler, {0xFF, 0xFF}).ok());
+  SetCollisionPointer(&rom, 0x02, filler);
+  const std::vector<uint8_t> before = rom.vector();
+
+  TrackCollisionBatch batch;
+  for (int room_id : {0x10, 0x11}) {
+    TrackCollisionBatchRoom room;
+    room.result.room_id = room_id;
+    room.result.collision_map = MakeCollisionMap({{0, 0xB0}, {1, 0xB0}});
+    room.changed = true;
+    batch.rooms.push_back(room);
+    ++batch.changed_count;
+  }
+
+  const absl::Status status = WriteTrackCollisionBatch(&rom, batch);
+  EXPECT_TRUE(absl::IsResourceExhausted(status)) << status;
+  EXPECT_EQ(rom.vector(), before);
+}
+
 }  // namespace
 }  // namespace yaze::zelda3
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "app/gfx/core/bitmap.h"
+#include "app/gfx/types/snes_tile.h"
+#include "app/gfx/util/compression.h"
+#include "rom/rom.h"
+#include "rom/snes.h"
+#include "rom/write_fence.h"
+#include "zelda3/game_data.h"
+
+namespace yaze::zelda3 {
+namespace {
+
+constexpr uint16_t kSheet = 0;  // 3BPP, compressed
+constexpr uint32_t kSheetPc = 0x080000;
+constexpr uint32_t kFreeRegionPc = 0x0A0000;
+
+// Pixels that compress to a few bytes.
+std::vector<uint8_t> FlatPixels() {
+  return std::vector<uint8_t>(gfx::kTilesheetWidth * gfx::kTilesheetHeight, 0);
+}
+
+// Pixels that barely compress.
+std::vector<uint8_t> NoisyPixels() {
+  std::vector<uint8_t> pixels(gfx::kTilesheetWidth * gfx::kTilesheetHeight);
+  uint32_t state = 0x12345678;
+  for (auto& pixel : pixels) {
+    state = state * 1664525u + 1013904223u;
+    pixel = static_cast<uint8_t>((state >> 24) & 0x07);
+  }
+  return pixels;
+}
+
+std::vector<uint8_t> CompressSheet(const std::vector<uint8_t>& pixels) {
+  std::vector<uint8_t> raw = gfx::IndexedToSnesSheet(pixels, 3);
+  raw.resize(kUncompressedSheetSize, 0);
+  const int raw_size = static_cast<int>(raw.size());
+  raw.resize(raw.size() * 2, 0);
+  int compressed_size = 0;
+  auto compressed =
+      gfx::HyruleMagicCompress(raw.data(), raw_size, &compressed_size, 1);
+  compressed.resize(compressed_size);
+  return compressed;
+}
+
+class GraphicsSheetSaveTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(rom_.LoadFromData(std::vector<uint8_t>(0x100000, 0)).ok());
+    const auto& constants = kVersionConstantsMap.at(zelda3_version::US);
+    ptr1_ = constants.kOverworldGfxPtr1;
+    ptr2_ = constants.kOverworldGfxPtr2;
+    ptr3_ = constants.kOverworldGfxPtr3;
+  }
+
+  // Stores pixels compressed at kSheetPc and points kSheet at it.
+  void SeedSheet(const std::vector<uint8_t>& pixels) {
+    ASSERT_TRUE(rom_.WriteVector(kSheetPc, CompressSheet(pixels)).ok());
+    SetSheetPointer(kSheetPc);
+    rom_.set_dirty(false);
+  }
+
+  void SetSheetPointer(uint32_t pc) {
+    const uint32_t snes = PcToSnes(pc);
+    rom_.mutable_data()[ptr1_ + kSheet] = static_cast<uint8_t>(snes >> 16);
+    rom_.mutable_data()[ptr2_ + kSheet] = static_cast<uint8_t>(snes >> 8);
+    rom_.mutable_data()[ptr3_ + kSheet] = static_cast<uint8_t>(snes);
+  }
+
+  uint32_t SheetPointer() const {
+    return GetGraphicsAddress(rom_.data(), kSheet, ptr1_, ptr2_, ptr3_,
+                              rom_.size());
+  }
+
+  void SetSheetPixels(const std::vector<uint8_t>& pixels) {
+    sheets_[kSheet].set_data(pixels);
+    sheets_[kSheet].set_active(true);
+  }
+
+  std::vector<uint8_t> DecompressedTiles(uint32_t pc) const {
+    auto data = gfx::lc_lz2::DecompressV2(rom_.data(), static_cast<int>(pc),
+                                          kUncompressedSheetSize, 1,
+                                          rom_.size());
+    EXPECT_TRUE(data.ok()) << data.status();
+    const size_t tile_bytes = gfx::IndexedToSnesSheet(FlatPixels(), 3).size();
+    data->resize(tile_bytes);
+    return *data;
+  }
+
+  absl::StatusOr<GraphicsSaveResult> Save(
+      const GraphicsSaveOptions& options = {}) {
+    const std::array<uint16_t, 1> ids = {kSheet};
+    return SaveGraphicsSheets(rom_, sheets_, ids, options);
+  }
+
+  Rom rom_;
+  std::array<gfx::Bitmap, kNumGfxSheets> sheets_;
+  uint32_t ptr1_ = 0;
+  uint32_t ptr2_ = 0;
+  uint32_t ptr3_ = 0;
+};
+
+TEST_F(GraphicsSheetSaveTest, RewritesSheetThatStillFitsInPlace) {
+  SeedSheet(NoisyPixels());
+  SetSheetPixels(FlatPixels());
+
+  auto result = Save();
+  ASSERT_TRUE(result.ok()) << result.status();
+
+  EXPECT_EQ(result->written_sheets, std::vector<uint16_t>{kSheet});
+  EXPECT_TRUE(result->relocated_sheets.empty());
+  EXPECT_EQ(SheetPointer(), kSheetPc);
+  EXPECT_EQ(DecompressedTiles(kSheetPc),
+            gfx::IndexedToSnesSheet(FlatPixels(), 3));
+}
+
+TEST_F(GraphicsSheetSaveTest, RelocatesSheetThatOutgrewItsSlot) {
+  SeedSheet(FlatPixels());
+  SetSheetPixels(NoisyPixels());
+
+  GraphicsSaveOptions options;
+  options.free_regions = {{kFreeRegionPc, kFreeRegionPc + 0x4000}};
+  auto result = Save(options);
+  ASSERT_TRUE(result.ok()) << result.status();
+
+  EXPECT_EQ(result->written_sheets, std::vector<uint16_t>{kSheet});
+  EXPECT_EQ(result->relocated_sheets, std::vector<uint16_t>{kSheet});
+  EXPECT_EQ(SheetPointer(), kFreeRegionPc);
+  EXPECT_EQ(DecompressedTiles(kFreeRegionPc),
+            gfx::IndexedToSnesSheet(NoisyPixels(), 3));
+}
+
+TEST_F(GraphicsSheetSaveTest, SkipsSheetsThatMatchTheRom) {
+  SeedSheet(NoisyPixels());
+  SetSheetPixels(NoisyPixels());
+  const std::vector<uint8_t> before = rom_.vector();
+
+  auto result = Save();
+  ASSERT_TRUE(result.ok()) << result.status();
+
+  EXPECT_EQ(result->unchanged_sheets, std::vector<uint16_t>{kSheet});
+  EXPECT_TRUE(result->written_sheets.empty());
+  EXPECT_EQ(rom_.vector(), before);
+  EXPECT_FALSE(rom_.dirty());
+}
+
+TEST_F(GraphicsSheetSaveTest, ReportsOutOfSpaceWithoutWriting) {
+  SeedSheet(FlatPixels());
+  SetSheetPixels(NoisyPixels());
+  const std::vector<uint8_t> before = rom_.vector();
+
+  auto result = Save();
+
+  EXPECT_TRUE(absl::IsResourceExhausted(result.status())) << result.status();
+  EXPECT_EQ(rom_.vector(), before);
+}
+
+TEST_F(GraphicsSheetSaveTest, RejectedPointerWriteLeavesRomUntouched) {
+  SeedSheet(FlatPixels());
+  SetSheetPixels(NoisyPixels());
+  const std::vector<uint8_t> before = rom_.vector();
+
+  // The sheet data may be written but the pointer tables may not.
+  rom::WriteFence fence;
+  ASSERT_TRUE(
+      fence.Allow(kFreeRegionPc, kFreeRegionPc + 0x4000, "GfxFreeSpace").ok());
+  rom::ScopedWriteFence scope(&rom_, &fence);
+  GraphicsSaveOptions options;
+  options.free_regions = {{kFreeRegionPc, kFreeRegionPc + 0x4000}};
+  auto result = Save(options);
+
+  EXPECT_FALSE(result.ok());
+  EXPECT_EQ(rom_.vector(), before);
+}
+
+}  // namespace
+}  // namespace yaze::zelda3
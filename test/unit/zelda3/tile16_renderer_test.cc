@@ -187,6 +187,57 @@ TEST(Tile16RendererTest,
   }
 }
 
+TEST(Tile16RendererTest, BuildBitmapMatchesPerPixelBlocksetCopy) {
+  constexpr int kTile8Count = 256;
+  constexpr int kTile16Count = 40;
+  std::vector<gfx::Tile16> tiles;
+  for (int i = 0; i < kTile16Count; ++i) {
+    auto info = [i](int quadrant) {
+      const int n = (i * 4) + quadrant;
+      return gfx::TileInfo(static_cast<uint16_t>((n * 37) % kTile8Count),
+                           static_cast<uint8_t>(n % 8), (n & 1) != 0,
+                           (n & 2) != 0, false);
+    };
+    tiles.emplace_back(info(0), info(1), info(2), info(3));
+  }
+
+  OverworldMap map;
+  *map.mutable_current_graphics() = MakeOverworldGraphics(kTile8Count);
+  ASSERT_TRUE(map.BuildTiles16Gfx(tiles, kTile16Count).ok());
+  ASSERT_EQ(map.tile16_pixels().size(), kTile16Count * 256u);
+
+  // Tiles past the built count must come out blank, as they did when the
+  // bitmap was copied out of the zero-initialized blockset.
+  OverworldBlockset world(0x200, std::vector<uint16_t>(0x200, 0));
+  for (int x = 0; x < 0x20; ++x) {
+    for (int y = 0; y < 0x20; ++y) {
+      world[x][y] = static_cast<uint16_t>(((x * 7) + (y * 3)) % 48);
+    }
+  }
+  ASSERT_TRUE(map.BuildBitmap(world).ok());
+
+  auto blockset = map.current_tile16_blockset();
+  std::vector<uint8_t> expected(0x40000, 0);
+  for (int y = 0; y < 0x20; ++y) {
+    for (int x = 0; x < 0x20; ++x) {
+      gfx::CopyTile8bpp16(x * 0x10, y * 0x10, world[x][y], expected, blockset);
+    }
+  }
+  EXPECT_EQ(map.bitmap_data(), expected);
+
+  // Rebuilding reuses the existing bitmap storage.
+  const uint8_t* storage = map.bitmap_data().data();
+  world[0][0] = 1;
+  ASSERT_TRUE(map.BuildBitmap(world).ok());
+  EXPECT_EQ(map.bitmap_data().data(), storage);
+  EXPECT_EQ(map.bitmap_data()[0], blockset[(1 % 8) * 0x10]);
+
+  // Cached tile16 pixels reproduce the same tile16 blockset.
+  OverworldMap cached;
+  cached.UseCachedTile16Pixels(map.tile16_pixels());
+  EXPECT_EQ(cached.current_tile16_blockset(), map.current_tile16_blockset());
+}
+
 TEST(Tile16RendererTest, SkipsInactiveOrOutOfRangeTile8Sources) {
   std::vector<gfx::Bitmap> tile8_bitmaps;
   tile8_bitmaps.push_back(MakeTile8Bitmap(MakeFilledTilePixels(0x05)));